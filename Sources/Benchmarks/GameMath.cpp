@@ -232,3 +232,19 @@ static void SinCos4(benchmark::State & state)
     benchmark::DoNotOptimize(c);
 }
 BENCHMARK(SinCos4);
+
+static void SinTurns4(benchmark::State & state)
+{
+    auto x = MakeFloats(Size * 4);
+    std::vector<float> s(Size * 4);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < Size; ++i)
+        {
+            SinTurns4(&(x[i * 4]), &(s[i * 4]));
+        }
+    }
+
+    benchmark::DoNotOptimize(s);
+}
+BENCHMARK(SinTurns4);
@@ -0,0 +1,129 @@
+#include "Utils.h"
+
+#include <Core/Algorithms.h>
+#include <Core/PrecalculatedFunction.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+static constexpr size_t SamplesCount = 32768;
+
+static std::array<Algorithms::OceanSurfaceWave, 3> MakeWaves()
+{
+    return {
+        Algorithms::OceanSurfaceWave{ -345.23, 0.0036, 1.5f },
+        Algorithms::OceanSurfaceWave{ -227.87, 0.0024, 1.125f },
+        Algorithms::OceanSurfaceWave{ -512.11, 0.0972, 0.0625f }
+    };
+}
+
+// How samples used to be generated: one at a time, looking sin up in a precalculated table
+static void OceanSurfaceSamples_PrecalculatedSin(benchmark::State & state)
+{
+    auto const samplesCount = MakeSize(SamplesCount);
+    auto heightField = MakeFloats(samplesCount + 4);
+    std::vector<float> samples(samplesCount * 2);
+
+    auto const waves = MakeWaves();
+
+    PrecalculatedFunction<8192> basalWaveSin(
+        [a = waves[0].Amplitude](float x)
+        {
+            return a * std::sin(2.0f * Pi<float> * x);
+        });
+
+    float const wave2AmplitudeCoeff = waves[1].Amplitude / waves[0].Amplitude;
+    float const rippleAmplitudeCoeff = waves[2].Amplitude / waves[0].Amplitude;
+
+    for (auto _ : state)
+    {
+        float phase1 = Algorithms::CalculateOceanSurfaceWavePhase(waves[0], 0);
+        float phase2 = Algorithms::CalculateOceanSurfaceWavePhase(waves[1], 0);
+        float phaseRipple = Algorithms::CalculateOceanSurfaceWavePhase(waves[2], 0);
+        float const phase1Dx = static_cast<float>(waves[0].PhaseDx);
+        float const phase2Dx = static_cast<float>(waves[1].PhaseDx);
+        float const phaseRippleDx = static_cast<float>(waves[2].PhaseDx);
+
+        float previousSampleValue = 0.0f;
+        for (size_t i = 0; i < samplesCount; ++i)
+        {
+            float const sampleValue =
+                (heightField[i] - 50.0f) * 50.0f
+                + basalWaveSin.GetLinearlyInterpolatedPeriodicFromNormalized(phase1)
+                + wave2AmplitudeCoeff * basalWaveSin.GetLinearlyInterpolatedPeriodicFromNormalized(phase2)
+                + rippleAmplitudeCoeff * basalWaveSin.GetLinearlyInterpolatedPeriodicFromNormalized(phaseRipple);
+
+            samples[i * 2] = sampleValue;
+            if (i > 0)
+                samples[i * 2 - 1] = sampleValue - previousSampleValue;
+
+            previousSampleValue = sampleValue;
+
+            phase1 += phase1Dx;
+            if (phase1 >= 1.0f)
+                phase1 -= 1.0f;
+            phase2 += phase2Dx;
+            if (phase2 >= 1.0f)
+                phase2 -= 1.0f;
+            phaseRipple += phaseRippleDx;
+            if (phaseRipple >= 1.0f)
+                phaseRipple -= 1.0f;
+        }
+    }
+
+    benchmark::DoNotOptimize(samples);
+}
+BENCHMARK(OceanSurfaceSamples_PrecalculatedSin);
+
+static void OceanSurfaceSamples_Naive(benchmark::State & state)
+{
+    auto const samplesCount = MakeSize(SamplesCount);
+    auto heightField = MakeFloats(samplesCount + 4);
+    std::vector<float> samples(samplesCount * 2);
+
+    auto const waves = MakeWaves();
+
+    for (auto _ : state)
+    {
+        Algorithms::GenerateOceanSurfaceSamples_Naive(
+            heightField.get(),
+            50.0f,
+            50.0f,
+            waves,
+            0,
+            samplesCount,
+            samples.data());
+    }
+
+    benchmark::DoNotOptimize(samples);
+}
+BENCHMARK(OceanSurfaceSamples_Naive);
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+static void OceanSurfaceSamples_SSEVectorized(benchmark::State & state)
+{
+    auto const samplesCount = MakeSize(SamplesCount);
+    auto heightField = MakeFloats(samplesCount + 4);
+    std::vector<float> samples(samplesCount * 2);
+
+    auto const waves = MakeWaves();
+
+    for (auto _ : state)
+    {
+        Algorithms::GenerateOceanSurfaceSamples_SSEVectorized(
+            heightField.get(),
+            50.0f,
+            50.0f,
+            waves,
+            0,
+            samplesCount,
+            samples.data());
+    }
+
+    benchmark::DoNotOptimize(samples);
+}
+BENCHMARK(OceanSurfaceSamples_SSEVectorized);
+#endif
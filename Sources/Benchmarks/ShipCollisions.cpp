@@ -0,0 +1,105 @@
+#include "Utils.h"
+
+#include <Game/GameAssetManager.h>
+#include <Game/HeadlessSimulation.h>
+
+#include <Core/AABBSet.h>
+#include <Core/ThreadManager.h>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+//
+// Ship-ship collisions, on two real ships in the same world; the second ship
+// is kept pressed against the first one, as with the move tool, so that
+// each step runs the narrowphase on the whole overlap region.
+//
+
+namespace {
+
+void RunTwoShips(
+    benchmark::State & state,
+    float overlap)
+{
+    GameAssetManager const gameAssetManager = GameAssetManager::FromGameRoot(std::filesystem::current_path());
+
+    ThreadManager threadManager(
+        false,
+        1,
+        { ThreadManager::CpuInfo(0, 1.0f) },
+        [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {});
+
+    HeadlessSimulation simulation(gameAssetManager, threadManager, 42);
+
+    ShipLoadSpecifications const loadSpecs(gameAssetManager.GetInstalledShipFolderPath() / "A.S. Te Aroha.shp2");
+    ShipId const ship1Id = simulation.AddShip(loadSpecs);
+    ShipId const ship2Id = simulation.AddShip(loadSpecs);
+
+    // Place the second ship after the first one, overlapping it by the specified amount
+    float const shipWidth = simulation.GetWorld().GetShip(ship1Id).CalculateParticleAABB().GetWidth();
+    simulation.GetWorld().MoveBy(
+        ship2Id,
+        vec2f(shipWidth - overlap, 0.0f),
+        vec2f::zero(),
+        simulation.GetSimulationParameters());
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+
+        // Push the second ship against the first one
+        simulation.GetWorld().MoveBy(
+            ship2Id,
+            vec2f::zero(),
+            vec2f(-1.0f, 0.0f),
+            simulation.GetSimulationParameters());
+
+        state.ResumeTiming();
+
+        simulation.Update();
+    }
+}
+
+}
+
+static void ShipCollisions_TwoShipsInContact(benchmark::State & state)
+{
+    RunTwoShips(state, 1.0f);
+}
+BENCHMARK(ShipCollisions_TwoShipsInContact);
+
+static void ShipCollisions_TwoShipsApart(benchmark::State & state)
+{
+    // Baseline: same ships and steps, without any contact
+    RunTwoShips(state, -100.0f);
+}
+BENCHMARK(ShipCollisions_TwoShipsApart);
+
+static void ShipCollisions_Broadphase_NoOverlap(benchmark::State & state)
+{
+    // Many ships, each with a few external frontiers, none overlapping any other ship
+    Geometry::ShipAABBSet aabbSet;
+    for (ShipId s = 0; s < 64; ++s)
+    {
+        float const left = static_cast<float>(s) * 500.0f;
+        for (int f = 0; f < 4; ++f)
+        {
+            float const frontierLeft = left + static_cast<float>(f) * 50.0f;
+            aabbSet.Add(Geometry::ShipAABB(frontierLeft, frontierLeft + 300.0f, 40.0f, -20.0f, 1000), s);
+        }
+    }
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        aabbSet.VisitCrossShipIntersections(
+            [&count](size_t, size_t)
+            {
+                ++count;
+            });
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+BENCHMARK(ShipCollisions_Broadphase_NoOverlap);
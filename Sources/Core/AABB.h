@@ -127,6 +127,14 @@ public:
             && point.y >= BottomLeft.y - margin
             && point.y <= TopRight.y + margin;
     }
+
+    inline bool Intersects(AABB const & other) const noexcept
+    {
+        return other.BottomLeft.x <= TopRight.x
+            && other.TopRight.x >= BottomLeft.x
+            && other.BottomLeft.y <= TopRight.y
+            && other.TopRight.y >= BottomLeft.y;
+    }
 };
 
 struct ShipAABB : public AABB
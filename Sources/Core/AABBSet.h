@@ -7,6 +7,7 @@
 
 #include "AABB.h"
 #include "Algorithms.h"
+#include "GameTypes.h"
 #include "Vectors.h"
 
 #include <algorithm>
@@ -127,10 +128,94 @@ class ShipAABBSet : public _AABBSet<ShipAABB>
 {
 public:
 
+    inline std::vector<ShipId> const & GetShipIds() const noexcept
+    {
+        return mShipIds;
+    }
+
+    inline void Add(
+        ShipAABB const & aabb,
+        ShipId shipId) noexcept
+    {
+        mAABBs.emplace_back(aabb);
+        mShipIds.emplace_back(shipId);
+    }
+
+    void Clear()
+    {
+        mAABBs.clear();
+        mShipIds.clear();
+    }
+
     inline std::optional<AABB> MakeWeightedUnion() const
     {
         return Algorithms::MakeAABBWeightedUnion(mAABBs);
     }
+
+    /*
+     * Invokes the visitor with the indices of each pair of intersecting AABBs
+     * belonging to different ships.
+     *
+     * Sweep-and-prune along X: AABBs are visited in order of their left edge,
+     * and each one is only tested against the AABBs that are still open
+     * at that edge.
+     */
+    template<typename TVisitor>
+    void VisitCrossShipIntersections(TVisitor && visitor) const
+    {
+        if (mAABBs.size() < 2)
+        {
+            return;
+        }
+
+        std::vector<size_t> sortedIndices(mAABBs.size());
+        for (size_t i = 0; i < mAABBs.size(); ++i)
+        {
+            sortedIndices[i] = i;
+        }
+
+        std::sort(
+            sortedIndices.begin(),
+            sortedIndices.end(),
+            [this](size_t a, size_t b)
+            {
+                return mAABBs[a].BottomLeft.x < mAABBs[b].BottomLeft.x;
+            });
+
+        std::vector<size_t> activeIndices;
+        for (size_t const i : sortedIndices)
+        {
+            auto const & aabb = mAABBs[i];
+
+            // Prune AABBs that closed before this one opens
+            activeIndices.erase(
+                std::remove_if(
+                    activeIndices.begin(),
+                    activeIndices.end(),
+                    [this, &aabb](size_t j)
+                    {
+                        return mAABBs[j].TopRight.x < aabb.BottomLeft.x;
+                    }),
+                activeIndices.end());
+
+            for (size_t const j : activeIndices)
+            {
+                if (mShipIds[j] != mShipIds[i]
+                    && mAABBs[j].BottomLeft.y <= aabb.TopRight.y
+                    && mAABBs[j].TopRight.y >= aabb.BottomLeft.y)
+                {
+                    visitor(j, i);
+                }
+            }
+
+            activeIndices.push_back(i);
+        }
+    }
+
+private:
+
+    // Parallel to mAABBs
+    std::vector<ShipId> mShipIds;
 };
 
 }
\ No newline at end of file
@@ -737,6 +737,210 @@ inline void SmoothBufferAndAdd(
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// OceanSurfaceSamples
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * A periodic component of the ocean surface, i.e. Amplitude * sin(2 * Pi * phase);
+ * the phase is normalized, and at sample i it is PhaseOrigin + i * PhaseDx.
+ */
+struct OceanSurfaceWave
+{
+    double PhaseOrigin;
+    double PhaseDx;
+    float Amplitude;
+};
+
+/*
+ * Returns the phase of the wave at the specified sample, wrapped into [0.0, 1.0);
+ * we calculate it in double precision so to not lose precision at far samples.
+ */
+inline float CalculateOceanSurfaceWavePhase(
+    OceanSurfaceWave const & wave,
+    size_t sampleIndex) noexcept
+{
+    double const phase = wave.PhaseOrigin + static_cast<double>(sampleIndex) * wave.PhaseDx;
+    return static_cast<float>(phase - std::floor(phase));
+}
+
+// The number of samples after which vectorized implementations re-calculate phases from scratch
+size_t constexpr OceanSurfaceSamplesPhaseBlockSize = 64;
+
+template<size_t WaveCount>
+inline void GenerateOceanSurfaceSamples_Naive(
+    float const * restrict heightField,
+    float heightFieldOffset,
+    float heightFieldAmplification,
+    std::array<OceanSurfaceWave, WaveCount> const & waves,
+    size_t startSample,
+    size_t endSample,
+    float * restrict samples) noexcept
+{
+    auto const calculateSampleValue = [&](size_t i)
+    {
+        float value = (heightField[i] - heightFieldOffset) * heightFieldAmplification;
+        for (auto const & wave : waves)
+        {
+            value += wave.Amplitude * std::sin(2.0f * Pi<float> * CalculateOceanSurfaceWavePhase(wave, i));
+        }
+
+        return value;
+    };
+
+    float sampleValue = calculateSampleValue(startSample);
+    for (size_t i = startSample; i < endSample; ++i)
+    {
+        float const nextSampleValue = calculateSampleValue(i + 1);
+
+        samples[i * 2] = sampleValue;
+        samples[i * 2 + 1] = nextSampleValue - sampleValue;
+
+        sampleValue = nextSampleValue;
+    }
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<size_t WaveCount>
+inline void GenerateOceanSurfaceSamples_SSEVectorized(
+    float const * restrict heightField,
+    float heightFieldOffset,
+    float heightFieldAmplification,
+    std::array<OceanSurfaceWave, WaveCount> const & waves,
+    size_t startSample,
+    size_t endSample,
+    float * restrict samples) noexcept
+{
+    // This code is vectorized for SSE = 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    static_assert((OceanSurfaceSamplesPhaseBlockSize % 4) == 0);
+    assert(is_aligned_to_float_element_count(startSample));
+    assert(is_aligned_to_float_element_count(endSample));
+
+    //
+    // Phases are advanced four samples at a time, and re-calculated from scratch at each
+    // phase block, so that single-precision errors do not accumulate; blocks being aligned
+    // to the sample index, the values of a sample do not depend on the range we're invoked
+    // for, as long as ranges are aligned to blocks as well
+    //
+
+    __m128 laneOffsets[WaveCount];
+    __m128 phaseSteps[WaveCount];
+    __m128 amplitudes[WaveCount];
+    for (size_t w = 0; w < WaveCount; ++w)
+    {
+        auto const lanePhaseOffset = [&](size_t l)
+        {
+            double const offset = static_cast<double>(l) * waves[w].PhaseDx;
+            return static_cast<float>(offset - std::floor(offset));
+        };
+
+        laneOffsets[w] = _mm_setr_ps(0.0f, lanePhaseOffset(1), lanePhaseOffset(2), lanePhaseOffset(3));
+        phaseSteps[w] = _mm_set1_ps(lanePhaseOffset(4));
+        amplitudes[w] = _mm_set1_ps(waves[w].Amplitude);
+    }
+
+    __m128 const heightFieldOffset_4 = _mm_set1_ps(heightFieldOffset);
+    __m128 const heightFieldAmplification_4 = _mm_set1_ps(heightFieldAmplification);
+    __m128 const one_4 = _mm_set1_ps(1.0f);
+
+    // Phases of the current four samples, in [0.0, 1.0)
+    __m128 phases[WaveCount];
+
+    auto const wrapPhases = [&](__m128 p)
+    {
+        return _mm_sub_ps(p, _mm_and_ps(_mm_cmpge_ps(p, one_4), one_4));
+    };
+
+    auto const calculatePhases = [&](size_t i)
+    {
+        for (size_t w = 0; w < WaveCount; ++w)
+        {
+            phases[w] = wrapPhases(_mm_add_ps(
+                _mm_set1_ps(CalculateOceanSurfaceWavePhase(waves[w], i)),
+                laneOffsets[w]));
+        }
+    };
+
+    auto const advancePhases = [&]()
+    {
+        for (size_t w = 0; w < WaveCount; ++w)
+        {
+            phases[w] = wrapPhases(_mm_add_ps(phases[w], phaseSteps[w]));
+        }
+    };
+
+    auto const calculateSampleValues = [&](__m128 heights)
+    {
+        __m128 values = _mm_mul_ps(
+            _mm_sub_ps(heights, heightFieldOffset_4),
+            heightFieldAmplification_4);
+
+        for (size_t w = 0; w < WaveCount; ++w)
+        {
+            values = _mm_add_ps(
+                values,
+                _mm_mul_ps(amplitudes[w], SinTurns4(phases[w])));
+        }
+
+        return values;
+    };
+
+    calculatePhases(startSample);
+    __m128 sampleValues = calculateSampleValues(_mm_loadu_ps(heightField + startSample));
+    for (size_t i = startSample; i < endSample; i += 4)
+    {
+        if (((i + 4) % OceanSurfaceSamplesPhaseBlockSize) == 0)
+            calculatePhases(i + 4);
+        else
+            advancePhases();
+
+        // Next four values; at the end of the range we only need - and may only read - the first one
+        __m128 const nextSampleValues = calculateSampleValues(
+            (i + 4 < endSample) ? _mm_loadu_ps(heightField + i + 4) : _mm_load_ss(heightField + i + 4));
+
+        // (v1, v2, v3, n0)
+        __m128 const shiftedSampleValues = _mm_shuffle_ps(
+            _mm_move_ss(sampleValues, nextSampleValues),
+            _mm_move_ss(sampleValues, nextSampleValues),
+            _MM_SHUFFLE(0, 3, 2, 1));
+
+        __m128 const deltas = _mm_sub_ps(shiftedSampleValues, sampleValues);
+
+        // Interleave values and deltas
+        _mm_storeu_ps(samples + i * 2, _mm_unpacklo_ps(sampleValues, deltas));
+        _mm_storeu_ps(samples + i * 2 + 4, _mm_unpackhi_ps(sampleValues, deltas));
+
+        sampleValues = nextSampleValues;
+    }
+}
+#endif
+
+/*
+ * Generates ocean surface samples [startSample, endSample) as the sum of the height
+ * field - offset and amplified - and of the specified waves. Samples are stored as
+ * (value, next value - value) pairs; the height field is also read at endSample.
+ *
+ * Both start and end are assumed to be aligned to the vectorization word; samples only
+ * depend on the range when the range is not aligned to OceanSurfaceSamplesPhaseBlockSize.
+ */
+template<size_t WaveCount>
+inline void GenerateOceanSurfaceSamples(
+    float const * restrict heightField,
+    float heightFieldOffset,
+    float heightFieldAmplification,
+    std::array<OceanSurfaceWave, WaveCount> const & waves,
+    size_t startSample,
+    size_t endSample,
+    float * restrict samples) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    GenerateOceanSurfaceSamples_SSEVectorized<WaveCount>(heightField, heightFieldOffset, heightFieldAmplification, waves, startSample, endSample, samples);
+#else
+    GenerateOceanSurfaceSamples_Naive<WaveCount>(heightField, heightFieldOffset, heightFieldAmplification, waves, startSample, endSample, samples);
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // CalculateSpringVectors
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
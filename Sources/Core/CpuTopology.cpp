@@ -0,0 +1,337 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "CpuTopology.h"
+
+#include "GameExceptions.h"
+#include "Log.h"
+#include "SysSpecifics.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#if FS_IS_OS_LINUX()
+#include <sched.h>
+#endif
+
+namespace /* anonymous */ {
+
+    std::optional<size_t> ParseCpuId(std::string const & str)
+    {
+        if (str.empty() || !std::all_of(str.cbegin(), str.cend(), [](char ch) { return ch >= '0' && ch <= '9'; }))
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<size_t>(std::stoul(str));
+    }
+
+#if FS_IS_OS_LINUX()
+    // The CPUs in the affinity mask of the process, or none if it cannot be determined
+    std::optional<std::vector<size_t>> GetProcessAllowedCpuIds()
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0)
+        {
+            LogMessage("CpuTopology: cannot get process affinity");
+            return std::nullopt;
+        }
+
+        std::vector<size_t> cpuIds;
+        for (size_t c = 0; c < CPU_SETSIZE; ++c)
+        {
+            if (CPU_ISSET(c, &cpuSet))
+            {
+                cpuIds.push_back(c);
+            }
+        }
+
+        return cpuIds;
+    }
+#endif
+
+}
+
+std::optional<CpuTopology> CpuTopology::Load()
+{
+#if FS_IS_OS_LINUX()
+    return Load(
+        "/sys/devices/system/cpu",
+        [](std::filesystem::path const & filePath) -> std::optional<std::string>
+        {
+            std::ifstream file(filePath);
+            if (!file.is_open())
+            {
+                return std::nullopt;
+            }
+
+            std::stringstream ss;
+            ss << file.rdbuf();
+            return ss.str();
+        },
+        GetProcessAllowedCpuIds());
+#else
+    return std::nullopt;
+#endif
+}
+
+std::optional<CpuTopology> CpuTopology::Load(
+    std::filesystem::path const & sysfsCpuPath,
+    FileReader const & fileReader,
+    std::optional<std::vector<size_t>> const & allowedCpuIds)
+{
+    try
+    {
+        auto const onlineCpuList = fileReader(sysfsCpuPath / "online");
+        if (!onlineCpuList.has_value())
+        {
+            LogMessage("CpuTopology: no CPU topology available");
+            return std::nullopt;
+        }
+
+        std::vector<size_t> cpuIds = ParseCpuList(*onlineCpuList);
+
+        // Only take the CPUs we're allowed to run on, as we pin threads to them
+        if (allowedCpuIds.has_value())
+        {
+            cpuIds.erase(
+                std::remove_if(
+                    cpuIds.begin(),
+                    cpuIds.end(),
+                    [&allowedCpuIds](size_t cpuId)
+                    {
+                        return std::find(allowedCpuIds->cbegin(), allowedCpuIds->cend(), cpuId) == allowedCpuIds->cend();
+                    }),
+                cpuIds.end());
+        }
+
+        if (cpuIds.empty())
+        {
+            return std::nullopt;
+        }
+
+        // Returns the lowest CPU ID in the list in the specified file, if the file exists
+        auto const readLowestCpuId = [&](std::filesystem::path const & filePath) -> std::optional<size_t>
+            {
+                auto const cpuList = fileReader(filePath);
+                if (!cpuList.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                auto const listCpuIds = ParseCpuList(*cpuList);
+                if (listCpuIds.empty())
+                {
+                    return std::nullopt;
+                }
+
+                return *std::min_element(listCpuIds.cbegin(), listCpuIds.cend());
+            };
+
+        std::vector<LogicalCpu> logicalCpus;
+        float maxCapacity = 0.0f;
+        for (size_t const cpuId : cpuIds)
+        {
+            std::filesystem::path const cpuPath = sysfsCpuPath / ("cpu" + std::to_string(cpuId));
+
+            // Capacity is only there on heterogeneous machines; when missing, all CPUs are equal
+            float capacity = 1024.0f;
+            if (auto const capacityStr = fileReader(cpuPath / "cpu_capacity"); capacityStr.has_value())
+            {
+                capacity = std::stof(Utils::Trim(*capacityStr));
+            }
+
+            size_t const coreId = readLowestCpuId(cpuPath / "topology" / "thread_siblings_list").value_or(cpuId);
+
+            // No L3 means one domain for all
+            size_t const cacheDomainId = readLowestCpuId(cpuPath / "cache" / "index3" / "shared_cpu_list").value_or(0);
+
+            logicalCpus.emplace_back(cpuId, capacity, coreId, cacheDomainId);
+
+            maxCapacity = std::max(maxCapacity, capacity);
+        }
+
+        if (maxCapacity <= 0.0f)
+        {
+            throw GameException("Invalid CPU capacities");
+        }
+
+        // Normalize capacities
+        for (auto & logicalCpu : logicalCpus)
+        {
+            logicalCpu.Capacity /= maxCapacity;
+        }
+
+        std::sort(
+            logicalCpus.begin(),
+            logicalCpus.end(),
+            [](LogicalCpu const & c1, LogicalCpu const & c2)
+            {
+                return c1.CpuId < c2.CpuId;
+            });
+
+        return CpuTopology(std::move(logicalCpus));
+    }
+    catch (std::exception const & ex)
+    {
+        LogMessage("CpuTopology: error loading CPU topology: ", ex.what());
+        return std::nullopt;
+    }
+}
+
+std::vector<size_t> CpuTopology::ParseCpuList(std::string const & cpuList)
+{
+    std::vector<size_t> cpuIds;
+
+    std::stringstream ss(Utils::Trim(cpuList));
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+        range = Utils::Trim(range);
+        if (range.empty())
+        {
+            continue;
+        }
+
+        std::optional<size_t> first;
+        std::optional<size_t> last;
+        auto const dashPos = range.find('-');
+        if (dashPos == std::string::npos)
+        {
+            first = ParseCpuId(range);
+            last = first;
+        }
+        else
+        {
+            first = ParseCpuId(range.substr(0, dashPos));
+            last = ParseCpuId(range.substr(dashPos + 1));
+        }
+
+        if (!first.has_value() || !last.has_value() || *last < *first)
+        {
+            throw GameException("Invalid CPU list \"" + cpuList + "\"");
+        }
+
+        for (size_t c = *first; c <= *last; ++c)
+        {
+            cpuIds.push_back(c);
+        }
+    }
+
+    return cpuIds;
+}
+
+std::vector<ThreadManager::CpuInfo> CpuTopology::MakeCpuResources() const
+{
+    //
+    // Split CPUs into the first CPU of each core, and their SMT siblings
+    //
+
+    std::vector<LogicalCpu> coreCpus;
+    std::vector<LogicalCpu> siblingCpus;
+    for (auto const & logicalCpu : mLogicalCpus) // Sorted by CPU ID
+    {
+        if (std::none_of(
+            coreCpus.cbegin(),
+            coreCpus.cend(),
+            [&logicalCpu](LogicalCpu const & c) { return c.CoreId == logicalCpu.CoreId; }))
+        {
+            coreCpus.push_back(logicalCpu);
+        }
+        else
+        {
+            siblingCpus.push_back(logicalCpu);
+        }
+    }
+
+    //
+    // Choose preferred cache domain: the one with most core capacity
+    //
+
+    std::map<size_t, float> cacheDomainCapacities;
+    for (auto const & coreCpu : coreCpus)
+    {
+        cacheDomainCapacities[coreCpu.CacheDomainId] += coreCpu.Capacity;
+    }
+
+    size_t preferredCacheDomainId = cacheDomainCapacities.cbegin()->first;
+    for (auto const & [cacheDomainId, capacity] : cacheDomainCapacities) // Lowest ID wins ties
+    {
+        if (capacity > cacheDomainCapacities.at(preferredCacheDomainId))
+        {
+            preferredCacheDomainId = cacheDomainId;
+        }
+    }
+
+    //
+    // Order
+    //
+
+    auto const fastestFirst = [](LogicalCpu const & c1, LogicalCpu const & c2)
+        {
+            return c1.Capacity > c2.Capacity;
+        };
+
+    std::stable_partition(
+        coreCpus.begin(),
+        coreCpus.end(),
+        [preferredCacheDomainId](LogicalCpu const & c) { return c.CacheDomainId == preferredCacheDomainId; });
+
+    auto const otherDomainsBegin = std::find_if(
+        coreCpus.begin(),
+        coreCpus.end(),
+        [preferredCacheDomainId](LogicalCpu const & c) { return c.CacheDomainId != preferredCacheDomainId; });
+
+    std::stable_sort(coreCpus.begin(), otherDomainsBegin, fastestFirst);
+    std::stable_sort(otherDomainsBegin, coreCpus.end(), fastestFirst);
+    std::stable_sort(siblingCpus.begin(), siblingCpus.end(), fastestFirst);
+
+    //
+    // Make resources, and log layout
+    //
+
+    std::vector<ThreadManager::CpuInfo> cpuResources;
+
+    LogMessage("CpuTopology: ", mLogicalCpus.size(), " CPUs, ", coreCpus.size(), " cores, ", cacheDomainCapacities.size(),
+        " cache domains; preferred cache domain: ", preferredCacheDomainId);
+
+    auto const addCpuResource = [&cpuResources](LogicalCpu const & logicalCpu, float speed, char const * role)
+        {
+            cpuResources.emplace_back(logicalCpu.CpuId, speed);
+
+            std::stringstream ss;
+            ss << std::fixed << std::setprecision(2)
+                << "  " << (cpuResources.size() - 1) << ": cpu=" << logicalCpu.CpuId
+                << " core=" << logicalCpu.CoreId
+                << " l3=" << logicalCpu.CacheDomainId
+                << " capacity=" << logicalCpu.Capacity
+                << " speed=" << speed
+                << " (" << role << ")";
+            LogMessage(ss.str());
+        };
+
+    for (auto it = coreCpus.cbegin(); it != coreCpus.cend(); ++it)
+    {
+        addCpuResource(
+            *it,
+            it->Capacity,
+            it->CacheDomainId == preferredCacheDomainId ? "core" : "core, other cache domain");
+    }
+
+    for (auto const & siblingCpu : siblingCpus)
+    {
+        addCpuResource(
+            siblingCpu,
+            siblingCpu.Capacity * SmtSiblingSpeedFactor,
+            "SMT sibling");
+    }
+
+    return cpuResources;
+}
@@ -0,0 +1,100 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "ThreadManager.h"
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * The topology of the processors of the machine, as exposed by Linux in sysfs:
+ * relative capacity of each logical CPU (big vs little cores), which logical CPUs
+ * are SMT siblings on the same physical core, and which share the same L3 cache.
+ *
+ * The topology is used to decide where to place threads: one thread per physical
+ * core, fastest cores first, all within the same cache domain as much as possible.
+ */
+class CpuTopology final
+{
+public:
+
+    // Speed of the second (and further) hardware threads of a physical core, relative
+    // to the core's speed: SMT siblings share the core's execution units
+    static float constexpr SmtSiblingSpeedFactor = 0.25f;
+
+    struct LogicalCpu
+    {
+        size_t CpuId;
+        float Capacity; // Relative to the fastest CPU, i.e. 1.0 for fastest
+        size_t CoreId; // Lowest CPU ID among the SMT siblings
+        size_t CacheDomainId; // Lowest CPU ID among the CPUs sharing the L3 cache
+
+        LogicalCpu(
+            size_t cpuId,
+            float capacity,
+            size_t coreId,
+            size_t cacheDomainId)
+            : CpuId(cpuId)
+            , Capacity(capacity)
+            , CoreId(coreId)
+            , CacheDomainId(cacheDomainId)
+        {}
+    };
+
+    // Returns the content of the specified file, or none if the file does not exist
+    using FileReader = std::function<std::optional<std::string>(std::filesystem::path const &)>;
+
+    /*
+     * Loads the topology from the machine's sysfs, restricted to the CPUs the process
+     * is allowed to run on (e.g. under taskset or cgroup cpusets); returns none when
+     * there is no topology information, e.g. on platforms other than Linux.
+     */
+    static std::optional<CpuTopology> Load();
+
+    /*
+     * Loads the topology from the sysfs CPU directory (i.e. /sys/devices/system/cpu)
+     * at the specified path, reading files via the specified reader; when specified,
+     * only the online CPUs that are also in allowedCpuIds are taken.
+     */
+    static std::optional<CpuTopology> Load(
+        std::filesystem::path const & sysfsCpuPath,
+        FileReader const & fileReader,
+        std::optional<std::vector<size_t>> const & allowedCpuIds = std::nullopt);
+
+    /*
+     * Parses a sysfs CPU list, e.g. "0-3,8,10-11".
+     */
+    static std::vector<size_t> ParseCpuList(std::string const & cpuList);
+
+    std::vector<LogicalCpu> const & GetLogicalCpus() const
+    {
+        return mLogicalCpus;
+    }
+
+    /*
+     * Makes the CPU resources for the ThreadManager, in order of preference:
+     *  - One CPU per physical core in the preferred cache domain, fastest first;
+     *  - One CPU per physical core in the other cache domains, fastest first;
+     *  - The remaining SMT siblings, with their speed reduced.
+     *
+     * Logs the chosen layout.
+     */
+    std::vector<ThreadManager::CpuInfo> MakeCpuResources() const;
+
+private:
+
+    explicit CpuTopology(std::vector<LogicalCpu> && logicalCpus)
+        : mLogicalCpus(std::move(logicalCpus))
+    {}
+
+private:
+
+    std::vector<LogicalCpu> mLogicalCpus; // Sorted by CPU ID
+};
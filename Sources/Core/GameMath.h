@@ -484,3 +484,55 @@ inline void SinCos4(float const * const xPtr, float * const sPtr, float * const
     cPtr[3] = std::cosf(xPtr[3]);
 #endif
 }
+
+/*
+ * Calculates sin(2 * Pi * x), i.e. the sine of an angle expressed in turns.
+ *
+ * Cheaper than the Cephes-based sine above: reducing turns is just a matter of
+ * rounding, after which we fold into a quarter turn and evaluate the Taylor series
+ * up to the 11th degree; the error is below 1e-7 over the quarter turn.
+ */
+
+DECLARE_4F_CONST(SinTurnsCof0, -2.5052108385e-8f);
+DECLARE_4F_CONST(SinTurnsCof1, 2.7557319224e-6f);
+DECLARE_4F_CONST(SinTurnsCof2, -1.9841269841e-4f);
+DECLARE_4F_CONST(SinTurnsCof3, 8.3333333333e-3f);
+DECLARE_4F_CONST(SinTurnsCof4, -1.6666666667e-1f);
+DECLARE_4F_CONST(TwoPi, 2.0f * Pi<float>);
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+inline __m128 SinTurns4(__m128 x)
+{
+    // Reduce to [-0.5, 0.5]
+    x = _mm_sub_ps(x, _mm_cvtepi32_ps(_mm_cvtps_epi32(x)));
+
+    // Fold into [0, 0.25], as sin(Pi - a) = sin(a), remembering the sign
+    __m128 const sign_bit = _mm_and_ps(x, *(__m128 *)SignMask4i);
+    __m128 a = _mm_and_ps(x, *(__m128 *)SignMaskInv4i);
+    a = _mm_min_ps(a, _mm_sub_ps(*(__m128 *)ZeroPointFive4f, a));
+
+    // Evaluate polynomial on [0, Pi/2]
+    __m128 const u = _mm_mul_ps(a, *(__m128 *)TwoPi4f);
+    __m128 const z = _mm_mul_ps(u, u);
+    __m128 y = *(__m128 *)SinTurnsCof04f;
+    y = _mm_add_ps(_mm_mul_ps(y, z), *(__m128 *)SinTurnsCof14f);
+    y = _mm_add_ps(_mm_mul_ps(y, z), *(__m128 *)SinTurnsCof24f);
+    y = _mm_add_ps(_mm_mul_ps(y, z), *(__m128 *)SinTurnsCof34f);
+    y = _mm_add_ps(_mm_mul_ps(y, z), *(__m128 *)SinTurnsCof44f);
+    y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, z), u), u);
+
+    return _mm_xor_ps(y, sign_bit);
+}
+#endif
+
+inline void SinTurns4(float const * const xPtr, float * const sPtr)
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    _mm_storeu_ps(sPtr, SinTurns4(_mm_loadu_ps(xPtr)));
+#else
+    sPtr[0] = std::sinf(2.0f * Pi<float> * xPtr[0]);
+    sPtr[1] = std::sinf(2.0f * Pi<float> * xPtr[1]);
+    sPtr[2] = std::sinf(2.0f * Pi<float> * xPtr[2]);
+    sPtr[3] = std::sinf(2.0f * Pi<float> * xPtr[3]);
+#endif
+}
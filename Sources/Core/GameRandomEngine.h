@@ -8,6 +8,7 @@
 #include "GameMath.h"
 #include "Vectors.h"
 
+#include <cstdint>
 #include <random>
 
 /*
@@ -16,19 +17,93 @@
  * Not so random - always uses the same seed. On purpose! We want two instances
  * of the game to be identical to each other.
  *
- * Singleton.
+ * The seed may be changed at the start of a session, e.g. for deterministic
+ * record/replay; two sessions started with the same seed are identical.
+ *
+ * Singleton, unless a thread binds its own instance - e.g. the one of the world it
+ * is simulating - in which case the thread gets that instance until it unbinds it.
  */
 class GameRandomEngine
 {
 public:
 
+    static std::uint32_t constexpr DefaultSeed = 19730528;
+
     static GameRandomEngine & GetInstance()
     {
-        static GameRandomEngine * instance = new GameRandomEngine();
+        if (mThreadInstance != nullptr)
+        {
+            return *mThreadInstance;
+        }
+
+        static GameRandomEngine * instance = new GameRandomEngine(DefaultSeed);
 
         return *instance;
     }
 
+    /*
+     * The instance bound to the calling thread, if any.
+     */
+    static GameRandomEngine * GetThreadInstance()
+    {
+        return mThreadInstance;
+    }
+
+    /*
+     * Binds an instance to the calling thread for the lifetime of the scope;
+     * nullptr binds the singleton.
+     */
+    class ThreadScope final
+    {
+    public:
+
+        explicit ThreadScope(GameRandomEngine * instance)
+            : mPreviousInstance(mThreadInstance)
+        {
+            mThreadInstance = instance;
+        }
+
+        ~ThreadScope()
+        {
+            mThreadInstance = mPreviousInstance;
+        }
+
+        ThreadScope(ThreadScope const &) = delete;
+        ThreadScope & operator=(ThreadScope const &) = delete;
+
+    private:
+
+        GameRandomEngine * const mPreviousInstance;
+    };
+
+    explicit GameRandomEngine(std::uint32_t seed)
+    {
+        mRandomUniformDistribution = std::uniform_real_distribution<float>(0.0f, 1.0f);
+        mNormalDistribution = std::normal_distribution<float>(0.0f, 1.0f);
+
+        Reseed(seed);
+    }
+
+    std::uint32_t GetSeed() const
+    {
+        return mSeed;
+    }
+
+    /*
+     * Restarts the engine from scratch with the specified seed.
+     */
+    void Reseed(std::uint32_t seed)
+    {
+        std::seed_seq seed_seq({ 1u, 242u, seed });
+        mRandomEngine = std::ranlux48_base(seed_seq);
+
+        // Distributions may cache state (e.g. the normal distribution generates pairs)
+        mRandomUniformDistribution.reset();
+        mNormalDistribution.reset();
+
+        mSeed = seed;
+    }
+
     /*
      * Returns a value between 0 and count - 1, included.
      */
@@ -138,14 +213,9 @@ public:
 
 private:
 
-    GameRandomEngine()
-    {
-        std::seed_seq seed_seq({ 1, 242, 19730528 });
-        mRandomEngine = std::ranlux48_base(seed_seq);
-        mRandomUniformDistribution = std::uniform_real_distribution<float>(0.0f, 1.0f);
-        mNormalDistribution = std::normal_distribution<float>(0.0f, 1.0f);
-    }
+    static inline thread_local GameRandomEngine * mThreadInstance = nullptr;
 
+    std::uint32_t mSeed;
     std::ranlux48_base mRandomEngine;
     std::uniform_real_distribution<float> mRandomUniformDistribution;
     std::normal_distribution<float> mNormalDistribution;
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include <cassert>
 #include <chrono>
 #include <optional>
 
@@ -13,7 +14,8 @@
  *
  * Note: it's not really a wall clock - its values do not measure time.
  *
- * Singleton.
+ * Singleton, unless a thread binds its own instance - e.g. the one of the world it
+ * is simulating - in which case the thread gets that instance until it unbinds it.
  */
 class GameWallClock
 {
@@ -27,11 +29,62 @@ public:
 
     static inline GameWallClock & GetInstance()
     {
+        if (mThreadInstance != nullptr)
+        {
+            return *mThreadInstance;
+        }
+
         static GameWallClock * instance = new GameWallClock();
 
         return *instance;
     }
 
+    /*
+     * The instance bound to the calling thread, if any.
+     */
+    static inline GameWallClock * GetThreadInstance()
+    {
+        return mThreadInstance;
+    }
+
+    /*
+     * Binds an instance to the calling thread for the lifetime of the scope;
+     * nullptr binds the singleton.
+     */
+    class ThreadScope final
+    {
+    public:
+
+        explicit ThreadScope(GameWallClock * instance)
+            : mPreviousInstance(mThreadInstance)
+        {
+            mThreadInstance = instance;
+        }
+
+        ~ThreadScope()
+        {
+            mThreadInstance = mPreviousInstance;
+        }
+
+        ThreadScope(ThreadScope const &) = delete;
+        ThreadScope & operator=(ThreadScope const &) = delete;
+
+    private:
+
+        GameWallClock * const mPreviousInstance;
+    };
+
+    GameWallClock()
+        : mClockStartTime(std::chrono::steady_clock::now())
+        , mFloatTimeOrigin(mClockStartTime)
+        , mLastPauseTime(std::chrono::steady_clock::now())
+        , mLastResumeTime(mLastPauseTime)
+        , mDeterministicNow()
+        , mNonDeterministicFloatTimeOrigin(mFloatTimeOrigin)
+    {
+
+    }
+
     /*
      * Returns the current time as a fractional number of seconds since an arbitrary
      * reference moment. It is not subject to the game pausing.
@@ -46,6 +99,12 @@ public:
 
     inline time_point Now() const
     {
+        if (mDeterministicNow.has_value())
+        {
+            // We're driven by the simulation
+            return *mDeterministicNow;
+        }
+
         if (mLastResumeTime.has_value())
         {
             // We're running
@@ -66,7 +125,7 @@ public:
      */
     inline float_time NowAsFloat() const
     {
-        return ElapsedAsFloat(mClockStartTime);
+        return ElapsedAsFloat(mFloatTimeOrigin);
     }
 
     /*
@@ -77,7 +136,7 @@ public:
      */
     inline float_time AsFloat(time_point timePoint) const
     {
-        return std::chrono::duration_cast<std::chrono::duration<float>>(timePoint - mClockStartTime).count();
+        return std::chrono::duration_cast<std::chrono::duration<float>>(timePoint - mFloatTimeOrigin).count();
     }
 
     inline duration Elapsed(time_point previousTimePoint) const
@@ -138,6 +197,11 @@ public:
             / std::chrono::duration_cast<std::chrono::duration<float>>(interval).count();
     }
 
+    /*
+     * Pausing is orthogonal to deterministic mode: while in deterministic mode, time only
+     * advances via AdvanceDeterministicTime(), but we keep track of whether we're paused
+     * so that we resume correctly once we exit deterministic mode.
+     */
     void SetPaused(bool isPaused)
     {
         if (isPaused)
@@ -157,17 +221,76 @@ public:
         }
     }
 
-private:
+    //
+    // Deterministic mode
+    //
+    // While in deterministic mode the clock does not follow real time anymore; instead, it
+    // only moves forward when the simulation steps, by exactly one simulation step at a time.
+    // Also, the origin of the float time is moved to the moment we enter deterministic mode,
+    // so that two sessions started in deterministic mode observe exactly the same time values,
+    // regardless of when they were started.
+    //
+    // Time points taken before entering deterministic mode are not to be compared with time
+    // points taken afterwards; deterministic sessions are expected to start with a new world.
+    // When exiting deterministic mode the original float time origin is restored, so that float
+    // times continue from those observed before the deterministic session.
+    //
+    // Deterministic mode may also be entered without starting a new session - as when
+    // fast-forwarding an ongoing simulation - in which case the float time origin is kept,
+    // and float times continue seamlessly.
+    //
 
-    GameWallClock()
-        : mClockStartTime(std::chrono::steady_clock::now())
-        , mLastPauseTime(std::chrono::steady_clock::now())
-        , mLastResumeTime(mLastPauseTime)
+    bool IsDeterministic() const
+    {
+        return mDeterministicNow.has_value();
+    }
+
+    void EnterDeterministicMode(bool isNewSession = true)
+    {
+        if (!mDeterministicNow.has_value())
+        {
+            mDeterministicNow = Now();
+            mNonDeterministicFloatTimeOrigin = mFloatTimeOrigin;
+        }
+
+        if (isNewSession)
+        {
+            mFloatTimeOrigin = *mDeterministicNow;
+        }
+    }
+
+    void AdvanceDeterministicTime(duration interval)
+    {
+        assert(mDeterministicNow.has_value());
+
+        *mDeterministicNow += interval;
+    }
+
+    void ExitDeterministicMode()
     {
+        if (mDeterministicNow.has_value())
+        {
+            // Continue from where the simulation left us
+            mLastPauseTime = *mDeterministicNow;
+            if (mLastResumeTime.has_value())
+            {
+                mLastResumeTime = std::chrono::steady_clock::now();
+            }
+
+            mFloatTimeOrigin = mNonDeterministicFloatTimeOrigin;
 
+            mDeterministicNow.reset();
+        }
     }
 
+private:
+
+    static inline thread_local GameWallClock * mThreadInstance = nullptr;
+
     time_point const mClockStartTime;
+    time_point mFloatTimeOrigin;
     time_point mLastPauseTime;
     std::optional<time_point> mLastResumeTime;
+    std::optional<time_point> mDeterministicNow;
+    time_point mNonDeterministicFloatTimeOrigin; // To restore when exiting deterministic mode
 };
@@ -8,7 +8,10 @@
 #include "GameChronometer.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <vector>
 
 enum class PerfMeasurement : size_t
@@ -20,6 +23,7 @@ enum class PerfMeasurement : size_t
     TotalOceanSurfaceUpdate,
     TotalShipsUpdate,
     TotalShipsSpringsUpdate,
+    TotalShipsSpringsStragglerGap, // Slowest spring relaxation thread's work time minus mean threads' work time
     TotalWaitForRenderUpload,
     TotalNetUpdate, // = TotalUpdate - TotalWaitForRenderUpload
 
@@ -32,11 +36,186 @@ enum class PerfMeasurement : size_t
     TotalRenderDraw, // In render thread
     TotalUploadRenderDraw,
 
-    _Last = TotalUploadRenderDraw
+    // Simulation thread pool
+    SimulationThreadPoolRun,            // Wall time of each batch of tasks
+    SimulationThreadPoolCriticalPath,   // Busy time of the busiest thread in each batch
+    SimulationThreadPoolImbalance,      // Critical path minus mean busy time of the threads in each batch
+
+    _Last = SimulationThreadPoolImbalance
+};
+
+enum class PerfCounter : size_t
+{
+    // Update
+    CulledEphemeralParticles = 0,
+
+    _Last = CulledEphemeralParticles
 };
 
 struct PerfStats
 {
+    /*
+     * Distribution of durations, in log-linear buckets: each power-of-two
+     * octave of durations is split into SubBucketCount linear sub-buckets,
+     * hence durations are reported with a relative error of at most
+     * 1/SubBucketCount. Fixed size, and adding a duration costs an index
+     * calculation and an increment.
+     *
+     * Counts are cumulative; the distribution over a window of time is
+     * obtained by subtracting the histogram taken at the start of the window.
+     */
+    struct Histogram
+    {
+    public:
+
+        // Durations below 2^MinExponent ns (~1us) all go in the first bucket
+        static int constexpr MinExponent = 10;
+
+        // Durations above 2^MaxExponent ns (~69s) all go in the last bucket
+        static int constexpr MaxExponent = 36;
+
+        static size_t constexpr SubBucketCount = 8;
+
+        static size_t constexpr BucketCount = 1 + (MaxExponent - MinExponent) * SubBucketCount;
+
+    private:
+
+        std::array<std::atomic<std::uint32_t>, BucketCount> mBuckets;
+
+    public:
+
+        Histogram()
+        {
+            Reset();
+        }
+
+        Histogram(Histogram const & other)
+        {
+            *this = other;
+        }
+
+        Histogram const & operator=(Histogram const & other)
+        {
+            for (size_t b = 0; b < BucketCount; ++b)
+            {
+                mBuckets[b].store(other.mBuckets[b].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            return *this;
+        }
+
+        inline void Update(GameChronometer::duration duration)
+        {
+            size_t const b = ToBucketIndex(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+            mBuckets[b].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline std::uint64_t GetCount() const
+        {
+            std::uint64_t count = 0;
+            for (auto const & bucket : mBuckets)
+            {
+                count += bucket.load(std::memory_order_relaxed);
+            }
+
+            return count;
+        }
+
+        /*
+         * Returns the upper bound of the bucket containing the specified fraction
+         * of the durations, or zero when there are no durations.
+         */
+        GameChronometer::duration GetPercentile(float fraction) const
+        {
+            std::uint64_t const count = GetCount();
+            if (count == 0)
+                return GameChronometer::duration::zero();
+
+            // Nearest rank; the tolerance keeps e.g. 0.99f * 100 from rounding up to 100
+            std::uint64_t const targetCount = std::max(
+                static_cast<std::uint64_t>(std::ceil(static_cast<double>(fraction) * static_cast<double>(count) - 1e-4)),
+                std::uint64_t(1));
+
+            std::uint64_t cumulativeCount = 0;
+            for (size_t b = 0; b < BucketCount; ++b)
+            {
+                cumulativeCount += mBuckets[b].load(std::memory_order_relaxed);
+                if (cumulativeCount >= targetCount)
+                {
+                    return GetBucketUpperBound(b);
+                }
+            }
+
+            return GetBucketUpperBound(BucketCount - 1);
+        }
+
+        inline GameChronometer::duration GetMax() const
+        {
+            return GetPercentile(1.0f);
+        }
+
+        inline void Reset()
+        {
+            for (auto & bucket : mBuckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        friend Histogram operator-(Histogram const & lhs, Histogram const & rhs)
+        {
+            Histogram res;
+            for (size_t b = 0; b < BucketCount; ++b)
+            {
+                res.mBuckets[b].store(
+                    lhs.mBuckets[b].load(std::memory_order_relaxed) - rhs.mBuckets[b].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+
+            return res;
+        }
+
+        static size_t ToBucketIndex(std::int64_t nanoseconds)
+        {
+            if (nanoseconds < (std::int64_t(1) << MinExponent))
+                return 0;
+
+            // nanoseconds = mantissa * 2^exponent, with mantissa in [0.5, 1)
+            int exponent;
+            double const mantissa = std::frexp(static_cast<double>(nanoseconds), &exponent);
+
+            int const octave = (exponent - 1) - MinExponent;
+            if (octave >= MaxExponent - MinExponent)
+                return BucketCount - 1;
+
+            size_t const subBucket = std::min(
+                static_cast<size_t>((mantissa * 2.0 - 1.0) * static_cast<double>(SubBucketCount)),
+                SubBucketCount - 1);
+
+            return 1 + static_cast<size_t>(octave) * SubBucketCount + subBucket;
+        }
+
+        static GameChronometer::duration GetBucketUpperBound(size_t bucketIndex)
+        {
+            double upperBoundNs;
+            if (bucketIndex == 0)
+            {
+                upperBoundNs = std::ldexp(1.0, MinExponent);
+            }
+            else
+            {
+                size_t const octave = (bucketIndex - 1) / SubBucketCount;
+                size_t const subBucket = (bucketIndex - 1) % SubBucketCount;
+                upperBoundNs =
+                    std::ldexp(1.0, MinExponent + static_cast<int>(octave))
+                    * (1.0 + static_cast<double>(subBucket + 1) / static_cast<double>(SubBucketCount));
+            }
+
+            return std::chrono::duration_cast<GameChronometer::duration>(
+                std::chrono::duration<double, std::nano>(upperBoundNs));
+        }
+    };
+
     struct Ratio
     {
     private:
@@ -60,14 +239,17 @@ struct PerfStats
         };
 
         std::atomic<_Ratio> mRatio;
+        Histogram mHistogram;
 
     public:
 
         Ratio()
             : mRatio()
+            , mHistogram()
         {}
 
         Ratio(Ratio const & other)
+            : mHistogram(other.mHistogram)
         {
             mRatio.store(other.mRatio.load());
         }
@@ -75,6 +257,7 @@ struct PerfStats
         Ratio const & operator=(Ratio const & other)
         {
             mRatio.store(other.mRatio.load());
+            mHistogram = other.mHistogram;
             return *this;
         }
 
@@ -84,6 +267,8 @@ struct PerfStats
             ratio.Duration += duration;
             ratio.Denominator += 1;
             mRatio.store(ratio);
+
+            mHistogram.Update(duration);
         }
 
         template<typename TDuration>
@@ -99,9 +284,31 @@ struct PerfStats
                 / static_cast<float>(ratio.Denominator);
         }
 
+        /*
+         * The duration below which the specified fraction of the durations
+         * falls, e.g. 0.99 for the 99th percentile.
+         */
+        template<typename TDuration>
+        inline float ToPercentile(float fraction) const
+        {
+            return std::chrono::duration_cast<std::chrono::duration<float, typename TDuration::period>>(mHistogram.GetPercentile(fraction)).count();
+        }
+
+        template<typename TDuration>
+        inline float ToMax() const
+        {
+            return std::chrono::duration_cast<std::chrono::duration<float, typename TDuration::period>>(mHistogram.GetMax()).count();
+        }
+
+        Histogram const & GetHistogram() const
+        {
+            return mHistogram;
+        }
+
         inline void Reset()
         {
             mRatio.store(_Ratio());
+            mHistogram.Reset();
         }
 
         friend Ratio operator-(Ratio const & lhs, Ratio const & rhs)
@@ -114,13 +321,93 @@ struct PerfStats
 
             Ratio res;
             res.mRatio.store(result);
+            res.mHistogram = lhs.mHistogram - rhs.mHistogram;
             return res;
         }
     };
 
+    struct Counter
+    {
+    private:
+
+        std::atomic<std::uint64_t> mValue;
+
+    public:
+
+        Counter()
+            : mValue(0)
+        {}
+
+        Counter(Counter const & other)
+        {
+            mValue.store(other.mValue.load());
+        }
+
+        Counter const & operator=(Counter const & other)
+        {
+            mValue.store(other.mValue.load());
+            return *this;
+        }
+
+        inline void Add(std::uint64_t value)
+        {
+            mValue.fetch_add(value);
+        }
+
+        inline std::uint64_t GetValue() const
+        {
+            return mValue.load();
+        }
+
+        inline void Reset()
+        {
+            mValue.store(0);
+        }
+
+        friend Counter operator-(Counter const & lhs, Counter const & rhs)
+        {
+            Counter res;
+            res.mValue.store(lhs.mValue.load() - rhs.mValue.load());
+            return res;
+        }
+    };
+
+    /*
+     * Utilization of one thread of the simulation thread pool, over the batches
+     * of tasks it took part in. Idle time is the time the thread spent in a batch
+     * without running tasks, i.e. waiting to be woken up or waiting for the
+     * other threads to complete.
+     */
+    struct ThreadPoolThread
+    {
+        Counter TaskCount;
+        Counter BusyNanoseconds;
+        Counter IdleNanoseconds;
+
+        inline float GetUtilization() const
+        {
+            auto const busy = BusyNanoseconds.GetValue();
+            auto const total = busy + IdleNanoseconds.GetValue();
+            return (total != 0)
+                ? static_cast<float>(busy) / static_cast<float>(total)
+                : 0.0f;
+        }
+
+        inline void Reset()
+        {
+            TaskCount.Reset();
+            BusyNanoseconds.Reset();
+            IdleNanoseconds.Reset();
+        }
+    };
+
+    // Threads beyond this number are accounted in the last entry
+    static size_t constexpr MaxThreadPoolThreads = 32;
+
     PerfStats()
     {
         mMeasurements.resize(static_cast<size_t>(PerfMeasurement::_Last) + 1);
+        mCounters.resize(static_cast<size_t>(PerfCounter::_Last) + 1);
         Reset();
     }
 
@@ -136,12 +423,69 @@ struct PerfStats
         mMeasurements[static_cast<std::size_t>(PM)].Update(duration);
     }
 
+    template<PerfCounter PC>
+    Counter const & GetCounter() const
+    {
+        return mCounters[static_cast<std::size_t>(PC)];
+    }
+
+    template<PerfCounter PC>
+    void AddToCounter(std::uint64_t value)
+    {
+        mCounters[static_cast<std::size_t>(PC)].Add(value);
+    }
+
+    ThreadPoolThread const & GetSimulationThreadPoolThread(size_t threadIndex) const // Calling thread is 0
+    {
+        return mSimulationThreadPoolThreads[std::min(threadIndex, MaxThreadPoolThreads - 1)];
+    }
+
+    /*
+     * The number of simulation thread pool threads that took part in at least one batch.
+     */
+    size_t GetSimulationThreadPoolThreadCount() const
+    {
+        size_t count = 0;
+        for (size_t t = 0; t < MaxThreadPoolThreads; ++t)
+        {
+            if (mSimulationThreadPoolThreads[t].BusyNanoseconds.GetValue() != 0
+                || mSimulationThreadPoolThreads[t].IdleNanoseconds.GetValue() != 0)
+            {
+                count = t + 1;
+            }
+        }
+
+        return count;
+    }
+
+    void UpdateSimulationThreadPoolThread(
+        size_t threadIndex,
+        std::uint64_t taskCount,
+        GameChronometer::duration busyDuration,
+        GameChronometer::duration idleDuration)
+    {
+        auto & thread = mSimulationThreadPoolThreads[std::min(threadIndex, MaxThreadPoolThreads - 1)];
+        thread.TaskCount.Add(taskCount);
+        thread.BusyNanoseconds.Add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(busyDuration).count()));
+        thread.IdleNanoseconds.Add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(idleDuration).count()));
+    }
+
     void Reset()
     {
         std::for_each(
             mMeasurements.begin(),
             mMeasurements.end(),
             [](auto & m) { m.Reset(); });
+
+        std::for_each(
+            mCounters.begin(),
+            mCounters.end(),
+            [](auto & c) { c.Reset(); });
+
+        std::for_each(
+            mSimulationThreadPoolThreads.begin(),
+            mSimulationThreadPoolThreads.end(),
+            [](auto & t) { t.Reset(); });
     }
 
     PerfStats & operator=(PerfStats const & other) = default;
@@ -152,16 +496,34 @@ private:
 
     // Indexed by PerfMeasurement integral
     std::vector<Ratio> mMeasurements;
+
+    // Indexed by PerfCounter integral
+    std::vector<Counter> mCounters;
+
+    // Indexed by thread index in the simulation thread pool
+    std::array<ThreadPoolThread, MaxThreadPoolThreads> mSimulationThreadPoolThreads;
 };
 
 inline PerfStats operator-(PerfStats const & lhs, PerfStats const & rhs)
 {
     PerfStats perfStats;
 
-    for (size_t i = 0; i < static_cast<size_t>(PerfMeasurement::_Last); ++i)
+    for (size_t i = 0; i <= static_cast<size_t>(PerfMeasurement::_Last); ++i)
     {
         perfStats.mMeasurements[i] = lhs.mMeasurements[i] - rhs.mMeasurements[i];
     }
 
+    for (size_t i = 0; i <= static_cast<size_t>(PerfCounter::_Last); ++i)
+    {
+        perfStats.mCounters[i] = lhs.mCounters[i] - rhs.mCounters[i];
+    }
+
+    for (size_t t = 0; t < PerfStats::MaxThreadPoolThreads; ++t)
+    {
+        perfStats.mSimulationThreadPoolThreads[t].TaskCount = lhs.mSimulationThreadPoolThreads[t].TaskCount - rhs.mSimulationThreadPoolThreads[t].TaskCount;
+        perfStats.mSimulationThreadPoolThreads[t].BusyNanoseconds = lhs.mSimulationThreadPoolThreads[t].BusyNanoseconds - rhs.mSimulationThreadPoolThreads[t].BusyNanoseconds;
+        perfStats.mSimulationThreadPoolThreads[t].IdleNanoseconds = lhs.mSimulationThreadPoolThreads[t].IdleNanoseconds - rhs.mSimulationThreadPoolThreads[t].IdleNanoseconds;
+    }
+
     return perfStats;
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+namespace /* anonymous */ {
+
+    /*
+     * Binds a thread buffer to the lifetime of its thread, so that the buffer
+     * may be reused once the thread is gone.
+     */
+    template<typename TThreadBuffer>
+    struct ThisThreadBufferHolder
+    {
+        TThreadBuffer * Buffer = nullptr;
+
+        ~ThisThreadBufferHolder()
+        {
+            if (Buffer != nullptr)
+            {
+                Buffer->IsInUse.store(false);
+            }
+        }
+    };
+
+}
+
+std::atomic<bool> Profiler::mIsEnabled(false);
+
+Profiler::Profiler()
+    : mEpoch(GameChronometer::Now())
+    , mThreadBuffers()
+    , mThreadBuffersMutex()
+{
+}
+
+void Profiler::SetThisThreadName(std::string const & threadName)
+{
+    GetThisThreadBuffer(&threadName);
+}
+
+void Profiler::Clear()
+{
+    std::lock_guard const lock{ mThreadBuffersMutex };
+
+    for (auto & threadBuffer : mThreadBuffers)
+    {
+        threadBuffer->RecordCount = 0;
+    }
+}
+
+picojson::value Profiler::ExportChromeTrace() const
+{
+    std::lock_guard const lock{ mThreadBuffersMutex };
+
+    picojson::array traceEvents;
+
+    for (auto const & threadBuffer : mThreadBuffers)
+    {
+        // Thread name
+        {
+            picojson::object args;
+            args.emplace("name", picojson::value(threadBuffer->ThreadName));
+
+            picojson::object metadataEvent;
+            metadataEvent.emplace("name", picojson::value("thread_name"));
+            metadataEvent.emplace("ph", picojson::value("M"));
+            metadataEvent.emplace("pid", picojson::value(std::int64_t(1)));
+            metadataEvent.emplace("tid", picojson::value(static_cast<std::int64_t>(threadBuffer->ThreadId)));
+            metadataEvent.emplace("args", picojson::value(args));
+
+            traceEvents.emplace_back(metadataEvent);
+        }
+
+        // Zones, oldest first
+        std::uint64_t const recordCount = std::min(threadBuffer->RecordCount, std::uint64_t(ThreadRingBufferSize));
+        for (std::uint64_t r = threadBuffer->RecordCount - recordCount; r < threadBuffer->RecordCount; ++r)
+        {
+            ZoneRecord const & record = threadBuffer->Ring[r % ThreadRingBufferSize];
+
+            // Chrome wants microseconds
+            picojson::object zoneEvent;
+            zoneEvent.emplace("name", picojson::value(record.Name));
+            zoneEvent.emplace("ph", picojson::value("X"));
+            zoneEvent.emplace("ts", picojson::value(static_cast<double>(record.StartNs) / 1000.0));
+            zoneEvent.emplace("dur", picojson::value(static_cast<double>(record.DurationNs) / 1000.0));
+            zoneEvent.emplace("pid", picojson::value(std::int64_t(1)));
+            zoneEvent.emplace("tid", picojson::value(static_cast<std::int64_t>(threadBuffer->ThreadId)));
+
+            picojson::object args;
+            args.emplace("depth", picojson::value(static_cast<std::int64_t>(record.Depth)));
+            zoneEvent.emplace("args", picojson::value(args));
+
+            traceEvents.emplace_back(zoneEvent);
+        }
+    }
+
+    picojson::object trace;
+    trace.emplace("traceEvents", picojson::value(traceEvents));
+    trace.emplace("displayTimeUnit", picojson::value("ms"));
+
+    return picojson::value(trace);
+}
+
+void Profiler::BeginZone(char const * name)
+{
+    ThreadBuffer & threadBuffer = GetThisThreadBuffer(nullptr);
+
+    if (threadBuffer.Depth < MaxZoneDepth)
+    {
+        threadBuffer.OpenZoneNames[threadBuffer.Depth] = name;
+        threadBuffer.OpenZoneStartTimes[threadBuffer.Depth] = GameChronometer::Now();
+    }
+
+    ++threadBuffer.Depth;
+}
+
+void Profiler::EndZone()
+{
+    ThreadBuffer & threadBuffer = GetThisThreadBuffer(nullptr);
+
+    assert(threadBuffer.Depth > 0);
+    --threadBuffer.Depth;
+
+    if (threadBuffer.Depth < MaxZoneDepth)
+    {
+        auto const endTime = GameChronometer::Now();
+        auto const startTime = threadBuffer.OpenZoneStartTimes[threadBuffer.Depth];
+
+        ZoneRecord & record = threadBuffer.Ring[threadBuffer.RecordCount % ThreadRingBufferSize];
+        record.Name = threadBuffer.OpenZoneNames[threadBuffer.Depth];
+        record.StartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(startTime - mEpoch).count();
+        record.DurationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+        record.Depth = static_cast<std::uint32_t>(threadBuffer.Depth);
+
+        ++threadBuffer.RecordCount;
+    }
+}
+
+Profiler::ThreadBuffer & Profiler::GetThisThreadBuffer(std::string const * threadName)
+{
+    thread_local ThisThreadBufferHolder<ThreadBuffer> thisThreadBuffer;
+
+    if (thisThreadBuffer.Buffer == nullptr)
+    {
+        thisThreadBuffer.Buffer = &AcquireThreadBuffer(threadName != nullptr ? *threadName : std::string());
+    }
+    else if (threadName != nullptr && thisThreadBuffer.Buffer->ThreadName != *threadName)
+    {
+        std::lock_guard const lock{ mThreadBuffersMutex };
+
+        thisThreadBuffer.Buffer->ThreadName = *threadName;
+    }
+
+    return *thisThreadBuffer.Buffer;
+}
+
+Profiler::ThreadBuffer & Profiler::AcquireThreadBuffer(std::string const & threadName)
+{
+    std::lock_guard const lock{ mThreadBuffersMutex };
+
+    // Reuse the buffer of an exited thread with the same name, if any, so that
+    // re-created thread pools do not keep adding buffers
+    if (!threadName.empty())
+    {
+        for (auto & threadBuffer : mThreadBuffers)
+        {
+            bool expected = false;
+            if (threadBuffer->ThreadName == threadName
+                && threadBuffer->IsInUse.compare_exchange_strong(expected, true))
+            {
+                threadBuffer->Depth = 0;
+                return *threadBuffer;
+            }
+        }
+    }
+
+    std::uint32_t const threadId = static_cast<std::uint32_t>(mThreadBuffers.size());
+
+    mThreadBuffers.emplace_back(
+        std::make_unique<ThreadBuffer>(
+            threadName.empty() ? "Thread " + std::to_string(threadId) : threadName,
+            threadId));
+
+    return *mThreadBuffers.back();
+}
@@ -0,0 +1,190 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameChronometer.h"
+
+#include <picojson.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * A hierarchical, scoped profiler.
+ *
+ * Code marks zones with FS_PROFILE_ZONE("Name"), which times the enclosing scope;
+ * zones nest naturally. Each thread records its completed zones into its own ring
+ * buffer, hence recording requires no locks; when a ring buffer is full, the
+ * oldest zones are overwritten.
+ *
+ * The profiler is always compiled in, and it is enabled and disabled at runtime;
+ * when disabled, the cost of a zone is a single branch on a flag.
+ *
+ * Recorded zones are exported in the Chrome trace-event format, which may be
+ * loaded in chrome://tracing, Perfetto, or Speedscope.
+ *
+ * Singleton.
+ */
+class Profiler final
+{
+public:
+
+    // Number of zones remembered by each thread
+    static size_t constexpr ThreadRingBufferSize = 16384;
+
+    // Maximum depth of nested zones; deeper zones are not recorded
+    static size_t constexpr MaxZoneDepth = 64;
+
+    static Profiler & GetInstance()
+    {
+        static Profiler * instance = new Profiler();
+
+        return *instance;
+    }
+
+    static inline bool IsEnabled()
+    {
+        return mIsEnabled.load(std::memory_order_relaxed);
+    }
+
+    void Enable()
+    {
+        mIsEnabled.store(true, std::memory_order_relaxed);
+    }
+
+    void Disable()
+    {
+        mIsEnabled.store(false, std::memory_order_relaxed);
+    }
+
+    /*
+     * Names the calling thread in exported traces. Threads that do not call this
+     * get a generic name.
+     */
+    void SetThisThreadName(std::string const & threadName);
+
+    /*
+     * Forgets all recorded zones. Not to be invoked while zones are being recorded.
+     */
+    void Clear();
+
+    /*
+     * Exports all recorded zones as a Chrome trace-event JSON object.
+     * Not to be invoked while zones are being recorded, e.g. invoke after the
+     * profiler has been disabled and the current simulation step has completed.
+     */
+    picojson::value ExportChromeTrace() const;
+
+    //
+    // Zone recording - invoked by Zone only when the profiler is enabled
+    //
+
+    void BeginZone(char const * name);
+
+    void EndZone();
+
+public:
+
+    /*
+     * RAII zone; use via FS_PROFILE_ZONE.
+     *
+     * The name must be a string literal, as it is stored by pointer.
+     */
+    class Zone final
+    {
+    public:
+
+        explicit Zone(char const * name)
+            : mIsRecording(IsEnabled())
+        {
+            if (mIsRecording)
+            {
+                GetInstance().BeginZone(name);
+            }
+        }
+
+        ~Zone()
+        {
+            if (mIsRecording)
+            {
+                GetInstance().EndZone();
+            }
+        }
+
+        Zone(Zone const &) = delete;
+        Zone & operator=(Zone const &) = delete;
+
+    private:
+
+        // Remembers whether we began, so that zones stay balanced when the
+        // profiler is toggled while a zone is open
+        bool const mIsRecording;
+    };
+
+private:
+
+    struct ZoneRecord
+    {
+        char const * Name;
+        std::int64_t StartNs; // Since profiler's epoch
+        std::int64_t DurationNs;
+        std::uint32_t Depth;
+    };
+
+    struct ThreadBuffer
+    {
+        std::string ThreadName;
+        std::uint32_t ThreadId; // Ordinal, for traces
+        std::atomic<bool> IsInUse; // Whether a live thread owns this buffer
+
+        std::unique_ptr<ZoneRecord[]> Ring;
+        std::uint64_t RecordCount; // Total ever written; ring position is RecordCount % ThreadRingBufferSize
+
+        std::array<GameChronometer::time_point, MaxZoneDepth> OpenZoneStartTimes;
+        std::array<char const *, MaxZoneDepth> OpenZoneNames;
+        size_t Depth; // Including zones deeper than MaxZoneDepth
+
+        ThreadBuffer(
+            std::string const & threadName,
+            std::uint32_t threadId)
+            : ThreadName(threadName)
+            , ThreadId(threadId)
+            , IsInUse(true)
+            , Ring(new ZoneRecord[ThreadRingBufferSize])
+            , RecordCount(0)
+            , OpenZoneStartTimes()
+            , OpenZoneNames()
+            , Depth(0)
+        {}
+    };
+
+    Profiler();
+
+    ThreadBuffer & GetThisThreadBuffer(std::string const * threadName); // Null when not naming the thread
+
+    ThreadBuffer & AcquireThreadBuffer(std::string const & threadName);
+
+private:
+
+    static std::atomic<bool> mIsEnabled;
+
+    GameChronometer::time_point const mEpoch;
+
+    // All thread buffers ever created; buffers of exited threads are
+    // reused by new threads with the same name
+    std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+    mutable std::mutex mThreadBuffersMutex;
+};
+
+#define _FS_PROFILE_ZONE_CAT2(a, b) a##b
+#define _FS_PROFILE_ZONE_CAT(a, b) _FS_PROFILE_ZONE_CAT2(a, b)
+
+#define FS_PROFILE_ZONE(name) Profiler::Zone const _FS_PROFILE_ZONE_CAT(_fsProfileZone, __LINE__)(name)
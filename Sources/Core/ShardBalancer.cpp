@@ -0,0 +1,128 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "ShardBalancer.h"
+
+#include "Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+void ShardBalancer::Reset(size_t shardCount)
+{
+    assert(shardCount > 0);
+
+    mWeights.assign(shardCount, 1.0f);
+    mPeriodShardTimes.assign(shardCount, 0.0f);
+    mPeriodStepCount = 0;
+    mIsRebalancing = false;
+    mLastStragglerGap = GameChronometer::duration::zero();
+    mLastRelativeStragglerGap = 0.0f;
+    mRelativeStragglerGapBeforeRebalance = 0.0f;
+    mHasPendingRebalanceReport = false;
+}
+
+bool ShardBalancer::Update(std::vector<GameChronometer::duration> const & shardDurations)
+{
+    assert(shardDurations.size() == mWeights.size());
+
+    for (size_t s = 0; s < shardDurations.size(); ++s)
+    {
+        mPeriodShardTimes[s] += std::chrono::duration<float>(shardDurations[s]).count();
+    }
+
+    ++mPeriodStepCount;
+    if (mPeriodStepCount < PeriodStepCount)
+    {
+        return false;
+    }
+
+    //
+    // End of period
+    //
+
+    float const meanShardTime = std::accumulate(mPeriodShardTimes.cbegin(), mPeriodShardTimes.cend(), 0.0f) / static_cast<float>(mPeriodShardTimes.size());
+    float const maxShardTime = *std::max_element(mPeriodShardTimes.cbegin(), mPeriodShardTimes.cend());
+
+    mLastStragglerGap = std::chrono::duration_cast<GameChronometer::duration>(
+        std::chrono::duration<float>((maxShardTime - meanShardTime) / static_cast<float>(mPeriodStepCount)));
+    mLastRelativeStragglerGap = (meanShardTime > 0.0f)
+        ? (maxShardTime - meanShardTime) / meanShardTime
+        : 0.0f;
+
+    if (mHasPendingRebalanceReport)
+    {
+        LogMessage("ShardBalancer: straggler gap before=", mRelativeStragglerGapBeforeRebalance * 100.0f, "% after=", mLastRelativeStragglerGap * 100.0f, "%");
+        mHasPendingRebalanceReport = false;
+    }
+
+    // Hysteresis
+    if (!mIsRebalancing && mLastRelativeStragglerGap > StartRelativeGap)
+    {
+        mIsRebalancing = true;
+    }
+    else if (mIsRebalancing && mLastRelativeStragglerGap < StopRelativeGap)
+    {
+        mIsRebalancing = false;
+    }
+
+    bool hasChanged = false;
+    if (mIsRebalancing && meanShardTime > 0.0f)
+    {
+        hasChanged = Rebalance(mPeriodShardTimes, meanShardTime);
+
+        if (hasChanged)
+        {
+            mRelativeStragglerGapBeforeRebalance = mLastRelativeStragglerGap;
+            mHasPendingRebalanceReport = true;
+        }
+    }
+
+    // Start new period
+    std::fill(mPeriodShardTimes.begin(), mPeriodShardTimes.end(), 0.0f);
+    mPeriodStepCount = 0;
+
+    return hasChanged;
+}
+
+bool ShardBalancer::Rebalance(
+    std::vector<float> const & shardTimes,
+    float meanShardTime)
+{
+    //
+    // A shard's time is proportional to its weight divided by its speed; to bring
+    // each shard to the mean time, its weight is scaled by meanTime/shardTime.
+    // We only apply a fraction of the correction (in log space), and clamp
+    // it, as timings are noisy.
+    //
+
+    std::vector<float> newWeights(mWeights.size());
+    float weightSum = 0.0f;
+    for (size_t s = 0; s < mWeights.size(); ++s)
+    {
+        float const correction = (shardTimes[s] > 0.0f)
+            ? std::clamp(meanShardTime / shardTimes[s], 0.5f, 2.0f)
+            : 2.0f; // An empty shard can certainly take more
+
+        newWeights[s] = mWeights[s] * std::pow(correction, CorrectionRate);
+        weightSum += newWeights[s];
+    }
+
+    // Normalize to a mean of 1
+    bool hasChanged = false;
+    for (size_t s = 0; s < mWeights.size(); ++s)
+    {
+        float const newWeight = std::clamp(newWeights[s] * static_cast<float>(mWeights.size()) / weightSum, MinWeight, MaxWeight);
+        if (newWeight != mWeights[s])
+        {
+            mWeights[s] = newWeight;
+            hasChanged = true;
+        }
+    }
+
+    return hasChanged;
+}
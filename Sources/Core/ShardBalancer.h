@@ -0,0 +1,141 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameChronometer.h"
+
+#include <cassert>
+#include <vector>
+
+/*
+ * Adapts the relative sizes of the shards of a parallel computation to the time
+ * each shard is measured to take, so that all threads complete at about the same
+ * time.
+ *
+ * Each shard has a weight - initially 1 - which multiplies the share of work the
+ * shard would get otherwise. Measurements are accumulated over periods of a few
+ * steps; at the end of each period the gap between the slowest shard and the mean
+ * (the "straggler gap") is calculated, and the weights are adjusted towards the
+ * shards' measured speeds.
+ *
+ * Rebalancing is subject to hysteresis: it starts when the gap grows above a
+ * threshold, and it only stops once the gap falls below a lower threshold, so that
+ * small fluctuations in timings do not make shards oscillate.
+ *
+ * Note: rebalancing makes results depend on timings. Moving shard boundaries moves
+ * elements between the per-thread buffers that are summed at the end of a parallel
+ * computation, hence it changes the order of floating point sums; two runs with the
+ * same inputs then diverge. Deterministic sessions must thus forgo rebalancing and
+ * keep the nominal weights, at the cost of stragglers.
+ */
+class ShardBalancer final
+{
+public:
+
+    // Number of steps measurements are accumulated over, before deciding
+    static size_t constexpr PeriodStepCount = 32;
+
+    // Relative straggler gap above which we start rebalancing
+    static float constexpr StartRelativeGap = 0.10f;
+
+    // Relative straggler gap below which we stop rebalancing
+    static float constexpr StopRelativeGap = 0.03f;
+
+    // Fraction of the measured imbalance we correct at each rebalancing
+    static float constexpr CorrectionRate = 0.5f;
+
+    static float constexpr MinWeight = 0.1f;
+    static float constexpr MaxWeight = 10.0f;
+
+public:
+
+    explicit ShardBalancer(size_t shardCount = 1)
+    {
+        Reset(shardCount);
+    }
+
+    void Reset(size_t shardCount);
+
+    size_t GetShardCount() const
+    {
+        return mWeights.size();
+    }
+
+    std::vector<float> const & GetWeights() const
+    {
+        return mWeights;
+    }
+
+    /*
+     * Whether all weights are at their initial value, i.e. shards are as they
+     * would be without rebalancing.
+     */
+    bool HasNominalWeights() const
+    {
+        for (float const weight : mWeights)
+        {
+            if (weight != 1.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool IsRebalancing() const
+    {
+        return mIsRebalancing;
+    }
+
+    /*
+     * The straggler gap - slowest shard's time minus mean shard time - per step,
+     * as measured over the last completed period.
+     */
+    GameChronometer::duration GetLastStragglerGap() const
+    {
+        return mLastStragglerGap;
+    }
+
+    /*
+     * The straggler gap relative to the mean shard time, as measured over the last
+     * completed period.
+     */
+    float GetLastRelativeStragglerGap() const
+    {
+        return mLastRelativeStragglerGap;
+    }
+
+    /*
+     * Takes the time spent by each shard in one step; returns true when the weights
+     * have changed, in which case the shards are to be recalculated.
+     */
+    bool Update(std::vector<GameChronometer::duration> const & shardDurations);
+
+private:
+
+    bool Rebalance(
+        std::vector<float> const & shardTimes,
+        float meanShardTime);
+
+private:
+
+    std::vector<float> mWeights;
+
+    // Accumulated over the current period, in seconds
+    std::vector<float> mPeriodShardTimes;
+    size_t mPeriodStepCount;
+
+    bool mIsRebalancing;
+
+    GameChronometer::duration mLastStragglerGap;
+    float mLastRelativeStragglerGap;
+
+    // The relative gap of the period before the last rebalancing, when the
+    // effect of that rebalancing has not been reported yet
+    float mRelativeStragglerGapBeforeRebalance;
+    bool mHasPendingRebalanceReport;
+};
@@ -125,6 +125,8 @@ void TaskThread::ThreadLoop(
 
         try
         {
+            FS_PROFILE_ZONE("TaskThread::Task");
+
             queuedTask.TaskToRun();
         }
         catch (GameInitializationAbortException const &)
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "GameExceptions.h"
+#include "Profiler.h"
 #include "ThreadManager.h"
 
 #include <condition_variable>
@@ -186,6 +187,8 @@ public:
 
             try
             {
+                FS_PROFILE_ZONE("TaskThread::Task");
+
                 task();
             }
             catch (GameInitializationAbortException const &)
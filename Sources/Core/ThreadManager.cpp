@@ -7,6 +7,7 @@
 
 #include "FloatingPoint.h"
 #include "Log.h"
+#include "Profiler.h"
 #include "SysSpecifics.h"
 
 #include <algorithm>
@@ -21,6 +22,9 @@
 #elif FS_IS_OS_ANDROID()
 #include <sys/syscall.h>
 #include <unistd.h>
+#elif FS_IS_OS_LINUX()
+#include <pthread.h>
+#include <sched.h>
 #endif
 
 size_t ThreadManager::GetNumberOfProcessors()
@@ -89,6 +93,12 @@ void ThreadManager::InitializeThisThread(
     EnableFloatingPointExceptions();
 #endif
 
+    //
+    // Name thread in profiles
+    //
+
+    Profiler::GetInstance().SetThisThreadName(threadName);
+
     mPlatformSpecificThreadInitializationFunctor(threadTaskKind, cpuId, threadTaskIndex, threadName);
 }
 
@@ -106,11 +116,35 @@ size_t ThreadManager::GetThisThreadProcessor()
     {
         return static_cast<size_t>(cpu);
     }
+#elif FS_IS_OS_LINUX()
+    int const cpu = sched_getcpu();
+    return (cpu < 0) ? static_cast<size_t>(-1) : static_cast<size_t>(cpu);
 #else
     return static_cast<size_t>(-1);
 #endif
 }
 
+bool ThreadManager::SetThisThreadAffinity(size_t cpuId)
+{
+#if FS_IS_OS_LINUX()
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuId, &cpuSet);
+
+    int const result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+    if (result != 0)
+    {
+        LogMessage("ThreadManager: cannot set affinity to cpu ", cpuId, ": error ", result);
+        return false;
+    }
+
+    return true;
+#else
+    (void)cpuId;
+    return false;
+#endif
+}
+
 size_t ThreadManager::GetSimulationParallelism() const
 {
     return mSimulationThreadPool->GetParallelism();
@@ -141,8 +175,9 @@ ThreadPool & ThreadManager::GetSimulationThreadPool()
 
 std::vector<ThreadManager::CpuInfo> ThreadManager::SortCpuResources(std::vector<CpuInfo> const & src)
 {
+    // Stable, as among equally-fast CPUs, the first ones are preferred
     std::vector<ThreadManager::CpuInfo> newCpuResources = src;
-    std::sort(
+    std::stable_sort(
         newCpuResources.begin(),
         newCpuResources.end(),
         [](CpuInfo const & c1, CpuInfo const & c2) -> bool
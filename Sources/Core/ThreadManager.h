@@ -75,6 +75,12 @@ public:
 
     static size_t GetThisThreadProcessor();
 
+    /*
+     * Pins the calling thread to the specified CPU, on platforms where this is
+     * supported; returns whether the thread has been pinned.
+     */
+    static bool SetThisThreadAffinity(size_t cpuId);
+
     //
     // Simulation Parallelism applies to all simulation tasks, including SpringRelaxation and LightDiffusion
     //
@@ -105,7 +111,7 @@ private:
 
     bool const mIsRenderingMultithreaded;
     size_t const mMaxSimulationParallelism; // Calculated via hardware concurrency; never changes
-    std::vector<CpuInfo> const mCpuResources; // Sorted by speef
+    std::vector<CpuInfo> const mCpuResources; // Sorted by speed, preserving order of preference among equal speeds
     PlatformSpecificThreadInitializationFunction const mPlatformSpecificThreadInitializationFunctor;
 
     std::unique_ptr<ThreadPool> mSimulationThreadPool;
@@ -6,6 +6,7 @@
 #include "ThreadPool.h"
 
 #include "Log.h"
+#include "Profiler.h"
 #include "SysSpecifics.h"
 
 #include <algorithm>
@@ -21,6 +22,11 @@ ThreadPool::ThreadPool(
     , mThreadAssignedTasks()
     , mThreadAssignedCompletedTasks(0)
     , mIsStop(false)
+    , mRunRandomEngine(nullptr)
+    , mRunWallClock(nullptr)
+    , mThreadRunStatistics(parallelism)
+    , mUnpublishedRunStatistics()
+    , mUnpublishedThreadStatistics(parallelism)
 {
     LogMessage("ThreadPool: creating thread pool with parallelism=", parallelism);
 
@@ -112,15 +118,24 @@ void ThreadPool::Run(std::vector<Task> const & tasks)
 {
     assert(!tasks.empty());
 
+    auto const startTime = GameChronometer::Now();
+
     // Shortcut to avoid paying synchronization penalties
     // in trivial cases
     if (mThreads.size() < 2 || tasks.size() == 1)
     {
+        for (auto & threadRunStatistics : mThreadRunStatistics)
+        {
+            threadRunStatistics = ThreadRunStatistics();
+        }
+
         for (Task const & task : tasks)
         {
-            RunTask(task);
+            RunTask(task, 0);
         }
 
+        RecordRun(GameChronometer::Now() - startTime);
+
         return;
     }
 
@@ -148,6 +163,14 @@ void ThreadPool::Run(std::vector<Task> const & tasks)
             mThreadAssignedTasks[t] = nullptr; // No tasks for extra threads
         }
 
+        mRunRandomEngine = GameRandomEngine::GetThreadInstance();
+        mRunWallClock = GameWallClock::GetThreadInstance();
+
+        for (auto & threadRunStatistics : mThreadRunStatistics)
+        {
+            threadRunStatistics = ThreadRunStatistics();
+        }
+
         mThreadAssignedCompletedTasks.store(0);
     }
 
@@ -155,13 +178,13 @@ void ThreadPool::Run(std::vector<Task> const & tasks)
     mWorkerThreadSignal.notify_all();
 
     // Run our own task - the calling thread's task
-    RunTask(tasks[0]);
+    RunTask(tasks[0], 0);
 
     // Run the remaining tasks on calling thread, if needed
     // (we assume there are few here, at most 1)
     for (size_t t = 1 + tasksAssignedToThreads; t < tasks.size(); ++t)
     {
-        RunTask(tasks[t]);
+        RunTask(tasks[t], 0);
     }
 
     // Wait until all tasks are completed
@@ -176,6 +199,31 @@ void ThreadPool::Run(std::vector<Task> const & tasks)
             }
         }
     }
+
+    RecordRun(GameChronometer::Now() - startTime);
+}
+
+void ThreadPool::PublishStatistics(PerfStats & perfStats)
+{
+    for (auto const & runStatistics : mUnpublishedRunStatistics)
+    {
+        perfStats.Update<PerfMeasurement::SimulationThreadPoolRun>(runStatistics.RunDuration);
+        perfStats.Update<PerfMeasurement::SimulationThreadPoolCriticalPath>(runStatistics.CriticalPathDuration);
+        perfStats.Update<PerfMeasurement::SimulationThreadPoolImbalance>(runStatistics.ImbalanceDuration);
+    }
+
+    mUnpublishedRunStatistics.clear();
+
+    for (size_t t = 0; t < mUnpublishedThreadStatistics.size(); ++t)
+    {
+        perfStats.UpdateSimulationThreadPoolThread(
+            t,
+            mUnpublishedThreadStatistics[t].TaskCount,
+            mUnpublishedThreadStatistics[t].BusyDuration,
+            mUnpublishedThreadStatistics[t].IdleDuration);
+
+        mUnpublishedThreadStatistics[t] = ThreadStatistics();
+    }
 }
 
 void ThreadPool::ThreadLoop(
@@ -201,6 +249,8 @@ void ThreadPool::ThreadLoop(
     while (true)
     {
         Task const * task = nullptr;
+        GameRandomEngine * randomEngine = nullptr;
+        GameWallClock * wallClock = nullptr;
         {
             std::unique_lock lock{ mLock };
 
@@ -227,6 +277,9 @@ void ThreadPool::ThreadLoop(
 
             // Remove semaphore, while we're in a lock
             std::swap(task, mThreadAssignedTasks[threadTaskIndex - 1]);
+
+            randomEngine = mRunRandomEngine;
+            wallClock = mRunWallClock;
         }
 
         // Tasks have been queued...
@@ -238,7 +291,12 @@ void ThreadPool::ThreadLoop(
 
         //LogMessage("Running thread-assigned task ", threadTaskIndex - 1);
 
-        RunTask(*task);
+        {
+            GameRandomEngine::ThreadScope const randomEngineScope(randomEngine);
+            GameWallClock::ThreadScope const wallClockScope(wallClock);
+
+            RunTask(*task, threadTaskIndex);
+        }
 
         //LogMessage("Completed thread-assigned task ", threadTaskIndex - 1);
 
@@ -252,8 +310,14 @@ void ThreadPool::ThreadLoop(
     LogMessage("Thread exiting");
 }
 
-void ThreadPool::RunTask(Task const & task)
+void ThreadPool::RunTask(
+    Task const & task,
+    size_t threadIndex)
 {
+    FS_PROFILE_ZONE("ThreadPool::Task");
+
+    auto const startTime = GameChronometer::Now();
+
     try
     {
         task();
@@ -266,4 +330,43 @@ void ThreadPool::RunTask(Task const & task)
 
         // Keep going...
     }
+
+    auto & threadRunStatistics = mThreadRunStatistics[threadIndex];
+    threadRunStatistics.TaskCount += 1;
+    threadRunStatistics.BusyDuration += GameChronometer::Now() - startTime;
+}
+
+void ThreadPool::RecordRun(GameChronometer::duration runDuration)
+{
+    GameChronometer::duration criticalPathDuration = GameChronometer::duration::zero();
+    GameChronometer::duration totalBusyDuration = GameChronometer::duration::zero();
+    size_t busyThreadCount = 0;
+
+    for (size_t t = 0; t < mThreadRunStatistics.size(); ++t)
+    {
+        auto const & threadRunStatistics = mThreadRunStatistics[t];
+
+        if (threadRunStatistics.TaskCount > 0)
+        {
+            criticalPathDuration = std::max(criticalPathDuration, threadRunStatistics.BusyDuration);
+            totalBusyDuration += threadRunStatistics.BusyDuration;
+            ++busyThreadCount;
+        }
+
+        // Threads without tasks have been idle throughout the batch
+        auto & threadStatistics = mUnpublishedThreadStatistics[t];
+        threadStatistics.TaskCount += threadRunStatistics.TaskCount;
+        threadStatistics.BusyDuration += threadRunStatistics.BusyDuration;
+        threadStatistics.IdleDuration += std::max(runDuration - threadRunStatistics.BusyDuration, GameChronometer::duration::zero());
+    }
+
+    if (mUnpublishedRunStatistics.size() < MaxUnpublishedRuns)
+    {
+        assert(busyThreadCount > 0);
+
+        mUnpublishedRunStatistics.push_back({
+            runDuration,
+            criticalPathDuration,
+            criticalPathDuration - totalBusyDuration / busyThreadCount });
+    }
 }
\ No newline at end of file
@@ -5,11 +5,16 @@
 ***************************************************************************************/
 #pragma once
 
+#include "GameChronometer.h"
+#include "GameRandomEngine.h"
+#include "GameWallClock.h"
+#include "PerfStats.h"
 #include "ThreadManager.h"
 
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <deque>
@@ -21,6 +26,13 @@
 /*
  * This class implements a thread pool that executes batches of tasks.
  *
+ * The pool keeps track of how long each of its threads spends running tasks
+ * and waiting during each batch, so that the balance of the tasks may be
+ * assessed; see PublishStatistics().
+ *
+ * Tasks see the random engine and the wall clock bound to the calling thread,
+ * if any, regardless of the thread they run on.
+ *
  */
 class ThreadPool final
 {
@@ -62,6 +74,14 @@ public:
         tasks.clear();
     }
 
+    /*
+     * Adds the statistics of the batches run since the last invocation to the
+     * simulation thread pool entries of the specified PerfStats, and forgets them.
+     *
+     * To be invoked by the thread that runs the batches, between batches.
+     */
+    void PublishStatistics(PerfStats & perfStats);
+
 private:
 
     void ThreadLoop(
@@ -70,7 +90,11 @@ private:
         std::string const & threadName,
         ThreadManager & threadManager);
 
-    void RunTask(Task const & task);
+    void RunTask(
+        Task const & task,
+        size_t threadIndex);
+
+    void RecordRun(GameChronometer::duration runDuration);
 
 private:
 
@@ -86,6 +110,43 @@ private:
             , CpuInfo(cpuInfo)
         { }
     };
+
+    // Work done by a thread in the current batch; written only by the thread
+    // itself while the batch runs, and read by the calling thread afterwards
+    struct alignas(64) ThreadRunStatistics
+    {
+        std::uint64_t TaskCount;
+        GameChronometer::duration BusyDuration;
+
+        ThreadRunStatistics()
+            : TaskCount(0)
+            , BusyDuration(GameChronometer::duration::zero())
+        {}
+    };
+
+    struct RunStatistics
+    {
+        GameChronometer::duration RunDuration;
+        GameChronometer::duration CriticalPathDuration;
+        GameChronometer::duration ImbalanceDuration;
+    };
+
+    struct ThreadStatistics
+    {
+        std::uint64_t TaskCount;
+        GameChronometer::duration BusyDuration;
+        GameChronometer::duration IdleDuration;
+
+        ThreadStatistics()
+            : TaskCount(0)
+            , BusyDuration(GameChronometer::duration::zero())
+            , IdleDuration(GameChronometer::duration::zero())
+        {}
+    };
+
+    // Batches beyond this number are not recorded until statistics are published
+    static size_t constexpr MaxUnpublishedRuns = 4096;
+
 private:
 
     ThreadManager::ThreadTaskKind const mThreadTaskKind;
@@ -109,4 +170,20 @@ private:
 
     // Set to true when have to stop
     bool mIsStop;
+
+    // The instances bound to the calling thread for the current batch, bound in turn
+    // to the threads running its tasks. Populated by main thread in a lock
+    GameRandomEngine * mRunRandomEngine;
+    GameWallClock * mRunWallClock;
+
+    //
+    // Statistics
+    //
+
+    // Sized for all threads
+    std::vector<ThreadRunStatistics> mThreadRunStatistics;
+
+    // Accumulated since last publish; only touched by calling thread
+    std::vector<RunStatistics> mUnpublishedRunStatistics;
+    std::vector<ThreadStatistics> mUnpublishedThreadStatistics; // Sized for all threads
 };
@@ -0,0 +1,206 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-18
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "AABB.h"
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace Geometry {
+
+/*
+ * A uniform grid over a region of space, binning triangles by their AABBs; used as
+ * a narrowphase for finding the triangles that might contain a given point.
+ *
+ * The grid only stores triangle indices, not positions: the caller may bin triangles
+ * with AABBs enlarged by a margin, and then keep querying the grid while the triangles
+ * move by less than that margin.
+ *
+ * The grid is meant to be rebuilt frequently, hence it retains its storage across builds.
+ */
+class TriangleGrid
+{
+public:
+
+    TriangleGrid()
+        : mRegion()
+        , mInverseCellSize(1.0f)
+        , mWidth(0)
+        , mHeight(0)
+        , mCellStarts()
+        , mTriangleIndices()
+        , mEntries()
+    {}
+
+    AABB const & GetRegion() const noexcept
+    {
+        return mRegion;
+    }
+
+    bool IsEmpty() const noexcept
+    {
+        return mTriangleIndices.empty();
+    }
+
+    /*
+     * Begins a new build over the specified region, discarding the current content.
+     *
+     * Cells are square; their size is the minimum size, unless that would make for more
+     * than the maximum number of cells along either side.
+     */
+    void BeginBuild(
+        AABB const & region,
+        float minCellSize,
+        int maxCellsPerSide)
+    {
+        assert(minCellSize > 0.0f);
+        assert(maxCellsPerSide > 0);
+
+        mRegion = region;
+
+        float const regionSize = std::max(std::max(region.GetWidth(), region.GetHeight()), 0.0f);
+        float const cellSize = std::max(minCellSize, regionSize / static_cast<float>(maxCellsPerSide));
+        mInverseCellSize = 1.0f / cellSize;
+
+        mWidth = std::clamp(static_cast<int>(std::ceil(std::max(region.GetWidth(), 0.0f) * mInverseCellSize)), 1, maxCellsPerSide);
+        mHeight = std::clamp(static_cast<int>(std::ceil(std::max(region.GetHeight(), 0.0f) * mInverseCellSize)), 1, maxCellsPerSide);
+
+        mEntries.clear();
+    }
+
+    /*
+     * Bins the specified triangle into all the cells overlapped by its AABB;
+     * triangles not overlapping the region are ignored.
+     */
+    void Add(
+        ElementIndex triangleIndex,
+        AABB const & triangleAabb)
+    {
+        if (!mRegion.Intersects(triangleAabb))
+        {
+            return;
+        }
+
+        int const left = ToCellX(triangleAabb.BottomLeft.x);
+        int const right = ToCellX(triangleAabb.TopRight.x);
+        int const bottom = ToCellY(triangleAabb.BottomLeft.y);
+        int const top = ToCellY(triangleAabb.TopRight.y);
+
+        for (int y = bottom; y <= top; ++y)
+        {
+            for (int x = left; x <= right; ++x)
+            {
+                mEntries.push_back({ static_cast<ElementIndex>(y * mWidth + x), triangleIndex });
+            }
+        }
+    }
+
+    /*
+     * Completes the build, making the grid ready for queries.
+     */
+    void EndBuild()
+    {
+        //
+        // Counting sort of entries by cell
+        //
+
+        size_t const cellCount = static_cast<size_t>(mWidth) * static_cast<size_t>(mHeight);
+
+        mCellStarts.assign(cellCount + 1, 0);
+        for (auto const & entry : mEntries)
+        {
+            ++mCellStarts[entry.CellIndex + 1];
+        }
+
+        for (size_t c = 1; c <= cellCount; ++c)
+        {
+            mCellStarts[c] += mCellStarts[c - 1];
+        }
+
+        // Scatter, using the cell starts as cursors; at the end each
+        // cursor is at the start of the next cell
+        mTriangleIndices.resize(mEntries.size());
+        for (auto const & entry : mEntries)
+        {
+            mTriangleIndices[mCellStarts[entry.CellIndex]++] = entry.TriangleIndex;
+        }
+
+        for (size_t c = cellCount; c > 0; --c)
+        {
+            mCellStarts[c] = mCellStarts[c - 1];
+        }
+
+        mCellStarts[0] = 0;
+
+        mEntries.clear();
+    }
+
+    /*
+     * Visits the triangles binned in the cell containing the specified point, until
+     * the visitor returns true; returns whether or not the visitor did so.
+     */
+    template<typename TVisitor>
+    inline bool VisitCandidates(
+        vec2f const & point,
+        TVisitor && visitor) const
+    {
+        if (!mRegion.Contains(point))
+        {
+            return false;
+        }
+
+        size_t const cellIndex = static_cast<size_t>(ToCellY(point.y)) * static_cast<size_t>(mWidth) + static_cast<size_t>(ToCellX(point.x));
+        assert(cellIndex + 1 < mCellStarts.size());
+
+        for (ElementIndex i = mCellStarts[cellIndex]; i < mCellStarts[cellIndex + 1]; ++i)
+        {
+            if (visitor(mTriangleIndices[i]))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+
+    inline int ToCellX(float x) const noexcept
+    {
+        return std::clamp(static_cast<int>((x - mRegion.BottomLeft.x) * mInverseCellSize), 0, mWidth - 1);
+    }
+
+    inline int ToCellY(float y) const noexcept
+    {
+        return std::clamp(static_cast<int>((y - mRegion.BottomLeft.y) * mInverseCellSize), 0, mHeight - 1);
+    }
+
+    AABB mRegion;
+    float mInverseCellSize;
+    int mWidth;
+    int mHeight;
+
+    // Triangle indices, by cell; the triangles of cell c are
+    // at [mCellStarts[c], mCellStarts[c + 1])
+    std::vector<ElementIndex> mCellStarts;
+    std::vector<ElementIndex> mTriangleIndices;
+
+    // Build-time storage
+    struct Entry
+    {
+        ElementIndex CellIndex;
+        ElementIndex TriangleIndex;
+    };
+
+    std::vector<Entry> mEntries;
+};
+
+}
@@ -20,6 +20,7 @@
 #include <Game/GameVersion.h>
 
 #include <Core/BuildInfo.h>
+#include <Core/CpuTopology.h>
 #include <Core/Log.h>
 #include <Core/SysSpecifics.h>
 #include <Core/ThreadManager.h>
@@ -124,7 +125,7 @@ public:
 
 private:
 
-    static std::vector<ThreadManager::CpuInfo> MakeCpuResources();
+    std::vector<ThreadManager::CpuInfo> MakeCpuResources();
 
     bool RunSecretTypingStateMachine(wxKeyEvent const & keyEvent);
 
@@ -135,6 +136,10 @@ private:
     std::unique_ptr<ThreadManager> mThreadManager;
     std::unique_ptr<LocalizationManager> mLocalizationManager;
 
+    // Whether the CPU resources have been made from the CPU topology, in which case
+    // we also pin threads to CPUs
+    bool mHasCpuTopology;
+
 
     //
     // Secret typing state machine
@@ -153,6 +158,7 @@ IMPLEMENT_APP(MainApp);
 MainApp::MainApp()
     : mMainFrame(nullptr)
     , mLocalizationManager()
+    , mHasCpuTopology(false)
 {
     //
     // Bootstrap log
@@ -269,9 +275,14 @@ bool MainApp::OnInit()
             cpuResources,
             [this](ThreadManager::ThreadTaskKind threadTaskKind, std::optional<size_t> cpuId, size_t threadTaskIndex, std::string const & threadName)
             {
-                // No platform-specific initialization for PC
                 LogMessage("  Thread type ", int(threadTaskKind), ": cpu=", cpuId.has_value() ? std::to_string(*cpuId) : "N/A",
                     " index=", threadTaskIndex, " name=", threadName);
+
+                // Pin to CPU, on platforms where we know the CPU topology
+                if (cpuId.has_value() && mHasCpuTopology)
+                {
+                    ThreadManager::SetThisThreadAffinity(*cpuId);
+                }
             });
 
         //
@@ -430,6 +441,17 @@ int MainApp::FilterEvent(wxEvent & event)
 
 std::vector<ThreadManager::CpuInfo> MainApp::MakeCpuResources()
 {
+    auto const cpuTopology = CpuTopology::Load();
+    if (cpuTopology.has_value())
+    {
+        auto cpuResources = cpuTopology->MakeCpuResources();
+        if (!cpuResources.empty() && cpuResources.size() <= ThreadManager::GetNumberOfProcessors())
+        {
+            mHasCpuTopology = true;
+            return cpuResources;
+        }
+    }
+
     std::vector<ThreadManager::CpuInfo> cpuResources;
 
     for (size_t c = 0; c < ThreadManager::GetNumberOfProcessors(); ++c)
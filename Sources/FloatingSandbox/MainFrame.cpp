@@ -15,11 +15,13 @@
 #include <UILib/ShipDescriptionDialog.h>
 #include <UILib/WxHelpers.h>
 
+#include <Game/FileStreams.h>
 #include <Game/GameVersion.h>
 
 #include <Core/GameExceptions.h>
 #include <Core/Log.h>
 
+#include <wx/filedlg.h>
 #include <wx/intl.h>
 #include <wx/msgdlg.h>
 #include <wx/panel.h>
@@ -33,6 +35,7 @@
 #include <ctime>
 #include <iomanip>
 #include <map>
+#include <random>
 #include <sstream>
 #include <thread>
 
@@ -50,6 +53,10 @@ long const ID_LOAD_SHIP_MENUITEM = wxNewId();
 long const ID_RELOAD_CURRENT_SHIP_MENUITEM = wxNewId();
 long const ID_RELOAD_PREVIOUS_SHIP_MENUITEM = wxNewId();
 long const ID_MORE_SHIPS_MENUITEM = wxNewId();
+long const ID_START_RECORDING_INPUT_MENUITEM = wxNewId();
+long const ID_STOP_RECORDING_INPUT_MENUITEM = wxNewId();
+long const ID_REPLAY_INPUT_MENUITEM = wxNewId();
+long const ID_STOP_REPLAYING_INPUT_MENUITEM = wxNewId();
 long const ID_SAVE_SCREENSHOT_MENUITEM = wxNewId();
 long const ID_OPEN_SCREENSHOT_FOLDER_MENUITEM = wxNewId();
 long const ID_QUIT_MENUITEM = wxNewId();
@@ -68,6 +75,8 @@ long const ID_TIME_OF_DAY_DOWN_MENUITEM = wxNewId();
 long const ID_FULL_TIME_OF_DAY_MENUITEM = wxNewId();
 long const ID_PAUSE_MENUITEM = wxNewId();
 long const ID_STEP_MENUITEM = wxNewId();
+long const ID_FAST_FORWARD_MENUITEM = wxNewId();
+long const ID_STOP_FAST_FORWARD_MENUITEM = wxNewId();
 
 long const ID_RCBOMBDETONATE_MENUITEM = wxNewId();
 long const ID_ANTIMATTERBOMBDETONATE_MENUITEM = wxNewId();
@@ -276,6 +285,26 @@ MainFrame::MainFrame(
 
             fileMenu->AppendSeparator();
 
+            mStartRecordingInputMenuItem = new wxMenuItem(fileMenu, ID_START_RECORDING_INPUT_MENUITEM, _("Start Recording Input"), _("Reload the current ship and record all input, for replaying it later"), wxITEM_NORMAL);
+            fileMenu->Append(mStartRecordingInputMenuItem);
+            fileMenu->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent &) { StartRecordingInput(); }, ID_START_RECORDING_INPUT_MENUITEM);
+
+            mStopRecordingInputMenuItem = new wxMenuItem(fileMenu, ID_STOP_RECORDING_INPUT_MENUITEM, _("Stop Recording Input..."), _("Stop recording input and save the recording"), wxITEM_NORMAL);
+            fileMenu->Append(mStopRecordingInputMenuItem);
+            fileMenu->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent &) { StopRecordingInput(); }, ID_STOP_RECORDING_INPUT_MENUITEM);
+            mStopRecordingInputMenuItem->Enable(false);
+
+            mReplayInputMenuItem = new wxMenuItem(fileMenu, ID_REPLAY_INPUT_MENUITEM, _("Replay Input..."), _("Open an input recording and replay it"), wxITEM_NORMAL);
+            fileMenu->Append(mReplayInputMenuItem);
+            fileMenu->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent &) { ReplayInput(); }, ID_REPLAY_INPUT_MENUITEM);
+
+            mStopReplayingInputMenuItem = new wxMenuItem(fileMenu, ID_STOP_REPLAYING_INPUT_MENUITEM, _("Stop Replaying Input"), _("Stop replaying input and resume playing"), wxITEM_NORMAL);
+            fileMenu->Append(mStopReplayingInputMenuItem);
+            fileMenu->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent &) { assert(!!mGameController); mGameController->StopReplayingInput(); }, ID_STOP_REPLAYING_INPUT_MENUITEM);
+            mStopReplayingInputMenuItem->Enable(false);
+
+            fileMenu->AppendSeparator();
+
             wxMenuItem * saveScreenshotMenuItem = new wxMenuItem(fileMenu, ID_SAVE_SCREENSHOT_MENUITEM, _("Save Screenshot") + wxS("\tCtrl+C"), wxEmptyString, wxITEM_NORMAL);
             fileMenu->Append(saveScreenshotMenuItem);
             Connect(ID_SAVE_SCREENSHOT_MENUITEM, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&MainFrame::OnSaveScreenshotMenuItemSelected);
@@ -386,6 +415,15 @@ MainFrame::MainFrame(
             Connect(ID_STEP_MENUITEM, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&MainFrame::OnStepMenuItemSelected);
             mStepMenuItem->Enable(false);
 
+            wxMenuItem * fastForwardMenuItem = new wxMenuItem(controlsMenu, ID_FAST_FORWARD_MENUITEM, _("Fast-Forward One Minute"), _("Simulate one minute without rendering"), wxITEM_NORMAL);
+            controlsMenu->Append(fastForwardMenuItem);
+            Connect(ID_FAST_FORWARD_MENUITEM, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&MainFrame::OnFastForwardMenuItemSelected);
+
+            mStopFastForwardMenuItem = new wxMenuItem(controlsMenu, ID_STOP_FAST_FORWARD_MENUITEM, _("Stop Fast-Forward"), _("Stop fast-forwarding and resume rendering"), wxITEM_NORMAL);
+            controlsMenu->Append(mStopFastForwardMenuItem);
+            Connect(ID_STOP_FAST_FORWARD_MENUITEM, wxEVT_COMMAND_MENU_SELECTED, (wxObjectEventFunction)&MainFrame::OnStopFastForwardMenuItemSelected);
+            mStopFastForwardMenuItem->Enable(false);
+
             mainMenuBar->Append(controlsMenu, _("&Controls"));
         }
 
@@ -1959,6 +1997,20 @@ void MainFrame::OnStepMenuItemSelected(wxCommandEvent & /*event*/)
     mGameController->PulseUpdateAtNextGameIteration();
 }
 
+void MainFrame::OnFastForwardMenuItemSelected(wxCommandEvent & /*event*/)
+{
+    assert(!!mGameController);
+
+    mGameController->StartFastForward(60.0f);
+}
+
+void MainFrame::OnStopFastForwardMenuItemSelected(wxCommandEvent & /*event*/)
+{
+    assert(!!mGameController);
+
+    mGameController->StopFastForward();
+}
+
 void MainFrame::OnAddHumanNpcGroupMenuItemSelected(wxCommandEvent & /*event*/)
 {
     assert(!!mGameController);
@@ -2832,6 +2884,28 @@ void MainFrame::ReconciliateUIWithAutoFocusTarget(std::optional<AutoFocusTargetK
     }
 }
 
+void MainFrame::ReconciliateUIWithInputRecording()
+{
+    assert(!!mGameController);
+    bool const isRecording = mGameController->IsRecordingInput();
+    bool const isReplaying = mGameController->IsReplayingInput();
+
+    mStartRecordingInputMenuItem->Enable(!isRecording && !isReplaying);
+    mStopRecordingInputMenuItem->Enable(isRecording);
+    mReplayInputMenuItem->Enable(!isRecording && !isReplaying);
+    mStopReplayingInputMenuItem->Enable(isReplaying);
+
+    // Tools would be ignored while replaying
+    wxMenuBar * const menuBar = GetMenuBar();
+    for (size_t m = 0; m < menuBar->GetMenuCount(); ++m)
+    {
+        if (menuBar->GetMenu(m) == mNonNpcToolsMenu || menuBar->GetMenu(m) == mNpcToolsMenu)
+        {
+            menuBar->EnableTop(m, !isReplaying);
+        }
+    }
+}
+
 void MainFrame::ReconciliateShipViewModeWithCurrentTool()
 {
     assert(!!mToolController);
@@ -2991,6 +3065,21 @@ std::filesystem::path MainFrame::ChooseDefaultShip(GameAssetManager const & game
 void MainFrame::LoadShip(
     ShipLoadSpecifications const & loadSpecs,
     bool isFromUser)
+{
+    LoadShip(
+        loadSpecs,
+        isFromUser,
+        [&]()
+        {
+            assert(mGameController);
+            return mGameController->ResetAndLoadShip(loadSpecs, mGameAssetManager);
+        });
+}
+
+void MainFrame::LoadShip(
+    ShipLoadSpecifications const & loadSpecs,
+    bool isFromUser,
+    std::function<ShipMetadata()> const & resetAndLoadShip)
 {
     //
     // Reset
@@ -3014,8 +3103,7 @@ void MainFrame::LoadShip(
     try
     {
         // Load
-        assert(mGameController);
-        auto const shipMetadata = mGameController->ResetAndLoadShip(loadSpecs, mGameAssetManager);
+        auto const shipMetadata = resetAndLoadShip();
 
         // Succeeded
         OnShipLoaded(loadSpecs);
@@ -3061,6 +3149,99 @@ void MainFrame::ReloadCurrentShip()
     LoadShip(*mCurrentShipLoadSpecs, false);
 }
 
+void MainFrame::StartRecordingInput()
+{
+    if (!mCurrentShipLoadSpecs.has_value())
+    {
+        return;
+    }
+
+    // Recordings start from the current ship, reloaded
+    ShipLoadSpecifications const loadSpecs = *mCurrentShipLoadSpecs;
+    std::uint32_t const seed = std::random_device()();
+
+    LoadShip(
+        loadSpecs,
+        false,
+        [&]()
+        {
+            assert(mGameController);
+            return mGameController->StartRecordingInput(loadSpecs, mGameAssetManager, seed);
+        });
+
+    ReconciliateUIWithInputRecording();
+}
+
+void MainFrame::StopRecordingInput()
+{
+    assert(mGameController);
+    InputRecording const recording = mGameController->StopRecordingInput();
+
+    ReconciliateUIWithInputRecording();
+
+    wxFileDialog saveDialog(
+        this,
+        _("Save Input Recording"),
+        wxEmptyString,
+        "recording.fsrec",
+        "Input recordings (*.fsrec)|*.fsrec",
+        wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+
+    if (saveDialog.ShowModal() == wxID_OK)
+    {
+        try
+        {
+            FileBinaryWriteStream outputStream(std::filesystem::path(saveDialog.GetPath().ToStdString()));
+            recording.SaveToStream(outputStream);
+        }
+        catch (std::exception const & ex)
+        {
+            OnError(ex.what(), false);
+        }
+    }
+}
+
+void MainFrame::ReplayInput()
+{
+    wxFileDialog openDialog(
+        this,
+        _("Replay Input Recording"),
+        wxEmptyString,
+        wxEmptyString,
+        "Input recordings (*.fsrec)|*.fsrec",
+        wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+
+    if (openDialog.ShowModal() != wxID_OK)
+    {
+        return;
+    }
+
+    std::optional<InputRecording> recording;
+
+    try
+    {
+        FileBinaryReadStream inputStream(std::filesystem::path(openDialog.GetPath().ToStdString()));
+        recording.emplace(InputRecording::LoadFromStream(inputStream));
+    }
+    catch (std::exception const & ex)
+    {
+        OnError(ex.what(), false);
+        return;
+    }
+
+    ShipLoadSpecifications const loadSpecs = recording->ShipLoadSpecs;
+
+    // Menu items are reconciled by the replay's start and end events
+    LoadShip(
+        loadSpecs,
+        false,
+        [&]()
+        {
+            assert(mGameController);
+            return mGameController->StartReplayingInput(std::move(*recording), mGameAssetManager);
+        });
+}
+
 void MainFrame::OnShipLoaded(ShipLoadSpecifications loadSpecs)
 {
     //
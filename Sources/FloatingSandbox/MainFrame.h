@@ -46,6 +46,7 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -126,6 +127,10 @@ private:
 
     wxBoxSizer * mMainPanelSizer;
     wxMenuItem * mReloadPreviousShipMenuItem;
+    wxMenuItem * mStartRecordingInputMenuItem;
+    wxMenuItem * mStopRecordingInputMenuItem;
+    wxMenuItem * mReplayInputMenuItem;
+    wxMenuItem * mStopReplayingInputMenuItem;
     wxMenuItem * mAutoFocusAtShipLoadMenuItem;
     wxMenuItem * mContinuousAutoFocusOnShipMenuItem;
     wxMenuItem * mContinuousAutoFocusOnSelectedNpcMenuItem;
@@ -134,6 +139,7 @@ private:
     wxMenuItem * mShipViewInteriorMenuItem;
     wxMenuItem * mPauseMenuItem;
     wxMenuItem * mStepMenuItem;
+    wxMenuItem * mStopFastForwardMenuItem;
 
     wxMenu * mNonNpcToolsMenu;
     wxMenuItem * mScareFishMenuItem;
@@ -234,6 +240,8 @@ private:
     void OnFullTimeOfDayMenuItemSelected(wxCommandEvent & event);
     void OnPauseMenuItemSelected(wxCommandEvent & event);
     void OnStepMenuItemSelected(wxCommandEvent & event);
+    void OnFastForwardMenuItemSelected(wxCommandEvent & event);
+    void OnStopFastForwardMenuItemSelected(wxCommandEvent & event);
     void OnLoadShipMenuItemSelected(wxCommandEvent & event);
     void OnReloadPreviousShipMenuItemSelected(wxCommandEvent & event);
     void OnSaveScreenshotMenuItemSelected(wxCommandEvent & event);
@@ -366,6 +374,26 @@ private:
         ReconciliateUIWithAutoFocusTarget(target);
     }
 
+    void OnFastForwardStarted() override
+    {
+        mStopFastForwardMenuItem->Enable(true);
+    }
+
+    void OnFastForwardEnded() override
+    {
+        mStopFastForwardMenuItem->Enable(false);
+    }
+
+    void OnInputReplayStarted() override
+    {
+        ReconciliateUIWithInputRecording();
+    }
+
+    void OnInputReplayEnded() override
+    {
+        ReconciliateUIWithInputRecording();
+    }
+
 private:
 
     void RunGameIteration();
@@ -432,6 +460,7 @@ private:
     void ReconciliateUIWithNpcSelection(bool areNpcsSelected);
     void ReconciliateAddNpcSubItems(ToolType toolType);
     void ReconciliateUIWithAutoFocusTarget(std::optional<AutoFocusTargetKindType> target);
+    void ReconciliateUIWithInputRecording();
     void ReconciliateShipViewModeWithCurrentTool();
 
     void RebuildNpcMenus();
@@ -442,8 +471,19 @@ private:
         ShipLoadSpecifications const & loadSpecs,
         bool isFromUser);
 
+    void LoadShip(
+        ShipLoadSpecifications const & loadSpecs,
+        bool isFromUser,
+        std::function<ShipMetadata()> const & resetAndLoadShip);
+
     void ReloadCurrentShip();
 
+    void StartRecordingInput();
+
+    void StopRecordingInput();
+
+    void ReplayInput();
+
     void OnShipLoaded(ShipLoadSpecifications loadSpecs); // By val to have own copy vs current/prev
 
     wxAcceleratorEntry MakePlainAcceleratorKey(int key, wxMenuItem * menuItem);
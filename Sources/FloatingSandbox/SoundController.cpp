@@ -47,6 +47,7 @@ SoundController::SoundController(
     , mPlayStressSounds(true)
     , mPlayWindSound(true)
     , mPlayAirBubbleSurfaceSound(true)
+    , mIsFastForwarding(false)
     , mLastWindSpeedAbsoluteMagnitude(0.0f)
     , mWindVolumeRunningAverage()
     , mLastWaterSplashed(0.0f)
@@ -1902,6 +1903,16 @@ void SoundController::OnTsunamiNotification(float /*x*/)
         true);
 }
 
+void SoundController::OnFastForwardStarted()
+{
+    mIsFastForwarding = true;
+}
+
+void SoundController::OnFastForwardEnded()
+{
+    mIsFastForwarding = false;
+}
+
 void SoundController::OnPointCombustionBegin()
 {
     mFireBurningSound.AddAggregateVolume();
@@ -3224,6 +3235,11 @@ void SoundController::PlayOneShotSound(
     float volume,
     bool isInterruptible)
 {
+    if (mIsFastForwarding)
+    {
+        return;
+    }
+
     //
     // Make sure there isn't already a "fungible" sound that started playing too recently;
     // if there is, just add to its volume
@@ -220,6 +220,10 @@ public:
 
     void OnTsunamiNotification(float x) override;
 
+    void OnFastForwardStarted() override;
+
+    void OnFastForwardEnded() override;
+
     void OnPointCombustionBegin() override;
 
     void OnPointCombustionEnd() override;
@@ -540,6 +544,9 @@ private:
     bool mPlayWindSound;
     bool mPlayAirBubbleSurfaceSound;
 
+    // While fast-forwarding we play no one-shot sounds, as their events come in bursts
+    bool mIsFastForwarding;
+
     float mLastWindSpeedAbsoluteMagnitude;
     RunningAverage<70> mWindVolumeRunningAverage;
 
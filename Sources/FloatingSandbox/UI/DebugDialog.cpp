@@ -5,6 +5,11 @@
  ***************************************************************************************/
 #include "DebugDialog.h"
 
+#include <Game/GameAssetManager.h>
+
+#include <Core/Profiler.h>
+
+#include <wx/filedlg.h>
 #include <wx/gbsizer.h>
 #include <wx/notebook.h>
 #include <wx/settings.h>
@@ -78,6 +83,19 @@ DebugDialog::DebugDialog(
     }
 
 
+    //
+    // Profiling
+    //
+
+    {
+        wxPanel * profilingPanel = new wxPanel(notebook);
+
+        PopulateProfilingPanel(profilingPanel);
+
+        notebook->AddPage(profilingPanel, _("Profiling"));
+    }
+
+
     //
     // Finalize dialog
     //
@@ -370,5 +388,74 @@ void DebugDialog::PopulateEventRecordingPanel(wxPanel * panel)
 
     // Finalize panel
 
+    panel->SetSizerAndFit(gridSizer);
+}
+
+void DebugDialog::PopulateProfilingPanel(wxPanel * panel)
+{
+    wxGridBagSizer * gridSizer = new wxGridBagSizer(0, 0);
+
+    {
+        mProfilingStartButton = new wxButton(panel, wxID_ANY, _("Start"));
+
+        mProfilingStartButton->Bind(
+            wxEVT_BUTTON,
+            [this](wxCommandEvent &)
+            {
+                mProfilingStartButton->Enable(false);
+                mProfilingStopButton->Enable(true);
+
+                Profiler::GetInstance().Clear();
+                Profiler::GetInstance().Enable();
+            });
+
+        gridSizer->Add(
+            mProfilingStartButton,
+            wxGBPosition(0, 0),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    {
+        mProfilingStopButton = new wxButton(panel, wxID_ANY, _("Stop and Save..."));
+
+        mProfilingStopButton->Enable(false);
+
+        mProfilingStopButton->Bind(
+            wxEVT_BUTTON,
+            [this](wxCommandEvent &)
+            {
+                mProfilingStartButton->Enable(true);
+                mProfilingStopButton->Enable(false);
+
+                Profiler::GetInstance().Disable();
+
+                wxFileDialog saveDialog(
+                    this,
+                    _("Save Trace"),
+                    wxEmptyString,
+                    "trace.json",
+                    "Chrome trace files (*.json)|*.json",
+                    wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+
+                if (saveDialog.ShowModal() == wxID_OK)
+                {
+                    GameAssetManager::SaveJson(
+                        Profiler::GetInstance().ExportChromeTrace(),
+                        std::filesystem::path(saveDialog.GetPath().ToStdString()));
+                }
+            });
+
+        gridSizer->Add(
+            mProfilingStopButton,
+            wxGBPosition(0, 1),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    // Finalize panel
+
     panel->SetSizerAndFit(gridSizer);
 }
\ No newline at end of file
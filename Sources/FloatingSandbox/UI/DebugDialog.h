@@ -32,6 +32,7 @@ private:
 
     void PopulateTrianglesPanel(wxPanel * panel);
     void PopulateEventRecordingPanel(wxPanel * panel);
+    void PopulateProfilingPanel(wxPanel * panel);
 
     inline void SetRecordedEventText(
         uint32_t eventIndex,
@@ -52,6 +53,8 @@ private:
     wxButton * mRecordEventStopButton;
     wxButton * mRecordEventStepButton;
     wxButton * mRecordEventRewindButton;
+    wxButton * mProfilingStartButton;
+    wxButton * mProfilingStopButton;
 
 private:
 
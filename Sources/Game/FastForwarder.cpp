@@ -0,0 +1,49 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "FastForwarder.h"
+
+#include <Simulation/SimulationParameters.h>
+
+#include <Core/GameWallClock.h>
+
+#include <cmath>
+
+bool FastForwarder::Start(float simulationDuration)
+{
+    size_t const stepCount = static_cast<size_t>(std::round(simulationDuration / SimulationParameters::SimulationStepTimeDuration<float>));
+    if (stepCount == 0)
+    {
+        return false;
+    }
+
+    mRemainingStepCount = stepCount;
+
+    EnsureDeterministicMode();
+
+    return true;
+}
+
+void FastForwarder::Stop()
+{
+    mRemainingStepCount = 0;
+
+    if (mHasEnteredDeterministicMode)
+    {
+        GameWallClock::GetInstance().ExitDeterministicMode();
+        mHasEnteredDeterministicMode = false;
+    }
+}
+
+void FastForwarder::EnsureDeterministicMode()
+{
+    auto & wallClock = GameWallClock::GetInstance();
+    if (!wallClock.IsDeterministic())
+    {
+        // Keep float times flowing from where they are
+        wallClock.EnterDeterministicMode(false);
+        mHasEnteredDeterministicMode = true;
+    }
+}
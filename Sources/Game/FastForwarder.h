@@ -0,0 +1,105 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Core/GameChronometer.h>
+
+#include <cassert>
+#include <cstddef>
+
+/*
+ * Runs the simulation for a given amount of simulation time without rendering it,
+ * with steps run back-to-back in batches.
+ *
+ * This is shared by the game and by headless simulations, which only differ in what
+ * they do at each step and how long they let each batch run for.
+ *
+ * While fast-forwarding the wall clock is kept in deterministic mode, so that it moves
+ * forward by exactly one simulation step at each step - exactly as it would if the
+ * steps were run at the normal pace. If the wall clock was not deterministic already,
+ * deterministic mode is entered without rebasing float times, and it is exited once
+ * fast-forwarding ends.
+ */
+class FastForwarder final
+{
+public:
+
+    FastForwarder()
+        : mRemainingStepCount(0)
+        , mHasEnteredDeterministicMode(false)
+    {}
+
+    ~FastForwarder()
+    {
+        Stop();
+    }
+
+    FastForwarder(FastForwarder const &) = delete;
+    FastForwarder & operator=(FastForwarder const &) = delete;
+
+    bool IsFastForwarding() const
+    {
+        return mRemainingStepCount > 0;
+    }
+
+    size_t GetRemainingStepCount() const
+    {
+        return mRemainingStepCount;
+    }
+
+    /*
+     * Starts fast-forwarding for the specified simulation time, replacing whatever
+     * was left of a fast-forward in progress.
+     *
+     * Returns false - and does nothing - if the time does not amount to any steps.
+     */
+    bool Start(float simulationDuration);
+
+    void Stop();
+
+    /*
+     * Runs steps back-to-back until either fast-forwarding is completed, or the specified
+     * real time has elapsed; at least one step is always run. The step function is expected
+     * to advance the wall clock when it is deterministic, and it may stop fast-forwarding.
+     *
+     * Returns the number of steps run.
+     */
+    template<typename TStepFunction>
+    size_t RunSteps(
+        TStepFunction && runStep,
+        GameChronometer::duration maxDuration)
+    {
+        assert(IsFastForwarding());
+
+        auto const startTime = GameChronometer::Now();
+        size_t stepCount = 0;
+        do
+        {
+            // A step may have ended a deterministic session
+            EnsureDeterministicMode();
+
+            --mRemainingStepCount;
+            runStep();
+            ++stepCount;
+        } while (mRemainingStepCount > 0 && GameChronometer::Now() - startTime < maxDuration);
+
+        if (mRemainingStepCount == 0)
+        {
+            Stop();
+        }
+
+        return stepCount;
+    }
+
+private:
+
+    void EnsureDeterministicMode();
+
+private:
+
+    size_t mRemainingStepCount;
+    bool mHasEnteredDeterministicMode;
+};
@@ -35,6 +35,21 @@ GameAssetManager::GameAssetManager(std::string const && argv0)
     assert(std::filesystem::exists(mShaderRoot));
 }
 
+GameAssetManager::GameAssetManager(
+	std::filesystem::path const & gameRoot,
+	std::filesystem::path const & dataRoot)
+	: mGameRoot(gameRoot)
+	, mDataRoot(dataRoot)
+	, mResourcesRoot(mDataRoot / "Resources")
+	, mTextureRoot(mDataRoot / "Textures")
+	, mShaderRoot(mDataRoot / "Shaders")
+{
+	if (!std::filesystem::exists(mDataRoot))
+	{
+		throw GameException("Cannot find game data at \"" + mDataRoot.string() + "\"");
+	}
+}
+
 GameAssetManager::GameAssetManager(std::filesystem::path const & textureRoot)
 	: mDataRoot(textureRoot) // Just because (not needed in this scenario)
 	, mTextureRoot(textureRoot)
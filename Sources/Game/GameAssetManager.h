@@ -21,6 +21,12 @@ public:
 
 	explicit GameAssetManager(std::filesystem::path const & textureRoot);
 
+	// For tools that do not run from within the game's installation
+	static GameAssetManager FromGameRoot(std::filesystem::path const & gameRoot)
+	{
+		return GameAssetManager(gameRoot, gameRoot / "Data");
+	}
+
 	//
 	// IAssetManager
 	//
@@ -156,6 +162,10 @@ public:
 
 private:
 
+	GameAssetManager(
+		std::filesystem::path const & gameRoot,
+		std::filesystem::path const & dataRoot);
+
 	std::filesystem::path MakeMaterialTexturesRootPath() const
 	{
 		return mTextureRoot / "Material";
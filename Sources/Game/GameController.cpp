@@ -13,9 +13,12 @@
 #include <Render/GameTextureDatabases.h>
 
 #include <Core/Conversions.h>
+#include <Core/GameRandomEngine.h>
 #include <Core/Log.h>
+#include <Core/Profiler.h>
 #include <Core/TextureAtlas.h>
 
+#include <cmath>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
@@ -97,6 +100,7 @@ GameController::GameController(
     , mIsPaused(false)
     , mIsPulseUpdateSet(false)
     , mIsMoveToolEngaged(false)
+    , mFastForwarder()
     // Parameters that we own
     , mTimeOfDay(0.0f) // We'll set it later
     , mIsShiftOn(false)
@@ -118,6 +122,11 @@ GameController::GameController(
         mSimulationEventDispatcher)
     , mThreadManager(threadManager)
     , mViewManager(mAutoFocusTarget, *mRenderContext)
+    , mInputRecorder()
+    , mInputReplayer()
+    , mInputReplayAssetManager(nullptr)
+    , mPreReplaySimulationParallelism()
+    , mIsDeterministicSession(false)
     // Smoothing
     , mFloatParameterSmoothers()
     // Stats
@@ -126,6 +135,7 @@ GameController::GameController(
     , mOriginTimestampGame(GameWallClock::GetInstance().Now())
     , mTotalPerfStats(std::move(perfStats))
     , mLastPublishedTotalPerfStats()
+    , mLatencyWindowPublishedTotalPerfStats()
     , mTotalFrameCount(0u)
     , mLastPublishedTotalFrameCount(0u)
     , mSkippedFirstStatPublishes(0)
@@ -329,19 +339,44 @@ ShipMetadata GameController::ResetAndLoadShip(
     ShipLoadSpecifications const & loadSpecs,
     IAssetManager const & assetManager)
 {
-    return InternalResetAndLoadShip(loadSpecs, assetManager);
+    EndReplayOnLiveShipLoad();
+
+    auto shipMetadata = InternalResetAndLoadShip(loadSpecs, assetManager, mWorld->GetOceanFloorHeightMap());
+
+    RecordShipLoad(loadSpecs, true);
+
+    return shipMetadata;
 }
 
 ShipMetadata GameController::ResetAndReloadShip(
     ShipLoadSpecifications const & loadSpecs,
     IAssetManager const & assetManager)
 {
-    return InternalResetAndLoadShip(loadSpecs, assetManager);
+    EndReplayOnLiveShipLoad();
+
+    auto shipMetadata = InternalResetAndLoadShip(loadSpecs, assetManager, mWorld->GetOceanFloorHeightMap());
+
+    RecordShipLoad(loadSpecs, true);
+
+    return shipMetadata;
 }
 
 ShipMetadata GameController::AddShip(
     ShipLoadSpecifications const & loadSpecs,
     IAssetManager const & assetManager)
+{
+    EndReplayOnLiveShipLoad();
+
+    auto shipMetadata = InternalLoadAndAddShip(loadSpecs, assetManager);
+
+    RecordShipLoad(loadSpecs, false);
+
+    return shipMetadata;
+}
+
+ShipMetadata GameController::InternalLoadAndAddShip(
+    ShipLoadSpecifications const & loadSpecs,
+    IAssetManager const & assetManager)
 {
     // Load ship definition
     auto shipDefinition = ShipDeSerializer::LoadShip(loadSpecs.DefinitionFilepath, mMaterialDatabase);
@@ -371,7 +406,7 @@ ShipMetadata GameController::AddShip(
         mShipStrengthRandomizer,
         mSimulationEventDispatcher,
         assetManager,
-        mSimulationParameters);
+        GetWorldSimulationParameters());
 
     //
     // No errors, so we may continue
@@ -427,60 +462,20 @@ void GameController::RunGameIteration()
 
     if (doUpdate)
     {
-        auto const startTime = GameChronometer::Now();
-
-        // Tell RenderContext we're starting an update
-        // (waits until the last upload has completed)
-        mRenderContext->UpdateStart();
-
-        auto const netStartTime = GameChronometer::Now();
-
-        float const nowGame = GameWallClock::GetInstance().NowAsFloat();
-
-        //
-        // Update parameter smoothers
-        //
+        if (mFastForwarder.IsFastForwarding())
+        {
+            RunFastForwardSteps();
 
-        std::for_each(
-            mFloatParameterSmoothers.begin(),
-            mFloatParameterSmoothers.end(),
-            [](auto & ps)
+            if (mFastForwarder.IsFastForwarding())
             {
-                ps.Update();
-            });
-
-        //
-        // Update world
-        //
-
-        assert(!!mWorld);
-        mWorld->Update(
-            mSimulationParameters,
-            mRenderContext->GetViewModel(),
-            mRenderContext->GetStressRenderMode(),
-            mThreadManager,
-            *mTotalPerfStats);
-
-        // Flush events
-        mSimulationEventDispatcher.Flush();
-        mGameEventDispatcher.Flush();
-
-        //
-        // Update misc
-        //
-
-        // Update state machines
-        UpdateAllStateMachines(mWorld->GetCurrentSimulationTime());
-
-        // Update notification layer
-        mNotificationLayer.Update(nowGame, mWorld->GetCurrentSimulationTime());
-
-        // Tell RenderContext we've finished an update
-        mRenderContext->UpdateEnd();
-
-        auto const endTime = GameChronometer::Now();
-        mTotalPerfStats->Update<PerfMeasurement::TotalNetUpdate>(endTime - netStartTime);
-        mTotalPerfStats->Update<PerfMeasurement::TotalUpdate>(endTime - startTime);
+                // Still fast-forwarding, hence no rendering
+                return;
+            }
+        }
+        else
+        {
+            RunSimulationStep(false);
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -491,6 +486,8 @@ void GameController::RunGameIteration()
     mRenderContext->RenderStart();
 
     {
+        FS_PROFILE_ZONE("GameController::RenderUpload");
+
         mRenderContext->UploadStart();
 
         auto const netStartTime = GameChronometer::Now();
@@ -526,6 +523,8 @@ void GameController::RunGameIteration()
     ////////////////////////////////////////////////////////////////////////////
 
     {
+        FS_PROFILE_ZONE("GameController::RenderDraw");
+
         auto const startTime = GameChronometer::Now();
 
         // Render
@@ -544,6 +543,136 @@ void GameController::RunGameIteration()
     ++mTotalFrameCount;
 }
 
+void GameController::RunSimulationStep(bool isFastForwarding)
+{
+    FS_PROFILE_ZONE("GameController::Update");
+
+    auto const startTime = GameChronometer::Now();
+
+    // Tell RenderContext we're starting an update
+    // (waits until the last upload has completed)
+    mRenderContext->UpdateStart();
+
+    auto const netStartTime = GameChronometer::Now();
+
+    //
+    // Update parameter smoothers
+    //
+    // Before recording, so that smoothed parameters are recorded for the
+    // step they are used in
+    //
+
+    std::for_each(
+        mFloatParameterSmoothers.begin(),
+        mFloatParameterSmoothers.end(),
+        [](auto & ps)
+        {
+            ps.Update();
+        });
+
+    //
+    // Deterministic sessions: feed recorded inputs for this step, or record the
+    // view and parameters for this step; then advance the clock by exactly one step
+    //
+
+    VisibleWorld const * visibleWorld = &(mRenderContext->GetVisibleWorld());
+
+    if (mInputReplayer)
+    {
+        assert(!!mWorld);
+        visibleWorld = &(mInputReplayer->OnSimulationStep(*this));
+    }
+    else if (mInputRecorder)
+    {
+        mInputRecorder->OnSimulationParameters(mSimulationParameters);
+        mInputRecorder->OnSimulationStep(*visibleWorld);
+    }
+
+    if (GameWallClock::GetInstance().IsDeterministic())
+    {
+        GameWallClock::GetInstance().AdvanceDeterministicTime(
+            std::chrono::duration_cast<GameWallClock::duration>(
+                std::chrono::duration<double>(SimulationParameters::SimulationStepTimeDuration<double>)));
+    }
+
+    float const nowGame = GameWallClock::GetInstance().NowAsFloat();
+
+    //
+    // Update world
+    //
+
+    assert(!!mWorld);
+    mWorld->Update(
+        GetWorldSimulationParameters(),
+        *visibleWorld,
+        mRenderContext->GetStressRenderMode(),
+        mThreadManager,
+        *mTotalPerfStats);
+
+    // Flush events - when fast-forwarding, once per iteration instead
+    if (!isFastForwarding)
+    {
+        mSimulationEventDispatcher.Flush();
+        mGameEventDispatcher.Flush();
+    }
+
+    //
+    // Update misc
+    //
+
+    // Update state machines
+    UpdateAllStateMachines(mWorld->GetCurrentSimulationTime());
+
+    // Update notification layer - when fast-forwarding, once per iteration instead
+    if (!isFastForwarding)
+    {
+        mNotificationLayer.Update(nowGame, mWorld->GetCurrentSimulationTime());
+    }
+
+    // Tell RenderContext we've finished an update
+    mRenderContext->UpdateEnd();
+
+    // Check whether we've reached the end of the replay
+    if (mInputReplayer && mInputReplayer->IsCompleted())
+    {
+        auto const isFinalStateMatching = mInputReplayer->OnCompleted(*this);
+
+        StopReplayingInput();
+
+        mNotificationLayer.PublishNotificationText(isFinalStateMatching == false ? "REPLAY COMPLETED - STATE DIVERGED" : "REPLAY COMPLETED");
+    }
+
+    auto const endTime = GameChronometer::Now();
+    mTotalPerfStats->Update<PerfMeasurement::TotalNetUpdate>(endTime - netStartTime);
+    mTotalPerfStats->Update<PerfMeasurement::TotalUpdate>(endTime - startTime);
+}
+
+void GameController::RunFastForwardSteps()
+{
+    FS_PROFILE_ZONE("GameController::FastForward");
+
+    // Run steps back-to-back, but only for so long at each iteration,
+    // so that the UI keeps being responsive
+    mFastForwarder.RunSteps(
+        [this]()
+        {
+            RunSimulationStep(true);
+        },
+        FastForwardIterationDuration);
+
+    // Catch up with what we've deferred
+    mSimulationEventDispatcher.Flush();
+    mGameEventDispatcher.Flush();
+    mNotificationLayer.Update(GameWallClock::GetInstance().NowAsFloat(), mWorld->GetCurrentSimulationTime());
+
+    if (!mFastForwarder.IsFastForwarding())
+    {
+        mGameEventDispatcher.OnFastForwardEnded();
+
+        mNotificationLayer.PublishNotificationText("FAST-FORWARD COMPLETED");
+    }
+}
+
 void GameController::LowFrequencyUpdate()
 {
     std::chrono::steady_clock::time_point const nowReal = std::chrono::steady_clock::now();
@@ -573,9 +702,35 @@ void GameController::LowFrequencyUpdate()
     mStatsLastTimestampReal = nowReal;
 
     mLastPublishedTotalPerfStats = *mTotalPerfStats;
+
+    mLatencyWindowPublishedTotalPerfStats.push_back(*mTotalPerfStats);
+    if (mLatencyWindowPublishedTotalPerfStats.size() > LatencyWindowPublishCount)
+    {
+        mLatencyWindowPublishedTotalPerfStats.pop_front();
+    }
     mLastPublishedTotalFrameCount = mTotalFrameCount;
 }
 
+void GameController::StartFastForward(float simulationDuration)
+{
+    bool const wasFastForwarding = mFastForwarder.IsFastForwarding();
+
+    if (mFastForwarder.Start(simulationDuration) && !wasFastForwarding)
+    {
+        mGameEventDispatcher.OnFastForwardStarted();
+    }
+}
+
+void GameController::StopFastForward()
+{
+    if (mFastForwarder.IsFastForwarding())
+    {
+        mFastForwarder.Stop();
+
+        mGameEventDispatcher.OnFastForwardEnded();
+    }
+}
+
 void GameController::StartRecordingEvents(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback)
 {
     mEventRecorder = std::make_unique<EventRecorder>(onEventCallback);
@@ -602,6 +757,118 @@ void GameController::ReplayRecordedEvent(RecordedEvent const & event)
         mSimulationParameters); // NOTE: using now's game parameters...but we don't want to capture these in the recorded event (at least at this moment)
 }
 
+ShipMetadata GameController::StartRecordingInput(
+    ShipLoadSpecifications const & loadSpecs,
+    IAssetManager const & assetManager,
+    std::uint32_t seed)
+{
+    assert(!mInputRecorder && !mInputReplayer);
+
+    // Capture initial state
+    InputRecording recording(
+        seed,
+        static_cast<std::uint32_t>(mThreadManager.GetSimulationParallelism()),
+        loadSpecs,
+        mSimulationParameters,
+        mWorld->GetOceanFloorHeightMap());
+
+    EnterDeterministicSession(seed);
+
+    ShipMetadata shipMetadata = [&]()
+        {
+            try
+            {
+                return InternalResetAndLoadShip(loadSpecs, assetManager, recording.InitialOceanFloorHeightMap);
+            }
+            catch (...)
+            {
+                ExitDeterministicSession();
+                throw;
+            }
+        }();
+
+    mInputRecorder = std::make_unique<InputRecorder>(std::move(recording));
+
+    return shipMetadata;
+}
+
+InputRecording GameController::StopRecordingInput()
+{
+    assert(!!mInputRecorder);
+
+    auto recording = mInputRecorder->StopRecording();
+    mInputRecorder.reset();
+
+    // Capture the final state, for replays to verify
+    assert(!!mWorld);
+    recording.FinalStateDigests = InputRecording::CalculateStateDigests(*mWorld);
+
+    ExitDeterministicSession();
+
+    return recording;
+}
+
+ShipMetadata GameController::StartReplayingInput(
+    InputRecording && recording,
+    IAssetManager const & assetManager)
+{
+    assert(!mInputRecorder && !mInputReplayer);
+
+    //
+    // Replay with the same parallelism as the recording, restoring ours when done;
+    // while replaying, the world runs with the recording's simulation parameters
+    //
+
+    mPreReplaySimulationParallelism = mThreadManager.GetSimulationParallelism();
+    mThreadManager.SetSimulationParallelism(recording.SimulationParallelism);
+
+    EnterDeterministicSession(recording.Seed);
+
+    mInputReplayer = std::make_unique<InputReplayer>(std::move(recording));
+    mInputReplayAssetManager = &assetManager;
+
+    ShipMetadata shipMetadata = [&]()
+        {
+            try
+            {
+                return InternalResetAndLoadShip(
+                    mInputReplayer->GetRecording().ShipLoadSpecs,
+                    assetManager,
+                    mInputReplayer->GetRecording().InitialOceanFloorHeightMap);
+            }
+            catch (...)
+            {
+                StopReplayingInput();
+                throw;
+            }
+        }();
+
+    mGameEventDispatcher.OnInputReplayStarted();
+
+    return shipMetadata;
+}
+
+void GameController::StopReplayingInput()
+{
+    bool const wasReplaying = !!mInputReplayer;
+
+    mInputReplayer.reset();
+    mInputReplayAssetManager = nullptr;
+
+    if (mPreReplaySimulationParallelism.has_value())
+    {
+        mThreadManager.SetSimulationParallelism(*mPreReplaySimulationParallelism);
+        mPreReplaySimulationParallelism.reset();
+    }
+
+    ExitDeterministicSession();
+
+    if (wasReplaying)
+    {
+        mGameEventDispatcher.OnInputReplayEnded();
+    }
+}
+
 /////////////////////////////////////////////////////////////
 // Interactions
 /////////////////////////////////////////////////////////////
@@ -753,6 +1020,9 @@ std::optional<GlobalElementId> GameController::PickObjectForPickAndPull(DisplayL
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::PickObjectForPickAndPull, worldCoordinates, worldSearchRadius))
+        return std::nullopt;
+
     return mWorld->PickObjectForPickAndPull(
         worldCoordinates,
         worldSearchRadius);
@@ -766,6 +1036,9 @@ void GameController::Pull(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::Pull, elementId, worldCoordinates))
+        return;
+
     mWorld->Pull(
         elementId,
         worldCoordinates,
@@ -800,6 +1073,9 @@ void GameController::MoveBy(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::MoveByConnectedComponent, connectedComponentId, worldOffset, inertialVelocity))
+        return;
+
     mWorld->MoveBy(
         connectedComponentId,
         worldOffset,
@@ -817,6 +1093,9 @@ void GameController::MoveBy(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::MoveByShip, shipId, worldOffset, inertialVelocity))
+        return;
+
     mWorld->MoveBy(
         shipId,
         worldOffset,
@@ -845,6 +1124,9 @@ void GameController::RotateBy(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RotateByConnectedComponent, connectedComponentId, angle, worldCenter, inertialAngle))
+        return;
+
     mWorld->RotateBy(
         connectedComponentId,
         angle,
@@ -873,6 +1155,9 @@ void GameController::RotateBy(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RotateByShip, shipId, angle, worldCenter, inertialAngle))
+        return;
+
     mWorld->RotateBy(
         shipId,
         angle,
@@ -907,15 +1192,20 @@ void GameController::MoveGrippedBy(
 
     // Apply action
     assert(!!mWorld);
+    std::vector<GrippedMoveParameters> const moves{
+        GrippedMoveParameters{
+            worldGripCenter,
+            worldGripRadius,
+            worldOffset,
+            inertialWorldOffset / SimulationParameters::SimulationStepTimeDuration<float>
+        }
+    };
+
+    if (!AcceptInput(RecordedInputType::MoveGrippedBy, moves))
+        return;
+
     mWorld->MoveGrippedBy(
-        {
-            GrippedMoveParameters{
-                worldGripCenter,
-                worldGripRadius,
-                worldOffset,
-                inertialWorldOffset / SimulationParameters::SimulationStepTimeDuration<float>
-            }
-        },
+        moves,
         mSimulationParameters);
 
     // Notify
@@ -942,6 +1232,9 @@ void GameController::RotateGrippedBy(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RotateGrippedBy, worldGripCenter, worldGripRadius, angle, inertialAngle))
+        return;
+
     mWorld->RotateGrippedBy(
         worldGripCenter,
         worldGripRadius,
@@ -959,6 +1252,9 @@ void GameController::EndMoveGrippedBy()
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::EndMoveGrippedBy))
+        return;
+
     mWorld->EndMoveGrippedBy(mSimulationParameters);
 }
 
@@ -976,6 +1272,9 @@ void GameController::DestroyAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::DestroyAt, worldCoordinates, worldRadius, sessionId))
+        return;
+
     mWorld->DestroyAt(
         worldCoordinates,
         worldRadius,
@@ -996,6 +1295,9 @@ void GameController::RepairAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RepairAt, worldCoordinates, worldRadius, repairStepId))
+        return;
+
     mWorld->RepairAt(
         worldCoordinates,
         worldRadius,
@@ -1013,6 +1315,9 @@ bool GameController::SawThrough(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::SawThrough, startWorldCoordinates, endWorldCoordinates, isFirstSegment))
+        return false;
+
     return mWorld->SawThrough(
         startWorldCoordinates,
         endWorldCoordinates,
@@ -1035,6 +1340,9 @@ bool GameController::ApplyHeatBlasterAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ApplyHeatBlasterAt, worldCoordinates, action, radius))
+        return false;
+
     bool isApplied = mWorld->ApplyHeatBlasterAt(
         worldCoordinates,
         action,
@@ -1071,6 +1379,9 @@ bool GameController::ExtinguishFireAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ExtinguishFireAt, worldCoordinates, strengthMultiplier, radius))
+        return false;
+
     bool isApplied = mWorld->ExtinguishFireAt(
         worldCoordinates,
         strengthMultiplier,
@@ -1105,6 +1416,9 @@ void GameController::ApplyBlastAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ApplyBlastAt, worldCoordinates, radius, forceMultiplier))
+        return;
+
     mWorld->ApplyBlastAt(
         worldCoordinates,
         radius,
@@ -1128,6 +1442,9 @@ bool GameController::ApplyElectricSparkAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ApplyElectricSparkAt, worldCoordinates, counter, lengthMultiplier))
+        return false;
+
     return mWorld->ApplyElectricSparkAt(
         worldCoordinates,
         counter,
@@ -1157,6 +1474,9 @@ void GameController::ApplyRadialWindFrom(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ApplyRadialWindFrom, sourceWorldCoordinates, preFrontRadius, preFrontWindSpeed, mainFrontRadius, mainFrontWindSpeed))
+        return;
+
     mWorld->ApplyRadialWindFrom(
         sourceWorldCoordinates,
         preFrontRadius,
@@ -1188,6 +1508,9 @@ bool GameController::ApplyLaserCannonThrough(
     {
         // Apply action
         assert(!!mWorld);
+        if (!AcceptInput(RecordedInputType::ApplyLaserCannonThrough, startWorld, endWorld, *strength))
+            return false;
+
         hasCut = mWorld->ApplyLaserCannonThrough(
             startWorld,
             endWorld,
@@ -1211,6 +1534,9 @@ void GameController::DrawTo(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::DrawTo, worldCoordinates, strengthFraction))
+        return;
+
     mWorld->DrawTo(
         worldCoordinates,
         strengthFraction,
@@ -1225,6 +1551,9 @@ void GameController::SwirlAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::SwirlAt, worldCoordinates, strengthFraction))
+        return;
+
     mWorld->SwirlAt(
         worldCoordinates,
         strengthFraction,
@@ -1242,6 +1571,9 @@ ElementIndex GameController::BeginPlaceAntiGravityField(DisplayLogicalCoordinate
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BeginPlaceAntiGravityField, worldStartCoordinates, worldSearchRadius))
+        return NoneElementIndex;
+
     return mWorld->BeginPlaceAntiGravityField(worldStartCoordinates, worldSearchRadius);
 }
 
@@ -1253,6 +1585,9 @@ void GameController::UpdatePlaceAntiGravityField(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::UpdatePlaceAntiGravityField, antiGravityFieldId, worldEndCoordinates))
+        return;
+
     mWorld->UpdatePlaceAntiGravityField(antiGravityFieldId, worldEndCoordinates);
 }
 
@@ -1268,6 +1603,9 @@ void GameController::EndPlaceAntiGravityField(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::EndPlaceAntiGravityField, antiGravityFieldId, worldEndCoordinates, worldSearchRadius, strengthMultiplier))
+        return;
+
     mWorld->EndPlaceAntiGravityField(antiGravityFieldId, worldEndCoordinates, worldSearchRadius, strengthMultiplier);
 }
 
@@ -1275,6 +1613,9 @@ void GameController::AbortPlaceAntiGravityField(ElementIndex antiGravityFieldId)
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::AbortPlaceAntiGravityField, antiGravityFieldId))
+        return;
+
     mWorld->AbortPlaceAntiGravityField(antiGravityFieldId);
 }
 
@@ -1282,6 +1623,9 @@ void GameController::BoostAntiGravityFields(float strengthMultiplier)
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BoostAntiGravityFields, strengthMultiplier))
+        return;
+
     mWorld->BoostAntiGravityFields(strengthMultiplier);
 }
 
@@ -1289,6 +1633,9 @@ bool GameController::RemoveAllAntiGravityFields()
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RemoveAllAntiGravityFields))
+        return false;
+
     return mWorld->RemoveAllAntiGravityFields();
 }
 
@@ -1301,6 +1648,9 @@ ElementIndex GameController::BeginPlaceTornado(int screenCoordinatesX)
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BeginPlaceTornado, worldX, worldSearchRadius))
+        return NoneElementIndex;
+
     return mWorld->BeginPlaceTornado(worldX, worldSearchRadius);
 }
 
@@ -1314,6 +1664,9 @@ void GameController::UpdateTornado(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::UpdateTornado, tornadoId, worldX, strengthMultiplier, heatDepth))
+        return;
+
     mWorld->UpdateTornado(tornadoId, worldX, strengthMultiplier, heatDepth);
 }
 
@@ -1321,6 +1674,9 @@ void GameController::EndPlaceTornado(ElementIndex tornadoId)
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::EndPlaceTornado, tornadoId))
+        return;
+
     mWorld->EndPlaceTornado(tornadoId);
 }
 
@@ -1330,6 +1686,9 @@ void GameController::TogglePinAt(DisplayLogicalCoordinates const & screenCoordin
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TogglePinAt, worldCoordinates))
+        return;
+
     mWorld->TogglePinAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1339,6 +1698,9 @@ void GameController::RemoveAllPins()
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RemoveAllPins))
+        return;
+
     mWorld->RemoveAllPins();
 }
 
@@ -1350,6 +1712,9 @@ std::optional<ToolApplicationLocus> GameController::InjectPressureAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::InjectPressureAt, worldCoordinates, pressureQuantityMultiplier))
+        return std::nullopt;
+
     auto const applicationLocus = mWorld->InjectPressureAt(
         worldCoordinates,
         pressureQuantityMultiplier,
@@ -1375,6 +1740,9 @@ bool GameController::FloodAt(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::FloodAt, worldCoordinates, mSimulationParameters.FloodRadius, flowSign))
+        return false;
+
     return mWorld->FloodAt(
         worldCoordinates,
         mSimulationParameters.FloodRadius,
@@ -1388,6 +1756,9 @@ void GameController::ToggleAntiMatterBombAt(DisplayLogicalCoordinates const & sc
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ToggleAntiMatterBombAt, worldCoordinates))
+        return;
+
     mWorld->ToggleAntiMatterBombAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1399,6 +1770,9 @@ void GameController::ToggleFireExtinguishingBombAt(DisplayLogicalCoordinates con
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ToggleFireExtinguishingBombAt, worldCoordinates))
+        return;
+
     mWorld->ToggleFireExtinguishingBombAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1410,6 +1784,9 @@ void GameController::ToggleImpactBombAt(DisplayLogicalCoordinates const & screen
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ToggleImpactBombAt, worldCoordinates))
+        return;
+
     mWorld->ToggleImpactBombAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1421,6 +1798,9 @@ void GameController::TogglePhysicsProbeAt(DisplayLogicalCoordinates const & scre
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TogglePhysicsProbeAt, worldCoordinates))
+        return;
+
     auto const toggleResult = mWorld->TogglePhysicsProbeAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1438,6 +1818,9 @@ void GameController::ToggleRCBombAt(DisplayLogicalCoordinates const & screenCoor
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ToggleRCBombAt, worldCoordinates))
+        return;
+
     mWorld->ToggleRCBombAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1449,6 +1832,9 @@ void GameController::ToggleTimerBombAt(DisplayLogicalCoordinates const & screenC
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ToggleTimerBombAt, worldCoordinates))
+        return;
+
     mWorld->ToggleTimerBombAt(
         worldCoordinates,
         mSimulationParameters);
@@ -1458,6 +1844,9 @@ void GameController::DetonateRCBombs()
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::DetonateRCBombs))
+        return;
+
     mWorld->DetonateRCBombs(mSimulationParameters);
 }
 
@@ -1465,6 +1854,9 @@ void GameController::DetonateAntiMatterBombs()
 {
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::DetonateAntiMatterBombs))
+        return;
+
     mWorld->DetonateAntiMatterBombs();
 }
 
@@ -1477,6 +1869,9 @@ void GameController::ApplyInteractiveWaveAt(
 
     // Apply action
     assert(mWorld);
+    if (!AcceptInput(RecordedInputType::ApplyInteractiveWaveAt, worldCoordinates, worldRadius))
+        return;
+
     mWorld->ApplyInteractiveWaveAt(worldCoordinates, worldRadius);
 }
 
@@ -1485,6 +1880,9 @@ std::optional<bool> GameController::AdjustOceanFloorTo(
     vec2f const & endWorldPosition)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::AdjustOceanFloorTo, startWorldPosition.x, startWorldPosition.y, endWorldPosition.x, endWorldPosition.y))
+        return std::nullopt;
+
     return mWorld->AdjustOceanFloorTo(
         startWorldPosition.x,
         startWorldPosition.y,
@@ -1503,6 +1901,9 @@ bool GameController::ScrubThrough(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ScrubThrough, startWorldCoordinates, endWorldCoordinates, worldRadius))
+        return false;
+
     return mWorld->ScrubThrough(
         startWorldCoordinates,
         endWorldCoordinates,
@@ -1520,6 +1921,9 @@ bool GameController::RustThrough(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RustThrough, startWorldCoordinates, endWorldCoordinates, worldRadius))
+        return false;
+
     return mWorld->RustThrough(
         startWorldCoordinates,
         endWorldCoordinates,
@@ -1531,6 +1935,12 @@ void GameController::ApplyThanosSnapAt(
     DisplayLogicalCoordinates const & screenCoordinates,
     bool isSparseMode)
 {
+    if (IsReplayingInput())
+    {
+        // Live inputs are ignored while replaying
+        return;
+    }
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     StartThanosSnapStateMachine(worldCoordinates.x, isSparseMode, mWorld->GetCurrentSimulationTime());
@@ -1545,6 +1955,9 @@ void GameController::ScareFish(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::ScareFish, worldCoordinates, radius, delay))
+        return;
+
     mWorld->ScareFish(
         worldCoordinates,
         radius,
@@ -1560,6 +1973,9 @@ void GameController::AttractFish(
 
     // Apply action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::AttractFish, worldCoordinates, radius, delay))
+        return;
+
     mWorld->AttractFish(
         worldCoordinates,
         radius,
@@ -1574,9 +1990,15 @@ void GameController::SetLampAt(
 
      // Scare fish
     assert(!!mWorld);
+    vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
+    float const worldRadius = mRenderContext->ScreenFractionToWorldOffset(radiusScreenFraction);
+
+    if (!AcceptInput(RecordedInputType::ScareFish, worldCoordinates, worldRadius, std::chrono::milliseconds(75)))
+        return;
+
     mWorld->ScareFish(
-        mRenderContext->ScreenToWorld(screenCoordinates),
-        mRenderContext->ScreenFractionToWorldOffset(radiusScreenFraction),
+        worldCoordinates,
+        worldRadius,
         std::chrono::milliseconds(75));
 }
 
@@ -1591,6 +2013,9 @@ void GameController::TriggerInteractiveLightningAt(DisplayLogicalCoordinates con
 
     // Do action
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TriggerInteractiveLightningAt, worldCoordinates))
+        return;
+
     mWorld->TriggerInteractiveLightningAt(worldCoordinates);
 }
 
@@ -1608,6 +2033,9 @@ std::optional<PickedNpc> GameController::BeginPlaceNewFurnitureNpc(
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BeginPlaceNewFurnitureNpc, subKind, worldCoordinates, doMoveWholeMesh || mIsPaused))
+        return std::nullopt;
+
     auto const result = mWorld->BeginPlaceNewFurnitureNpc(
         subKind,
         worldCoordinates,
@@ -1633,6 +2061,9 @@ std::optional<PickedNpc> GameController::BeginPlaceNewHumanNpc(
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BeginPlaceNewHumanNpc, subKind, worldCoordinates, doMoveWholeMesh || mIsPaused))
+        return std::nullopt;
+
     auto const result = mWorld->BeginPlaceNewHumanNpc(
         subKind,
         worldCoordinates,
@@ -1679,6 +2110,9 @@ void GameController::BeginMoveNpc(
     bool doMoveWholeMesh)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BeginMoveNpc, id, particleOrdinal, doMoveWholeMesh || mIsPaused))
+        return;
+
     mWorld->BeginMoveNpc(
         id,
         particleOrdinal,
@@ -1688,6 +2122,9 @@ void GameController::BeginMoveNpc(
 void GameController::BeginMoveNpcs(std::vector<NpcId> const & ids)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::BeginMoveNpcs, ids))
+        return;
+
     mWorld->BeginMoveNpcs(ids);
 }
 
@@ -1700,6 +2137,9 @@ void GameController::MoveNpcTo(
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::MoveNpcTo, id, worldCoordinates, worldOffset, doMoveWholeMesh || mIsPaused))
+        return;
+
     mWorld->MoveNpcTo(
         id,
         worldCoordinates,
@@ -1714,6 +2154,9 @@ void GameController::MoveNpcsBy(
     vec2f const worldOffset = mRenderContext->ScreenOffsetToWorldOffset(screenOffset);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::MoveNpcsBy, ids, worldOffset))
+        return;
+
     mWorld->MoveNpcsBy(
         ids,
         worldOffset);
@@ -1722,18 +2165,27 @@ void GameController::MoveNpcsBy(
 void GameController::EndMoveNpc(NpcId id)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::EndMoveNpc, id))
+        return;
+
     mWorld->EndMoveNpc(id);
 }
 
 void GameController::CompleteNewNpc(NpcId id)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::CompleteNewNpc, id))
+        return;
+
     mWorld->CompleteNewNpc(id);
 }
 
 void GameController::RemoveNpc(NpcId id)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RemoveNpc, id))
+        return;
+
     mWorld->RemoveNpc(id);
 }
 
@@ -1745,18 +2197,27 @@ void GameController::RemoveNpcsInRect(
     vec2f const corner2WorldCoordinates = mRenderContext->ScreenToWorld(corner2ScreenCoordinates);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RemoveNpcsInRect, corner1WorldCoordinates, corner2WorldCoordinates))
+        return;
+
     mWorld->RemoveNpcsInRect(corner1WorldCoordinates, corner2WorldCoordinates);
 }
 
 void GameController::AbortNewNpc(NpcId id)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::AbortNewNpc, id))
+        return;
+
     mWorld->AbortNewNpc(id);
 }
 
 void GameController::AddNpcGroup(NpcKindType kind)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::AddNpcGroup, kind, mRenderContext->GetVisibleWorld()))
+        return;
+
     auto const result = mWorld->AddNpcGroup(
         kind,
         mRenderContext->GetVisibleWorld(),
@@ -1771,6 +2232,9 @@ void GameController::AddNpcGroup(NpcKindType kind)
 void GameController::TurnaroundNpc(NpcId id)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TurnaroundNpc, id))
+        return;
+
     mWorld->TurnaroundNpc(id);
 }
 
@@ -1782,6 +2246,9 @@ void GameController::TurnaroundNpcsInRect(
     vec2f const corner2WorldCoordinates = mRenderContext->ScreenToWorld(corner2ScreenCoordinates);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TurnaroundNpcsInRect, corner1WorldCoordinates, corner2WorldCoordinates))
+        return;
+
     mWorld->TurnaroundNpcsInRect(corner1WorldCoordinates, corner2WorldCoordinates);
 }
 
@@ -1794,6 +2261,9 @@ std::optional<NpcId> GameController::GetCurrentlySelectedNpc() const
 void GameController::SelectNpc(std::optional<NpcId> id)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::SelectNpc, id))
+        return;
+
     mWorld->SelectNpc(id);
 
     if (mViewManager.GetAutoFocusTarget() == AutoFocusTargetKindType::SelectedNpc)
@@ -1805,6 +2275,9 @@ void GameController::SelectNpc(std::optional<NpcId> id)
 void GameController::SelectNextNpc()
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::SelectNextNpc))
+        return;
+
     mWorld->SelectNextNpc(); // We'll pick this up later at UpdateAutoFocus() if we're focusing on it
 
     if (mViewManager.GetAutoFocusTarget() == AutoFocusTargetKindType::SelectedNpc)
@@ -1816,6 +2289,9 @@ void GameController::SelectNextNpc()
 void GameController::HighlightNpcs(std::vector<NpcId> const & ids)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::HighlightNpcs, ids))
+        return;
+
     mWorld->HighlightNpcs(ids);
 }
 
@@ -1827,6 +2303,9 @@ void GameController::HighlightNpcsInRect(
     vec2f const corner2WorldCoordinates = mRenderContext->ScreenToWorld(corner2ScreenCoordinates);
 
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::HighlightNpcsInRect, corner1WorldCoordinates, corner2WorldCoordinates))
+        return;
+
     mWorld->HighlightNpcsInRect(corner1WorldCoordinates, corner2WorldCoordinates);
 }
 
@@ -1857,30 +2336,45 @@ void GameController::QueryNearestNpcAt(DisplayLogicalCoordinates const & screenC
 void GameController::TriggerTsunami()
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TriggerTsunami))
+        return;
+
     mWorld->TriggerTsunami();
 }
 
 void GameController::TriggerRogueWave()
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TriggerRogueWave))
+        return;
+
     mWorld->TriggerRogueWave();
 }
 
 void GameController::TriggerStorm()
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TriggerStorm))
+        return;
+
     mWorld->TriggerStorm();
 }
 
 void GameController::TriggerRandomLightning()
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::TriggerRandomLightning))
+        return;
+
     mWorld->TriggerRandomLightning(mSimulationParameters);
 }
 
 void GameController::HighlightElectricalElement(GlobalElectricalElementId electricalElementId)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::HighlightElectricalElement, electricalElementId))
+        return;
+
     mWorld->HighlightElectricalElement(electricalElementId);
 }
 
@@ -1889,6 +2383,9 @@ void GameController::SetSwitchState(
     ElectricalState switchState)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::SetSwitchState, electricalElementId, switchState))
+        return;
+
     mWorld->SetSwitchState(
         electricalElementId,
         switchState,
@@ -1900,6 +2397,9 @@ void GameController::SetEngineControllerState(
     float controllerValue)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::SetEngineControllerState, electricalElementId, controllerValue))
+        return;
+
     mWorld->SetEngineControllerState(
         electricalElementId,
         controllerValue,
@@ -1909,6 +2409,9 @@ void GameController::SetEngineControllerState(
 bool GameController::DestroyTriangle(GlobalElementId triangleId)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::DestroyTriangle, triangleId))
+        return false;
+
     return mWorld->DestroyTriangle(
         triangleId,
         mSimulationParameters);
@@ -1917,6 +2420,9 @@ bool GameController::DestroyTriangle(GlobalElementId triangleId)
 bool GameController::RestoreTriangle(GlobalElementId triangleId)
 {
     assert(!!mWorld);
+    if (!AcceptInput(RecordedInputType::RestoreTriangle, triangleId))
+        return false;
+
     return mWorld->RestoreTriangle(triangleId);
 }
 
@@ -2042,7 +2548,10 @@ void GameController::SetAutoFocusTarget(std::optional<AutoFocusTargetKindType> c
         // Select first NPC as a courtesy if none is selected
         if (!mWorld->GetNpcs().GetCurrentlySelectedNpc().has_value())
         {
-            mWorld->SelectFirstNpc();
+            if (AcceptInput(RecordedInputType::SelectFirstNpc))
+            {
+                mWorld->SelectFirstNpc();
+            }
         }
     }
 
@@ -2122,11 +2631,30 @@ void GameController::OnHumanNpcCountsUpdated(
     }
 }
 
+Physics::World & GameController::GetReplayWorld()
+{
+    assert(!!mWorld);
+    return *mWorld;
+}
+
+void GameController::ReplayAddShip(ShipLoadSpecifications const & loadSpecs)
+{
+    assert(mInputReplayAssetManager != nullptr);
+    InternalLoadAndAddShip(loadSpecs, *mInputReplayAssetManager);
+}
+
+void GameController::ReplayResetAndLoadShip(ShipLoadSpecifications const & loadSpecs)
+{
+    assert(mInputReplayAssetManager != nullptr);
+    InternalResetAndLoadShip(loadSpecs, *mInputReplayAssetManager, mWorld->GetOceanFloorHeightMap());
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////
 
 ShipMetadata GameController::InternalResetAndLoadShip(
     ShipLoadSpecifications const & loadSpecs,
-    IAssetManager const & assetManager)
+    IAssetManager const & assetManager,
+    OceanFloorHeightMap const & oceanFloorHeightMap)
 {
     assert(!!mWorld);
 
@@ -2144,12 +2672,12 @@ ShipMetadata GameController::InternalResetAndLoadShip(
 
     // Create a new world
     auto newWorld = std::make_unique<Physics::World>(
-        OceanFloorHeightMap(mWorld->GetOceanFloorHeightMap()),
+        OceanFloorHeightMap(oceanFloorHeightMap),
         mFishSpeciesDatabase,
         mRenderContext->GetUnderwaterPlantsSpeciesCount(),
         mNpcDatabase,
         mSimulationEventDispatcher,
-        mSimulationParameters);
+        GetWorldSimulationParameters());
 
     // Produce ship
     auto const shipId = newWorld->GetNextShipId();
@@ -2163,7 +2691,7 @@ ShipMetadata GameController::InternalResetAndLoadShip(
         mShipStrengthRandomizer,
         mSimulationEventDispatcher,
         assetManager,
-        mSimulationParameters);
+        GetWorldSimulationParameters());
 
     //
     // No errors, so we may continue
@@ -2180,6 +2708,31 @@ ShipMetadata GameController::InternalResetAndLoadShip(
     return shipMetadata;
 }
 
+void GameController::EnterDeterministicSession(std::uint32_t seed)
+{
+    // Sessions start with a new world, and a fast-forward would otherwise
+    // end up exiting the session's deterministic mode
+    StopFastForward();
+
+    // Same seed, same random sequences
+    GameRandomEngine::GetInstance().Reseed(seed);
+
+    // Simulation time drives the clock
+    GameWallClock::GetInstance().EnterDeterministicMode();
+
+    // Tell the world - and the worlds to come
+    mIsDeterministicSession = true;
+    mWorld->SetDeterministicSession(true);
+}
+
+void GameController::ExitDeterministicSession()
+{
+    GameWallClock::GetInstance().ExitDeterministicMode();
+
+    mIsDeterministicSession = false;
+    mWorld->SetDeterministicSession(false);
+}
+
 void GameController::Reset(std::unique_ptr<Physics::World> newWorld)
 {
     // Reset world
@@ -2189,6 +2742,9 @@ void GameController::Reset(std::unique_ptr<Physics::World> newWorld)
     // Set event recorder (if any)
     mWorld->SetEventRecorder(mEventRecorder.get());
 
+    // Keep the deterministic session (if any)
+    mWorld->SetDeterministicSession(mIsDeterministicSession);
+
     // Reset state machines
     ResetAllStateMachines();
 
@@ -2261,6 +2817,7 @@ void GameController::ResetStats()
 {
     mTotalPerfStats->Reset();
     mLastPublishedTotalPerfStats.Reset();
+    mLatencyWindowPublishedTotalPerfStats.clear();
     mTotalFrameCount = 0;
     mLastPublishedTotalFrameCount = 0;
     mStatsOriginTimestampReal = std::chrono::steady_clock::time_point::min();
@@ -2271,6 +2828,9 @@ void GameController::ResetStats()
 void GameController::PublishStats(std::chrono::steady_clock::time_point nowReal)
 {
     PerfStats const lastDeltaPerfStats = *mTotalPerfStats - mLastPublishedTotalPerfStats;
+    PerfStats const latencyWindowPerfStats = mLatencyWindowPublishedTotalPerfStats.empty()
+        ? *mTotalPerfStats
+        : *mTotalPerfStats - mLatencyWindowPublishedTotalPerfStats.front();
     uint64_t const lastDeltaFrameCount = mTotalFrameCount - mLastPublishedTotalFrameCount;
 
     // Calculate fps
@@ -2300,6 +2860,7 @@ void GameController::PublishStats(std::chrono::steady_clock::time_point nowReal)
         totalFps,
         lastDeltaPerfStats,
         *mTotalPerfStats,
+        latencyWindowPerfStats,
         std::chrono::duration<float>(GameWallClock::GetInstance().Now() - mOriginTimestampGame),
         mIsPaused,
         mRenderContext->GetZoom(),
@@ -6,11 +6,13 @@
 #pragma once
 
 #include "GameAssetManager.h"
+#include "FastForwarder.h"
 #include "GameEventDispatcher.h"
 #include "IGameController.h"
 #include "IGameControllerSettings.h"
 #include "IGameControllerSettingsOptions.h"
 #include "IGameEventHandlers.h"
+#include "InputRecording.h"
 #include "NotificationLayer.h"
 #include "ShipLoadSpecifications.h"
 #include "ViewManager.h"
@@ -44,6 +46,7 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -62,6 +65,7 @@ class GameController final
     , public IGenericShipEventHandler
     , public IWavePhenomenaEventHandler
     , public INpcEventHandler
+    , public IInputReplayTarget
 {
 public:
 
@@ -174,10 +178,21 @@ public:
         mIsPulseUpdateSet = true;
     }
 
+    void StartFastForward(float simulationDuration) override;
+    void StopFastForward() override;
+    bool IsFastForwarding() const override { return mFastForwarder.IsFastForwarding(); }
+
     void StartRecordingEvents(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback) override;
     RecordedEvents StopRecordingEvents() override;
     void ReplayRecordedEvent(RecordedEvent const & event) override;
 
+    ShipMetadata StartRecordingInput(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager, std::uint32_t seed) override;
+    InputRecording StopRecordingInput() override;
+    ShipMetadata StartReplayingInput(InputRecording && recording, IAssetManager const & assetManager) override;
+    void StopReplayingInput() override;
+    bool IsRecordingInput() const override { return !!mInputRecorder; }
+    bool IsReplayingInput() const override { return !!mInputReplayer; }
+
     //
     // Game Control and notifications
     //
@@ -659,7 +674,7 @@ public:
     // Ocean floor
 
     OceanFloorHeightMap const & GetOceanFloorTerrain() const override { return mWorld->GetOceanFloorHeightMap(); }
-    void SetOceanFloorTerrain(OceanFloorHeightMap const & value) override { mWorld->SetOceanFloorHeightMap(value); }
+    void SetOceanFloorTerrain(OceanFloorHeightMap const & value) override { if (!mInputReplayer) mWorld->SetOceanFloorHeightMap(value); }
 
     float GetSeaDepth() const override { return mFloatParameterSmoothers[SeaDepthParameterSmoother].GetValue(); }
     void SetSeaDepth(float value) override { mFloatParameterSmoothers[SeaDepthParameterSmoother].SetValue(value); }
@@ -1187,6 +1202,16 @@ private:
         size_t insideShipCount,
         size_t outsideShipCount) override;
 
+    //
+    // Input replay
+    //
+
+    Physics::World & GetReplayWorld() override;
+
+    void ReplayAddShip(ShipLoadSpecifications const & loadSpecs) override;
+
+    void ReplayResetAndLoadShip(ShipLoadSpecifications const & loadSpecs) override;
+
 private:
 
     GameController(
@@ -1200,11 +1225,83 @@ private:
         ProgressCallback const & progressCallback);
 
     ShipMetadata InternalResetAndLoadShip(
+        ShipLoadSpecifications const & loadSpecs,
+        IAssetManager const & assetManager,
+        OceanFloorHeightMap const & oceanFloorHeightMap);
+
+    ShipMetadata InternalLoadAndAddShip(
         ShipLoadSpecifications const & loadSpecs,
         IAssetManager const & assetManager);
 
+    // Ship loads from the UI replace the ships of the replay, which hence ends
+    void EndReplayOnLiveShipLoad()
+    {
+        if (mInputReplayer)
+        {
+            StopReplayingInput();
+        }
+    }
+
+    void EnterDeterministicSession(std::uint32_t seed);
+
+    void ExitDeterministicSession();
+
+    // The parameters the world runs with: while replaying, those of the recording
+    SimulationParameters const & GetWorldSimulationParameters() const
+    {
+        return mInputReplayer
+            ? mInputReplayer->GetSimulationParameters()
+            : mSimulationParameters;
+    }
+
+    template<typename... TArgs>
+    void RecordInput(
+        RecordedInputType type,
+        TArgs const &... args)
+    {
+        if (mInputRecorder)
+        {
+            mInputRecorder->OnSimulationParameters(mSimulationParameters);
+            mInputRecorder->Record(type, args...);
+        }
+    }
+
+    /*
+     * Records a live input, returning whether the input is to be applied: while replaying,
+     * live inputs are ignored, as the World is then driven by the recording alone.
+     */
+    template<typename... TArgs>
+    bool AcceptInput(
+        RecordedInputType type,
+        TArgs const &... args)
+    {
+        if (mInputReplayer)
+        {
+            return false;
+        }
+
+        RecordInput(type, args...);
+
+        return true;
+    }
+
+    void RecordShipLoad(
+        ShipLoadSpecifications const & loadSpecs,
+        bool isReset)
+    {
+        if (mInputRecorder)
+        {
+            mInputRecorder->OnSimulationParameters(mSimulationParameters);
+            mInputRecorder->OnShipLoaded(loadSpecs, isReset);
+        }
+    }
+
     void Reset(std::unique_ptr<Physics::World> newWorld);
 
+    void RunSimulationStep(bool isFastForwarding);
+
+    void RunFastForwardSteps();
+
     void InternalAddShip(
         std::unique_ptr<Physics::Ship> ship,
         RgbaImageData && exteriorTextureImage,
@@ -1287,6 +1384,10 @@ private:
     bool mIsPulseUpdateSet;
     bool mIsMoveToolEngaged;
 
+    // Fast-forward: at each iteration we run steps for at most the iteration duration
+    FastForwarder mFastForwarder;
+    static constexpr auto FastForwardIterationDuration = std::chrono::milliseconds(50);
+
 
     //
     // The parameters that we own
@@ -1311,6 +1412,11 @@ private:
     ThreadManager & mThreadManager;
     ViewManager mViewManager;
     std::unique_ptr<EventRecorder> mEventRecorder;
+    std::unique_ptr<InputRecorder> mInputRecorder;
+    std::unique_ptr<InputReplayer> mInputReplayer;
+    IAssetManager const * mInputReplayAssetManager; // For ships loaded while replaying
+    std::optional<size_t> mPreReplaySimulationParallelism;
+    bool mIsDeterministicSession; // While recording or replaying
 
 
     //
@@ -1340,6 +1446,12 @@ private:
     GameWallClock::time_point mOriginTimestampGame;
     std::unique_ptr<PerfStats> mTotalPerfStats;
     PerfStats mLastPublishedTotalPerfStats;
+
+    // The last few published total stats, oldest first; latency distributions
+    // are taken over the window since the oldest of these
+    static size_t constexpr LatencyWindowPublishCount = 5;
+    std::deque<PerfStats> mLatencyWindowPublishedTotalPerfStats;
+
     uint64_t mTotalFrameCount;
     uint64_t mLastPublishedTotalFrameCount;
     int mSkippedFirstStatPublishes;
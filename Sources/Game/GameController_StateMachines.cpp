@@ -202,6 +202,7 @@ void GameController::StartThanosSnapStateMachine(
         mGameEventDispatcher.OnSilenceStarted();
 
         // Silence world
+        RecordInput(RecordedInputType::SetSilence, 1.0f);
         mWorld->SetSilence(1.0f);
     }
     else
@@ -247,6 +248,7 @@ bool GameController::UpdateThanosSnapStateMachine(
     float const leftInnerEdgeX = leftOuterEdgeX + SliceWidth / 2.0f;
     if (leftInnerEdgeX > -SimulationParameters::HalfMaxWorldWidth)
     {
+        RecordInput(RecordedInputType::ApplyThanosSnap, stateMachine.CenterX, radius, leftOuterEdgeX, leftInnerEdgeX, stateMachine.IsSparseMode);
         mWorld->ApplyThanosSnap(
             stateMachine.CenterX,
             radius,
@@ -262,6 +264,7 @@ bool GameController::UpdateThanosSnapStateMachine(
     float const rightInnerEdgeX = rightOuterEdgeX - SliceWidth / 2.0f;
     if (rightInnerEdgeX < SimulationParameters::HalfMaxWorldWidth)
     {
+        RecordInput(RecordedInputType::ApplyThanosSnap, stateMachine.CenterX, radius, rightInnerEdgeX, rightOuterEdgeX, stateMachine.IsSparseMode);
         mWorld->ApplyThanosSnap(
             stateMachine.CenterX,
             radius,
@@ -432,6 +435,7 @@ void GameController::UpdateAllStateMachines(float currentSimulationTime)
             if (mThanosSnapStateMachines.empty())
             {
                 // Lift silence on world
+                RecordInput(RecordedInputType::SetSilence, 0.0f);
                 mWorld->SetSilence(0.0f);
 
                 // Lift silence
@@ -87,6 +87,38 @@ public:
         }
     }
 
+    void OnFastForwardStarted() override
+    {
+        for (auto sink : mGameSinks)
+        {
+            sink->OnFastForwardStarted();
+        }
+    }
+
+    void OnFastForwardEnded() override
+    {
+        for (auto sink : mGameSinks)
+        {
+            sink->OnFastForwardEnded();
+        }
+    }
+
+    void OnInputReplayStarted() override
+    {
+        for (auto sink : mGameSinks)
+        {
+            sink->OnInputReplayStarted();
+        }
+    }
+
+    void OnInputReplayEnded() override
+    {
+        for (auto sink : mGameSinks)
+        {
+            sink->OnInputReplayEnded();
+        }
+    }
+
     //
     // Game Statistics
     //
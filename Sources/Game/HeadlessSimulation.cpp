@@ -0,0 +1,282 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "HeadlessSimulation.h"
+
+#include "FastForwarder.h"
+#include "ShipDeSerializer.h"
+
+#include <Simulation/ShipFactory.h>
+
+#include <Render/GameTextureDatabases.h>
+
+#include <Core/GameChronometer.h>
+#include <Core/TextureAtlas.h>
+#include <Core/TextureDatabase.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+namespace /* anonymous */ {
+
+    NpcDatabase LoadNpcDatabase(
+        GameAssetManager const & gameAssetManager,
+        MaterialDatabase const & materialDatabase)
+    {
+        auto const npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+
+        return NpcDatabase::Load(
+            gameAssetManager,
+            materialDatabase,
+            npcTextureAtlas);
+    }
+
+    size_t GetUnderwaterPlantsSpeciesCount(GameAssetManager const & gameAssetManager)
+    {
+        // Same as what the render context gets from its atlas, without building the atlas
+        auto const genericLinearTextureDatabase = TextureDatabase<GameTextureDatabases::GenericLinearTextureDatabase>::Load(gameAssetManager);
+
+        return genericLinearTextureDatabase.GetGroup(GameTextureDatabases::GenericLinearTextureDatabase::TextureGroupsType::UnderwaterPlant).GetFrameCount();
+    }
+
+}
+
+HeadlessSimulation::Databases::Databases(GameAssetManager const & gameAssetManager)
+    : MaterialDb(MaterialDatabase::Load(gameAssetManager))
+    , FishSpeciesDb(FishSpeciesDatabase::Load(gameAssetManager))
+    , NpcDb(LoadNpcDatabase(gameAssetManager, MaterialDb))
+    , UnderwaterPlantsSpeciesCount(GetUnderwaterPlantsSpeciesCount(gameAssetManager))
+{
+}
+
+HeadlessSimulation::Databases::Databases(
+    MaterialDatabase && materialDb,
+    FishSpeciesDatabase && fishSpeciesDb,
+    NpcDatabase && npcDb,
+    size_t underwaterPlantsSpeciesCount)
+    : MaterialDb(std::move(materialDb))
+    , FishSpeciesDb(std::move(fishSpeciesDb))
+    , NpcDb(std::move(npcDb))
+    , UnderwaterPlantsSpeciesCount(underwaterPlantsSpeciesCount)
+{
+}
+
+HeadlessSimulation::HeadlessSimulation(
+    GameAssetManager const & gameAssetManager,
+    ThreadManager & threadManager,
+    std::uint32_t seed)
+    : HeadlessSimulation(
+        gameAssetManager,
+        std::make_shared<Databases const>(gameAssetManager),
+        threadManager,
+        seed)
+{
+}
+
+HeadlessSimulation::HeadlessSimulation(
+    GameAssetManager const & gameAssetManager,
+    std::shared_ptr<Databases const> databases,
+    ThreadManager & threadManager,
+    std::uint32_t seed)
+    : HeadlessSimulation(
+        gameAssetManager,
+        std::move(databases),
+        OceanFloorHeightMap::LoadFromImage(gameAssetManager.LoadPngImageRgb(gameAssetManager.GetDefaultOceanFloorHeightMapFilePath())),
+        threadManager,
+        seed)
+{
+}
+
+HeadlessSimulation::HeadlessSimulation(
+    IAssetManager const & assetManager,
+    std::shared_ptr<Databases const> databases,
+    OceanFloorHeightMap && oceanFloorHeightMap,
+    ThreadManager & threadManager,
+    std::uint32_t seed)
+    : mAssetManager(assetManager)
+    , mThreadManager(threadManager)
+    , mDatabases(std::move(databases))
+    , mShipStrengthRandomizer()
+    , mShipTexturizer(mDatabases->MaterialDb, assetManager)
+    , mRandomEngine(seed)
+    , mWallClock()
+    , mSimulationParameters()
+    , mSimulationEventDispatcher()
+    , mWorld()
+    , mInputReplayer()
+    , mIsReplayFinalStateMatching()
+    , mVisibleWorld()
+    , mPerfStats()
+    , mStepCount(0)
+{
+    // Enter deterministic session
+    mWallClock.EnterDeterministicMode();
+
+    // Create world
+    ThreadScope const threadScope(*this);
+    ResetWorld(std::move(oceanFloorHeightMap));
+}
+
+ShipId HeadlessSimulation::AddShip(ShipLoadSpecifications const & loadSpecs)
+{
+    return AddShip(
+        ShipDeSerializer::LoadShip(loadSpecs.DefinitionFilepath, mDatabases->MaterialDb),
+        loadSpecs.LoadOptions);
+}
+
+ShipId HeadlessSimulation::AddShip(
+    ShipDefinition && shipDefinition,
+    ShipLoadOptions const & loadOptions)
+{
+    ThreadScope const threadScope(*this);
+
+    auto const shipId = mWorld->GetNextShipId();
+
+    auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+        shipId,
+        *mWorld,
+        std::move(shipDefinition),
+        loadOptions,
+        mDatabases->MaterialDb,
+        mShipTexturizer,
+        mShipStrengthRandomizer,
+        mSimulationEventDispatcher,
+        mAssetManager,
+        GetWorldSimulationParameters());
+
+    // Textures are not needed without rendering
+    (void)exteriorTextureImage;
+    (void)interiorViewImage;
+
+    mWorld->AddShip(std::move(ship));
+
+    // Center view on ship
+    auto const shipAABB = mWorld->GetShip(shipId).CalculateParticleAABB();
+    mVisibleWorld.Center = shipAABB.CalculateCenter();
+    mVisibleWorld.Width = std::max(mVisibleWorld.Width, shipAABB.GetWidth() * 1.2f);
+    mVisibleWorld.Height = mVisibleWorld.Width * 9.0f / 16.0f;
+    mVisibleWorld.TopLeft = mVisibleWorld.Center + vec2f(-mVisibleWorld.Width / 2.0f, mVisibleWorld.Height / 2.0f);
+    mVisibleWorld.BottomRight = mVisibleWorld.Center + vec2f(mVisibleWorld.Width / 2.0f, -mVisibleWorld.Height / 2.0f);
+
+    return shipId;
+}
+
+void HeadlessSimulation::StartReplay(InputRecording && recording)
+{
+    ThreadScope const threadScope(*this);
+
+    // Same as the game does when it starts replaying
+    mRandomEngine.Reseed(recording.Seed);
+    mWallClock.EnterDeterministicMode();
+
+    mInputReplayer = std::make_unique<InputReplayer>(std::move(recording));
+    mIsReplayFinalStateMatching.reset();
+
+    ResetWorld(OceanFloorHeightMap(mInputReplayer->GetRecording().InitialOceanFloorHeightMap));
+    AddShip(mInputReplayer->GetRecording().ShipLoadSpecs);
+}
+
+void HeadlessSimulation::Update()
+{
+    ThreadScope const threadScope(*this);
+
+    RunSimulationStep();
+
+    // Nobody's listening, but this keeps the dispatcher from accumulating events
+    mSimulationEventDispatcher.Flush();
+}
+
+size_t HeadlessSimulation::FastForward(float simulationDuration)
+{
+    ThreadScope const threadScope(*this);
+
+    FastForwarder fastForwarder;
+    if (!fastForwarder.Start(simulationDuration))
+    {
+        return 0;
+    }
+
+    // No UI to keep responsive, hence one single batch
+    size_t const stepCount = fastForwarder.RunSteps(
+        [this]()
+        {
+            RunSimulationStep();
+        },
+        GameChronometer::duration::max());
+
+    mSimulationEventDispatcher.Flush();
+
+    return stepCount;
+}
+
+void HeadlessSimulation::ReplayAddShip(ShipLoadSpecifications const & loadSpecs)
+{
+    AddShip(loadSpecs);
+}
+
+void HeadlessSimulation::ReplayResetAndLoadShip(ShipLoadSpecifications const & loadSpecs)
+{
+    // Keep the ocean floor, as the game does
+    ResetWorld(OceanFloorHeightMap(mWorld->GetOceanFloorHeightMap()));
+
+    AddShip(loadSpecs);
+}
+
+void HeadlessSimulation::RunSimulationStep()
+{
+    auto const startTime = GameChronometer::Now();
+
+    // Feed recorded inputs for this step, as the game does
+    VisibleWorld const * visibleWorld = &mVisibleWorld;
+    if (mInputReplayer)
+    {
+        visibleWorld = &(mInputReplayer->OnSimulationStep(*this));
+    }
+
+    mWallClock.AdvanceDeterministicTime(
+        std::chrono::duration_cast<GameWallClock::duration>(
+            std::chrono::duration<double>(SimulationParameters::SimulationStepTimeDuration<double>)));
+
+    mWorld->Update(
+        GetWorldSimulationParameters(),
+        *visibleWorld,
+        StressRenderModeType::None,
+        mThreadManager,
+        mPerfStats);
+
+    if (mInputReplayer && mInputReplayer->IsCompleted())
+    {
+        mIsReplayFinalStateMatching = mInputReplayer->OnCompleted(*this);
+        mInputReplayer.reset();
+    }
+
+    auto const endTime = GameChronometer::Now();
+    mPerfStats.Update<PerfMeasurement::TotalNetUpdate>(endTime - startTime);
+    mPerfStats.Update<PerfMeasurement::TotalUpdate>(endTime - startTime);
+
+    ++mStepCount;
+}
+
+void HeadlessSimulation::ResetWorld(OceanFloorHeightMap && oceanFloorHeightMap)
+{
+    mWorld = std::make_unique<Physics::World>(
+        std::move(oceanFloorHeightMap),
+        mDatabases->FishSpeciesDb,
+        mDatabases->UnderwaterPlantsSpeciesCount,
+        mDatabases->NpcDb,
+        mSimulationEventDispatcher,
+        GetWorldSimulationParameters());
+
+    // Headless runs are always deterministic sessions
+    mWorld->SetDeterministicSession(true);
+
+    // Default view, until a ship is added
+    mVisibleWorld.Center = vec2f::zero();
+    mVisibleWorld.Width = 200.0f;
+    mVisibleWorld.Height = 112.5f;
+    mVisibleWorld.TopLeft = vec2f(-mVisibleWorld.Width / 2.0f, mVisibleWorld.Height / 2.0f);
+    mVisibleWorld.BottomRight = vec2f(mVisibleWorld.Width / 2.0f, -mVisibleWorld.Height / 2.0f);
+}
@@ -0,0 +1,243 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameAssetManager.h"
+#include "InputRecording.h"
+#include "ShipLoadSpecifications.h"
+
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/ShipDefinition.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+
+#include <Core/GameRandomEngine.h>
+#include <Core/GameTypes.h>
+#include <Core/GameWallClock.h>
+#include <Core/IAssetManager.h>
+#include <Core/PerfStats.h>
+#include <Core/ThreadManager.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+/*
+ * A World simulated without rendering, sound, or UI - for tools that need to
+ * run the simulation on real ships, such as benchmarks.
+ *
+ * Runs in a deterministic session: the simulation has its own random engine,
+ * seeded with the specified seed, and its own wall clock, which advances by
+ * exactly one simulation step at each update; so the same inputs produce the
+ * same simulation, also when multiple simulations run side by side.
+ *
+ * Code acting directly on the world, rather than via this class, must do so
+ * within a ThreadScope, for the world to see the simulation's engine and clock.
+ *
+ * May also replay an input recording made in the game, without any UI.
+ *
+ * Besides the game's assets, may also run on databases and ships made from
+ * scratch, as tests do.
+ */
+class HeadlessSimulation final : public IInputReplayTarget
+{
+public:
+
+    /*
+     * The read-only databases of a simulation, which may be shared among
+     * simulations running in parallel.
+     */
+    struct Databases
+    {
+        MaterialDatabase const MaterialDb;
+        FishSpeciesDatabase const FishSpeciesDb;
+        NpcDatabase const NpcDb;
+        size_t const UnderwaterPlantsSpeciesCount;
+
+        explicit Databases(GameAssetManager const & gameAssetManager);
+
+        Databases(
+            MaterialDatabase && materialDb,
+            FishSpeciesDatabase && fishSpeciesDb,
+            NpcDatabase && npcDb,
+            size_t underwaterPlantsSpeciesCount);
+
+        Databases(Databases const &) = delete;
+        Databases & operator=(Databases const &) = delete;
+    };
+
+    /*
+     * Binds the simulation's random engine and wall clock to the calling thread,
+     * for the lifetime of the scope.
+     */
+    class ThreadScope final
+    {
+    public:
+
+        explicit ThreadScope(HeadlessSimulation & simulation)
+            : mRandomEngineScope(&simulation.mRandomEngine)
+            , mWallClockScope(&simulation.mWallClock)
+        {}
+
+    private:
+
+        GameRandomEngine::ThreadScope const mRandomEngineScope;
+        GameWallClock::ThreadScope const mWallClockScope;
+    };
+
+public:
+
+    HeadlessSimulation(
+        GameAssetManager const & gameAssetManager,
+        ThreadManager & threadManager,
+        std::uint32_t seed);
+
+    HeadlessSimulation(
+        GameAssetManager const & gameAssetManager,
+        std::shared_ptr<Databases const> databases,
+        ThreadManager & threadManager,
+        std::uint32_t seed);
+
+    HeadlessSimulation(
+        IAssetManager const & assetManager,
+        std::shared_ptr<Databases const> databases,
+        OceanFloorHeightMap && oceanFloorHeightMap,
+        ThreadManager & threadManager,
+        std::uint32_t seed);
+
+    HeadlessSimulation(HeadlessSimulation const &) = delete;
+    HeadlessSimulation & operator=(HeadlessSimulation const &) = delete;
+
+    /*
+     * Loads a ship into the world, and centers the visible world on it.
+     */
+    ShipId AddShip(ShipLoadSpecifications const & loadSpecs);
+
+    ShipId AddShip(
+        ShipDefinition && shipDefinition,
+        ShipLoadOptions const & loadOptions);
+
+    /*
+     * Resets the world to the initial state of the recording, and starts feeding
+     * its inputs at each update, until the replay is completed.
+     *
+     * Replaying is bit-identical only with the same simulation parallelism as
+     * the recording's, which is left to the owner of the thread manager.
+     */
+    void StartReplay(InputRecording && recording);
+
+    bool IsReplaying() const
+    {
+        return !!mInputReplayer;
+    }
+
+    /*
+     * Whether the last completed replay has reproduced the final state of its recording;
+     * none when the recording has no final state.
+     */
+    std::optional<bool> IsReplayFinalStateMatching() const
+    {
+        return mIsReplayFinalStateMatching;
+    }
+
+    /*
+     * Runs one simulation step.
+     */
+    void Update();
+
+    /*
+     * Runs the simulation for the specified simulation time with the same FastForwarder
+     * the game uses: steps run back-to-back, and events are flushed only at the end.
+     * Returns the number of steps run.
+     */
+    size_t FastForward(float simulationDuration);
+
+    Physics::World & GetWorld()
+    {
+        return *mWorld;
+    }
+
+    Physics::World const & GetWorld() const
+    {
+        return *mWorld;
+    }
+
+    SimulationParameters & GetSimulationParameters()
+    {
+        return mSimulationParameters;
+    }
+
+    VisibleWorld & GetVisibleWorld()
+    {
+        return mVisibleWorld;
+    }
+
+    PerfStats const & GetPerfStats() const
+    {
+        return mPerfStats;
+    }
+
+    std::uint64_t GetStepCount() const
+    {
+        return mStepCount;
+    }
+
+    //
+    // IInputReplayTarget
+    //
+
+    Physics::World & GetReplayWorld() override
+    {
+        return *mWorld;
+    }
+
+    void ReplayAddShip(ShipLoadSpecifications const & loadSpecs) override;
+
+    void ReplayResetAndLoadShip(ShipLoadSpecifications const & loadSpecs) override;
+
+private:
+
+    // The parameters the world runs with: while replaying, those of the recording
+    SimulationParameters const & GetWorldSimulationParameters() const
+    {
+        return mInputReplayer
+            ? mInputReplayer->GetSimulationParameters()
+            : mSimulationParameters;
+    }
+
+    void ResetWorld(OceanFloorHeightMap && oceanFloorHeightMap);
+
+    void RunSimulationStep();
+
+private:
+
+    IAssetManager const & mAssetManager;
+    ThreadManager & mThreadManager;
+
+    std::shared_ptr<Databases const> const mDatabases;
+    ShipStrengthRandomizer mShipStrengthRandomizer;
+    ShipTexturizer mShipTexturizer; // Not shared, as it caches textures
+
+    GameRandomEngine mRandomEngine;
+    GameWallClock mWallClock;
+
+    SimulationParameters mSimulationParameters;
+    SimulationEventDispatcher mSimulationEventDispatcher;
+    std::unique_ptr<Physics::World> mWorld;
+    std::unique_ptr<InputReplayer> mInputReplayer;
+    std::optional<bool> mIsReplayFinalStateMatching;
+
+    VisibleWorld mVisibleWorld;
+    PerfStats mPerfStats;
+    std::uint64_t mStepCount;
+};
@@ -0,0 +1,155 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "HeadlessSimulationBatch.h"
+
+#include <Core/Log.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace /* anonymous */ {
+
+    float CalculateSubmergedPointsFraction(Physics::Ship const & ship)
+    {
+        ElementCount const pointCount = ship.GetPoints().GetRawShipPointCount();
+        if (pointCount == 0)
+        {
+            return 0.0f;
+        }
+
+        ElementCount submergedPointCount = 0;
+        for (ElementIndex p = 0; p < pointCount; ++p)
+        {
+            if (ship.IsUnderwater(p))
+            {
+                ++submergedPointCount;
+            }
+        }
+
+        return static_cast<float>(submergedPointCount) / static_cast<float>(pointCount);
+    }
+
+    float CalculateBrokenSpringsFraction(Physics::Ship const & ship)
+    {
+        auto const & springs = ship.GetSprings();
+        if (springs.GetElementCount() == 0)
+        {
+            return 0.0f;
+        }
+
+        ElementCount brokenSpringCount = 0;
+        for (auto const springIndex : springs)
+        {
+            if (springs.IsDeleted(springIndex))
+            {
+                ++brokenSpringCount;
+            }
+        }
+
+        return static_cast<float>(brokenSpringCount) / static_cast<float>(springs.GetElementCount());
+    }
+
+}
+
+HeadlessSimulationBatch::HeadlessSimulationBatch(
+    GameAssetManager const & gameAssetManager,
+    ThreadManager & threadManager)
+    : mGameAssetManager(gameAssetManager)
+    , mThreadManager(threadManager)
+    , mDatabases(std::make_shared<HeadlessSimulation::Databases const>(gameAssetManager))
+{
+}
+
+std::vector<HeadlessSimulationBatch::WorldMetrics> HeadlessSimulationBatch::Run(std::vector<WorldSpecification> const & worldSpecifications) const
+{
+    std::vector<WorldMetrics> worldMetrics(worldSpecifications.size());
+
+    if (worldSpecifications.empty())
+    {
+        return worldMetrics;
+    }
+
+    auto & threadPool = mThreadManager.GetSimulationThreadPool();
+
+    // One task per thread, each taking the next world as soon as it's done
+    // with the previous one, so that long worlds do not hold up the others
+    std::atomic<size_t> nextWorldIndex = 0;
+
+    std::vector<ThreadPool::Task> tasks;
+    size_t const taskCount = std::min(threadPool.GetParallelism(), worldSpecifications.size());
+    for (size_t t = 0; t < taskCount; ++t)
+    {
+        tasks.emplace_back(
+            [&]()
+            {
+                for (size_t w = nextWorldIndex++; w < worldSpecifications.size(); w = nextWorldIndex++)
+                {
+                    worldMetrics[w] = RunWorld(worldSpecifications[w]);
+                }
+            });
+    }
+
+    threadPool.Run(tasks);
+
+    return worldMetrics;
+}
+
+HeadlessSimulationBatch::WorldMetrics HeadlessSimulationBatch::RunWorld(WorldSpecification const & worldSpecification) const
+{
+    WorldMetrics metrics;
+
+    try
+    {
+        // The world is simulated entirely on this thread; with a parallelism of one,
+        // no threads are started, hence the CPU does not matter
+        ThreadManager worldThreadManager(
+            false,
+            1,
+            { ThreadManager::CpuInfo(0, 1.0f) },
+            [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {});
+
+        HeadlessSimulation simulation(
+            mGameAssetManager,
+            mDatabases,
+            worldThreadManager,
+            worldSpecification.Seed);
+
+        ShipId const shipId = simulation.AddShip(worldSpecification.ShipLoadSpecs);
+
+        for (size_t s = 0; s < worldSpecification.StepCount; ++s)
+        {
+            if (worldSpecification.Action)
+            {
+                HeadlessSimulation::ThreadScope const threadScope(simulation);
+                worldSpecification.Action(simulation, shipId, s);
+            }
+
+            auto const startTime = GameChronometer::Now();
+
+            simulation.Update();
+
+            metrics.UpdateDuration += GameChronometer::Now() - startTime;
+            ++metrics.StepCount;
+
+            metrics.SubmergedPointsFraction = CalculateSubmergedPointsFraction(simulation.GetWorld().GetShip(shipId));
+            if (!metrics.SunkStepCount.has_value() && metrics.SubmergedPointsFraction >= SunkSubmergedPointsFraction)
+            {
+                metrics.SunkStepCount = metrics.StepCount;
+            }
+        }
+
+        metrics.BrokenSpringsFraction = CalculateBrokenSpringsFraction(simulation.GetWorld().GetShip(shipId));
+    }
+    catch (std::exception const & ex)
+    {
+        LogMessage("HeadlessSimulationBatch: error simulating ", worldSpecification.ShipLoadSpecs.DefinitionFilepath.string(), ": ", ex.what());
+
+        metrics.Error = ex.what();
+    }
+
+    return metrics;
+}
@@ -0,0 +1,90 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameAssetManager.h"
+#include "HeadlessSimulation.h"
+#include "ShipLoadSpecifications.h"
+
+#include <Core/GameChronometer.h>
+#include <Core/GameTypes.h>
+#include <Core/ThreadManager.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * Runs many independent headless simulations in parallel, one world per task, for
+ * validating ships in bulk - e.g. whether they float, how long they take to sink,
+ * or how much of them survives a number of bombs.
+ *
+ * All worlds share the same read-only databases, which are loaded only once. Each
+ * world runs on one thread with its own random engine and wall clock, hence it yields
+ * the same results it yields when simulated alone with a simulation parallelism of one.
+ */
+class HeadlessSimulationBatch final
+{
+public:
+
+    // A ship is deemed sunk once this fraction of its points is underwater
+    static float constexpr SunkSubmergedPointsFraction = 0.9f;
+
+    struct WorldSpecification
+    {
+        ShipLoadSpecifications ShipLoadSpecs;
+        std::uint32_t Seed;
+        size_t StepCount;
+        std::function<void(HeadlessSimulation &, ShipId, size_t)> Action; // Optional; invoked before each step, with the step index
+
+        WorldSpecification(
+            ShipLoadSpecifications const & shipLoadSpecs,
+            std::uint32_t seed,
+            size_t stepCount,
+            std::function<void(HeadlessSimulation &, ShipId, size_t)> action = {})
+            : ShipLoadSpecs(shipLoadSpecs)
+            , Seed(seed)
+            , StepCount(stepCount)
+            , Action(std::move(action))
+        {}
+    };
+
+    struct WorldMetrics
+    {
+        std::optional<std::string> Error; // Set when the world could not be simulated, e.g. when the ship could not be loaded
+        size_t StepCount = 0;
+        GameChronometer::duration UpdateDuration = GameChronometer::duration::zero(); // Of all steps
+        float SubmergedPointsFraction = 0.0f; // At the end
+        float BrokenSpringsFraction = 0.0f; // At the end
+        std::optional<size_t> SunkStepCount; // Number of steps after which the ship was first deemed sunk
+    };
+
+public:
+
+    HeadlessSimulationBatch(
+        GameAssetManager const & gameAssetManager,
+        ThreadManager & threadManager);
+
+    /*
+     * Simulates all worlds on the simulation thread pool of the thread manager, and
+     * returns their metrics in the same order as the specifications.
+     */
+    std::vector<WorldMetrics> Run(std::vector<WorldSpecification> const & worldSpecifications) const;
+
+private:
+
+    WorldMetrics RunWorld(WorldSpecification const & worldSpecification) const;
+
+private:
+
+    GameAssetManager const & mGameAssetManager;
+    ThreadManager & mThreadManager;
+
+    std::shared_ptr<HeadlessSimulation::Databases const> const mDatabases;
+};
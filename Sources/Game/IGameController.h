@@ -7,6 +7,7 @@
 
 #include "GameAssetManager.h"
 #include "IGameEventHandlers.h"
+#include "InputRecording.h"
 #include "ShipLoadSpecifications.h"
 
 #include <Simulation/EventRecorder.h>
@@ -55,10 +56,25 @@ struct IGameController
 
     virtual void PulseUpdateAtNextGameIteration() = 0;
 
+    // Fast-forward: runs the simulation for the specified simulation time without
+    // rendering, then resumes rendering
+    virtual void StartFastForward(float simulationDuration) = 0;
+    virtual void StopFastForward() = 0;
+    virtual bool IsFastForwarding() const = 0;
+
     virtual void StartRecordingEvents(std::function<void(uint32_t, RecordedEvent const &)> onEventCallback) = 0;
     virtual RecordedEvents StopRecordingEvents() = 0;
     virtual void ReplayRecordedEvent(RecordedEvent const & event) = 0;
 
+    // Deterministic sessions: both reset the world and load the ship, with the simulation
+    // driven by a clock that only advances with simulation steps
+    virtual ShipMetadata StartRecordingInput(ShipLoadSpecifications const & loadSpecs, IAssetManager const & assetManager, std::uint32_t seed) = 0;
+    virtual InputRecording StopRecordingInput() = 0;
+    virtual ShipMetadata StartReplayingInput(InputRecording && recording, IAssetManager const & assetManager) = 0;
+    virtual void StopReplayingInput() = 0;
+    virtual bool IsRecordingInput() const = 0;
+    virtual bool IsReplayingInput() const = 0;
+
 
     //
     // Game Control and notifications
@@ -53,6 +53,29 @@ struct IGameEventHandler
     {
         // Default-implemented
     }
+
+    // Simulation steps run back-to-back without rendering, and without sounds
+    // being expected, between these two
+    virtual void OnFastForwardStarted()
+    {
+        // Default-implemented
+    }
+
+    virtual void OnFastForwardEnded()
+    {
+        // Default-implemented
+    }
+
+    // Live input is ignored between these two, as the world is driven by a recording
+    virtual void OnInputReplayStarted()
+    {
+        // Default-implemented
+    }
+
+    virtual void OnInputReplayEnded()
+    {
+        // Default-implemented
+    }
 };
 
 struct IGameStatisticsEventHandler
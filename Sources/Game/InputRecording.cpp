@@ -0,0 +1,1166 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "InputRecording.h"
+
+#include <Simulation/StateSnapshot.h>
+
+#include <Core/DeSerializationBuffer.h>
+#include <Core/GameExceptions.h>
+#include <Core/MemoryStreams.h>
+#include <Core/Utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+static std::uint32_t constexpr InputRecordingMagic = 0x46534952; // FSIR
+static std::uint16_t constexpr InputRecordingVersion = 3; // 2: final state digests; 3: simulation parameters by name
+
+///////////////////////////////////////////////////////////////////////////////////////
+// SimulationParametersRecording
+///////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template<typename T>
+RecordedSimulationParameterValue ToRecordedValue(T const & value)
+{
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, float>)
+    {
+        return value;
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<std::int64_t>(value);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        return static_cast<std::int64_t>(value);
+    }
+    else
+    {
+        // std::chrono::duration
+        return static_cast<std::int64_t>(value.count());
+    }
+}
+
+template<typename T>
+bool FromRecordedValue(
+    RecordedSimulationParameterValue const & recordedValue,
+    T & value)
+{
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, float>)
+    {
+        if (!std::holds_alternative<T>(recordedValue))
+            return false;
+
+        value = std::get<T>(recordedValue);
+    }
+    else
+    {
+        if (!std::holds_alternative<std::int64_t>(recordedValue))
+            return false;
+
+        auto const intValue = std::get<std::int64_t>(recordedValue);
+        if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+        {
+            value = static_cast<T>(intValue);
+        }
+        else
+        {
+            // std::chrono::duration
+            value = T(static_cast<typename T::rep>(intValue));
+        }
+    }
+
+    return true;
+}
+
+struct SimulationParameterField
+{
+    char const * Name;
+    RecordedSimulationParameterValue(*Get)(SimulationParameters const &);
+    bool(*Set)(SimulationParameters &, RecordedSimulationParameterValue const &);
+};
+
+template<auto Member>
+SimulationParameterField MakeSimulationParameterField(char const * name)
+{
+    return SimulationParameterField{
+        name,
+        [](SimulationParameters const & parameters) -> RecordedSimulationParameterValue
+        {
+            return ToRecordedValue(parameters.*Member);
+        },
+        [](SimulationParameters & parameters, RecordedSimulationParameterValue const & recordedValue) -> bool
+        {
+            return FromRecordedValue(recordedValue, parameters.*Member);
+        } };
+}
+
+#define FS_SIMULATION_PARAMETER_FIELD(name) MakeSimulationParameterField<&SimulationParameters::name>(#name)
+
+// All the parameters that may change during a session; names are stored in recordings,
+// hence they must not change
+SimulationParameterField const SimulationParameterFields[] = {
+    FS_SIMULATION_PARAMETER_FIELD(NumMechanicalDynamicsIterationsAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(SpringStiffnessAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(SpringDampingAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(SpringStrengthAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(GlobalDampingAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(ElasticityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(StaticFrictionAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(KineticFrictionAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(RotAcceler8r),
+    FS_SIMULATION_PARAMETER_FIELD(StaticPressureForceAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(LiftForceAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(RustAcceler8r),
+    FS_SIMULATION_PARAMETER_FIELD(RustWeaknessAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(AlgaeGrowthAcceler8r),
+    FS_SIMULATION_PARAMETER_FIELD(AirDensityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(AirFrictionDragAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(AirPressureDragAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterDensityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterFrictionDragAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterPressureDragAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterImpactForceAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterIntakeAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterDiffusionSpeedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterCrazyness),
+    FS_SIMULATION_PARAMETER_FIELD(SeaDepth),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorBedrockBumpiness),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorBedrockDetailAmplification),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorBedrockElasticityCoefficient),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorBedrockFrictionCoefficient),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorSiltThickness),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorSiltBumpiness),
+    FS_SIMULATION_PARAMETER_FIELD(OceanFloorSiltHardness),
+    FS_SIMULATION_PARAMETER_FIELD(MaxEphemeralParticles),
+    FS_SIMULATION_PARAMETER_FIELD(DoGenerateDebris),
+    FS_SIMULATION_PARAMETER_FIELD(SmokeMassAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(SmokeEmitterSmokeEmissionDensityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(SmokeEmitterSmokeParticleLifetimeAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(DoEmitSmokeWithFire),
+    FS_SIMULATION_PARAMETER_FIELD(CombustionSmokeEmissionDensityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(CombustionSmokeParticleLifetimeAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(DoGenerateSparklesForCuts),
+    FS_SIMULATION_PARAMETER_FIELD(AirBubblesDensity),
+    FS_SIMULATION_PARAMETER_FIELD(DoGenerateEngineWakeParticles),
+    FS_SIMULATION_PARAMETER_FIELD(SiltDustCloudSensitivity),
+    FS_SIMULATION_PARAMETER_FIELD(SiltDustCloudUnderwaterLifetime),
+    FS_SIMULATION_PARAMETER_FIELD(DoModulateWind),
+    FS_SIMULATION_PARAMETER_FIELD(WindSpeedBase),
+    FS_SIMULATION_PARAMETER_FIELD(WindSpeedMaxFactor),
+    FS_SIMULATION_PARAMETER_FIELD(WindGustFrequencyAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(BasalWaveHeightAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(BasalWaveLengthAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(BasalWaveSpeedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(InteractiveWaveGrowthRateAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(TsunamiRate),
+    FS_SIMULATION_PARAMETER_FIELD(RogueWaveRate),
+    FS_SIMULATION_PARAMETER_FIELD(DoDisplaceWater),
+    FS_SIMULATION_PARAMETER_FIELD(WaterDisplacementWaveHeightAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterFoamSensitivityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterFoamLifetimeAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaterSplashSensitivityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(WaveSmoothnessAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(StormRate),
+    FS_SIMULATION_PARAMETER_FIELD(StormDuration),
+    FS_SIMULATION_PARAMETER_FIELD(StormStrengthAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(LightningBlastProbability),
+    FS_SIMULATION_PARAMETER_FIELD(LightningBlastRadius),
+    FS_SIMULATION_PARAMETER_FIELD(LightningBlastHeat),
+    FS_SIMULATION_PARAMETER_FIELD(DoRainWithStorm),
+    FS_SIMULATION_PARAMETER_FIELD(RainFloodAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(AirTemperature),
+    FS_SIMULATION_PARAMETER_FIELD(WaterTemperature),
+    FS_SIMULATION_PARAMETER_FIELD(MaxBurningParticlesPerShip),
+    FS_SIMULATION_PARAMETER_FIELD(ThermalConductivityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(HeatDissipationAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(IgnitionTemperatureAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(MeltingTemperatureAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(CombustionSpeedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(CombustionHeatAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(HeatBlasterHeatFlow),
+    FS_SIMULATION_PARAMETER_FIELD(HeatBlasterRadius),
+    FS_SIMULATION_PARAMETER_FIELD(LaserRayHeatFlow),
+    FS_SIMULATION_PARAMETER_FIELD(LuminiscenceAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(LightSpreadAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(ElectricalElementHeatProducedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(DoShowElectricalNotifications),
+    FS_SIMULATION_PARAMETER_FIELD(EngineThrustAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(DoEnginesWorkAboveWater),
+    FS_SIMULATION_PARAMETER_FIELD(WaterPumpPowerAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(NumberOfFishes),
+    FS_SIMULATION_PARAMETER_FIELD(FishSizeMultiplier),
+    FS_SIMULATION_PARAMETER_FIELD(FishSpeedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(DoFishShoaling),
+    FS_SIMULATION_PARAMETER_FIELD(FishShoalRadiusAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(UnderwaterPlantsDensity),
+    FS_SIMULATION_PARAMETER_FIELD(UnderwaterPlantSizeMultiplier),
+    FS_SIMULATION_PARAMETER_FIELD(NpcSpringReductionFractionAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(NpcSpringDampingCoefficientAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(NpcFrictionAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(NpcWindReceptivityAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(NpcSizeMultiplier),
+    FS_SIMULATION_PARAMETER_FIELD(NpcPassiveBlastRadiusAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(HumanNpcEquilibriumTorqueStiffnessCoefficient),
+    FS_SIMULATION_PARAMETER_FIELD(HumanNpcEquilibriumTorqueDampingCoefficient),
+    FS_SIMULATION_PARAMETER_FIELD(HumanNpcWalkingSpeedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(MaxNpcs),
+    FS_SIMULATION_PARAMETER_FIELD(NpcsPerGroup),
+    FS_SIMULATION_PARAMETER_FIELD(NumberOfStars),
+    FS_SIMULATION_PARAMETER_FIELD(NumberOfClouds),
+    FS_SIMULATION_PARAMETER_FIELD(DoDayLightCycle),
+    FS_SIMULATION_PARAMETER_FIELD(DayLightCycleDuration),
+    FS_SIMULATION_PARAMETER_FIELD(DestroyRadius),
+    FS_SIMULATION_PARAMETER_FIELD(RepairRadius),
+    FS_SIMULATION_PARAMETER_FIELD(RepairSpeedAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(DoApplyPhysicsToolsToShips),
+    FS_SIMULATION_PARAMETER_FIELD(DoApplyPhysicsToolsToNpcs),
+    FS_SIMULATION_PARAMETER_FIELD(BombBlastRadius),
+    FS_SIMULATION_PARAMETER_FIELD(BombBlastForceAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(BombBlastHeat),
+    FS_SIMULATION_PARAMETER_FIELD(AntiMatterBombImplosionStrength),
+    FS_SIMULATION_PARAMETER_FIELD(TimerBombInterval),
+    FS_SIMULATION_PARAMETER_FIELD(InjectPressureQuantity),
+    FS_SIMULATION_PARAMETER_FIELD(FloodRadius),
+    FS_SIMULATION_PARAMETER_FIELD(FloodQuantity),
+    FS_SIMULATION_PARAMETER_FIELD(FireExtinguisherRadius),
+    FS_SIMULATION_PARAMETER_FIELD(BlastToolRadius),
+    FS_SIMULATION_PARAMETER_FIELD(BlastToolForceAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(ScrubRustToolRadius),
+    FS_SIMULATION_PARAMETER_FIELD(WindMakerToolWindSpeed),
+    FS_SIMULATION_PARAMETER_FIELD(AntiGravityFieldAccelerationAdjustment),
+    FS_SIMULATION_PARAMETER_FIELD(IsUltraViolentMode),
+    FS_SIMULATION_PARAMETER_FIELD(MoveToolInertia),
+    FS_SIMULATION_PARAMETER_FIELD(SpringRelaxationParallelComputationMode),
+    FS_SIMULATION_PARAMETER_FIELD(IsLightingEnabled)
+};
+
+#undef FS_SIMULATION_PARAMETER_FIELD
+
+}
+
+RecordedSimulationParameters SimulationParametersRecording::Capture(SimulationParameters const & parameters)
+{
+    RecordedSimulationParameters recordedParameters;
+    for (auto const & field : SimulationParameterFields)
+    {
+        recordedParameters.emplace_back(field.Name, field.Get(parameters));
+    }
+
+    return recordedParameters;
+}
+
+RecordedSimulationParameters SimulationParametersRecording::CaptureChanges(
+    SimulationParameters const & oldParameters,
+    SimulationParameters const & newParameters)
+{
+    RecordedSimulationParameters recordedParameters;
+    for (auto const & field : SimulationParameterFields)
+    {
+        auto newValue = field.Get(newParameters);
+        if (newValue != field.Get(oldParameters))
+        {
+            recordedParameters.emplace_back(field.Name, std::move(newValue));
+        }
+    }
+
+    return recordedParameters;
+}
+
+void SimulationParametersRecording::Apply(
+    RecordedSimulationParameters const & recordedParameters,
+    SimulationParameters & parameters)
+{
+    for (auto const & [name, value] : recordedParameters)
+    {
+        auto const fieldIt = std::find_if(
+            std::cbegin(SimulationParameterFields),
+            std::cend(SimulationParameterFields),
+            [&name = name](SimulationParameterField const & field)
+            {
+                return name == field.Name;
+            });
+
+        // Parameters unknown to this build are ignored
+        if (fieldIt != std::cend(SimulationParameterFields))
+        {
+            if (!fieldIt->Set(parameters, value))
+            {
+                throw GameException("Input recording contains simulation parameter \"" + name + "\" with an unexpected type");
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// InputRecording
+///////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::uint64_t> InputRecording::CalculateStateDigests(Physics::World const & world)
+{
+    auto const snapshot = StateSnapshot::Capture(world, 0);
+
+    std::vector<std::uint64_t> digests;
+    for (size_t ss = 0; ss < StateSnapshot::SubsystemCount; ++ss)
+    {
+        digests.push_back(snapshot.CalculateDigest(static_cast<StateSubsystemType>(ss)));
+    }
+
+    return digests;
+}
+
+void InputRecording::SaveToStream(BinaryWriteStream & outputStream) const
+{
+    DeSerializationBuffer<BigEndianess> buffer(1024 * 1024);
+
+    //
+    // Header
+    //
+
+    buffer.Append(InputRecordingMagic);
+    buffer.Append(InputRecordingVersion);
+
+    buffer.Append(Seed);
+    buffer.Append(SimulationParallelism);
+    buffer.Append(picojson::value(ShipLoadSpecs.ToJson()).serialize());
+
+    // Simulation parameters: by name, encoded as an input's arguments
+    RecordedInput simulationParametersInput(0, RecordedInputType::SimulationParametersChange);
+    simulationParametersInput.WriteArguments(SimulationParametersRecording::Capture(InitialSimulationParameters));
+    buffer.Append(static_cast<std::uint32_t>(simulationParametersInput.Payload.size()));
+    buffer.Append(simulationParametersInput.Payload.data(), simulationParametersInput.Payload.size());
+
+    MemoryBinaryWriteStream oceanFloorStream;
+    InitialOceanFloorHeightMap.SaveToStream(oceanFloorStream);
+    buffer.Append(static_cast<std::uint32_t>(oceanFloorStream.GetSize()));
+    buffer.Append(oceanFloorStream.GetData(), oceanFloorStream.GetSize());
+
+    buffer.Append(StepCount);
+
+    buffer.Append(static_cast<std::uint32_t>(FinalStateDigests.size()));
+    for (auto const digest : FinalStateDigests)
+    {
+        buffer.Append(digest);
+    }
+
+    //
+    // Inputs
+    //
+
+    buffer.Append(static_cast<std::uint64_t>(Inputs.size()));
+
+    for (auto const & input : Inputs)
+    {
+        buffer.Append(input.Step);
+        buffer.Append(static_cast<std::uint16_t>(input.Type));
+        buffer.Append(static_cast<std::uint32_t>(input.Payload.size()));
+        buffer.Append(input.Payload.data(), input.Payload.size());
+    }
+
+    outputStream.Write(buffer.GetData(), buffer.GetSize());
+}
+
+InputRecording InputRecording::LoadFromStream(BinaryReadStream & inputStream)
+{
+    size_t const size = inputStream.GetSize();
+
+    DeSerializationBuffer<BigEndianess> buffer(size);
+    inputStream.Read(buffer.Receive(size), size);
+
+    size_t offset = 0;
+
+    auto const ensureAvailable = [&](size_t count)
+        {
+            if (offset + count > size)
+            {
+                throw GameException("Input recording is truncated");
+            }
+        };
+
+    //
+    // Header
+    //
+
+    ensureAvailable(sizeof(std::uint32_t) + sizeof(std::uint16_t));
+
+    std::uint32_t magic;
+    offset += buffer.ReadAt(offset, magic);
+    if (magic != InputRecordingMagic)
+    {
+        throw GameException("File is not an input recording");
+    }
+
+    std::uint16_t version;
+    offset += buffer.ReadAt(offset, version);
+    // Versions before 3 stored simulation parameters as the raw bytes of the struct
+    if (version < 3 || version > InputRecordingVersion)
+    {
+        throw GameException("Input recording was made with an incompatible version of the game");
+    }
+
+    ensureAvailable(2 * sizeof(std::uint32_t));
+
+    std::uint32_t seed;
+    offset += buffer.ReadAt(offset, seed);
+
+    std::uint32_t simulationParallelism;
+    offset += buffer.ReadAt(offset, simulationParallelism);
+
+    ensureAvailable(sizeof(std::uint32_t));
+    std::string shipLoadSpecsJson;
+    offset += buffer.ReadAt(offset, shipLoadSpecsJson);
+    auto const shipLoadSpecs = ShipLoadSpecifications::FromJson(
+        Utils::ParseJSONString(shipLoadSpecsJson).get<picojson::object>());
+
+    ensureAvailable(sizeof(std::uint32_t));
+    std::uint32_t simulationParametersSize;
+    offset += buffer.ReadAt(offset, simulationParametersSize);
+
+    ensureAvailable(simulationParametersSize);
+    std::vector<std::uint8_t> simulationParametersData(simulationParametersSize);
+    offset += buffer.ReadAt(offset, simulationParametersData.data(), simulationParametersSize);
+    RecordedInput const simulationParametersInput(0, RecordedInputType::SimulationParametersChange, std::move(simulationParametersData));
+
+    // Parameters missing from the recording keep this build's defaults
+    SimulationParameters simulationParameters;
+    SimulationParametersRecording::Apply(
+        std::get<0>(simulationParametersInput.ReadArguments<RecordedSimulationParameters>()),
+        simulationParameters);
+
+    ensureAvailable(sizeof(std::uint32_t));
+    std::uint32_t oceanFloorSize;
+    offset += buffer.ReadAt(offset, oceanFloorSize);
+
+    ensureAvailable(oceanFloorSize);
+    std::vector<std::uint8_t> oceanFloorData(oceanFloorSize);
+    offset += buffer.ReadAt(offset, oceanFloorData.data(), oceanFloorSize);
+    MemoryBinaryReadStream oceanFloorStream(std::move(oceanFloorData));
+
+    InputRecording recording(
+        seed,
+        simulationParallelism,
+        shipLoadSpecs,
+        simulationParameters,
+        OceanFloorHeightMap::LoadFromStream(oceanFloorStream));
+
+    ensureAvailable(sizeof(std::uint64_t));
+
+    offset += buffer.ReadAt(offset, recording.StepCount);
+
+    ensureAvailable(sizeof(std::uint32_t));
+
+    std::uint32_t digestCount;
+    offset += buffer.ReadAt(offset, digestCount);
+
+    ensureAvailable(digestCount * sizeof(std::uint64_t));
+
+    recording.FinalStateDigests.resize(digestCount);
+    for (auto & digest : recording.FinalStateDigests)
+    {
+        offset += buffer.ReadAt(offset, digest);
+    }
+
+    //
+    // Inputs
+    //
+
+    ensureAvailable(sizeof(std::uint64_t));
+
+    std::uint64_t inputCount;
+    offset += buffer.ReadAt(offset, inputCount);
+
+    // Do not trust the count before reserving for it
+    size_t constexpr MinInputSize = sizeof(std::uint64_t) + sizeof(std::uint16_t) + sizeof(std::uint32_t);
+    if (inputCount > (size - offset) / MinInputSize)
+    {
+        throw GameException("Input recording is truncated");
+    }
+
+    recording.Inputs.reserve(static_cast<size_t>(inputCount));
+
+    for (std::uint64_t i = 0; i < inputCount; ++i)
+    {
+        ensureAvailable(MinInputSize);
+
+        std::uint64_t step;
+        offset += buffer.ReadAt(offset, step);
+
+        std::uint16_t type;
+        offset += buffer.ReadAt(offset, type);
+        if (type > static_cast<std::uint16_t>(RecordedInputType::_Last))
+        {
+            throw GameException("Input recording contains an unrecognized input");
+        }
+
+        std::uint32_t payloadSize;
+        offset += buffer.ReadAt(offset, payloadSize);
+
+        ensureAvailable(payloadSize);
+        std::vector<std::uint8_t> payload(payloadSize);
+        offset += buffer.ReadAt(offset, payload.data(), payloadSize);
+
+        recording.Inputs.emplace_back(
+            step,
+            static_cast<RecordedInputType>(type),
+            std::move(payload));
+    }
+
+    return recording;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// InputRecorder
+///////////////////////////////////////////////////////////////////////////////////////
+
+void InputRecorder::OnSimulationParameters(SimulationParameters const & simulationParameters)
+{
+    // Only record the parameters that have changed, as parameters change a few at a time
+    auto const changes = SimulationParametersRecording::CaptureChanges(mLastSimulationParameters, simulationParameters);
+    if (!changes.empty())
+    {
+        Record(RecordedInputType::SimulationParametersChange, changes);
+        SimulationParametersRecording::Apply(changes, mLastSimulationParameters);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+// InputReplayer
+///////////////////////////////////////////////////////////////////////////////////////
+
+VisibleWorld const & InputReplayer::OnSimulationStep(IInputReplayTarget & target)
+{
+    ApplyInputsUpToCurrentStep(target);
+
+    ++mCurrentStep;
+
+    return mVisibleWorld;
+}
+
+std::optional<bool> InputReplayer::OnCompleted(IInputReplayTarget & target)
+{
+    assert(IsCompleted());
+
+    ApplyInputsUpToCurrentStep(target);
+
+    if (mRecording.FinalStateDigests.empty())
+    {
+        return std::nullopt;
+    }
+
+    return InputRecording::CalculateStateDigests(target.GetReplayWorld()) == mRecording.FinalStateDigests;
+}
+
+void InputReplayer::ApplyInputsUpToCurrentStep(IInputReplayTarget & target)
+{
+    for (; mNextInput < mRecording.Inputs.size() && mRecording.Inputs[mNextInput].Step <= mCurrentStep; ++mNextInput)
+    {
+        auto const & input = mRecording.Inputs[mNextInput];
+
+        switch (input.Type)
+        {
+            case RecordedInputType::VisibleWorld:
+            {
+                std::tie(mVisibleWorld) = input.ReadArguments<VisibleWorld>();
+                break;
+            }
+
+            case RecordedInputType::SimulationParametersChange:
+            {
+                auto const [changes] = input.ReadArguments<RecordedSimulationParameters>();
+                SimulationParametersRecording::Apply(changes, mSimulationParameters);
+
+                break;
+            }
+
+            case RecordedInputType::AddShip:
+            case RecordedInputType::ResetAndLoadShip:
+            {
+                auto const [shipLoadSpecsJson] = input.ReadArguments<std::string>();
+                auto const shipLoadSpecs = ShipLoadSpecifications::FromJson(
+                    Utils::ParseJSONString(shipLoadSpecsJson).get<picojson::object>());
+
+                if (input.Type == RecordedInputType::AddShip)
+                {
+                    target.ReplayAddShip(shipLoadSpecs);
+                }
+                else
+                {
+                    target.ReplayResetAndLoadShip(shipLoadSpecs);
+                }
+
+                break;
+            }
+
+            default:
+            {
+                // Fetched for each input, as a ship load might have replaced it
+                ApplyInput(
+                    input,
+                    target.GetReplayWorld(),
+                    mSimulationParameters);
+
+                break;
+            }
+        }
+    }
+}
+
+void InputReplayer::ApplyInput(
+    RecordedInput const & input,
+    Physics::World & world,
+    SimulationParameters const & simulationParameters)
+{
+    switch (input.Type)
+    {
+        case RecordedInputType::VisibleWorld:
+        case RecordedInputType::SimulationParametersChange:
+        case RecordedInputType::AddShip:
+        case RecordedInputType::ResetAndLoadShip:
+        {
+            // Not World inputs, applied by caller
+            assert(false);
+            break;
+        }
+
+        case RecordedInputType::MoveByConnectedComponent:
+        {
+            auto const [connectedComponentId, moveOffset, inertialVelocity] = input.ReadArguments<GlobalConnectedComponentId, vec2f, vec2f>();
+            world.MoveBy(connectedComponentId, moveOffset, inertialVelocity, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::MoveByShip:
+        {
+            auto const [shipId, moveOffset, inertialVelocity] = input.ReadArguments<ShipId, vec2f, vec2f>();
+            world.MoveBy(shipId, moveOffset, inertialVelocity, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::RotateByConnectedComponent:
+        {
+            auto const [connectedComponentId, angle, center, inertialAngle] = input.ReadArguments<GlobalConnectedComponentId, float, vec2f, float>();
+            world.RotateBy(connectedComponentId, angle, center, inertialAngle, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::RotateByShip:
+        {
+            auto const [shipId, angle, center, inertialAngle] = input.ReadArguments<ShipId, float, vec2f, float>();
+            world.RotateBy(shipId, angle, center, inertialAngle, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::MoveGrippedBy:
+        {
+            auto const [movesWorld] = input.ReadArguments<std::vector<GrippedMoveParameters>>();
+            world.MoveGrippedBy(movesWorld, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::RotateGrippedBy:
+        {
+            auto const [gripCenter, gripRadius, angle, inertialAngle] = input.ReadArguments<vec2f, float, float, float>();
+            world.RotateGrippedBy(gripCenter, gripRadius, angle, inertialAngle, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::EndMoveGrippedBy:
+        {
+            world.EndMoveGrippedBy(simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::PickObjectForPickAndPull:
+        {
+            auto const [pickPosition, searchRadius] = input.ReadArguments<vec2f, float>();
+            world.PickObjectForPickAndPull(pickPosition, searchRadius);
+            break;
+        }
+
+        case RecordedInputType::Pull:
+        {
+            auto const [elementId, target] = input.ReadArguments<GlobalElementId, vec2f>();
+            world.Pull(elementId, target, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::DestroyAt:
+        {
+            auto const [targetPos, radius, sessionId] = input.ReadArguments<vec2f, float, SessionId>();
+            world.DestroyAt(targetPos, radius, sessionId, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::RepairAt:
+        {
+            auto const [targetPos, radius, repairStepId] = input.ReadArguments<vec2f, float, SequenceNumber>();
+            world.RepairAt(targetPos, radius, repairStepId, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::SawThrough:
+        {
+            auto const [startPos, endPos, isFirstSegment] = input.ReadArguments<vec2f, vec2f, bool>();
+            world.SawThrough(startPos, endPos, isFirstSegment, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ApplyHeatBlasterAt:
+        {
+            auto const [targetPos, action, radius] = input.ReadArguments<vec2f, HeatBlasterActionType, float>();
+            world.ApplyHeatBlasterAt(targetPos, action, radius, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ExtinguishFireAt:
+        {
+            auto const [targetPos, strengthMultiplier, radius] = input.ReadArguments<vec2f, float, float>();
+            world.ExtinguishFireAt(targetPos, strengthMultiplier, radius, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ApplyBlastAt:
+        {
+            auto const [targetPos, radius, forceMultiplier] = input.ReadArguments<vec2f, float, float>();
+            world.ApplyBlastAt(targetPos, radius, forceMultiplier, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ApplyElectricSparkAt:
+        {
+            auto const [targetPos, counter, lengthMultiplier] = input.ReadArguments<vec2f, std::uint64_t, float>();
+            world.ApplyElectricSparkAt(targetPos, counter, lengthMultiplier, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ApplyRadialWindFrom:
+        {
+            auto const [sourcePos, preFrontRadius, preFrontWindSpeed, mainFrontRadius, mainFrontWindSpeed] = input.ReadArguments<vec2f, float, float, float, float>();
+            world.ApplyRadialWindFrom(sourcePos, preFrontRadius, preFrontWindSpeed, mainFrontRadius, mainFrontWindSpeed, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ApplyLaserCannonThrough:
+        {
+            auto const [startPos, endPos, strength] = input.ReadArguments<vec2f, vec2f, float>();
+            world.ApplyLaserCannonThrough(startPos, endPos, strength, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::DrawTo:
+        {
+            auto const [targetPos, strengthFraction] = input.ReadArguments<vec2f, float>();
+            world.DrawTo(targetPos, strengthFraction, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::SwirlAt:
+        {
+            auto const [targetPos, strengthFraction] = input.ReadArguments<vec2f, float>();
+            world.SwirlAt(targetPos, strengthFraction, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::BeginPlaceAntiGravityField:
+        {
+            auto const [startPos, searchRadius] = input.ReadArguments<vec2f, float>();
+            world.BeginPlaceAntiGravityField(startPos, searchRadius);
+            break;
+        }
+
+        case RecordedInputType::UpdatePlaceAntiGravityField:
+        {
+            auto const [antiGravityFieldId, endPos] = input.ReadArguments<ElementIndex, vec2f>();
+            world.UpdatePlaceAntiGravityField(antiGravityFieldId, endPos);
+            break;
+        }
+
+        case RecordedInputType::EndPlaceAntiGravityField:
+        {
+            auto const [antiGravityFieldId, endPos, searchRadius, strengthMultiplier] = input.ReadArguments<ElementIndex, vec2f, float, float>();
+            world.EndPlaceAntiGravityField(antiGravityFieldId, endPos, searchRadius, strengthMultiplier);
+            break;
+        }
+
+        case RecordedInputType::AbortPlaceAntiGravityField:
+        {
+            auto const [antiGravityFieldId] = input.ReadArguments<ElementIndex>();
+            world.AbortPlaceAntiGravityField(antiGravityFieldId);
+            break;
+        }
+
+        case RecordedInputType::BoostAntiGravityFields:
+        {
+            auto const [strengthMultiplier] = input.ReadArguments<float>();
+            world.BoostAntiGravityFields(strengthMultiplier);
+            break;
+        }
+
+        case RecordedInputType::RemoveAllAntiGravityFields:
+        {
+            world.RemoveAllAntiGravityFields();
+            break;
+        }
+
+        case RecordedInputType::BeginPlaceTornado:
+        {
+            auto const [posX, searchRadius] = input.ReadArguments<float, float>();
+            world.BeginPlaceTornado(posX, searchRadius);
+            break;
+        }
+
+        case RecordedInputType::UpdateTornado:
+        {
+            auto const [tornadoId, posX, strengthMultiplier, heatDepth] = input.ReadArguments<ElementIndex, float, float, float>();
+            world.UpdateTornado(tornadoId, posX, strengthMultiplier, heatDepth);
+            break;
+        }
+
+        case RecordedInputType::EndPlaceTornado:
+        {
+            auto const [tornadoId] = input.ReadArguments<ElementIndex>();
+            world.EndPlaceTornado(tornadoId);
+            break;
+        }
+
+        case RecordedInputType::TogglePinAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.TogglePinAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::RemoveAllPins:
+        {
+            world.RemoveAllPins();
+            break;
+        }
+
+        case RecordedInputType::InjectPressureAt:
+        {
+            auto const [targetPos, pressureQuantityMultiplier] = input.ReadArguments<vec2f, float>();
+            world.InjectPressureAt(targetPos, pressureQuantityMultiplier, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::FloodAt:
+        {
+            auto const [targetPos, radius, flowSign] = input.ReadArguments<vec2f, float, float>();
+            world.FloodAt(targetPos, radius, flowSign, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ToggleAntiMatterBombAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.ToggleAntiMatterBombAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ToggleFireExtinguishingBombAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.ToggleFireExtinguishingBombAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ToggleImpactBombAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.ToggleImpactBombAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::TogglePhysicsProbeAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.TogglePhysicsProbeAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ToggleRCBombAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.ToggleRCBombAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ToggleTimerBombAt:
+        {
+            auto const [targetPos] = input.ReadArguments<vec2f>();
+            world.ToggleTimerBombAt(targetPos, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::DetonateRCBombs:
+        {
+            world.DetonateRCBombs(simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::DetonateAntiMatterBombs:
+        {
+            world.DetonateAntiMatterBombs();
+            break;
+        }
+
+        case RecordedInputType::ApplyInteractiveWaveAt:
+        {
+            auto const [worldCoordinates, worldRadius] = input.ReadArguments<vec2f, float>();
+            world.ApplyInteractiveWaveAt(worldCoordinates, worldRadius);
+            break;
+        }
+
+        case RecordedInputType::AdjustOceanFloorTo:
+        {
+            auto const [x1, targetY1, x2, targetY2] = input.ReadArguments<float, float, float, float>();
+            world.AdjustOceanFloorTo(x1, targetY1, x2, targetY2);
+            break;
+        }
+
+        case RecordedInputType::ScrubThrough:
+        {
+            auto const [startPos, endPos, radius] = input.ReadArguments<vec2f, vec2f, float>();
+            world.ScrubThrough(startPos, endPos, radius);
+            break;
+        }
+
+        case RecordedInputType::RustThrough:
+        {
+            auto const [startPos, endPos, radius] = input.ReadArguments<vec2f, vec2f, float>();
+            world.RustThrough(startPos, endPos, radius, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::ApplyThanosSnap:
+        {
+            auto const [centerX, radius, leftFrontX, rightFrontX, isSparseMode] = input.ReadArguments<float, float, float, float, bool>();
+            world.ApplyThanosSnap(centerX, radius, leftFrontX, rightFrontX, isSparseMode, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::SetSilence:
+        {
+            auto const [silenceAmount] = input.ReadArguments<float>();
+            world.SetSilence(silenceAmount);
+            break;
+        }
+
+        case RecordedInputType::ScareFish:
+        {
+            auto const [position, radius, delay] = input.ReadArguments<vec2f, float, std::chrono::milliseconds>();
+            world.ScareFish(position, radius, delay);
+            break;
+        }
+
+        case RecordedInputType::AttractFish:
+        {
+            auto const [position, radius, delay] = input.ReadArguments<vec2f, float, std::chrono::milliseconds>();
+            world.AttractFish(position, radius, delay);
+            break;
+        }
+
+        case RecordedInputType::TriggerInteractiveLightningAt:
+        {
+            auto const [targetWorldPosition] = input.ReadArguments<vec2f>();
+            world.TriggerInteractiveLightningAt(targetWorldPosition);
+            break;
+        }
+
+        case RecordedInputType::TriggerTsunami:
+        {
+            world.TriggerTsunami();
+            break;
+        }
+
+        case RecordedInputType::TriggerRogueWave:
+        {
+            world.TriggerRogueWave();
+            break;
+        }
+
+        case RecordedInputType::TriggerStorm:
+        {
+            world.TriggerStorm();
+            break;
+        }
+
+        case RecordedInputType::TriggerRandomLightning:
+        {
+            world.TriggerRandomLightning(simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::HighlightElectricalElement:
+        {
+            auto const [electricalElementId] = input.ReadArguments<GlobalElectricalElementId>();
+            world.HighlightElectricalElement(electricalElementId);
+            break;
+        }
+
+        case RecordedInputType::SetSwitchState:
+        {
+            auto const [electricalElementId, switchState] = input.ReadArguments<GlobalElectricalElementId, ElectricalState>();
+            world.SetSwitchState(electricalElementId, switchState, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::SetEngineControllerState:
+        {
+            auto const [electricalElementId, controllerValue] = input.ReadArguments<GlobalElectricalElementId, float>();
+            world.SetEngineControllerState(electricalElementId, controllerValue, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::DestroyTriangle:
+        {
+            auto const [triangleId] = input.ReadArguments<GlobalElementId>();
+            world.DestroyTriangle(triangleId, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::RestoreTriangle:
+        {
+            auto const [triangleId] = input.ReadArguments<GlobalElementId>();
+            world.RestoreTriangle(triangleId);
+            break;
+        }
+
+        case RecordedInputType::BeginPlaceNewFurnitureNpc:
+        {
+            auto const [subKind, position, doMoveWholeMesh] = input.ReadArguments<std::optional<NpcSubKindIdType>, vec2f, bool>();
+            world.BeginPlaceNewFurnitureNpc(subKind, position, doMoveWholeMesh);
+            break;
+        }
+
+        case RecordedInputType::BeginPlaceNewHumanNpc:
+        {
+            auto const [subKind, position, doMoveWholeMesh] = input.ReadArguments<std::optional<NpcSubKindIdType>, vec2f, bool>();
+            world.BeginPlaceNewHumanNpc(subKind, position, doMoveWholeMesh);
+            break;
+        }
+
+        case RecordedInputType::BeginMoveNpc:
+        {
+            auto const [id, particleOrdinal, doMoveWholeMesh] = input.ReadArguments<NpcId, int, bool>();
+            world.BeginMoveNpc(id, particleOrdinal, doMoveWholeMesh);
+            break;
+        }
+
+        case RecordedInputType::BeginMoveNpcs:
+        {
+            auto const [ids] = input.ReadArguments<std::vector<NpcId>>();
+            world.BeginMoveNpcs(ids);
+            break;
+        }
+
+        case RecordedInputType::MoveNpcTo:
+        {
+            auto const [id, position, offset, doMoveWholeMesh] = input.ReadArguments<NpcId, vec2f, vec2f, bool>();
+            world.MoveNpcTo(id, position, offset, doMoveWholeMesh);
+            break;
+        }
+
+        case RecordedInputType::MoveNpcsBy:
+        {
+            auto const [ids, stride] = input.ReadArguments<std::vector<NpcId>, vec2f>();
+            world.MoveNpcsBy(ids, stride);
+            break;
+        }
+
+        case RecordedInputType::EndMoveNpc:
+        {
+            auto const [id] = input.ReadArguments<NpcId>();
+            world.EndMoveNpc(id);
+            break;
+        }
+
+        case RecordedInputType::CompleteNewNpc:
+        {
+            auto const [id] = input.ReadArguments<NpcId>();
+            world.CompleteNewNpc(id);
+            break;
+        }
+
+        case RecordedInputType::RemoveNpc:
+        {
+            auto const [id] = input.ReadArguments<NpcId>();
+            world.RemoveNpc(id);
+            break;
+        }
+
+        case RecordedInputType::RemoveNpcsInRect:
+        {
+            auto const [corner1, corner2] = input.ReadArguments<vec2f, vec2f>();
+            world.RemoveNpcsInRect(corner1, corner2);
+            break;
+        }
+
+        case RecordedInputType::AbortNewNpc:
+        {
+            auto const [id] = input.ReadArguments<NpcId>();
+            world.AbortNewNpc(id);
+            break;
+        }
+
+        case RecordedInputType::AddNpcGroup:
+        {
+            auto const [kind, visibleWorld] = input.ReadArguments<NpcKindType, VisibleWorld>();
+            world.AddNpcGroup(kind, visibleWorld, simulationParameters);
+            break;
+        }
+
+        case RecordedInputType::TurnaroundNpc:
+        {
+            auto const [id] = input.ReadArguments<NpcId>();
+            world.TurnaroundNpc(id);
+            break;
+        }
+
+        case RecordedInputType::TurnaroundNpcsInRect:
+        {
+            auto const [corner1, corner2] = input.ReadArguments<vec2f, vec2f>();
+            world.TurnaroundNpcsInRect(corner1, corner2);
+            break;
+        }
+
+        case RecordedInputType::SelectFirstNpc:
+        {
+            world.SelectFirstNpc();
+            break;
+        }
+
+        case RecordedInputType::SelectNextNpc:
+        {
+            world.SelectNextNpc();
+            break;
+        }
+
+        case RecordedInputType::SelectNpc:
+        {
+            auto const [id] = input.ReadArguments<std::optional<NpcId>>();
+            world.SelectNpc(id);
+            break;
+        }
+
+        case RecordedInputType::HighlightNpcs:
+        {
+            auto const [ids] = input.ReadArguments<std::vector<NpcId>>();
+            world.HighlightNpcs(ids);
+            break;
+        }
+
+        case RecordedInputType::HighlightNpcsInRect:
+        {
+            auto const [corner1, corner2] = input.ReadArguments<vec2f, vec2f>();
+            world.HighlightNpcsInRect(corner1, corner2);
+            break;
+        }
+    }
+}
@@ -0,0 +1,599 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "ShipLoadSpecifications.h"
+
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/SimulationParameters.h>
+
+#include <Core/GameExceptions.h>
+#include <Core/GameTypes.h>
+#include <Core/Streams.h>
+#include <Core/Vectors.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/*
+ * Deterministic recording and replay of the inputs to a World.
+ *
+ * An input is a World interaction, as invoked by the GameController. Inputs are recorded in world
+ * space, with all view-dependent quantities (screen coordinates, zoom-dependent radii, and so on)
+ * already resolved, together with the simulation step at which they have been invoked; they are
+ * replayed right before the simulation step with the same number, hence in the same position
+ * relative to World updates as when they were recorded.
+ *
+ * A recording also captures everything else the World depends on at the beginning of the session
+ * (random seed, simulation parameters, ocean floor, ship, simulation parallelism), so that when the
+ * session is run in deterministic mode, replaying the recording yields bit-identical state; changes
+ * to the simulation parameters and ship loads made during the session are recorded as inputs.
+ *
+ * A recording also stores digests of the state of the World at the end of the session, so that
+ * replays may verify that they have reproduced it.
+ */
+
+enum class RecordedInputType : std::uint16_t
+{
+    // Not an interaction: the visible world changed (which affects e.g. fishes and particles)
+    VisibleWorld = 0,
+
+    MoveByConnectedComponent,
+    MoveByShip,
+    RotateByConnectedComponent,
+    RotateByShip,
+    MoveGrippedBy,
+    RotateGrippedBy,
+    EndMoveGrippedBy,
+    PickObjectForPickAndPull,
+    Pull,
+    DestroyAt,
+    RepairAt,
+    SawThrough,
+    ApplyHeatBlasterAt,
+    ExtinguishFireAt,
+    ApplyBlastAt,
+    ApplyElectricSparkAt,
+    ApplyRadialWindFrom,
+    ApplyLaserCannonThrough,
+    DrawTo,
+    SwirlAt,
+    BeginPlaceAntiGravityField,
+    UpdatePlaceAntiGravityField,
+    EndPlaceAntiGravityField,
+    AbortPlaceAntiGravityField,
+    BoostAntiGravityFields,
+    RemoveAllAntiGravityFields,
+    BeginPlaceTornado,
+    UpdateTornado,
+    EndPlaceTornado,
+    TogglePinAt,
+    RemoveAllPins,
+    InjectPressureAt,
+    FloodAt,
+    ToggleAntiMatterBombAt,
+    ToggleFireExtinguishingBombAt,
+    ToggleImpactBombAt,
+    TogglePhysicsProbeAt,
+    ToggleRCBombAt,
+    ToggleTimerBombAt,
+    DetonateRCBombs,
+    DetonateAntiMatterBombs,
+    ApplyInteractiveWaveAt,
+    AdjustOceanFloorTo,
+    ScrubThrough,
+    RustThrough,
+    ApplyThanosSnap,
+    SetSilence,
+    ScareFish,
+    AttractFish,
+    TriggerInteractiveLightningAt,
+    TriggerTsunami,
+    TriggerRogueWave,
+    TriggerStorm,
+    TriggerRandomLightning,
+    HighlightElectricalElement,
+    SetSwitchState,
+    SetEngineControllerState,
+    DestroyTriangle,
+    RestoreTriangle,
+    BeginPlaceNewFurnitureNpc,
+    BeginPlaceNewHumanNpc,
+    BeginMoveNpc,
+    BeginMoveNpcs,
+    MoveNpcTo,
+    MoveNpcsBy,
+    EndMoveNpc,
+    CompleteNewNpc,
+    RemoveNpc,
+    RemoveNpcsInRect,
+    AbortNewNpc,
+    AddNpcGroup,
+    TurnaroundNpc,
+    TurnaroundNpcsInRect,
+    SelectFirstNpc,
+    SelectNextNpc,
+    SelectNpc,
+    HighlightNpcs,
+    HighlightNpcsInRect,
+
+    // Not interactions: changes to the session
+    SimulationParametersChange,
+    AddShip,
+    ResetAndLoadShip,
+
+    _Last = ResetAndLoadShip
+};
+
+/*
+ * Simulation parameters are recorded by name, each with a typed value, so that recordings
+ * may be replayed by builds whose SimulationParameters differ: parameters unknown to the
+ * replaying build are ignored, and parameters missing from a recording keep their defaults.
+ */
+using RecordedSimulationParameterValue = std::variant<bool, float, std::int64_t>;
+using RecordedSimulationParameters = std::vector<std::pair<std::string, RecordedSimulationParameterValue>>;
+
+class SimulationParametersRecording final
+{
+public:
+
+    // All parameters
+    static RecordedSimulationParameters Capture(SimulationParameters const & parameters);
+
+    // Only the parameters that differ, with their new values
+    static RecordedSimulationParameters CaptureChanges(
+        SimulationParameters const & oldParameters,
+        SimulationParameters const & newParameters);
+
+    static void Apply(
+        RecordedSimulationParameters const & recordedParameters,
+        SimulationParameters & parameters);
+};
+
+/*
+ * A single recorded input: its type, the step at which it was invoked, and
+ * its arguments, packed into a payload.
+ */
+struct RecordedInput
+{
+    std::uint64_t Step;
+    RecordedInputType Type;
+    std::vector<std::uint8_t> Payload;
+
+    RecordedInput(
+        std::uint64_t step,
+        RecordedInputType type)
+        : Step(step)
+        , Type(type)
+        , Payload()
+    {}
+
+    RecordedInput(
+        std::uint64_t step,
+        RecordedInputType type,
+        std::vector<std::uint8_t> && payload)
+        : Step(step)
+        , Type(type)
+        , Payload(std::move(payload))
+    {}
+
+    template<typename... TArgs>
+    void WriteArguments(TArgs const &... args)
+    {
+        (WriteArgument(args), ...);
+    }
+
+    template<typename... TArgs>
+    std::tuple<TArgs...> ReadArguments() const
+    {
+        size_t offset = 0;
+
+        // Note: braced initialization guarantees left-to-right evaluation
+        std::tuple<TArgs...> arguments{ ReadArgument<TArgs>(offset)... };
+        if (offset != Payload.size())
+        {
+            throw GameException("Input recording contains an input with unexpected arguments");
+        }
+
+        return arguments;
+    }
+
+private:
+
+    template<typename T>
+    struct is_optional : std::false_type {};
+
+    template<typename T>
+    struct is_optional<std::optional<T>> : std::true_type {};
+
+    template<typename T>
+    struct is_vector : std::false_type {};
+
+    template<typename T>
+    struct is_vector<std::vector<T>> : std::true_type {};
+
+    template<typename T>
+    struct is_pair : std::false_type {};
+
+    template<typename T1, typename T2>
+    struct is_pair<std::pair<T1, T2>> : std::true_type {};
+
+    template<typename T>
+    struct is_variant : std::false_type {};
+
+    template<typename... Ts>
+    struct is_variant<std::variant<Ts...>> : std::true_type {};
+
+    template<typename T>
+    void WriteArgument(T const & value)
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            WriteArgument(static_cast<std::uint32_t>(value.size()));
+
+            size_t const offset = Payload.size();
+            Payload.resize(offset + value.size());
+            std::memcpy(Payload.data() + offset, value.data(), value.size());
+        }
+        else if constexpr (is_optional<T>::value)
+        {
+            WriteArgument(value.has_value());
+            if (value.has_value())
+            {
+                WriteArgument(*value);
+            }
+        }
+        else if constexpr (is_vector<T>::value)
+        {
+            WriteArgument(static_cast<std::uint32_t>(value.size()));
+            for (auto const & element : value)
+            {
+                WriteArgument(element);
+            }
+        }
+        else if constexpr (is_pair<T>::value)
+        {
+            WriteArgument(value.first);
+            WriteArgument(value.second);
+        }
+        else if constexpr (is_variant<T>::value)
+        {
+            WriteArgument(static_cast<std::uint8_t>(value.index()));
+            std::visit(
+                [this](auto const & alternative)
+                {
+                    WriteArgument(alternative);
+                },
+                value);
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            size_t const offset = Payload.size();
+            Payload.resize(offset + sizeof(T));
+            std::memcpy(Payload.data() + offset, &value, sizeof(T));
+        }
+    }
+
+    template<typename T>
+    T ReadArgument(size_t & offset) const
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            std::uint32_t const size = ReadArgument<std::uint32_t>(offset);
+            EnsureAvailable(offset, size);
+
+            T value(reinterpret_cast<char const *>(Payload.data() + offset), size);
+            offset += size;
+
+            return value;
+        }
+        else if constexpr (is_optional<T>::value)
+        {
+            if (ReadArgument<bool>(offset))
+            {
+                return T(ReadArgument<typename T::value_type>(offset));
+            }
+            else
+            {
+                return T(std::nullopt);
+            }
+        }
+        else if constexpr (is_vector<T>::value)
+        {
+            std::uint32_t const size = ReadArgument<std::uint32_t>(offset);
+
+            // Each element takes at least one byte
+            EnsureAvailable(offset, size);
+
+            T value;
+            value.reserve(size);
+            for (std::uint32_t i = 0; i < size; ++i)
+            {
+                value.emplace_back(ReadArgument<typename T::value_type>(offset));
+            }
+
+            return value;
+        }
+        else if constexpr (is_pair<T>::value)
+        {
+            auto first = ReadArgument<typename T::first_type>(offset);
+            auto second = ReadArgument<typename T::second_type>(offset);
+
+            return T(std::move(first), std::move(second));
+        }
+        else if constexpr (is_variant<T>::value)
+        {
+            std::uint8_t const index = ReadArgument<std::uint8_t>(offset);
+
+            return ReadVariantArgument<T>(index, offset, std::make_index_sequence<std::variant_size_v<T>>());
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            EnsureAvailable(offset, sizeof(T));
+
+            // Not all of our types are default-constructible
+            std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+            std::memcpy(&storage, Payload.data() + offset, sizeof(T));
+            offset += sizeof(T);
+
+            return *reinterpret_cast<T const *>(&storage);
+        }
+    }
+
+    template<typename T, size_t... AlternativeIndices>
+    T ReadVariantArgument(
+        std::uint8_t index,
+        size_t & offset,
+        std::index_sequence<AlternativeIndices...>) const
+    {
+        std::optional<T> value;
+        ((index == AlternativeIndices
+            ? (void)value.emplace(std::in_place_index<AlternativeIndices>, ReadArgument<std::variant_alternative_t<AlternativeIndices, T>>(offset))
+            : (void)0), ...);
+
+        if (!value.has_value())
+        {
+            throw GameException("Input recording contains an input with unexpected arguments");
+        }
+
+        return std::move(*value);
+    }
+
+    void EnsureAvailable(
+        size_t offset,
+        size_t size) const
+    {
+        if (offset > Payload.size() || size > Payload.size() - offset)
+        {
+            throw GameException("Input recording contains a truncated input");
+        }
+    }
+};
+
+/*
+ * A whole recorded session.
+ */
+struct InputRecording
+{
+    //
+    // Initial state
+    //
+
+    std::uint32_t Seed;
+    std::uint32_t SimulationParallelism;
+    ShipLoadSpecifications ShipLoadSpecs;
+    SimulationParameters InitialSimulationParameters;
+    OceanFloorHeightMap InitialOceanFloorHeightMap;
+
+    //
+    // Inputs
+    //
+
+    std::vector<RecordedInput> Inputs; // By step
+    std::uint64_t StepCount; // Number of simulation steps run during the recording
+
+    //
+    // Final state
+    //
+
+    std::vector<std::uint64_t> FinalStateDigests; // By StateSubsystemType; empty when unknown
+
+    InputRecording(
+        std::uint32_t seed,
+        std::uint32_t simulationParallelism,
+        ShipLoadSpecifications const & shipLoadSpecs,
+        SimulationParameters const & initialSimulationParameters,
+        OceanFloorHeightMap const & initialOceanFloorHeightMap)
+        : Seed(seed)
+        , SimulationParallelism(simulationParallelism)
+        , ShipLoadSpecs(shipLoadSpecs)
+        , InitialSimulationParameters(initialSimulationParameters)
+        , InitialOceanFloorHeightMap(initialOceanFloorHeightMap)
+        , Inputs()
+        , StepCount(0)
+        , FinalStateDigests()
+    {}
+
+    /*
+     * The digests of the state of all subsystems of the World, as stored in FinalStateDigests.
+     */
+    static std::vector<std::uint64_t> CalculateStateDigests(Physics::World const & world);
+
+    void SaveToStream(BinaryWriteStream & outputStream) const;
+
+    static InputRecording LoadFromStream(BinaryReadStream & inputStream);
+};
+
+/*
+ * Records inputs while a session runs.
+ */
+class InputRecorder final
+{
+public:
+
+    InputRecorder(InputRecording && recording)
+        : mRecording(std::move(recording))
+        , mLastVisibleWorld()
+        , mLastSimulationParameters(mRecording.InitialSimulationParameters)
+    {}
+
+    std::uint64_t GetCurrentStep() const
+    {
+        return mRecording.StepCount;
+    }
+
+    template<typename... TArgs>
+    void Record(
+        RecordedInputType type,
+        TArgs const &... args)
+    {
+        auto & input = mRecording.Inputs.emplace_back(mRecording.StepCount, type);
+        input.WriteArguments(args...);
+    }
+
+    /*
+     * Invoked with the current simulation parameters before anything that depends
+     * on them - inputs, ship loads, and simulation steps; records the parameters
+     * that have changed since the last invocation.
+     */
+    void OnSimulationParameters(SimulationParameters const & simulationParameters);
+
+    /*
+     * Invoked after a ship has been loaded during the session.
+     */
+    void OnShipLoaded(
+        ShipLoadSpecifications const & loadSpecs,
+        bool isReset)
+    {
+        Record(
+            isReset ? RecordedInputType::ResetAndLoadShip : RecordedInputType::AddShip,
+            picojson::value(loadSpecs.ToJson()).serialize());
+    }
+
+    /*
+     * Invoked right before each simulation step, with the visible world the step
+     * is going to run with.
+     */
+    void OnSimulationStep(VisibleWorld const & visibleWorld)
+    {
+        if (!mLastVisibleWorld.has_value()
+            || std::memcmp(&visibleWorld, &(*mLastVisibleWorld), sizeof(VisibleWorld)) != 0)
+        {
+            Record(RecordedInputType::VisibleWorld, visibleWorld);
+            mLastVisibleWorld = visibleWorld;
+        }
+
+        ++mRecording.StepCount;
+    }
+
+    InputRecording StopRecording()
+    {
+        return std::move(mRecording);
+    }
+
+private:
+
+    InputRecording mRecording;
+    std::optional<VisibleWorld> mLastVisibleWorld;
+    SimulationParameters mLastSimulationParameters;
+};
+
+/*
+ * Whatever owns the World a recording is replayed into.
+ */
+class IInputReplayTarget
+{
+public:
+
+    virtual ~IInputReplayTarget() = default;
+
+    // Might change after a ship load with reset
+    virtual Physics::World & GetReplayWorld() = 0;
+
+    virtual void ReplayAddShip(ShipLoadSpecifications const & loadSpecs) = 0;
+
+    virtual void ReplayResetAndLoadShip(ShipLoadSpecifications const & loadSpecs) = 0;
+};
+
+/*
+ * Feeds recorded inputs back into a World.
+ */
+class InputReplayer final
+{
+public:
+
+    InputReplayer(InputRecording && recording)
+        : mRecording(std::move(recording))
+        , mCurrentStep(0)
+        , mNextInput(0)
+        , mVisibleWorld()
+        , mSimulationParameters(mRecording.InitialSimulationParameters)
+    {}
+
+    InputRecording const & GetRecording() const
+    {
+        return mRecording;
+    }
+
+    // The parameters the world is to run with, as of the current step
+    SimulationParameters const & GetSimulationParameters() const
+    {
+        return mSimulationParameters;
+    }
+
+    std::uint64_t GetCurrentStep() const
+    {
+        return mCurrentStep;
+    }
+
+    bool IsCompleted() const
+    {
+        return mCurrentStep >= mRecording.StepCount;
+    }
+
+    /*
+     * Invoked right before each simulation step; applies all the inputs that
+     * were recorded before this step, and returns the visible world the step
+     * is to be run with.
+     */
+    VisibleWorld const & OnSimulationStep(IInputReplayTarget & target);
+
+    /*
+     * Invoked once the replay is completed; applies the inputs that were recorded
+     * after the last simulation step.
+     *
+     * Returns whether the state of the World matches the final state of the recording;
+     * none when the recording has no final state.
+     */
+    std::optional<bool> OnCompleted(IInputReplayTarget & target);
+
+private:
+
+    void ApplyInputsUpToCurrentStep(IInputReplayTarget & target);
+
+    void ApplyInput(
+        RecordedInput const & input,
+        Physics::World & world,
+        SimulationParameters const & simulationParameters);
+
+    InputRecording const mRecording;
+    std::uint64_t mCurrentStep;
+    size_t mNextInput;
+    VisibleWorld mVisibleWorld;
+    SimulationParameters mSimulationParameters;
+};
@@ -73,6 +73,7 @@ void NotificationLayer::SetStatusTexts(
     float averageFps,
     PerfStats const & lastDeltaPerfStats,
     PerfStats const & totalPerfStats,
+    PerfStats const & latencyWindowPerfStats,
     std::chrono::duration<float> elapsedGameSeconds,
     bool isPaused,
     float zoom,
@@ -129,6 +130,7 @@ void NotificationLayer::SetStatusTexts(
 				<< " (S=" << shipsSpringsUpdatePercent << "%) (N=" << npcsUpdatePercent << "%))"
 				<< " UPL:(W=" << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalWaitForRenderDraw>().ToRatio<std::chrono::milliseconds>() << "MS +"
 				<< " " << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalNetRenderUpload>().ToRatio<std::chrono::milliseconds>() << "MS)"
+				<< " CUL:" << lastDeltaPerfStats.GetCounter<PerfCounter::CulledEphemeralParticles>().GetValue()
 				;
 
 			mStatusTextLines[1] = ss.str();
@@ -168,6 +170,55 @@ void NotificationLayer::SetStatusTexts(
 			mStatusTextLines[3] = ss.str();
 		}
 
+		ss.str("");
+
+		{
+			auto const writeLatencies = [&ss](char const * name, PerfStats::Ratio const & measurement)
+			{
+				ss << name << ":" << measurement.ToPercentile<std::chrono::milliseconds>(0.5f)
+					<< "/" << measurement.ToPercentile<std::chrono::milliseconds>(0.95f)
+					<< "/" << measurement.ToPercentile<std::chrono::milliseconds>(0.99f)
+					<< "/" << measurement.ToMax<std::chrono::milliseconds>() << "MS";
+			};
+
+			// P50/P95/P99/MAX over the latency window
+			ss << std::fixed << std::setprecision(2) << "LAT ";
+			writeLatencies("UPD", latencyWindowPerfStats.GetMeasurement<PerfMeasurement::TotalNetUpdate>());
+			ss << " ";
+			writeLatencies("SPR", latencyWindowPerfStats.GetMeasurement<PerfMeasurement::TotalShipsSpringsUpdate>());
+			ss << " ";
+			writeLatencies("UPL", latencyWindowPerfStats.GetMeasurement<PerfMeasurement::TotalNetRenderUpload>());
+			ss << " ";
+			writeLatencies("RND", latencyWindowPerfStats.GetMeasurement<PerfMeasurement::TotalRenderDraw>());
+
+			mStatusTextLines[4] = ss.str();
+		}
+
+		ss.str("");
+
+		{
+			// Simulation thread pool, over the last interval: average batch critical
+			// path and imbalance, and utilization of each thread
+			ss << std::fixed << std::setprecision(2)
+				<< "TPL CP:" << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolCriticalPath>().ToRatio<std::chrono::milliseconds>() << "MS"
+				<< " IMB:" << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolImbalance>().ToRatio<std::chrono::milliseconds>() << "MS"
+				<< " SPR GAP:" << lastDeltaPerfStats.GetMeasurement<PerfMeasurement::TotalShipsSpringsStragglerGap>().ToRatio<std::chrono::milliseconds>() << "MS"
+				<< " UTL:";
+
+			ss << std::setprecision(0);
+			for (size_t t = 0; t < lastDeltaPerfStats.GetSimulationThreadPoolThreadCount(); ++t)
+			{
+				if (t > 0)
+					ss << "/";
+
+				ss << lastDeltaPerfStats.GetSimulationThreadPoolThread(t).GetUtilization() * 100.0f;
+			}
+
+			ss << "%";
+
+			mStatusTextLines[5] = ss.str();
+		}
+
 		// Text needs to be re-uploaded
 		mIsStatusTextDirty = true;
     }
@@ -45,6 +45,7 @@ public:
         float averageFps,
         PerfStats const & lastDeltaPerfStats,
         PerfStats const & totalPerfStats,
+        PerfStats const & latencyWindowPerfStats,
         std::chrono::duration<float> elapsedGameSeconds,
         bool isPaused,
         float zoom,
@@ -220,7 +221,7 @@ private:
 
     bool mIsStatusTextEnabled;
     bool mIsExtendedStatusTextEnabled;
-	std::array<std::string, 4> mStatusTextLines;
+	std::array<std::string, 6> mStatusTextLines;
 	bool mIsStatusTextDirty;
 
 	//
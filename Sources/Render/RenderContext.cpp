@@ -8,6 +8,7 @@
 #include <Core/GameChronometer.h>
 #include <Core/GameExceptions.h>
 #include <Core/Log.h>
+#include <Core/Profiler.h>
 #include <Core/SysSpecifics.h>
 #include <Core/ThreadManager.h>
 
@@ -498,6 +499,8 @@ void RenderContext::Draw(float currentSimulationTime)
     mLastRenderDrawCompletionIndicator = mRenderThread.QueueTask(
         [this, renderParameters = mRenderParameters.TakeSnapshotAndClear(), lampToolToSet = mLampToolToSet, currentSimulationTime = currentSimulationTime]() mutable
         {
+            FS_PROFILE_ZONE("RenderContext::Draw");
+
             auto const startTime = GameChronometer::Now();
 
             RenderStatistics renderStats;
@@ -6,16 +6,24 @@
 
 #include "AndroidTextureDatabases.h"
 #include "ShipDatabaseBaker.h"
+#include "SimulationBenchmarkRunner.h"
 #include "SoundAtlasBaker.h"
 #include "TextureAtlasBaker.h"
 
+#include <Game/GameAssetManager.h>
+
 #include <Render/GameTextureDatabases.h>
 
 #include <Core/ImageData.h>
+#include <Core/Profiler.h>
+#include <Core/ThreadManager.h>
 #include <Core/Utils.h>
 
+#include <algorithm>
 #include <cassert>
+#include <filesystem>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <string>
 
@@ -27,6 +35,14 @@ int DoBakeSoundAtlas(int argc, char ** argv);
 
 int DoBakeTextureAtlas(int argc, char ** argv);
 
+int DoRunSimulationBenchmark(int argc, char ** argv);
+
+int DoRunReplay(int argc, char ** argv);
+
+int DoRunDifferential(int argc, char ** argv);
+
+int DoRunBatch(int argc, char ** argv);
+
 void PrintUsage();
 
 int main(int argc, char ** argv)
@@ -52,6 +68,22 @@ int main(int argc, char ** argv)
         {
             return DoBakeTextureAtlas(argc, argv);
         }
+        else if (verb == "run_simulation_benchmark")
+        {
+            return DoRunSimulationBenchmark(argc, argv);
+        }
+        else if (verb == "run_replay")
+        {
+            return DoRunReplay(argc, argv);
+        }
+        else if (verb == "run_differential")
+        {
+            return DoRunDifferential(argc, argv);
+        }
+        else if (verb == "run_batch")
+        {
+            return DoRunBatch(argc, argv);
+        }
         else
         {
             throw std::runtime_error("Unrecognized verb '" + verb + "'");
@@ -268,6 +300,399 @@ int DoBakeTextureAtlas(int argc, char ** argv)
     return 0;
 }
 
+int DoRunSimulationBenchmark(int argc, char ** argv)
+{
+    if (argc < 5)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const gameRootPath(argv[2]);
+    std::filesystem::path const shipFilePath(argv[3]);
+    std::filesystem::path const outputFilePath(argv[4]);
+    std::string scenarioName = "all";
+    size_t stepCount = 1000;
+    size_t simulationParallelism = ThreadManager::GetNumberOfProcessors();
+    std::optional<std::filesystem::path> traceFilePath;
+
+    for (int i = 5; i < argc; ++i)
+    {
+        std::string option(argv[i]);
+        if (i == argc - 1)
+        {
+            throw std::runtime_error("Missing value for option '" + option + "'");
+        }
+
+        if (option == "-s")
+        {
+            scenarioName = argv[i + 1];
+        }
+        else if (option == "-n")
+        {
+            stepCount = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-p")
+        {
+            simulationParallelism = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-t")
+        {
+            traceFilePath = std::filesystem::path(argv[i + 1]);
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized option '" + option + "'");
+        }
+
+        ++i;
+    }
+
+    auto const scenarios = SimulationBenchmarkRunner::StrToScenarioTypes(scenarioName);
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running run_simulation_benchmark:" << std::endl;
+    std::cout << "  game root directory           : " << gameRootPath << std::endl;
+    std::cout << "  ship file                     : " << shipFilePath << std::endl;
+    std::cout << "  output file                   : " << outputFilePath << std::endl;
+    std::cout << "  scenario                      : " << scenarioName << std::endl;
+    std::cout << "  steps                         : " << stepCount << std::endl;
+    std::cout << "  simulation parallelism        : " << simulationParallelism << std::endl;
+    if (traceFilePath.has_value())
+    {
+        std::cout << "  trace file                    : " << *traceFilePath << std::endl;
+
+        Profiler::GetInstance().Enable();
+    }
+
+    auto const results = SimulationBenchmarkRunner::Run(
+        gameRootPath,
+        shipFilePath,
+        scenarios,
+        stepCount,
+        simulationParallelism);
+
+    GameAssetManager::SaveJson(results, outputFilePath);
+
+    if (traceFilePath.has_value())
+    {
+        Profiler::GetInstance().Disable();
+
+        GameAssetManager::SaveJson(Profiler::GetInstance().ExportChromeTrace(), *traceFilePath);
+    }
+
+    std::cout << "Benchmark completed." << std::endl;
+
+    return 0;
+}
+
+int DoRunReplay(int argc, char ** argv)
+{
+    if (argc < 5)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const gameRootPath(argv[2]);
+    std::filesystem::path const recordingFilePath(argv[3]);
+    std::filesystem::path const outputFilePath(argv[4]);
+    std::optional<size_t> simulationParallelism;
+    std::optional<std::filesystem::path> traceFilePath;
+
+    for (int i = 5; i < argc; ++i)
+    {
+        std::string option(argv[i]);
+        if (i == argc - 1)
+        {
+            throw std::runtime_error("Missing value for option '" + option + "'");
+        }
+
+        if (option == "-p")
+        {
+            simulationParallelism = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-t")
+        {
+            traceFilePath = std::filesystem::path(argv[i + 1]);
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized option '" + option + "'");
+        }
+
+        ++i;
+    }
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running run_replay:" << std::endl;
+    std::cout << "  game root directory           : " << gameRootPath << std::endl;
+    std::cout << "  recording file                : " << recordingFilePath << std::endl;
+    std::cout << "  output file                   : " << outputFilePath << std::endl;
+    if (simulationParallelism.has_value())
+    {
+        std::cout << "  simulation parallelism        : " << *simulationParallelism << std::endl;
+    }
+    if (traceFilePath.has_value())
+    {
+        std::cout << "  trace file                    : " << *traceFilePath << std::endl;
+
+        Profiler::GetInstance().Enable();
+    }
+
+    auto const results = SimulationBenchmarkRunner::RunReplay(
+        gameRootPath,
+        recordingFilePath,
+        simulationParallelism);
+
+    GameAssetManager::SaveJson(results, outputFilePath);
+
+    if (traceFilePath.has_value())
+    {
+        Profiler::GetInstance().Disable();
+
+        GameAssetManager::SaveJson(Profiler::GetInstance().ExportChromeTrace(), *traceFilePath);
+    }
+
+    //
+    // Report outcome; not reproducing the recording's final state is a failure
+    //
+
+    auto const & finalStateMatches = results.get<picojson::object>().at("final_state_matches");
+    if (finalStateMatches.is<picojson::null>())
+    {
+        std::cout << "Replay completed; the recording has no final state to verify." << std::endl;
+        return 0;
+    }
+    else if (finalStateMatches.get<bool>())
+    {
+        std::cout << "Replay completed; final state is identical." << std::endl;
+        return 0;
+    }
+    else
+    {
+        std::cout << "Replay completed; final state DIVERGED." << std::endl;
+        return 1;
+    }
+}
+
+int DoRunDifferential(int argc, char ** argv)
+{
+    if (argc < 5)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const gameRootPath(argv[2]);
+    std::filesystem::path const shipFilePath(argv[3]);
+    std::filesystem::path const outputFilePath(argv[4]);
+    std::string scenarioName = "idle_float";
+    size_t stepCount = 1000;
+    size_t snapshotInterval = 50;
+    float tolerance = 0.0f;
+    SimulationBenchmarkRunner::Configuration configuration1;
+    std::optional<SimulationBenchmarkRunner::Configuration> configuration2;
+    std::optional<std::filesystem::path> referenceSnapshotsFilePath;
+    std::optional<std::filesystem::path> outputSnapshotsFilePath;
+
+    for (int i = 5; i < argc; ++i)
+    {
+        std::string option(argv[i]);
+        if (i == argc - 1)
+        {
+            throw std::runtime_error("Missing value for option '" + option + "'");
+        }
+
+        if (option == "-s")
+        {
+            scenarioName = argv[i + 1];
+        }
+        else if (option == "-n")
+        {
+            stepCount = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-e")
+        {
+            snapshotInterval = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-x")
+        {
+            tolerance = std::max(static_cast<float>(atof(argv[i + 1])), 0.0f);
+        }
+        else if (option == "-1")
+        {
+            configuration1 = SimulationBenchmarkRunner::Configuration::FromStr(argv[i + 1]);
+        }
+        else if (option == "-2")
+        {
+            configuration2 = SimulationBenchmarkRunner::Configuration::FromStr(argv[i + 1]);
+        }
+        else if (option == "-r")
+        {
+            referenceSnapshotsFilePath = std::filesystem::path(argv[i + 1]);
+        }
+        else if (option == "-w")
+        {
+            outputSnapshotsFilePath = std::filesystem::path(argv[i + 1]);
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized option '" + option + "'");
+        }
+
+        ++i;
+    }
+
+    auto const scenarios = SimulationBenchmarkRunner::StrToScenarioTypes(scenarioName);
+    if (scenarios.size() != 1)
+    {
+        throw std::runtime_error("Differential runs require a single scenario");
+    }
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running run_differential:" << std::endl;
+    std::cout << "  game root directory           : " << gameRootPath << std::endl;
+    std::cout << "  ship file                     : " << shipFilePath << std::endl;
+    std::cout << "  output file                   : " << outputFilePath << std::endl;
+    std::cout << "  scenario                      : " << scenarioName << std::endl;
+    std::cout << "  steps                         : " << stepCount << std::endl;
+    std::cout << "  snapshot interval             : " << snapshotInterval << std::endl;
+    std::cout << "  tolerance                     : " << tolerance << std::endl;
+    std::cout << "  configuration 1               : " << configuration1.ToStr() << std::endl;
+    if (referenceSnapshotsFilePath.has_value())
+    {
+        std::cout << "  reference snapshots           : " << *referenceSnapshotsFilePath << std::endl;
+    }
+    else if (configuration2.has_value())
+    {
+        std::cout << "  configuration 2               : " << configuration2->ToStr() << std::endl;
+    }
+    if (outputSnapshotsFilePath.has_value())
+    {
+        std::cout << "  output snapshots              : " << *outputSnapshotsFilePath << std::endl;
+    }
+
+    auto const results = SimulationBenchmarkRunner::RunDifferential(
+        gameRootPath,
+        shipFilePath,
+        scenarios[0],
+        stepCount,
+        snapshotInterval,
+        tolerance,
+        configuration1,
+        configuration2,
+        referenceSnapshotsFilePath,
+        outputSnapshotsFilePath);
+
+    GameAssetManager::SaveJson(results, outputFilePath);
+
+    //
+    // Report outcome; diverging is a failure
+    //
+
+    auto const & resultsObject = results.get<picojson::object>();
+    auto const firstDivergenceIt = resultsObject.find("first_divergence");
+    if (firstDivergenceIt == resultsObject.end())
+    {
+        std::cout << "Snapshots taken." << std::endl;
+        return 0;
+    }
+    else if (firstDivergenceIt->second.is<picojson::null>())
+    {
+        std::cout << (resultsObject.at("identical").get<bool>() ? "Identical." : "Equal within tolerance.") << std::endl;
+        return 0;
+    }
+    else
+    {
+        std::cout << "DIVERGED: " << firstDivergenceIt->second.serialize() << std::endl;
+        return 1;
+    }
+}
+
+int DoRunBatch(int argc, char ** argv)
+{
+    if (argc < 5)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    std::filesystem::path const gameRootPath(argv[2]);
+    std::filesystem::path const shipPath(argv[3]);
+    std::filesystem::path const outputFilePath(argv[4]);
+    std::string scenarioName = "sink";
+    size_t stepCount = 1000;
+    size_t worldsPerShipCount = 1;
+    size_t parallelism = ThreadManager::GetNumberOfProcessors();
+
+    for (int i = 5; i < argc; ++i)
+    {
+        std::string option(argv[i]);
+        if (i == argc - 1)
+        {
+            throw std::runtime_error("Missing value for option '" + option + "'");
+        }
+
+        if (option == "-s")
+        {
+            scenarioName = argv[i + 1];
+        }
+        else if (option == "-n")
+        {
+            stepCount = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-c")
+        {
+            worldsPerShipCount = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else if (option == "-p")
+        {
+            parallelism = static_cast<size_t>(std::max(atoi(argv[i + 1]), 1));
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized option '" + option + "'");
+        }
+
+        ++i;
+    }
+
+    auto const scenarios = SimulationBenchmarkRunner::StrToScenarioTypes(scenarioName);
+    if (scenarios.size() != 1)
+    {
+        throw std::runtime_error("Batch runs require a single scenario");
+    }
+
+    std::cout << SEPARATOR << std::endl;
+
+    std::cout << "Running run_batch:" << std::endl;
+    std::cout << "  game root directory           : " << gameRootPath << std::endl;
+    std::cout << "  ship file or directory        : " << shipPath << std::endl;
+    std::cout << "  output file                   : " << outputFilePath << std::endl;
+    std::cout << "  scenario                      : " << scenarioName << std::endl;
+    std::cout << "  steps                         : " << stepCount << std::endl;
+    std::cout << "  worlds per ship               : " << worldsPerShipCount << std::endl;
+    std::cout << "  parallelism                   : " << parallelism << std::endl;
+
+    auto const results = SimulationBenchmarkRunner::RunBatch(
+        gameRootPath,
+        shipPath,
+        scenarios[0],
+        stepCount,
+        worldsPerShipCount,
+        parallelism);
+
+    GameAssetManager::SaveJson(results, outputFilePath);
+
+    std::cout << "Batch completed." << std::endl;
+
+    return 0;
+}
+
 void PrintUsage()
 {
     std::cout << std::endl;
@@ -275,4 +700,9 @@ void PrintUsage()
     std::cout << " bake_ship_database <ship_directory_json> <ship_root_dir> <out_dir> <max_preview_w> <max_preview_h>" << std::endl;
     std::cout << " bake_sound_atlas <sounds_root_dir> <out_dir>" << std::endl;
     std::cout << " bake_texture_atlas Cloud|Explosion|NPC|AndroidUI <textures_root_dir> <out_dir> [[-a] [-b] [-m] [-d] [-r] | -o <options_json>] [-z <resize_factor>]" << std::endl;
+    std::cout << " run_simulation_benchmark <game_root_dir> <ship_file> <out_json> [-s idle_float|sink|bomb_chain|fire_spread|all] [-n <steps>] [-p <simulation_parallelism>] [-t <out_trace_json>]" << std::endl;
+    std::cout << " run_replay <game_root_dir> <input_recording_file> <out_json> [-p <simulation_parallelism>] [-t <out_trace_json>]" << std::endl;
+    std::cout << " run_differential <game_root_dir> <ship_file> <out_json> [-s idle_float|sink|bomb_chain|fire_spread] [-n <steps>] [-e <snapshot_interval>] [-x <tolerance>] [-1 <configuration>] [-2 <configuration> | -r <reference_snapshots>] [-w <out_snapshots>]" << std::endl;
+    std::cout << "   configuration: [parallelism=<n>][,relaxation=step_by_step|full_speed|hybrid][,stepping=frame|fast_forward]" << std::endl;
+    std::cout << " run_batch <game_root_dir> <ship_file_or_dir> <out_json> [-s idle_float|sink|bomb_chain|fire_spread] [-n <steps>] [-c <worlds_per_ship>] [-p <parallelism>]" << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,887 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "SimulationBenchmarkRunner.h"
+
+#include <Game/FileStreams.h>
+#include <Game/GameAssetManager.h>
+#include <Game/HeadlessSimulation.h>
+#include <Game/HeadlessSimulationBatch.h>
+#include <Game/InputRecording.h>
+#include <Game/ShipDeSerializer.h>
+#include <Game/ShipLoadSpecifications.h>
+
+#include <Simulation/StateSnapshot.h>
+
+#include <Core/CpuTopology.h>
+#include <Core/GameChronometer.h>
+#include <Core/PerfStats.h>
+#include <Core/ThreadManager.h>
+#include <Core/Utils.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace /* anonymous */ {
+
+// Same seed for all runs, so that all runs do the same work
+std::uint32_t constexpr Seed = 42;
+
+struct Phase
+{
+    std::string Name;
+    size_t StepCount;
+    std::function<void(HeadlessSimulation &, ShipId, size_t)> Action; // Invoked before each step of the phase, with the step index in the phase
+
+    Phase(
+        std::string const & name,
+        size_t stepCount,
+        std::function<void(HeadlessSimulation &, ShipId, size_t)> && action = {})
+        : Name(name)
+        , StepCount(stepCount)
+        , Action(std::move(action))
+    {}
+};
+
+std::string ScenarioTypeToStr(SimulationBenchmarkRunner::ScenarioType scenario)
+{
+    switch (scenario)
+    {
+        case SimulationBenchmarkRunner::ScenarioType::IdleFloat:
+            return "idle_float";
+        case SimulationBenchmarkRunner::ScenarioType::Sink:
+            return "sink";
+        case SimulationBenchmarkRunner::ScenarioType::BombChain:
+            return "bomb_chain";
+        case SimulationBenchmarkRunner::ScenarioType::FireSpread:
+            return "fire_spread";
+    }
+
+    assert(false);
+    return "";
+}
+
+/*
+ * Returns the current position of the n-th of count ship points evenly spread across the ship's points.
+ */
+vec2f GetTargetPosition(
+    HeadlessSimulation const & simulation,
+    ShipId shipId,
+    size_t n,
+    size_t count)
+{
+    auto const & points = simulation.GetWorld().GetShip(shipId).GetPoints();
+    ElementIndex const pointIndex = static_cast<ElementIndex>((2 * n + 1) * points.GetRawShipPointCount() / (2 * count));
+    return points.GetPosition(pointIndex);
+}
+
+std::vector<Phase> MakePhases(
+    SimulationBenchmarkRunner::ScenarioType scenario,
+    size_t stepCount)
+{
+    size_t const settleStepCount = stepCount / 4;
+
+    switch (scenario)
+    {
+        case SimulationBenchmarkRunner::ScenarioType::IdleFloat:
+        {
+            return { Phase("float", stepCount) };
+        }
+
+        case SimulationBenchmarkRunner::ScenarioType::Sink:
+        {
+            size_t constexpr LeakCount = 3;
+
+            return {
+                Phase("settle", settleStepCount),
+                Phase(
+                    "flood",
+                    stepCount - settleStepCount,
+                    [](HeadlessSimulation & simulation, ShipId shipId, size_t)
+                    {
+                        for (size_t l = 0; l < LeakCount; ++l)
+                        {
+                            simulation.GetWorld().FloodAt(
+                                GetTargetPosition(simulation, shipId, l, LeakCount),
+                                1.0f,
+                                1.0f,
+                                simulation.GetSimulationParameters());
+                        }
+                    })
+            };
+        }
+
+        case SimulationBenchmarkRunner::ScenarioType::BombChain:
+        {
+            size_t constexpr BombCount = 6;
+            size_t const chainStepCount = stepCount - settleStepCount;
+            size_t const bombInterval = std::max(chainStepCount / (BombCount + 1), size_t(2));
+
+            return {
+                Phase("settle", settleStepCount),
+                Phase(
+                    "chain",
+                    chainStepCount,
+                    [bombInterval](HeadlessSimulation & simulation, ShipId shipId, size_t step)
+                    {
+                        size_t const bomb = step / bombInterval;
+                        if (bomb < BombCount)
+                        {
+                            if (step % bombInterval == 0)
+                            {
+                                simulation.GetWorld().ToggleRCBombAt(
+                                    GetTargetPosition(simulation, shipId, bomb, BombCount),
+                                    simulation.GetSimulationParameters());
+                            }
+                            else if (step % bombInterval == 1)
+                            {
+                                simulation.GetWorld().DetonateRCBombs(simulation.GetSimulationParameters());
+                            }
+                        }
+                    })
+            };
+        }
+
+        case SimulationBenchmarkRunner::ScenarioType::FireSpread:
+        {
+            size_t const igniteStepCount = std::max(stepCount / 8, size_t(1));
+
+            return {
+                Phase("settle", settleStepCount),
+                Phase(
+                    "ignite",
+                    igniteStepCount,
+                    [](HeadlessSimulation & simulation, ShipId shipId, size_t)
+                    {
+                        simulation.GetWorld().ApplyHeatBlasterAt(
+                            GetTargetPosition(simulation, shipId, 0, 1),
+                            HeatBlasterActionType::Heat,
+                            4.0f,
+                            simulation.GetSimulationParameters());
+                    }),
+                Phase("burn", stepCount - std::min(settleStepCount + igniteStepCount, stepCount))
+            };
+        }
+    }
+
+    assert(false);
+    return {};
+}
+
+/*
+ * The actions of all the phases of the scenario, as one action over the steps of the whole scenario.
+ */
+std::function<void(HeadlessSimulation &, ShipId, size_t)> MakeScenarioAction(
+    SimulationBenchmarkRunner::ScenarioType scenario,
+    size_t stepCount)
+{
+    return [phases = MakePhases(scenario, stepCount)](HeadlessSimulation & simulation, ShipId shipId, size_t step)
+        {
+            for (auto const & phase : phases)
+            {
+                if (step < phase.StepCount)
+                {
+                    if (phase.Action)
+                    {
+                        phase.Action(simulation, shipId, step);
+                    }
+
+                    return;
+                }
+
+                step -= phase.StepCount;
+            }
+        };
+}
+
+template<PerfMeasurement TMeasurement>
+void AddMeasurement(
+    char const * name,
+    PerfStats const & perfStats,
+    picojson::object & measurementsJson)
+{
+    measurementsJson.emplace(
+        name,
+        picojson::value(static_cast<double>(perfStats.GetMeasurement<TMeasurement>().template ToRatio<std::chrono::microseconds>()) / 1000.0));
+}
+
+picojson::value MakePhaseJson(
+    Phase const & phase,
+    PerfStats const & phasePerfStats,
+    GameChronometer::duration phaseDuration)
+{
+    picojson::object phaseJson;
+
+    phaseJson.emplace("name", picojson::value(phase.Name));
+    phaseJson.emplace("steps", picojson::value(static_cast<std::int64_t>(phase.StepCount)));
+
+    double const phaseMs = std::chrono::duration<double, std::milli>(phaseDuration).count();
+    phaseJson.emplace("wall_time_ms", picojson::value(phaseMs));
+
+    // Average milliseconds per measurement
+    picojson::object measurementsJson;
+    AddMeasurement<PerfMeasurement::TotalUpdate>("update", phasePerfStats, measurementsJson);
+    AddMeasurement<PerfMeasurement::TotalShipsSpringsUpdate>("ships_springs_update", phasePerfStats, measurementsJson);
+    AddMeasurement<PerfMeasurement::TotalShipsSpringsStragglerGap>("ships_springs_straggler_gap", phasePerfStats, measurementsJson);
+    AddMeasurement<PerfMeasurement::TotalNpcUpdate>("npc_update", phasePerfStats, measurementsJson);
+    AddMeasurement<PerfMeasurement::TotalFishUpdate>("fish_update", phasePerfStats, measurementsJson);
+    phaseJson.emplace("avg_ms", picojson::value(measurementsJson));
+
+    // Update latency distribution
+    auto const & updateMeasurement = phasePerfStats.GetMeasurement<PerfMeasurement::TotalUpdate>();
+    picojson::object updateLatencyJson;
+    updateLatencyJson.emplace("p50", picojson::value(static_cast<double>(updateMeasurement.ToPercentile<std::chrono::microseconds>(0.5f)) / 1000.0));
+    updateLatencyJson.emplace("p95", picojson::value(static_cast<double>(updateMeasurement.ToPercentile<std::chrono::microseconds>(0.95f)) / 1000.0));
+    updateLatencyJson.emplace("p99", picojson::value(static_cast<double>(updateMeasurement.ToPercentile<std::chrono::microseconds>(0.99f)) / 1000.0));
+    updateLatencyJson.emplace("max", picojson::value(static_cast<double>(updateMeasurement.ToMax<std::chrono::microseconds>()) / 1000.0));
+    phaseJson.emplace("update_latency_ms", picojson::value(updateLatencyJson));
+
+    // Simulation thread pool balance
+    picojson::object threadPoolJson;
+    AddMeasurement<PerfMeasurement::SimulationThreadPoolRun>("avg_run_ms", phasePerfStats, threadPoolJson);
+    AddMeasurement<PerfMeasurement::SimulationThreadPoolCriticalPath>("avg_critical_path_ms", phasePerfStats, threadPoolJson);
+    AddMeasurement<PerfMeasurement::SimulationThreadPoolImbalance>("avg_imbalance_ms", phasePerfStats, threadPoolJson);
+    picojson::array threadPoolThreadsJson;
+    for (size_t t = 0; t < phasePerfStats.GetSimulationThreadPoolThreadCount(); ++t)
+    {
+        auto const & thread = phasePerfStats.GetSimulationThreadPoolThread(t);
+
+        picojson::object threadJson;
+        threadJson.emplace("tasks", picojson::value(static_cast<std::int64_t>(thread.TaskCount.GetValue())));
+        threadJson.emplace("busy_ms", picojson::value(static_cast<double>(thread.BusyNanoseconds.GetValue()) / 1000000.0));
+        threadJson.emplace("idle_ms", picojson::value(static_cast<double>(thread.IdleNanoseconds.GetValue()) / 1000000.0));
+        threadJson.emplace("utilization", picojson::value(static_cast<double>(thread.GetUtilization())));
+        threadPoolThreadsJson.emplace_back(threadJson);
+    }
+    threadPoolJson.emplace("threads", picojson::value(threadPoolThreadsJson));
+    phaseJson.emplace("thread_pool", picojson::value(threadPoolJson));
+
+    picojson::object countersJson;
+    countersJson.emplace(
+        "culled_ephemeral_particles",
+        picojson::value(static_cast<std::int64_t>(phasePerfStats.GetCounter<PerfCounter::CulledEphemeralParticles>().GetValue())));
+    phaseJson.emplace("counters", picojson::value(countersJson));
+
+    return picojson::value(phaseJson);
+}
+
+std::string SpringRelaxationParallelComputationModeToStr(SpringRelaxationParallelComputationModeType mode)
+{
+    switch (mode)
+    {
+        case SpringRelaxationParallelComputationModeType::StepByStep:
+            return "step_by_step";
+        case SpringRelaxationParallelComputationModeType::FullSpeed:
+            return "full_speed";
+        case SpringRelaxationParallelComputationModeType::Hybrid:
+            return "hybrid";
+    }
+
+    assert(false);
+    return "";
+}
+
+std::vector<StateSnapshot> RunForStateSnapshots(
+    GameAssetManager const & gameAssetManager,
+    ThreadManager & threadManager,
+    std::filesystem::path const & shipFilePath,
+    SimulationBenchmarkRunner::ScenarioType scenario,
+    size_t stepCount,
+    size_t snapshotInterval,
+    SimulationBenchmarkRunner::Configuration const & configuration)
+{
+    threadManager.SetSimulationParallelism(std::min(configuration.SimulationParallelism, threadManager.GetMaxSimulationParallelism()));
+
+    HeadlessSimulation simulation(gameAssetManager, threadManager, Seed);
+    simulation.GetSimulationParameters().SpringRelaxationParallelComputationMode = configuration.SpringRelaxationParallelComputationMode;
+
+    ShipId const shipId = simulation.AddShip(ShipLoadSpecifications(shipFilePath));
+
+    std::vector<StateSnapshot> snapshots;
+    snapshots.emplace_back(StateSnapshot::Capture(simulation.GetWorld(), 0));
+
+    std::uint64_t step = 0;
+    for (auto const & phase : MakePhases(scenario, stepCount))
+    {
+        if (configuration.IsFastForward && !phase.Action)
+        {
+            // Fast-forward up to each snapshot, and up to the end of the phase
+            for (size_t s = 0; s < phase.StepCount;)
+            {
+                size_t const chunkStepCount = std::min(
+                    snapshotInterval - static_cast<size_t>(step % snapshotInterval),
+                    phase.StepCount - s);
+
+                size_t const actualStepCount = simulation.FastForward(static_cast<float>(chunkStepCount) * SimulationParameters::SimulationStepTimeDuration<float>);
+                assert(actualStepCount == chunkStepCount);
+                (void)actualStepCount;
+
+                s += chunkStepCount;
+                step += chunkStepCount;
+
+                if ((step % snapshotInterval) == 0)
+                {
+                    snapshots.emplace_back(StateSnapshot::Capture(simulation.GetWorld(), step));
+                }
+            }
+
+            continue;
+        }
+
+        for (size_t s = 0; s < phase.StepCount; ++s)
+        {
+            if (phase.Action)
+            {
+                HeadlessSimulation::ThreadScope const threadScope(simulation);
+                phase.Action(simulation, shipId, s);
+            }
+
+            simulation.Update();
+            ++step;
+
+            if ((step % snapshotInterval) == 0)
+            {
+                snapshots.emplace_back(StateSnapshot::Capture(simulation.GetWorld(), step));
+            }
+        }
+    }
+
+    if (snapshots.back().GetStep() != step)
+    {
+        snapshots.emplace_back(StateSnapshot::Capture(simulation.GetWorld(), step));
+    }
+
+    return snapshots;
+}
+
+picojson::value MakeDigestsJson(StateSnapshot const & snapshot)
+{
+    picojson::object digestsJson;
+
+    for (size_t ss = 0; ss < StateSnapshot::SubsystemCount; ++ss)
+    {
+        StateSubsystemType const subsystem = static_cast<StateSubsystemType>(ss);
+
+        std::stringstream digestSs;
+        digestSs << std::hex << std::setw(16) << std::setfill('0') << snapshot.CalculateDigest(subsystem);
+        digestsJson.emplace(StateSubsystemTypeToStr(subsystem), picojson::value(digestSs.str()));
+    }
+
+    return picojson::value(digestsJson);
+}
+
+picojson::value MakeDivergenceJson(StateSnapshot::Divergence const & divergence)
+{
+    auto const makeValueJson = [](std::optional<float> const & value)
+        {
+            return value.has_value()
+                ? picojson::value(static_cast<double>(*value))
+                : picojson::value();
+        };
+
+    picojson::object divergenceJson;
+    divergenceJson.emplace("subsystem", picojson::value(StateSubsystemTypeToStr(divergence.Subsystem)));
+    divergenceJson.emplace("ship", picojson::value(static_cast<std::int64_t>(divergence.Ship)));
+    divergenceJson.emplace("element", picojson::value(static_cast<std::int64_t>(divergence.Element)));
+    divergenceJson.emplace("component", picojson::value(static_cast<std::int64_t>(divergence.Component)));
+    divergenceJson.emplace("value_1", makeValueJson(divergence.Value1));
+    divergenceJson.emplace("value_2", makeValueJson(divergence.Value2));
+
+    return picojson::value(divergenceJson);
+}
+
+/*
+ * Clamps the simulation parallelism to the CPUs we may use.
+ */
+std::unique_ptr<ThreadManager> MakeThreadManager(size_t & simulationParallelism)
+{
+    // Place threads as the game does, when the topology is known
+    auto const cpuTopology = CpuTopology::Load();
+
+    std::vector<ThreadManager::CpuInfo> cpuResources;
+    if (cpuTopology.has_value())
+    {
+        cpuResources = cpuTopology->MakeCpuResources();
+    }
+
+    bool const doPinThreads = !cpuResources.empty() && cpuResources.size() <= ThreadManager::GetNumberOfProcessors();
+    if (!doPinThreads)
+    {
+        cpuResources.clear();
+        for (size_t c = 0; c < ThreadManager::GetNumberOfProcessors(); ++c)
+        {
+            cpuResources.emplace_back(c, 1.0f);
+        }
+    }
+
+    simulationParallelism = std::clamp(simulationParallelism, size_t(1), cpuResources.size());
+
+    auto threadManager = std::make_unique<ThreadManager>(
+        false,
+        simulationParallelism,
+        cpuResources,
+        [doPinThreads](ThreadManager::ThreadTaskKind, std::optional<size_t> cpuId, size_t, std::string const &)
+        {
+            if (cpuId.has_value() && doPinThreads)
+            {
+                ThreadManager::SetThisThreadAffinity(*cpuId);
+            }
+        });
+
+    threadManager->InitializeThisThread(
+        ThreadManager::ThreadTaskKind::MainAndSimulation,
+        cpuResources[0].CpuId,
+        0,
+        "ShipTools Main Thread");
+
+    return threadManager;
+}
+
+}
+
+std::vector<SimulationBenchmarkRunner::ScenarioType> SimulationBenchmarkRunner::StrToScenarioTypes(std::string const & str)
+{
+    std::vector<ScenarioType> const allScenarios = {
+        ScenarioType::IdleFloat,
+        ScenarioType::Sink,
+        ScenarioType::BombChain,
+        ScenarioType::FireSpread };
+
+    if (Utils::CaseInsensitiveEquals(str, "all"))
+    {
+        return allScenarios;
+    }
+
+    for (auto const scenario : allScenarios)
+    {
+        if (Utils::CaseInsensitiveEquals(str, ScenarioTypeToStr(scenario)))
+        {
+            return { scenario };
+        }
+    }
+
+    throw std::runtime_error("Unrecognized scenario '" + str + "'");
+}
+
+SimulationBenchmarkRunner::Configuration::Configuration()
+    : SimulationParallelism(1)
+    , SpringRelaxationParallelComputationMode(SimulationParameters().SpringRelaxationParallelComputationMode)
+    , IsFastForward(false)
+{
+}
+
+SimulationBenchmarkRunner::Configuration SimulationBenchmarkRunner::Configuration::FromStr(std::string const & str)
+{
+    Configuration configuration;
+
+    std::stringstream ss(str);
+    std::string setting;
+    while (std::getline(ss, setting, ','))
+    {
+        auto const equalsPos = setting.find('=');
+        if (equalsPos == std::string::npos)
+        {
+            throw std::runtime_error("Invalid configuration setting '" + setting + "'");
+        }
+
+        std::string const name = Utils::Trim(setting.substr(0, equalsPos));
+        std::string const value = Utils::Trim(setting.substr(equalsPos + 1));
+
+        if (name == "parallelism")
+        {
+            configuration.SimulationParallelism = static_cast<size_t>(std::max(std::atoi(value.c_str()), 1));
+        }
+        else if (name == "relaxation")
+        {
+            bool isFound = false;
+            for (auto const mode : { SpringRelaxationParallelComputationModeType::StepByStep, SpringRelaxationParallelComputationModeType::FullSpeed, SpringRelaxationParallelComputationModeType::Hybrid })
+            {
+                if (Utils::CaseInsensitiveEquals(value, SpringRelaxationParallelComputationModeToStr(mode)))
+                {
+                    configuration.SpringRelaxationParallelComputationMode = mode;
+                    isFound = true;
+                    break;
+                }
+            }
+
+            if (!isFound)
+            {
+                throw std::runtime_error("Unrecognized relaxation mode '" + value + "'");
+            }
+        }
+        else if (name == "stepping")
+        {
+            if (Utils::CaseInsensitiveEquals(value, "frame"))
+            {
+                configuration.IsFastForward = false;
+            }
+            else if (Utils::CaseInsensitiveEquals(value, "fast_forward"))
+            {
+                configuration.IsFastForward = true;
+            }
+            else
+            {
+                throw std::runtime_error("Unrecognized stepping mode '" + value + "'");
+            }
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized configuration setting '" + name + "'");
+        }
+    }
+
+    return configuration;
+}
+
+std::string SimulationBenchmarkRunner::Configuration::ToStr() const
+{
+    return "parallelism=" + std::to_string(SimulationParallelism)
+        + ",relaxation=" + SpringRelaxationParallelComputationModeToStr(SpringRelaxationParallelComputationMode)
+        + ",stepping=" + (IsFastForward ? "fast_forward" : "frame");
+}
+
+picojson::value SimulationBenchmarkRunner::Run(
+    std::filesystem::path const & gameRootPath,
+    std::filesystem::path const & shipFilePath,
+    std::vector<ScenarioType> const & scenarios,
+    size_t stepCount,
+    size_t simulationParallelism)
+{
+    GameAssetManager const gameAssetManager = GameAssetManager::FromGameRoot(gameRootPath);
+
+    auto const threadManager = MakeThreadManager(simulationParallelism);
+
+    //
+    // Run scenarios
+    //
+
+    picojson::array scenariosJson;
+
+    for (auto const scenario : scenarios)
+    {
+        std::cout << "  " << ScenarioTypeToStr(scenario) << "..." << std::endl;
+
+        HeadlessSimulation simulation(gameAssetManager, *threadManager, Seed);
+        ShipId const shipId = simulation.AddShip(ShipLoadSpecifications(shipFilePath));
+
+        picojson::array phasesJson;
+
+        for (auto const & phase : MakePhases(scenario, stepCount))
+        {
+            PerfStats const startPerfStats = simulation.GetPerfStats();
+            auto const startTime = GameChronometer::Now();
+
+            for (size_t s = 0; s < phase.StepCount; ++s)
+            {
+                if (phase.Action)
+                {
+                    HeadlessSimulation::ThreadScope const threadScope(simulation);
+                    phase.Action(simulation, shipId, s);
+                }
+
+                simulation.Update();
+            }
+
+            auto const phaseDuration = GameChronometer::Now() - startTime;
+
+            phasesJson.emplace_back(
+                MakePhaseJson(
+                    phase,
+                    simulation.GetPerfStats() - startPerfStats,
+                    phaseDuration));
+        }
+
+        picojson::object scenarioJson;
+        scenarioJson.emplace("name", picojson::value(ScenarioTypeToStr(scenario)));
+        scenarioJson.emplace("phases", picojson::value(phasesJson));
+
+        scenariosJson.emplace_back(scenarioJson);
+    }
+
+    picojson::object rootJson;
+    rootJson.emplace("ship", picojson::value(shipFilePath.filename().string()));
+    rootJson.emplace("steps", picojson::value(static_cast<std::int64_t>(stepCount)));
+    rootJson.emplace("simulation_parallelism", picojson::value(static_cast<std::int64_t>(simulationParallelism)));
+    rootJson.emplace("scenarios", picojson::value(scenariosJson));
+
+    return picojson::value(rootJson);
+}
+
+picojson::value SimulationBenchmarkRunner::RunReplay(
+    std::filesystem::path const & gameRootPath,
+    std::filesystem::path const & recordingFilePath,
+    std::optional<size_t> simulationParallelism)
+{
+    GameAssetManager const gameAssetManager = GameAssetManager::FromGameRoot(gameRootPath);
+
+    FileBinaryReadStream recordingStream(recordingFilePath);
+    InputRecording recording = InputRecording::LoadFromStream(recordingStream);
+
+    // Unless told otherwise, replay with the recording's parallelism, as that's the only one yielding the same simulation
+    size_t actualSimulationParallelism = simulationParallelism.value_or(recording.SimulationParallelism);
+    auto const threadManager = MakeThreadManager(actualSimulationParallelism);
+    if (actualSimulationParallelism != recording.SimulationParallelism)
+    {
+        std::cout << "  WARNING: replaying with simulation parallelism " << actualSimulationParallelism
+            << " instead of the recording's " << recording.SimulationParallelism << "; the simulation will diverge" << std::endl;
+    }
+
+    Phase const phase("replay", static_cast<size_t>(recording.StepCount));
+
+    HeadlessSimulation simulation(gameAssetManager, *threadManager, recording.Seed);
+    simulation.StartReplay(std::move(recording));
+
+    PerfStats const startPerfStats = simulation.GetPerfStats();
+    auto const startTime = GameChronometer::Now();
+
+    while (simulation.IsReplaying())
+    {
+        simulation.Update();
+    }
+
+    auto const phaseDuration = GameChronometer::Now() - startTime;
+
+    picojson::object rootJson;
+    rootJson.emplace("recording", picojson::value(recordingFilePath.filename().string()));
+    rootJson.emplace("steps", picojson::value(static_cast<std::int64_t>(phase.StepCount)));
+    rootJson.emplace("simulation_parallelism", picojson::value(static_cast<std::int64_t>(actualSimulationParallelism)));
+    rootJson.emplace("replay", MakePhaseJson(phase, simulation.GetPerfStats() - startPerfStats, phaseDuration));
+
+    // Whether we've reproduced the state at the end of the recording
+    auto const isFinalStateMatching = simulation.IsReplayFinalStateMatching();
+    rootJson.emplace("final_state_matches", isFinalStateMatching.has_value() ? picojson::value(*isFinalStateMatching) : picojson::value());
+
+    return picojson::value(rootJson);
+}
+
+picojson::value SimulationBenchmarkRunner::RunDifferential(
+    std::filesystem::path const & gameRootPath,
+    std::filesystem::path const & shipFilePath,
+    ScenarioType scenario,
+    size_t stepCount,
+    size_t snapshotInterval,
+    float tolerance,
+    Configuration const & configuration1,
+    std::optional<Configuration> const & configuration2,
+    std::optional<std::filesystem::path> const & referenceSnapshotsFilePath,
+    std::optional<std::filesystem::path> const & outputSnapshotsFilePath)
+{
+    assert(snapshotInterval > 0);
+
+    GameAssetManager const gameAssetManager = GameAssetManager::FromGameRoot(gameRootPath);
+
+    size_t maxSimulationParallelism = std::max(
+        configuration1.SimulationParallelism,
+        configuration2.has_value() ? configuration2->SimulationParallelism : size_t(1));
+    auto const threadManager = MakeThreadManager(maxSimulationParallelism);
+
+    //
+    // Run first configuration
+    //
+
+    std::cout << "  " << configuration1.ToStr() << "..." << std::endl;
+
+    auto const snapshots1 = RunForStateSnapshots(gameAssetManager, *threadManager, shipFilePath, scenario, stepCount, snapshotInterval, configuration1);
+
+    if (outputSnapshotsFilePath.has_value())
+    {
+        FileBinaryWriteStream outputStream(*outputSnapshotsFilePath);
+        StateSnapshot::SaveToStream(snapshots1, outputStream);
+    }
+
+    //
+    // Get snapshots to compare against
+    //
+
+    std::optional<std::vector<StateSnapshot>> snapshots2;
+    std::string snapshots2Name;
+
+    if (referenceSnapshotsFilePath.has_value())
+    {
+        FileBinaryReadStream inputStream(*referenceSnapshotsFilePath);
+        snapshots2 = StateSnapshot::LoadFromStream(inputStream);
+        snapshots2Name = referenceSnapshotsFilePath->filename().string();
+    }
+    else if (configuration2.has_value())
+    {
+        std::cout << "  " << configuration2->ToStr() << "..." << std::endl;
+
+        snapshots2 = RunForStateSnapshots(gameAssetManager, *threadManager, shipFilePath, scenario, stepCount, snapshotInterval, *configuration2);
+        snapshots2Name = configuration2->ToStr();
+    }
+
+    //
+    // Compare
+    //
+
+    picojson::array snapshotsJson;
+    std::optional<picojson::value> firstDivergenceJson;
+    bool isIdentical = true;
+
+    for (size_t i = 0; i < snapshots1.size(); ++i)
+    {
+        picojson::object snapshotJson;
+        snapshotJson.emplace("step", picojson::value(static_cast<std::int64_t>(snapshots1[i].GetStep())));
+        snapshotJson.emplace("digests_1", MakeDigestsJson(snapshots1[i]));
+
+        if (snapshots2.has_value())
+        {
+            if (i >= snapshots2->size() || (*snapshots2)[i].GetStep() != snapshots1[i].GetStep())
+            {
+                throw std::runtime_error("Snapshots to compare against were taken at different steps");
+            }
+
+            auto const & snapshot2 = (*snapshots2)[i];
+            snapshotJson.emplace("digests_2", MakeDigestsJson(snapshot2));
+
+            for (size_t ss = 0; ss < StateSnapshot::SubsystemCount; ++ss)
+            {
+                isIdentical = isIdentical && (snapshots1[i].CalculateDigest(static_cast<StateSubsystemType>(ss)) == snapshot2.CalculateDigest(static_cast<StateSubsystemType>(ss)));
+            }
+
+            if (!firstDivergenceJson.has_value())
+            {
+                auto const divergences = StateSnapshot::FindDivergences(snapshots1[i], snapshot2, tolerance);
+                if (!divergences.empty())
+                {
+                    picojson::array divergencesJson;
+                    for (auto const & divergence : divergences)
+                    {
+                        divergencesJson.emplace_back(MakeDivergenceJson(divergence));
+                    }
+
+                    picojson::object divergenceJson;
+                    divergenceJson.emplace("step", picojson::value(static_cast<std::int64_t>(snapshots1[i].GetStep())));
+                    divergenceJson.emplace("divergences", picojson::value(divergencesJson));
+
+                    firstDivergenceJson = picojson::value(divergenceJson);
+                }
+            }
+        }
+
+        snapshotsJson.emplace_back(snapshotJson);
+    }
+
+    picojson::object rootJson;
+    rootJson.emplace("ship", picojson::value(shipFilePath.filename().string()));
+    rootJson.emplace("scenario", picojson::value(ScenarioTypeToStr(scenario)));
+    rootJson.emplace("steps", picojson::value(static_cast<std::int64_t>(stepCount)));
+    rootJson.emplace("tolerance", picojson::value(static_cast<double>(tolerance)));
+    rootJson.emplace("configuration_1", picojson::value(configuration1.ToStr()));
+    rootJson.emplace("snapshots", picojson::value(snapshotsJson));
+
+    if (snapshots2.has_value())
+    {
+        rootJson.emplace("configuration_2", picojson::value(snapshots2Name));
+        rootJson.emplace("identical", picojson::value(isIdentical));
+        rootJson.emplace("first_divergence", firstDivergenceJson.value_or(picojson::value()));
+    }
+
+    return picojson::value(rootJson);
+}
+
+picojson::value SimulationBenchmarkRunner::RunBatch(
+    std::filesystem::path const & gameRootPath,
+    std::filesystem::path const & shipPath,
+    ScenarioType scenario,
+    size_t stepCount,
+    size_t worldsPerShipCount,
+    size_t parallelism)
+{
+    GameAssetManager const gameAssetManager = GameAssetManager::FromGameRoot(gameRootPath);
+
+    std::vector<std::filesystem::path> shipFilePaths;
+    if (std::filesystem::is_directory(shipPath))
+    {
+        for (auto const & entry : std::filesystem::directory_iterator(shipPath))
+        {
+            if (entry.is_regular_file() && ShipDeSerializer::IsAnyShipDefinitionFile(entry.path()))
+            {
+                shipFilePaths.push_back(entry.path());
+            }
+        }
+
+        std::sort(shipFilePaths.begin(), shipFilePaths.end());
+    }
+    else
+    {
+        shipFilePaths.push_back(shipPath);
+    }
+
+    auto const threadManager = MakeThreadManager(parallelism);
+
+    // Loads the databases, once for all worlds
+    auto const loadStartTime = GameChronometer::Now();
+    HeadlessSimulationBatch const batch(gameAssetManager, *threadManager);
+    auto const loadDuration = GameChronometer::Now() - loadStartTime;
+
+    std::vector<HeadlessSimulationBatch::WorldSpecification> worldSpecifications;
+    for (auto const & shipFilePath : shipFilePaths)
+    {
+        for (size_t w = 0; w < worldsPerShipCount; ++w)
+        {
+            worldSpecifications.emplace_back(
+                ShipLoadSpecifications(shipFilePath),
+                Seed + static_cast<std::uint32_t>(w),
+                stepCount,
+                MakeScenarioAction(scenario, stepCount));
+        }
+    }
+
+    std::cout << "  " << worldSpecifications.size() << " worlds..." << std::endl;
+
+    auto const runStartTime = GameChronometer::Now();
+    auto const worldMetrics = batch.Run(worldSpecifications);
+    auto const runDuration = GameChronometer::Now() - runStartTime;
+
+    picojson::array worldsJson;
+    for (size_t w = 0; w < worldSpecifications.size(); ++w)
+    {
+        auto const & metrics = worldMetrics[w];
+
+        picojson::object worldJson;
+        worldJson.emplace("ship", picojson::value(worldSpecifications[w].ShipLoadSpecs.DefinitionFilepath.filename().string()));
+        worldJson.emplace("seed", picojson::value(static_cast<std::int64_t>(worldSpecifications[w].Seed)));
+
+        if (metrics.Error.has_value())
+        {
+            worldJson.emplace("error", picojson::value(*metrics.Error));
+        }
+        else
+        {
+            double const updateMs = std::chrono::duration<double, std::milli>(metrics.UpdateDuration).count();
+
+            worldJson.emplace("steps", picojson::value(static_cast<std::int64_t>(metrics.StepCount)));
+            worldJson.emplace("avg_update_ms", picojson::value(metrics.StepCount > 0 ? updateMs / static_cast<double>(metrics.StepCount) : 0.0));
+            worldJson.emplace("submerged_fraction", picojson::value(static_cast<double>(metrics.SubmergedPointsFraction)));
+            worldJson.emplace("broken_springs_fraction", picojson::value(static_cast<double>(metrics.BrokenSpringsFraction)));
+            worldJson.emplace(
+                "sunk_steps",
+                metrics.SunkStepCount.has_value()
+                    ? picojson::value(static_cast<std::int64_t>(*metrics.SunkStepCount))
+                    : picojson::value());
+        }
+
+        worldsJson.emplace_back(worldJson);
+    }
+
+    picojson::object rootJson;
+    rootJson.emplace("scenario", picojson::value(ScenarioTypeToStr(scenario)));
+    rootJson.emplace("steps", picojson::value(static_cast<std::int64_t>(stepCount)));
+    rootJson.emplace("parallelism", picojson::value(static_cast<std::int64_t>(parallelism)));
+    rootJson.emplace("database_load_ms", picojson::value(std::chrono::duration<double, std::milli>(loadDuration).count()));
+    rootJson.emplace("wall_time_ms", picojson::value(std::chrono::duration<double, std::milli>(runDuration).count()));
+    rootJson.emplace("worlds", picojson::value(worldsJson));
+
+    return picojson::value(rootJson);
+}
@@ -0,0 +1,104 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Core/GameTypes.h>
+
+#include <picojson.h>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * Runs the whole simulation headless on a real ship, through a scripted scenario, and
+ * reports the PerfStats measurements of each phase of the scenario.
+ *
+ * Each scenario runs on a freshly-loaded ship in a deterministic session, hence the work
+ * done is the same across runs with the same inputs, and timings may be compared across
+ * commits.
+ *
+ * Scenarios may also be run for differential validation: snapshots of the simulation state
+ * are taken at regular intervals under two configurations - or under one configuration and
+ * compared against the snapshots saved by another build - and the first divergence between
+ * the two is reported.
+ */
+class SimulationBenchmarkRunner
+{
+public:
+
+    enum class ScenarioType
+    {
+        IdleFloat,  // Ship just floats
+        Sink,       // Ship is flooded at a few places
+        BombChain,  // RC bombs go off one after the other, from one end of the ship to the other
+        FireSpread  // Ship is set on fire at its center, and fire spreads
+    };
+
+    static std::vector<ScenarioType> StrToScenarioTypes(std::string const & str);
+
+    struct Configuration
+    {
+        size_t SimulationParallelism;
+        SpringRelaxationParallelComputationModeType SpringRelaxationParallelComputationMode;
+        bool IsFastForward; // Runs the steps of phases without actions via fast-forward, rather than frame by frame
+
+        Configuration();
+
+        // E.g. "parallelism=4,relaxation=hybrid,stepping=fast_forward"; unspecified values are the defaults
+        static Configuration FromStr(std::string const & str);
+
+        std::string ToStr() const;
+    };
+
+    static picojson::value Run(
+        std::filesystem::path const & gameRootPath,
+        std::filesystem::path const & shipFilePath,
+        std::vector<ScenarioType> const & scenarios,
+        size_t stepCount,
+        size_t simulationParallelism);
+
+    /*
+     * Replays an input recording made in the game, and reports the PerfStats
+     * measurements of the whole replay.
+     */
+    static picojson::value RunReplay(
+        std::filesystem::path const & gameRootPath,
+        std::filesystem::path const & recordingFilePath,
+        std::optional<size_t> simulationParallelism);
+
+    /*
+     * Runs the scenario with the first configuration, taking state snapshots every
+     * snapshotInterval steps and optionally saving them; then compares them with the
+     * snapshots of the reference file, if specified, or else of a run with the second
+     * configuration, if specified.
+     */
+    static picojson::value RunDifferential(
+        std::filesystem::path const & gameRootPath,
+        std::filesystem::path const & shipFilePath,
+        ScenarioType scenario,
+        size_t stepCount,
+        size_t snapshotInterval,
+        float tolerance,
+        Configuration const & configuration1,
+        std::optional<Configuration> const & configuration2,
+        std::optional<std::filesystem::path> const & referenceSnapshotsFilePath,
+        std::optional<std::filesystem::path> const & outputSnapshotsFilePath);
+
+    /*
+     * Runs the scenario on each ship - the specified ship file, or all ships in the
+     * specified directory - in as many worlds per ship as specified, each with its
+     * own seed; worlds run in parallel, one per task, and report their own metrics.
+     */
+    static picojson::value RunBatch(
+        std::filesystem::path const & gameRootPath,
+        std::filesystem::path const & shipPath,
+        ScenarioType scenario,
+        size_t stepCount,
+        size_t worldsPerShipCount,
+        size_t parallelism);
+};
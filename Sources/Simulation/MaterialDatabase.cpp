@@ -368,22 +368,28 @@ MaterialDatabase MaterialDatabase::Make(
     MaterialColorMap<StructuralMaterial> structuralMaterialColorMap;
     MaterialNameMap<StructuralMaterial> structuralMaterialNameMap;
 
+    UniqueStructuralMaterialsArray uniqueStructuralMaterials;
+    for (size_t i = 0; i < uniqueStructuralMaterials.size(); ++i)
+        uniqueStructuralMaterials[i].second = nullptr;
+
     for (auto s : structuralMaterials)
     {
-        auto [_1, isInserted1] = structuralMaterialColorMap.insert({ s->ColorKey, *s });
+        auto [instanceIt, isInserted1] = structuralMaterialColorMap.insert({ s->ColorKey, *s });
         assert(isInserted1);
-        (void)_1;
         (void)isInserted1;
 
         auto [_2, isInserted2] = structuralMaterialNameMap.insert({ s->Name, s->ColorKey });
         assert(isInserted2);
         (void)_2;
         (void)isInserted2;
-    }
 
-    UniqueStructuralMaterialsArray uniqueStructuralMaterials;
-    for (size_t i = 0; i < uniqueStructuralMaterials.size(); ++i)
-        uniqueStructuralMaterials[i].second = nullptr;
+        if (s->UniqueType.has_value())
+        {
+            uniqueStructuralMaterials[static_cast<size_t>(*(s->UniqueType))] = std::make_pair(
+                s->ColorKey,
+                &(instanceIt->second));
+        }
+    }
 
     Palette<StructuralMaterial> structuralMaterialPalette;
     Palette<StructuralMaterial> ropeMaterialPalette;
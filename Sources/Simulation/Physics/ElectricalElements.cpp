@@ -703,6 +703,7 @@ void ElectricalElements::Destroy(
             if (mElementStateBuffer[electricalElementIndex].Generator.IsProducingCurrent)
             {
                 mElementStateBuffer[electricalElementIndex].Generator.IsProducingCurrent = false;
+                mIsPowerPropagationDirty = true;
 
                 // See whether we need to publish a power probe change
                 if (mInstanceInfos[electricalElementIndex].InstanceIndex != NoneElectricalElementInstanceIndex)
@@ -898,6 +899,7 @@ void ElectricalElements::Destroy(
 
     // Remember that connectivity structure has changed during this step
     mHasConnectivityStructureChangedInCurrentStep = true;
+    mIsPowerPropagationDirty = true;
 
     // Remember there's been a power failure in this step;
     // note we also set it in case a *lamp* is broken, not only when a generator
@@ -1010,6 +1012,7 @@ void ElectricalElements::Restore(ElementIndex electricalElementIndex)
 
             // Restore default gate state
             mGateStateBuffer[electricalElementIndex] = mMaterialBuffer[electricalElementIndex]->GateState;
+            mIsPowerPropagationDirty = true;
 
             break;
         }
@@ -1071,6 +1074,7 @@ void ElectricalElements::Restore(ElementIndex electricalElementIndex)
 
     // Remember that connectivity structure has changed during this step
     mHasConnectivityStructureChangedInCurrentStep = true;
+    mIsPowerPropagationDirty = true;
 }
 
 void ElectricalElements::OnPhysicalStructureChanged(Points const & points)
@@ -1225,8 +1229,9 @@ void ElectricalElements::Update(
     //
     // 3. Update sources and connectivity
     //
-    // We do this regardless of dirty elements, as elements might have changed their state autonomously
-    // (e.g. generators might have become wet, switches might have been toggled, etc.)
+    // We check sources regardless of dirty elements, as they might have changed their state autonomously
+    // (e.g. generators might have become wet); the propagation itself is only re-done when something
+    // it depends on has changed.
     //
     // Here we propagate source "power state" to all conducting-connected elements,
     // obeying at the same time elements' gate states
@@ -1247,7 +1252,7 @@ void ElectricalElements::Update(
     UpdateSinks(
         currentWallClockTime,
         currentSimulationTime,
-        newConnectivityVisitSequenceNumber,
+        mPowerPropagationVisitSequenceNumber,
         points,
         effectiveAirDensity,
         effectiveWaterDensity,
@@ -1376,6 +1381,9 @@ void ElectricalElements::InternalChangeConductivity(
 
     // Change current value
     mConductivityBuffer[elementIndex].ConductsElectricity = value;
+
+    // Remember that power needs to be re-propagated
+    mIsPowerPropagationDirty = true;
 }
 
 void ElectricalElements::UpdateEngineConductivity(
@@ -1636,6 +1644,7 @@ void ElectricalElements::UpdateAutomaticConductivityAndGateToggles(
                             //
 
                             mGateStateBuffer[elementIndex] = !mMaterialBuffer[elementIndex]->GateState;
+                            mIsPowerPropagationDirty = true;
 
                             // Highlight element
                             HighlightElectricalElement(elementIndex, points);
@@ -1723,25 +1732,17 @@ void ElectricalElements::UpdateSourcesAndPropagation(
     SimulationParameters const & simulationParameters)
 {
     //
-    // Visit electrical graph starting from sources, and propagate connectivity state
-    // by means of visit sequence number
+    // 1. Check pre-conditions that need to be satisfied by sources before visiting the connectivity graph;
+    // a source flipping its pre-conditions invalidates the last propagation
     //
 
-    std::queue<ElementIndex> electricalElementsToVisit;
-
     for (auto const sourceElementIndex : mSources)
     {
         // Do not visit deleted sources
         if (!IsDeleted(sourceElementIndex))
         {
-            //
-            // Check pre-conditions that need to be satisfied by source before visiting the connectivity graph
-            //
-
             auto const sourcePointIndex = GetPointIndex(sourceElementIndex);
 
-            bool sourcePreconditionsSatisfied = false;
-
             switch (GetMaterialType(sourceElementIndex))
             {
                 case ElectricalMaterial::ElectricalElementType::Generator:
@@ -1805,8 +1806,6 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                         }
                     }
 
-                    sourcePreconditionsSatisfied = isProducingCurrent;
-
                     //
                     // Check if it's a state change
                     //
@@ -1816,6 +1815,9 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                         // Change state
                         mElementStateBuffer[sourceElementIndex].Generator.IsProducingCurrent = isProducingCurrent;
 
+                        // Propagation needs to be re-done
+                        mIsPowerPropagationDirty = true;
+
                         // See whether we need to publish a power probe change
                         if (mInstanceInfos[sourceElementIndex].InstanceIndex != NoneElectricalElementInstanceIndex)
                         {
@@ -1856,8 +1858,32 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                     break;
                 }
             }
+        }
+    }
+
+    //
+    // 2. Visit electrical graph starting from sources, and propagate connectivity state
+    // by means of visit sequence number.
+    //
+    // The result of the propagation only depends on the connectivity structure, on conductivity
+    // and gate states, and on the sources' pre-conditions; we only re-visit the graph when any
+    // of these have changed since the last visit, and otherwise stick to the last visit's
+    // sequence number.
+    //
 
-            if (sourcePreconditionsSatisfied
+    if (mIsPowerPropagationDirty)
+    {
+        mPowerPropagationVisitSequenceNumber = newConnectivityVisitSequenceNumber;
+        mPowerPropagatingSources.clear();
+
+        std::queue<ElementIndex> electricalElementsToVisit;
+
+        for (auto const sourceElementIndex : mSources)
+        {
+            assert(GetMaterialType(sourceElementIndex) == ElectricalMaterial::ElectricalElementType::Generator); // At the moment our only sources are generators
+
+            if (!IsDeleted(sourceElementIndex)
+                && mElementStateBuffer[sourceElementIndex].Generator.IsProducingCurrent
                 && mGateStateBuffer[sourceElementIndex] // Though doesn't make too much sense to have gate-OFF sources
                 // Make sure we haven't visited it already
                 && newConnectivityVisitSequenceNumber != mCurrentConnectivityVisitSequenceNumberBuffer[sourceElementIndex])
@@ -1904,16 +1930,26 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                     }
                 }
 
-                //
-                // Generate heat
-                //
-
-                points.AddHeat(sourcePointIndex,
-                    mMaterialHeatGeneratedBuffer[sourceElementIndex]
-                    * simulationParameters.ElectricalElementHeatProducedAdjustment
-                    * SimulationParameters::SimulationStepTimeDuration<float>);
+                // Remember this source is propagating power
+                mPowerPropagatingSources.push_back(sourceElementIndex);
             }
         }
+
+        mIsPowerPropagationDirty = false;
+    }
+
+    //
+    // 3. Generate heat at propagating sources
+    //
+
+    for (auto const sourceElementIndex : mPowerPropagatingSources)
+    {
+        assert(!IsDeleted(sourceElementIndex));
+
+        points.AddHeat(GetPointIndex(sourceElementIndex),
+            mMaterialHeatGeneratedBuffer[sourceElementIndex]
+            * simulationParameters.ElectricalElementHeatProducedAdjustment
+            * SimulationParameters::SimulationStepTimeDuration<float>);
     }
 }
 
@@ -2496,6 +2532,7 @@ void ElectricalElements::UpdateSinks(
 
                         // Reset gate state
                         mGateStateBuffer[sinkElementIndex] = mMaterialBuffer[sinkElementIndex]->GateState;
+                        mIsPowerPropagationDirty = true;
                     }
                     else if (isConnectedToPower && !mElementStateBuffer[sinkElementIndex].TimerSwitch.IsOperating)
                     {
@@ -2615,7 +2652,7 @@ void ElectricalElements::UpdateSinks(
                 }
 
                 // Apply water pump force to point
-                points.GetLeakingComposite(pointIndex).LeakingSources.WaterPumpForce = waterPumpForce;
+                points.SetWaterPumpForce(pointIndex, waterPumpForce);
 
                 // Eventually publish force change notification
                 if (waterPumpState.CurrentNormalizedForce != waterPumpState.LastPublishedNormalizedForce)
@@ -558,6 +558,9 @@ public:
         , mCurrentLightSpreadAdjustment(simulationParameters.LightSpreadAdjustment)
         , mCurrentLuminiscenceAdjustment(simulationParameters.LuminiscenceAdjustment)
         , mHasConnectivityStructureChangedInCurrentStep(true)
+        , mIsPowerPropagationDirty(true)
+        , mPowerPropagationVisitSequenceNumber()
+        , mPowerPropagatingSources()
         , mPowerFailureReasonInCurrentStep()
     {
         mInstanceInfos.reserve(mElementCount);
@@ -725,6 +728,7 @@ public:
 
         // Remember that connectivity structure has changed during this step
         mHasConnectivityStructureChangedInCurrentStep = true;
+        mIsPowerPropagationDirty = true;
     }
 
     inline void RemoveConnectedElectricalElement(
@@ -746,6 +750,7 @@ public:
 
         // Remember that connectivity structure has changed during this step
         mHasConnectivityStructureChangedInCurrentStep = true;
+        mIsPowerPropagationDirty = true;
 
         if (hasBeenSevered)
         {
@@ -1042,6 +1047,14 @@ private:
     // to happen at these changes
     bool mHasConnectivityStructureChangedInCurrentStep;
 
+    // Cached result of the last power propagation: the propagation is only re-done when
+    // flagged as dirty, i.e. when anything has changed that affects it (connectivity,
+    // conductivity, gate states, sources' pre-conditions); otherwise, elements reached
+    // by the last propagation are those marked with its visit sequence number
+    bool mIsPowerPropagationDirty;
+    SequenceNumber mPowerPropagationVisitSequenceNumber;
+    std::vector<ElementIndex> mPowerPropagatingSources;
+
     // Flag indicating the cause of a power failure during the current
     // simulation step; cleared at the end of sinks' update.
     // Set only when there's been a failure; not set if power disappears
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #include "Physics.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace Physics {
@@ -35,7 +36,7 @@ OceanFloor::OceanFloor(OceanFloorHeightMap && heightMap)
     CalculateBedrockBumpProfile();
 
     // Calculate samples
-    CalculateResultantSampleValues();
+    CalculateResultantSampleValues(0, SamplesCount - 1);
 
     // Remember we're dirty
     mIsDirty = true;
@@ -48,7 +49,7 @@ void OceanFloor::SetHeightMap(OceanFloorHeightMap const & heightMap)
     mHeightMap = heightMap;
 
     // Recalculate samples
-    CalculateResultantSampleValues();
+    CalculateResultantSampleValues(0, SamplesCount - 1);
 
     // Remember we're dirty
     mIsDirty = true;
@@ -88,7 +89,7 @@ void OceanFloor::Update(SimulationParameters const & simulationParameters)
         mCurrentOceanFloorSiltPerturbationSinAmplitude = mCurrentOceanFloorSiltThickness * mCurrentOceanFloorSiltBumpiness;
 
         // Recalculate samples
-        CalculateResultantSampleValues();
+        CalculateResultantSampleValues(0, SamplesCount - 1);
 
         // Remember we are dirty
         mIsDirty = true;
@@ -190,14 +191,16 @@ std::optional<bool> OceanFloor::AdjustTo(
 
     bool hasAdjusted = false;
     float x = leftX;
-    for (auto s = static_cast<size_t>(sampleIndex); x <= rightX && s < SamplesCount; ++s, x += Dx)
+    size_t s = static_cast<size_t>(sampleIndex);
+    for (; x <= rightX && s < SamplesCount; ++s, x += Dx)
     {
         // Calculate new sample value, i.e. trajectory's value
         float const newSampleValue = leftTargetY + slopeY * (x - leftX);
 
         // Decide whether it's a significant change
-        // (consumed by tool)
-        hasAdjusted |= std::abs(newSampleValue - mSamples[s].BedrockSampleValue) > 0.2f;
+        // (consumed by tool); samples are not current with the
+        // terrain we've changed so far, hence we compare against the terrain
+        hasAdjusted |= std::abs(newSampleValue - CalculateResultantBedrockSampleValue(s)) > 0.2f;
 
         // Translate sample value into terrain change
         // (inverse of CalculateResultantSampleValue(.))
@@ -206,13 +209,19 @@ std::optional<bool> OceanFloor::AdjustTo(
             (newSampleValue - mBedrockBumpProfile[s] + mCurrentSeaDepth)
             / mCurrentOceanFloorBedrockDetailAmplification;
 
-        // Update terrain and samples
+        // Update terrain
         SetTerrainHeight(s, newTerrainProfileSampleValue);
     }
 
-    // Remember we're dirty now
-    mIsDirty = true;
-    mIsDirtyForRendering = true;
+    // Recalculate the samples of the whole trajectory at once
+    if (s > static_cast<size_t>(sampleIndex))
+    {
+        CalculateResultantSampleValues(static_cast<size_t>(sampleIndex), s - 1);
+
+        // Remember we're dirty
+        mIsDirty = true;
+        mIsDirtyForRendering = true;
+    }
 
     return hasAdjusted;
 }
@@ -252,54 +261,51 @@ void OceanFloor::DisplaceAt(
     {
         float rYOffset = yOffset * sampleIndexDx;
         SetTerrainHeight(sampleIndexI + 1, mHeightMap[sampleIndexI + 1] + rYOffset);
+
+        // Recalculate both samples at once
+        CalculateResultantSampleValues(sampleIndexI, sampleIndexI + 1);
+    }
+    else
+    {
+        CalculateResultantSampleValues(sampleIndexI, sampleIndexI);
     }
 
-    // Remember we're dirty now
+    // Remember we're dirty
     mIsDirty = true;
     mIsDirtyForRendering = true;
 }
 
-///////////////////////////////////////////////////////////////////////////////////
-
-void OceanFloor::SetTerrainHeight(
-    size_t sampleIndex,
-    float terrainHeight)
+float OceanFloor::GetMaxSiltHeightBetween(
+    float leftX,
+    float rightX) const noexcept
 {
-    assert(sampleIndex >= 0 && sampleIndex < SamplesCount);
+    assert(leftX >= -SimulationParameters::HalfMaxWorldWidth && rightX <= SimulationParameters::HalfMaxWorldWidth);
+    assert(leftX <= rightX);
 
-    // Update terrain
-    mHeightMap[sampleIndex] = terrainHeight;
-
-    // Adjust bedrock profile
+    auto const leftSampleIndex = FastTruncateToArchInt((leftX + SimulationParameters::HalfMaxWorldWidth) / Dx);
+    auto const rightSampleIndex = FastTruncateToArchInt((rightX + SimulationParameters::HalfMaxWorldWidth) / Dx) + 1; // Next sample participates in interpolation
+    assert(leftSampleIndex >= 0 && rightSampleIndex <= static_cast<register_int>(SamplesCount)); // We have an extra sample
 
-    // Recalculate sample value
-    float const newBedrockSampleValue = CalculateResultantBedrockSampleValue(sampleIndex);
-
-    // Update sample value
-    mSamples[sampleIndex].BedrockSampleValue = newBedrockSampleValue;
-
-    // Update previous sample's delta
-    if (sampleIndex > 0)
+    float maxSiltHeight = mSamples[leftSampleIndex].SiltSampleValue;
+    for (auto s = leftSampleIndex + 1; s <= rightSampleIndex; ++s)
     {
-        mSamples[sampleIndex - 1].BedrockSampleValuePlusOneMinusSampleValue = newBedrockSampleValue - mSamples[sampleIndex - 1].BedrockSampleValue;
+        maxSiltHeight = std::max(maxSiltHeight, mSamples[s].SiltSampleValue);
     }
 
-    if (sampleIndex < SamplesCount - 1)
-    {
-        // Update this sample's delta;
-        // no point in updating delta of extra sample, as it's always zero
-        mSamples[sampleIndex].BedrockSampleValuePlusOneMinusSampleValue = mSamples[sampleIndex + 1].BedrockSampleValue - newBedrockSampleValue;
-    }
+    return maxSiltHeight;
+}
 
-    // Make sure extra sample has same value as previous one
-    mSamples[SamplesCount].BedrockSampleValue = mSamples[SamplesCount - 1].BedrockSampleValue;
+///////////////////////////////////////////////////////////////////////////////////
 
-    // Now calculate Silt profile, on top of bedrock profile
+void OceanFloor::SetTerrainHeight(
+    size_t sampleIndex,
+    float terrainHeight)
+{
+    assert(sampleIndex >= 0 && sampleIndex < SamplesCount);
 
-    // Silt height at i depends on bedrock[i-1] and bedrock[i];
-    // since we've changed bedrock[sampleIndex - 1] and bedrock[sampleIndex], we've affected
-    // silt at sampleIndex - 1 (bc bedrock[sampleIndex- 1 ]), sampleIndex (bc both), and sampleIndex + 1 (bc bedrock[sampleIndex])
-    CalculateSiltSampleValues(sampleIndex > 0 ? sampleIndex - 1 : sampleIndex, sampleIndex < SamplesCount - 1 ? sampleIndex + 1 : sampleIndex);
+    // Update terrain; samples are recalculated by the caller, together
+    // with all other samples changed by the same edit
+    mHeightMap[sampleIndex] = terrainHeight;
 }
 
 void OceanFloor::CalculateBedrockBumpProfile()
@@ -318,40 +324,44 @@ void OceanFloor::CalculateBedrockBumpProfile()
     }
 }
 
-void OceanFloor::CalculateResultantSampleValues()
+void OceanFloor::CalculateResultantSampleValues(size_t startIndex, size_t endIndex)
 {
+    assert(startIndex <= endIndex && endIndex < SamplesCount);
+
     //
     // Populate bedrock profile
     //
+    // The terrain at [startIndex, endIndex] affects the bedrock samples in the same
+    // interval, and the deltas of those samples and of the sample preceding them
+    //
 
-    // sample index = 0
-    float previousBedrockSampleValue;
+    for (size_t i = startIndex; i <= endIndex; ++i)
     {
-        previousBedrockSampleValue = CalculateResultantBedrockSampleValue(0);
-
-        mSamples[0].BedrockSampleValue = previousBedrockSampleValue;
+        mSamples[i].BedrockSampleValue = CalculateResultantBedrockSampleValue(i);
     }
 
-    // sample index = 1...SamplesCount-1
-    for (size_t i = 1; i < SamplesCount; ++i)
+    // Deltas: sample index = (startIndex - 1)...(endIndex), excluding SamplesCount-1
+    for (size_t i = (startIndex > 0 ? startIndex - 1 : 0); i <= endIndex && i < SamplesCount - 1; ++i)
     {
-        float const bedrockSampleValue = CalculateResultantBedrockSampleValue(i);
-
-        mSamples[i].BedrockSampleValue = bedrockSampleValue;
-        mSamples[i - 1].BedrockSampleValuePlusOneMinusSampleValue = bedrockSampleValue - previousBedrockSampleValue;
-
-        previousBedrockSampleValue = bedrockSampleValue;
+        mSamples[i].BedrockSampleValuePlusOneMinusSampleValue = mSamples[i + 1].BedrockSampleValue - mSamples[i].BedrockSampleValue;
     }
 
     assert(mSamples[SamplesCount - 1].BedrockSampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
 
     // Make sure extra sample has same value as previous one
-    assert(previousBedrockSampleValue == mSamples[SamplesCount - 1].BedrockSampleValue);
-    mSamples[SamplesCount].BedrockSampleValue = previousBedrockSampleValue;
+    mSamples[SamplesCount].BedrockSampleValue = mSamples[SamplesCount - 1].BedrockSampleValue;
     assert(mSamples[SamplesCount].BedrockSampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
 
+    //
     // Now calculate Silt profile, on top of bedrock profile
-    CalculateSiltSampleValues(0, SamplesCount - 1);
+    //
+    // Silt height at i depends on bedrock[i - 1], bedrock[i], and bedrock[i + 1] (via the slopes
+    // of the two segments at i); hence we've affected silt from startIndex - 1 to endIndex + 1
+    //
+
+    CalculateSiltSampleValues(
+        startIndex > 0 ? startIndex - 1 : startIndex,
+        endIndex < SamplesCount - 1 ? endIndex + 1 : endIndex);
 
     // Verify invariants
     assert(mSamples[SamplesCount - 1].SiltSampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
@@ -120,6 +120,14 @@ public:
         return std::make_tuple(y < sampleValue, sampleValue, sampleIndexI);
     }
 
+    /*
+     * Returns the height of the highest silt sample among those spanning the specified range;
+     * no position in the range above this height may be underneath the ocean floor.
+     *
+     * Assumption: x's are within world boundaries, and leftX <= rightX.
+     */
+    float GetMaxSiltHeightBetween(float leftX, float rightX) const noexcept;
+
     /*
      * Assumption: x is within world boundaries.
      */
@@ -192,7 +200,7 @@ private:
 
     void CalculateBedrockBumpProfile();
 
-    void CalculateResultantSampleValues();
+    void CalculateResultantSampleValues(size_t startIndex, size_t endIndex); // end included
 
     inline float CalculateResultantBedrockSampleValue(size_t sampleIndex) const
     {
@@ -10,6 +10,7 @@
 #include <Core/GameWallClock.h>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 
@@ -37,7 +38,6 @@ OceanSurface::OceanSurface(
     , mBasalWaveNumber2(0.0f)
     , mBasalWaveAngularVelocity1(0.0f)
     , mBasalWaveAngularVelocity2(0.0f)
-    , mBasalWaveSin1()
     , mNextTsunamiTimestamp(GameWallClock::duration::max())
     , mNextRogueWaveTimestamp(GameWallClock::duration::max())
     ////////
@@ -50,6 +50,7 @@ OceanSurface::OceanSurface(
     , mRogueWaveRate(std::chrono::seconds::max())
     ////////
     , mSamples(SamplesCount + 1)
+    , mGenerateSamplesTasks()
     , mSWEHeightField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples)
     , mSWEVelocityField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples + 1)
     , mInteractiveWaveTargetHeight(SamplesCount)
@@ -81,7 +82,8 @@ OceanSurface::OceanSurface(
 void OceanSurface::Update(
     float currentSimulationTime,
     Wind const & wind,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadPool * simulationThreadPool)
 {
     auto const now = GameWallClock::GetInstance().Now();
 
@@ -251,7 +253,8 @@ void OceanSurface::Update(
     GenerateSamples(
         currentSimulationTime,
         wind,
-        simulationParameters);
+        simulationParameters,
+        simulationThreadPool);
 
     //
     // 6. Reset Interactive Waves
@@ -633,19 +636,6 @@ void OceanSurface::RecalculateWaveCoefficients(
     mBasalWaveAngularVelocity1 = 2.0f * Pi<float> / basalWavePeriod;
     mBasalWaveAngularVelocity2 = 0.75f * mBasalWaveAngularVelocity1;
 
-    //
-    // Pre-calculate basal wave sinusoid
-    //
-    // By pre-multiplying with the first basal wave's amplitude we may save
-    // one multiplication later
-    //
-
-    mBasalWaveSin1.Recalculate(
-        [a = mBasalWaveAmplitude1](float x)
-        {
-            return a * sin(2.0f * Pi<float> * x);
-        });
-
     //
     // Store new parameter values that we are now current with
     //
@@ -958,7 +948,8 @@ void OceanSurface::AdvectFields()
 void OceanSurface::GenerateSamples(
     float currentSimulationTime,
     Wind const & wind,
-    SimulationParameters const & /*simulationParameters*/)
+    SimulationParameters const & /*simulationParameters*/,
+    ThreadPool * simulationThreadPool)
 {
     //
     // Sample values are a combination of:
@@ -995,11 +986,12 @@ void OceanSurface::GenerateSamples(
     //
     // Generate samples
     //
-    // We feed the sin-calculating function with values normalized in the [0..1) interval,
+    // The phase of each wave is normalized in the [0..1) interval,
     // so we keep precision in-check.
     //
 
-    float const x = -SimulationParameters::HalfMaxWorldWidth;
+    double const x = -SimulationParameters::HalfMaxWorldWidth;
+    double const t = currentSimulationTime;
 
     float const basalWave2AmplitudeCoeff =
         (mBasalWaveAmplitude1 != 0.0f)
@@ -1011,154 +1003,80 @@ void OceanSurface::GenerateSamples(
         ? windRipplesWaveHeight / mBasalWaveAmplitude1
         : 0.0f;
 
-    // Avoid negative args for the precalc'd sin, to achieve speedup
-
-    float sinArg1 = (mBasalWaveNumber1 * x - mBasalWaveAngularVelocity1 * currentSimulationTime) / (2 * Pi<float>);
-    if (sinArg1 < 0.0f)
-    {
-        float iptr;
-        sinArg1 = 1.0f - std::modf(-sinArg1, &iptr); // -7.8 => 0.2
-    }
-    else
-    {
-        // Just avoid large floats
-        float iptr;
-        sinArg1 = std::modf(sinArg1, &iptr);
-    }
-
-    float sinArg2 = (mBasalWaveNumber2 * x - mBasalWaveAngularVelocity2 * currentSimulationTime + secondaryBasalComponentPhase) / (2 * Pi<float>);
-    if (sinArg2 < 0.0f)
-    {
-        float iptr;
-        sinArg2 = 1.0f - std::modf(-sinArg2, &iptr); // -7.8 => 0.2
-    }
-    else
-    {
-        // Just avoid large floats
-        float iptr;
-        sinArg2 = std::modf(sinArg2, &iptr);
-    }
-
-    float sinArgRipple = (WindRippleWaveNumber * x - windRipplesAngularVelocity * currentSimulationTime) / (2 * Pi<float>);
-    if (sinArgRipple < 0.0f)
-    {
-        float iptr;
-        sinArgRipple = 1.0f - std::modf(-sinArgRipple, &iptr); // -7.8 => 0.2
-    }
-    else
-    {
-        // Just avoid large floats
-        float iptr;
-        sinArgRipple = std::modf(sinArgRipple, &iptr);
-    }
-
-    // sample index = 0
-    float previousSampleValue;
+    std::array<Algorithms::OceanSurfaceWave, 3> const waves{
+        // Basal wave 1
+        Algorithms::OceanSurfaceWave{
+            (mBasalWaveNumber1 * x - mBasalWaveAngularVelocity1 * t) / (2.0 * Pi<double>),
+            mBasalWaveNumber1 * Dx / (2.0 * Pi<double>),
+            mBasalWaveAmplitude1 },
+        // Basal wave 2
+        Algorithms::OceanSurfaceWave{
+            (mBasalWaveNumber2 * x - mBasalWaveAngularVelocity2 * t + secondaryBasalComponentPhase) / (2.0 * Pi<double>),
+            mBasalWaveNumber2 * Dx / (2.0 * Pi<double>),
+            basalWave2AmplitudeCoeff * mBasalWaveAmplitude1 },
+        // Wind gust ripples
+        Algorithms::OceanSurfaceWave{
+            (WindRippleWaveNumber * x - windRipplesAngularVelocity * t) / (2.0 * Pi<double>),
+            WindRippleWaveNumber * Dx / (2.0 * Pi<double>),
+            rippleWaveAmplitudeCoeff * mBasalWaveAmplitude1 }
+    };
+
+    // Generates samples in [startSample, endSample); also reads the SWE height
+    // field at endSample, which falls at most in the SWE boundary
+    auto const generateSamples = [&](size_t startSample, size_t endSample)
     {
-        float const sweValue =
-            (mSWEHeightField[SWEBufferPrefixSize + 0] - SWEHeightFieldOffset)
-            * SWEHeightFieldAmplification;
-
-        if (sinArg1 >= 1.0f)
-            sinArg1 -= 1.0f;
-        float const basalValue1 =
-            mBasalWaveSin1.GetLinearlyInterpolatedPeriodicFromNormalized(sinArg1);
-
-        if (sinArg2 >= 1.0f)
-            sinArg2 -= 1.0f;
-        float const basalValue2 =
-            basalWave2AmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodicFromNormalized(sinArg2);
-
-        if (sinArgRipple >= 1.0f)
-            sinArgRipple -= 1.0f;
-        float const rippleValue =
-            rippleWaveAmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodicFromNormalized(sinArgRipple);
-
-        previousSampleValue =
-            sweValue
-            + basalValue1
-            + basalValue2
-            + rippleValue;
-
-        mSamples[0].SampleValue = previousSampleValue;
-    }
-
-    float sinArg1Dx = mBasalWaveNumber1 * Dx / (2 * Pi<float>);
-    if (sinArg1Dx < 0.0f)
+        Algorithms::GenerateOceanSurfaceSamples(
+            &(mSWEHeightField[SWEBufferPrefixSize]),
+            SWEHeightFieldOffset,
+            SWEHeightFieldAmplification,
+            waves,
+            startSample,
+            endSample,
+            reinterpret_cast<float *>(mSamples.data()));
+    };
+
+    static_assert(sizeof(Sample) == 2 * sizeof(float));
+    static_assert(is_aligned_to_float_element_count(SamplesCount));
+
+    // Each chunk is aligned to the algorithm's phase blocks,
+    // hence results do not depend on the number of chunks
+    size_t constexpr MinSamplesPerChunk = 4096;
+    static_assert(is_aligned_to_float_element_count(Algorithms::OceanSurfaceSamplesPhaseBlockSize));
+
+    size_t const chunkCount = (simulationThreadPool != nullptr)
+        ? std::max(std::min(simulationThreadPool->GetParallelism(), SamplesCount / MinSamplesPerChunk), size_t(1))
+        : size_t(1);
+
+    if (chunkCount == 1)
     {
-        float iptr;
-        sinArg1Dx = 1.0f - std::modf(-sinArg1Dx, &iptr); // -7.8 => 0.2
+        generateSamples(0, SamplesCount);
     }
     else
     {
-        // Just avoid large floats
-        float iptr;
-        sinArg1Dx = std::modf(sinArg1Dx, &iptr);
-    }
+        size_t const samplesPerChunk =
+            (SamplesCount / chunkCount + Algorithms::OceanSurfaceSamplesPhaseBlockSize - 1)
+            / Algorithms::OceanSurfaceSamplesPhaseBlockSize
+            * Algorithms::OceanSurfaceSamplesPhaseBlockSize;
 
-    float sinArg2Dx = mBasalWaveNumber2 * Dx / (2 * Pi<float>);
-    if (sinArg2Dx < 0.0f)
-    {
-        float iptr;
-        sinArg2Dx = 1.0f - std::modf(-sinArg2Dx, &iptr); // -7.8 => 0.2
-    }
-    else
-    {
-        // Just avoid large floats
-        float iptr;
-        sinArg2Dx = std::modf(sinArg2Dx, &iptr);
-    }
-
-    float const sinArgRippleDx = WindRippleWaveNumber * Dx / (2 * Pi<float>);
-    assert(sinArgRippleDx >= 0.0f);
+        assert(mGenerateSamplesTasks.empty());
+        for (size_t startSample = 0; startSample < SamplesCount; startSample += samplesPerChunk)
+        {
+            size_t const endSample = std::min(startSample + samplesPerChunk, SamplesCount);
+            mGenerateSamplesTasks.emplace_back(
+                [&generateSamples, startSample, endSample]()
+                {
+                    generateSamples(startSample, endSample);
+                });
+        }
 
-    // sample index = 1...SamplesCount - 1
-    Sample * const restrict samplesPtr = &(mSamples[0]); // Tiny speedup
-    for (size_t i = 1; i < SamplesCount; ++i)
-    {
-        float const sweValue =
-            (mSWEHeightField[SWEBufferPrefixSize + i] - SWEHeightFieldOffset)
-            * SWEHeightFieldAmplification;
-
-        sinArg1 += sinArg1Dx;
-        if (sinArg1 >= 1.0f)
-            sinArg1 -= 1.0f;
-        float const basalValue1 =
-            mBasalWaveSin1.GetLinearlyInterpolatedPeriodicFromNormalized(sinArg1);
-
-        sinArg2 += sinArg2Dx;
-        if (sinArg2 >= 1.0f)
-            sinArg2 -= 1.0f;
-        float const basalValue2 =
-            basalWave2AmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodicFromNormalized(sinArg2);
-
-        sinArgRipple += sinArgRippleDx;
-        if (sinArgRipple >= 1.0f)
-            sinArgRipple -= 1.0f;
-        float const rippleValue =
-            rippleWaveAmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodicFromNormalized(sinArgRipple);
-
-        float const sampleValue =
-            sweValue
-            + basalValue1
-            + basalValue2
-            + rippleValue;
-
-        samplesPtr[i].SampleValue = sampleValue;
-        samplesPtr[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
-
-        previousSampleValue = sampleValue;
+        simulationThreadPool->RunAndClear(mGenerateSamplesTasks);
     }
 
-    assert(mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
+    // The last sample has no next sample to diff with
+    mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f;
 
     // Populate extra sample - same value as last sample
-    assert(previousSampleValue == mSamples[SamplesCount - 1].SampleValue);
-    mSamples[SamplesCount].SampleValue = previousSampleValue;
+    mSamples[SamplesCount].SampleValue = mSamples[SamplesCount - 1].SampleValue;
 
     assert(mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
 }
@@ -10,13 +10,16 @@
 
 #include <Core/Buffer.h>
 #include <Core/GameMath.h>
-#include <Core/PrecalculatedFunction.h>
 #include <Core/RunningAverage.h>
 #include <Core/StrongTypeDef.h>
 #include <Core/SysSpecifics.h>
+#include <Core/ThreadPool.h>
 
+#include <cassert>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace Physics
 {
@@ -29,10 +32,14 @@ public:
         World & parentWorld,
         SimulationEventDispatcher & simulationEventDispatcher);
 
+    /*
+     * The thread pool is optional; when specified, samples are generated in parallel.
+     */
     void Update(
         float currentSimulationTime,
         Wind const & wind,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadPool * simulationThreadPool);
 
     void Upload(RenderContext & renderContext) const;
 
@@ -91,6 +98,70 @@ public:
         return GetHeightAt(position.x) - position.y;
     }
 
+    /*
+     * Calculates the depths of a batch of positions; equivalent to invoking
+     * GetDepth() for each position, but gathers ocean heights four at a time.
+     *
+     * Assumption: all x's are in world boundaries.
+     */
+    inline void GetDepths(
+        vec2f const * restrict positions,
+        float * restrict outDepths,
+        size_t count) const noexcept
+    {
+        size_t i = 0;
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+        __m128 const halfMaxWorldWidth_4 = _mm_set1_ps(SimulationParameters::HalfMaxWorldWidth);
+        __m128 const dx_4 = _mm_set1_ps(Dx);
+
+        Sample const * const restrict samples = mSamples.data();
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 const pos01_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i)); // x0,y0,x1,y1
+            __m128 const pos23_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i + 2)); // x2,y2,x3,y3
+            __m128 const x_4 = _mm_shuffle_ps(pos01_4, pos23_4, _MM_SHUFFLE(2, 0, 2, 0)); // x0,x1,x2,x3
+            __m128 const y_4 = _mm_shuffle_ps(pos01_4, pos23_4, _MM_SHUFFLE(3, 1, 3, 1)); // y0,y1,y2,y3
+
+            // Fractional index in the sample array, and its integral and fractional parts
+            __m128 const sampleIndexF_4 = _mm_div_ps(_mm_add_ps(x_4, halfMaxWorldWidth_4), dx_4);
+            __m128i const sampleIndexI_4 = _mm_cvttps_epi32(sampleIndexF_4);
+            __m128 const sampleIndexDx_4 = _mm_sub_ps(sampleIndexF_4, _mm_cvtepi32_ps(sampleIndexI_4));
+
+            // Gather (value, delta) pairs
+            alignas(16) std::int32_t sampleIndices[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(sampleIndices), sampleIndexI_4);
+
+            assert(sampleIndices[0] >= 0 && static_cast<size_t>(sampleIndices[0]) < SamplesCount);
+            assert(sampleIndices[1] >= 0 && static_cast<size_t>(sampleIndices[1]) < SamplesCount);
+            assert(sampleIndices[2] >= 0 && static_cast<size_t>(sampleIndices[2]) < SamplesCount);
+            assert(sampleIndices[3] >= 0 && static_cast<size_t>(sampleIndices[3]) < SamplesCount);
+
+            __m128 sample01_4 = _mm_setzero_ps();
+            sample01_4 = _mm_loadl_pi(sample01_4, reinterpret_cast<__m64 const *>(samples + sampleIndices[0])); // v0,d0,_,_
+            sample01_4 = _mm_loadh_pi(sample01_4, reinterpret_cast<__m64 const *>(samples + sampleIndices[1])); // v0,d0,v1,d1
+            __m128 sample23_4 = _mm_setzero_ps();
+            sample23_4 = _mm_loadl_pi(sample23_4, reinterpret_cast<__m64 const *>(samples + sampleIndices[2])); // v2,d2,_,_
+            sample23_4 = _mm_loadh_pi(sample23_4, reinterpret_cast<__m64 const *>(samples + sampleIndices[3])); // v2,d2,v3,d3
+
+            __m128 const sampleValue_4 = _mm_shuffle_ps(sample01_4, sample23_4, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 const sampleDelta_4 = _mm_shuffle_ps(sample01_4, sample23_4, _MM_SHUFFLE(3, 1, 3, 1));
+
+            // Same operations, in the same order, as GetHeightAt() - y
+            __m128 const height_4 = _mm_add_ps(sampleValue_4, _mm_mul_ps(sampleDelta_4, sampleIndexDx_4));
+            _mm_storeu_ps(outDepths + i, _mm_sub_ps(height_4, y_4));
+        }
+
+#endif
+
+        for (; i < count; ++i)
+        {
+            outDepths[i] = GetDepth(positions[i]);
+        }
+    }
+
     /*
      * Assumption: x is in world boundaries.
      */
@@ -235,7 +306,8 @@ private:
     void GenerateSamples(
         float currentSimulationTime,
         Wind const & wind,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadPool * simulationThreadPool);
 
 private:
 
@@ -256,7 +328,6 @@ private:
     float mBasalWaveNumber2;
     float mBasalWaveAngularVelocity1;
     float mBasalWaveAngularVelocity2;
-    PrecalculatedFunction<8192> mBasalWaveSin1;
     GameWallClock::time_point mNextTsunamiTimestamp;
     GameWallClock::time_point mNextRogueWaveTimestamp;
 
@@ -310,6 +381,9 @@ private:
     // The samples
     Buffer<Sample> mSamples;
 
+    // The tasks for generating samples in parallel
+    std::vector<ThreadPool::Task> mGenerateSamplesTasks;
+
     //
     // SWE Buffers
     //
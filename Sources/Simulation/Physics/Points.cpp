@@ -76,6 +76,10 @@ void Points::Add(
     mWaterVelocityBuffer.emplace_back(vec2f::zero());
     mWaterMomentumBuffer.emplace_back(vec2f::zero());
     mCumulatedIntakenWater.emplace_back(0.0f);
+    mIsInWetPointsBuffer.emplace_back(false);
+    if (water != 0.0f)
+        AddWetPoint(pointIndex);
+    mIsInLeakingPointsBuffer.emplace_back(false);
     mLeakingCompositeBuffer.emplace_back(LeakingComposite(isStructurallyLeaking));
     if (isStructurallyLeaking)
         SetStructurallyLeaking(pointIndex);
@@ -90,9 +94,12 @@ void Points::Add(
     mMaterialIgnitionTemperatureBuffer.emplace_back(structuralMaterial.IgnitionTemperature);
     mMaterialCombustionTypeBuffer.emplace_back(structuralMaterial.CombustionType);
     mCombustionStateBuffer.emplace_back(CombustionState());
+    mIsHotCandidateBuffer.emplace_back(false);
 
     // Water raction dynamics
     mWaterReactionStateBuffer.emplace_back(structuralMaterial.WaterReactivity);
+    if (mWaterReactionStateBuffer[pointIndex].State != WaterReactionState::StateType::Inert)
+        mWaterReactivePoints.push_back(pointIndex);
 
     // Electrical dynamics
     mElectricalElementBuffer.emplace_back(electricalElementIndex);
@@ -205,7 +212,7 @@ void Points::CreateEphemeralParticleAirBubble(
 
     mMaterialWindReceptivityBuffer[pointIndex] = 0.0f; // Air bubbles (underwater) do not care about wind
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::AirBubble;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::AirBubble);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = std::numeric_limits<float>::max();
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::AirBubbleState(
@@ -292,7 +299,7 @@ void Points::CreateEphemeralParticleAsh(
 
     mMaterialWindReceptivityBuffer[pointIndex] = ashStructuralMaterial.WindReceptivity;
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::Ash;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::Ash);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::AshState();
@@ -371,7 +378,7 @@ void Points::CreateEphemeralParticleDebris(
 
     mMaterialWindReceptivityBuffer[pointIndex] = structuralMaterial.WindReceptivity;
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::Debris;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::Debris);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::DebrisState();
@@ -457,7 +464,7 @@ void Points::CreateEphemeralParticleSiltCloud(
 
     mMaterialWindReceptivityBuffer[pointIndex] = 0.2f; // Silt clouds care about wind
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::SiltCloud;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::SiltCloud);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::SiltCloudState(
@@ -469,7 +476,7 @@ void Points::CreateEphemeralParticleSiltCloud(
     mPlaneIdBuffer[pointIndex] = planeId;
     mPlaneIdFloatBuffer[pointIndex] = static_cast<float>(planeId);
 
-    mRandomNormalizedUniformFloatBuffer[pointIndex] = GameRandomEngine::GetInstance().GenerateNormalizedUniformReal();
+    mRandomNormalizedUniformFloatBuffer[pointIndex] = mRandomStream.GenerateNormalizedUniformReal();
 
     //mColorBuffer[pointIndex] = siltCloudStructuralMaterial.RenderColor.toVec4f();
 }
@@ -484,6 +491,9 @@ void Points::InternalCreateEphemeralParticleSmoke(
     PlaneId planeId,
     SimulationParameters const & simulationParameters)
 {
+    if (IsCosmeticEphemeralParticleSpawnCulled(position))
+        return; // Not worth it
+
     // Get a free slot (or steal one)
     auto const ephemeralParticleIndex = FindFreeEphemeralParticle(1, true);
     assert(ephemeralParticleIndex != NoneElementIndex);
@@ -577,7 +587,7 @@ void Points::InternalCreateEphemeralParticleSmoke(
 
     mMaterialWindReceptivityBuffer[pointIndex] = 0.2f; // Smoke cares about wind
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::Smoke;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::Smoke);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::SmokeState(
@@ -590,7 +600,7 @@ void Points::InternalCreateEphemeralParticleSmoke(
     mPlaneIdBuffer[pointIndex] = planeId;
     mPlaneIdFloatBuffer[pointIndex] = static_cast<float>(planeId);
 
-    mRandomNormalizedUniformFloatBuffer[pointIndex] = GameRandomEngine::GetInstance().GenerateNormalizedUniformReal();
+    mRandomNormalizedUniformFloatBuffer[pointIndex] = mRandomStream.GenerateNormalizedUniformReal();
 
     //mColorBuffer[pointIndex] = smokeStructuralMaterial.RenderColor.toVec4f();
 }
@@ -604,6 +614,9 @@ void Points::CreateEphemeralParticleSparkle(
     float maxSimulationLifetime,
     PlaneId planeId)
 {
+    if (IsCosmeticEphemeralParticleSpawnCulled(position))
+        return; // Not worth it
+
     // Get a free slot (or steal one)
     auto const ephemeralParticleIndex = FindFreeEphemeralParticle(0, true);
     assert(ephemeralParticleIndex != NoneElementIndex);
@@ -661,7 +674,7 @@ void Points::CreateEphemeralParticleSparkle(
 
     mMaterialWindReceptivityBuffer[pointIndex] = 20.0f; // Sparkles are susceptible to wind
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::Sparkle;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::Sparkle);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::SparkleState();
@@ -680,6 +693,9 @@ void Points::CreateEphemeralParticleWakeBubble(
     PlaneId planeId,
     SimulationParameters const & simulationParameters)
 {
+    if (IsCosmeticEphemeralParticleSpawnCulled(position))
+        return; // Not worth it
+
     // Get a free slot (but don't steal one)
     auto const ephemeralParticleIndex = FindFreeEphemeralParticle(0, false);
     if (ephemeralParticleIndex == NoneElementIndex)
@@ -742,7 +758,7 @@ void Points::CreateEphemeralParticleWakeBubble(
 
     mMaterialWindReceptivityBuffer[pointIndex] = 0.0f; // Wake bubbles (underwater) do not care about wind
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::WakeBubble;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::WakeBubble);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = 0.4f; // Magic number
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::WakeBubbleState();
@@ -768,6 +784,9 @@ ElementIndex Points::CreateEphemeralParticleWaterFoam(
     PlaneId planeId,
     SimulationParameters const & simulationParameters)
 {
+    if (IsCosmeticEphemeralParticleSpawnCulled(position))
+        return NoneElementIndex; // Not worth it
+
     // Get a free slot (but don't steal one)
     auto const ephemeralParticleIndex = FindFreeEphemeralParticle(0, false);
     if (ephemeralParticleIndex == NoneElementIndex)
@@ -833,7 +852,7 @@ ElementIndex Points::CreateEphemeralParticleWaterFoam(
 
     mMaterialWindReceptivityBuffer[pointIndex] = waterFoamStructuralMaterial.WindReceptivity;
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::WaterFoam;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::WaterFoam);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     assert(visibilityHaste > 0.0f);
@@ -848,7 +867,7 @@ ElementIndex Points::CreateEphemeralParticleWaterFoam(
     mPlaneIdBuffer[pointIndex] = planeId;
     mPlaneIdFloatBuffer[pointIndex] = static_cast<float>(planeId);
 
-    mRandomNormalizedUniformFloatBuffer[pointIndex] = GameRandomEngine::GetInstance().GenerateNormalizedUniformReal();
+    mRandomNormalizedUniformFloatBuffer[pointIndex] = mRandomStream.GenerateNormalizedUniformReal();
 
     //mColorBuffer[pointIndex] = waterFoamStructuralMaterial.RenderColor.toVec4f();
 
@@ -867,6 +886,9 @@ ElementIndex Points::CreateEphemeralParticleWaterSplash(
     PlaneId planeId,
     SimulationParameters const & simulationParameters)
 {
+    if (IsCosmeticEphemeralParticleSpawnCulled(position))
+        return NoneElementIndex; // Not worth it
+
     // Get a free slot (or steal one)
     auto const ephemeralParticleIndex = FindFreeEphemeralParticle(1, true);
     assert(ephemeralParticleIndex != NoneElementIndex);
@@ -931,7 +953,7 @@ ElementIndex Points::CreateEphemeralParticleWaterSplash(
 
     mMaterialWindReceptivityBuffer[pointIndex] = waterSplashStructuralMaterial.WindReceptivity;
 
-    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::WaterSplash;
+    ActivateEphemeralParticle(ephemeralParticleIndex, EphemeralType::WaterSplash);
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State = EphemeralState::WaterSplashState(
@@ -944,7 +966,7 @@ ElementIndex Points::CreateEphemeralParticleWaterSplash(
     mPlaneIdBuffer[pointIndex] = planeId;
     mPlaneIdFloatBuffer[pointIndex] = static_cast<float>(planeId);
 
-    mRandomNormalizedUniformFloatBuffer[pointIndex] = GameRandomEngine::GetInstance().GenerateNormalizedUniformReal();
+    mRandomNormalizedUniformFloatBuffer[pointIndex] = mRandomStream.GenerateNormalizedUniformReal();
 
     //mColorBuffer[pointIndex] = waterSplashStructuralMaterial.RenderColor.toVec4f();
 
@@ -1151,6 +1173,51 @@ void Points::UpdateForSimulationParameters(SimulationParameters const & simulati
     }
 }
 
+void Points::PrepareWetPoints()
+{
+    mWetPoints.erase(
+        std::remove_if(
+            mWetPoints.begin(),
+            mWetPoints.end(),
+            [this](ElementIndex pointIndex)
+            {
+                if (mWaterBuffer[pointIndex] != 0.0f)
+                {
+                    return false;
+                }
+
+                // Dried up: no mass, no velocity
+                mWaterVelocityBuffer[pointIndex] = vec2f::zero();
+                mWaterMomentumBuffer[pointIndex] = vec2f::zero();
+
+                mIsInWetPointsBuffer[pointIndex] = false;
+                return true;
+            }),
+        mWetPoints.end());
+
+    // Visit points in index order, as we would when visiting all points
+    std::sort(mWetPoints.begin(), mWetPoints.end());
+}
+
+void Points::PruneLeakingPoints()
+{
+    mLeakingPoints.erase(
+        std::remove_if(
+            mLeakingPoints.begin(),
+            mLeakingPoints.end(),
+            [this](ElementIndex pointIndex)
+            {
+                if (mLeakingCompositeBuffer[pointIndex].IsCumulativelyLeaking)
+                {
+                    return false;
+                }
+
+                mIsInLeakingPointsBuffer[pointIndex] = false;
+                return true;
+            }),
+        mLeakingPoints.end());
+}
+
 void Points::UpdateCombustionLowFrequency(
     ElementIndex pointOffset,
     ElementIndex pointStride,
@@ -1178,13 +1245,74 @@ void Points::UpdateCombustionLowFrequency(
     float const rainExtinguishCdf = FastPow(stormParameters.RainDensity / 2.0f, 3.3f);
 
     //
-    // Visit all points
+    // Collect the points of this slice that may transition: hot candidates,
+    // burning points, and water-reactive points; all other points are
+    // guaranteed to be no-ops below.
+    //
+    // We visit them in index order, as we would when visiting all points.
     //
     // No real reason not to do ephemeral points as well, other than they're
     // currently not expected to burn
     //
 
-    for (ElementIndex pointIndex = pointOffset; pointIndex < mRawShipPointCount; pointIndex += pointStride)
+    mCombustionLowFrequencyPoints.clear();
+
+    // Hot candidates - pruning the ones of this slice that may not ignite anymore
+    mHotCandidatePoints.erase(
+        std::remove_if(
+            mHotCandidatePoints.begin(),
+            mHotCandidatePoints.end(),
+            [&](ElementIndex pointIndex)
+            {
+                if (pointIndex % pointStride != pointOffset)
+                {
+                    // Not ours
+                    return false;
+                }
+
+                if (mCombustionStateBuffer[pointIndex].State == CombustionState::StateType::NotBurning
+                    && GetTemperature(pointIndex) >= mMaterialIgnitionTemperatureBuffer[pointIndex] * simulationParameters.IgnitionTemperatureAdjustment + SimulationParameters::IgnitionTemperatureHighWatermark)
+                {
+                    mCombustionLowFrequencyPoints.push_back(pointIndex);
+                    return false;
+                }
+
+                // Cooled down or not in NotBurning anymore; if it ever goes back to
+                // NotBurning while hot, PropagateHeat will flag it again
+                mIsHotCandidateBuffer[pointIndex] = false;
+                return true;
+            }),
+        mHotCandidatePoints.end());
+
+    for (auto const pointIndex : mBurningPoints)
+    {
+        if (pointIndex % pointStride == pointOffset
+            && mCombustionStateBuffer[pointIndex].State == CombustionState::StateType::Burning)
+        {
+            mCombustionLowFrequencyPoints.push_back(pointIndex);
+        }
+    }
+
+    for (auto const pointIndex : mWaterReactivePoints)
+    {
+        if (pointIndex % pointStride == pointOffset
+            && (mWaterReactionStateBuffer[pointIndex].State == WaterReactionState::StateType::Unreacted
+                || mWaterReactionStateBuffer[pointIndex].State == WaterReactionState::StateType::ReactionTriggered))
+        {
+            mCombustionLowFrequencyPoints.push_back(pointIndex);
+        }
+    }
+
+    std::sort(mCombustionLowFrequencyPoints.begin(), mCombustionLowFrequencyPoints.end());
+    mCombustionLowFrequencyPoints.erase(
+        std::unique(mCombustionLowFrequencyPoints.begin(), mCombustionLowFrequencyPoints.end()),
+        mCombustionLowFrequencyPoints.end());
+
+    //
+    // Visit points
+    //
+
+    for (auto const pointIndex : mCombustionLowFrequencyPoints)
     {
         //
         // Combustion
@@ -1252,7 +1380,7 @@ void Points::UpdateCombustionLowFrequency(
                 // Notify combustion end
                 mSimulationEventHandler.OnPointCombustionEnd();
             }
-            else if (GameRandomEngine::GetInstance().GenerateUniformBoolean(rainExtinguishCdf))
+            else if (mRandomStream.GenerateUniformBoolean(rainExtinguishCdf))
             {
                 //
                 // Transition to Extinguishing - by smothering for rain
@@ -1340,7 +1468,7 @@ void Points::UpdateCombustionLowFrequency(
         // honoring MaxBurningParticles at the same time
         size_t const maxIgnitionPoints = std::min(
             std::min(
-                size_t(4) + GameRandomEngine::GetInstance().Choose(size_t(6)), // 4->9
+                size_t(4) + mRandomStream.Choose(size_t(6)), // 4->9
                 mBurningPoints.size() < simulationParameters.MaxBurningParticlesPerShip
                 ? static_cast<size_t>(simulationParameters.MaxBurningParticlesPerShip) - mBurningPoints.size()
                 : size_t(0)),
@@ -1659,7 +1787,7 @@ void Points::UpdateCombustionHighFrequency(
 
                     pointCombustionState.NextSmokeEmissionSimulationTimestamp =
                         currentSimulationTime
-                        + GameRandomEngine::GetInstance().GenerateExponentialReal(
+                        + mRandomStream.GenerateExponentialReal(
                             baseline
                             * pointCombustionState.FlameDevelopment // Wait longer is flame is starting
                             * simulationParameters.CombustionSmokeEmissionDensityAdjustment);
@@ -1674,7 +1802,7 @@ void Points::UpdateCombustionHighFrequency(
 
                     // Calculate lifetime
                     float const maxSimulationLifetime =
-                        GameRandomEngine::GetInstance().GenerateUniformReal(
+                        mRandomStream.GenerateUniformReal(
                             SimulationParameters::MinCombustionSmokeParticleLifetime,
                             SimulationParameters::MaxCombustionSmokeParticleLifetime)
                         * simulationParameters.CombustionSmokeParticleLifetimeAdjustment;
@@ -1866,370 +1994,633 @@ void Points::ReorderBurningPointsForDepth()
 
 void Points::UpdateEphemeralParticles(
     float currentSimulationTime,
-    SimulationParameters const & simulationParameters)
+    VisibleWorld const & visibleWorld,
+    ThreadPool & simulationThreadPool,
+    SimulationParameters const & simulationParameters,
+    PerfStats & perfStats)
 {
+    UpdateEphemeralParticleLod(visibleWorld);
+
+    //
+    // Particles are visited by type, via the type lists; each task visits one slice
+    // of each type list, and defers expirations and any other mutation of shared
+    // state to its own task state, which we commit serially at the end
+    //
+
+    size_t totalActiveParticles = 0;
+    for (auto const & typeList : mActiveEphemeralParticlesByType)
+    {
+        totalActiveParticles += typeList.size();
+    }
+
+    if (totalActiveParticles == 0)
+    {
+        perfStats.AddToCounter<PerfCounter::CulledEphemeralParticles>(mCulledEphemeralParticleCount);
+        mCulledEphemeralParticleCount = 0;
+
+        return;
+    }
+
     // Transformation from desired velocity impulse to force
     float const randomWalkVelocityImpulseToForceCoefficient =
         SimulationParameters::AirMass
         / simulationParameters.SimulationStepTimeDuration<float>;
 
     // Ocean surface displacement at bubbles surfacing
-    float const oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset =
+    float const oceanSurfaceDisplacementAtAirBubbleSurfacingSurfaceOffset =
         (simulationParameters.DoDisplaceWater ? 1.0f : 0.0f)
         * 1.0f;
 
-    // Visit all ephemeral particles
-    for (ElementIndex ephemeralParticleIndex : this->EphemeralPoints())
+    //
+    // Decide parallelism - we don't want to pay for synchronization with just a few particles
+    //
+
+    size_t constexpr MinParticlesPerTask = 512;
+
+    size_t const parallelism = std::max(
+        std::min(
+            simulationThreadPool.GetParallelism(),
+            totalActiveParticles / MinParticlesPerTask),
+        size_t(1));
+
+    if (mEphemeralParticleUpdateTaskStates.size() < parallelism)
     {
-        auto const ephemeralType = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type;
-        if (EphemeralType::None != ephemeralType)
+        mEphemeralParticleUpdateTaskStates.resize(parallelism);
+    }
+
+    for (size_t t = 0; t < parallelism; ++t)
+    {
+        auto & taskState = mEphemeralParticleUpdateTaskStates[t];
+
+        taskState.Random = mRandomStream.Fork();
+        taskState.ExpiredEphemeralParticles.clear();
+        taskState.OceanSurfaceDisplacements.clear();
+        taskState.CulledCount = 0;
+    }
+
+    //
+    // Run tasks
+    //
+
+    auto const runTask = [&, parallelism](size_t t)
+    {
+        auto & taskState = mEphemeralParticleUpdateTaskStates[t];
+
+        auto const sliceOf = [t, parallelism](size_t count) -> std::tuple<size_t, size_t>
+        {
+            return { count * t / parallelism, count * (t + 1) / parallelism };
+        };
+
+        auto [airBubbleStart, airBubbleEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::AirBubble)].size());
+        UpdateEphemeralParticles_AirBubble(airBubbleStart, airBubbleEnd, currentSimulationTime, oceanSurfaceDisplacementAtAirBubbleSurfacingSurfaceOffset, taskState);
+
+        auto [ashStart, ashEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Ash)].size());
+        UpdateEphemeralParticles_Ash(ashStart, ashEnd, currentSimulationTime, taskState);
+
+        auto [debrisStart, debrisEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Debris)].size());
+        UpdateEphemeralParticles_Debris(debrisStart, debrisEnd, currentSimulationTime, taskState);
+
+        auto [siltCloudStart, siltCloudEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::SiltCloud)].size());
+        UpdateEphemeralParticles_SiltCloud(siltCloudStart, siltCloudEnd, currentSimulationTime, taskState);
+
+        auto [smokeStart, smokeEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Smoke)].size());
+        UpdateEphemeralParticles_Smoke(smokeStart, smokeEnd, currentSimulationTime, randomWalkVelocityImpulseToForceCoefficient, taskState);
+
+        auto [sparkleStart, sparkleEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Sparkle)].size());
+        UpdateEphemeralParticles_Sparkle(sparkleStart, sparkleEnd, currentSimulationTime, taskState);
+
+        auto [wakeBubbleStart, wakeBubbleEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WakeBubble)].size());
+        UpdateEphemeralParticles_WakeBubble(wakeBubbleStart, wakeBubbleEnd, currentSimulationTime, taskState);
+
+        auto [waterFoamStart, waterFoamEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WaterFoam)].size());
+        UpdateEphemeralParticles_WaterFoam(waterFoamStart, waterFoamEnd, currentSimulationTime, taskState);
+
+        auto [waterSplashStart, waterSplashEnd] = sliceOf(mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WaterSplash)].size());
+        UpdateEphemeralParticles_WaterSplash(waterSplashStart, waterSplashEnd, currentSimulationTime, taskState);
+    };
+
+    if (parallelism == 1)
+    {
+        runTask(0);
+    }
+    else
+    {
+        mEphemeralParticleUpdateTasks.clear();
+        for (size_t t = 0; t < parallelism; ++t)
+        {
+            mEphemeralParticleUpdateTasks.emplace_back(
+                [&runTask, t]()
+                {
+                    runTask(t);
+                });
+        }
+
+        simulationThreadPool.RunAndClear(mEphemeralParticleUpdateTasks);
+    }
+
+    //
+    // Commit task states, in task order so that we're deterministic
+    //
+
+    unsigned int airBubblesSurfacedCount = 0;
+
+    for (size_t t = 0; t < parallelism; ++t)
+    {
+        auto const & taskState = mEphemeralParticleUpdateTaskStates[t];
+
+        for (auto const & [x, yOffset] : taskState.OceanSurfaceDisplacements)
+        {
+            mParentWorld.DisplaceOceanSurfaceAt(x, yOffset);
+        }
+
+        airBubblesSurfacedCount += static_cast<unsigned int>(taskState.OceanSurfaceDisplacements.size());
+
+        for (ElementIndex const ephemeralParticleIndex : taskState.ExpiredEphemeralParticles)
+        {
+            ExpireEphemeralParticle(ephemeralParticleIndex);
+        }
+
+        mCulledEphemeralParticleCount += taskState.CulledCount;
+    }
+
+    if (airBubblesSurfacedCount > 0)
+    {
+        mSimulationEventHandler.OnAirBubbleSurfaced(airBubblesSurfacedCount);
+    }
+
+    perfStats.AddToCounter<PerfCounter::CulledEphemeralParticles>(mCulledEphemeralParticleCount);
+    mCulledEphemeralParticleCount = 0;
+}
+
+void Points::UpdateEphemeralParticleLod(VisibleWorld const & visibleWorld)
+{
+    //
+    // Cull region: the visible world, plus a margin so that particles
+    // drifting in from just off-screen are still there when they do
+    //
+
+    float constexpr CullRegionMarginFraction = 0.2f;
+
+    vec2f const margin(
+        visibleWorld.Width * CullRegionMarginFraction,
+        visibleWorld.Height * CullRegionMarginFraction);
+
+    mEphemeralParticleLod.CullRegionBottomLeft = vec2f(visibleWorld.TopLeft.x, visibleWorld.BottomRight.y) - margin;
+    mEphemeralParticleLod.CullRegionTopRight = vec2f(visibleWorld.BottomRight.x, visibleWorld.TopLeft.y) + margin;
+
+    //
+    // Spawn density: full up to twice the visible world height at zoom=1.0,
+    // then decreasing with the screen coverage of each particle
+    //
+
+    float constexpr FullDensityMaxVisibleWorldHeight = 280.0f;
+    float constexpr MinSpawnDensity = 0.2f;
+
+    assert(visibleWorld.Height > 0.0f);
+    mEphemeralParticleLod.SpawnDensity = Clamp(
+        FullDensityMaxVisibleWorldHeight / visibleWorld.Height,
+        MinSpawnDensity,
+        1.0f);
+}
+
+void Points::UpdateEphemeralParticles_AirBubble(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    float oceanSurfaceDisplacementAtAirBubbleSurfacingSurfaceOffset,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::AirBubble)].data();
+
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::AirBubble);
+
+        auto const pointIndex = EphemeralParticleIndexToPointIndex(ephemeralParticleIndex);
+
+        // Do not advance air bubble if it's pinned
+        if (IsPinned(pointIndex))
+        {
+            continue;
+        }
+
+        float const depth = GetCachedDepth(pointIndex);
+        if (depth <= 0.0f)
+        {
+            // Got to the surface, expire
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
         {
             //
-            // Run this particle's state machine
+            // Update state
             //
 
-            auto const pointIndex = EphemeralParticleIndexToPointIndex(ephemeralParticleIndex);
+            auto & state = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.AirBubble;
 
-            switch (ephemeralType)
+            // DeltaY
+
+            state.CurrentDeltaY = depth;
+
+            // Simulation lifetime
+
+            auto const simulationLifetime =
+                currentSimulationTime
+                - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+
+            state.SimulationLifetime = simulationLifetime;
+
+            //
+            // Update vortex
+            //
+
+            float const vortexValue =
+                state.VortexAmplitude
+                * PrecalcLoFreqSin.GetNearestPeriodic(
+                    state.NormalizedVortexAngularVelocity * simulationLifetime);
+
+            // Apply vortex to bubble
+            AddStaticForce(
+                pointIndex,
+                vec2f(
+                    vortexValue,
+                    0.0f));
+
+            //
+            // Displace ocean surface, if surfacing and enabled
+            //
+
+            if (depth < oceanSurfaceDisplacementAtAirBubbleSurfacingSurfaceOffset)
             {
-                case EphemeralType::AirBubble:
-                {
-                    // Do not advance air bubble if it's pinned
-                    if (!IsPinned(pointIndex))
-                    {
-                        float const depth = GetCachedDepth(pointIndex);
-                        if (depth <= 0.0f)
-                        {
-                            // Got to the surface, expire
-                            ExpireEphemeralParticle(ephemeralParticleIndex);
-                        }
-                        else
-                        {
-                            //
-                            // Update state
-                            //
+                taskState.OceanSurfaceDisplacements.emplace_back(
+                    GetPosition(pointIndex).x,
+                    // Magnitude is lower with depth and higher with scale
+                    (oceanSurfaceDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * state.FinalScale * 3.75f); // Magic number
+            }
+        }
+    }
+}
 
-                            auto & state = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.AirBubble;
+void Points::UpdateEphemeralParticles_Ash(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Ash)].data();
 
-                            // DeltaY
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::Ash);
 
-                            state.CurrentDeltaY = depth;
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime)
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update alpha based off remaining time
+            float const alpha = std::max(
+                1.0f - LinearStep(0.5f, 1.0f, elapsedSimulationLifetime / maxSimulationLifetime),
+                0.0f);
+            mColorBuffer[EphemeralParticleIndexToPointIndex(ephemeralParticleIndex)].w = alpha;
+
+            // Update progress
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.Ash.ElapsedSimulationTime = elapsedSimulationLifetime;
+        }
+    }
+}
 
-                            // Simulation lifetime
+void Points::UpdateEphemeralParticles_Debris(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Debris)].data();
 
-                            auto const simulationLifetime =
-                                currentSimulationTime
-                                - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::Debris);
 
-                            state.SimulationLifetime = simulationLifetime;
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime)
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update alpha based off remaining time
+            float const alpha = std::max(
+                1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
+                0.0f);
+            mColorBuffer[EphemeralParticleIndexToPointIndex(ephemeralParticleIndex)].w = alpha;
+        }
+    }
+}
 
-                            //
-                            // Update vortex
-                            //
+void Points::UpdateEphemeralParticles_SiltCloud(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::SiltCloud)].data();
 
-                            float const vortexValue =
-                                state.VortexAmplitude
-                                * PrecalcLoFreqSin.GetNearestPeriodic(
-                                    state.NormalizedVortexAngularVelocity * simulationLifetime);
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::SiltCloud);
 
-                            // Apply vortex to bubble
-                            AddStaticForce(
-                                pointIndex,
-                                vec2f(
-                                    vortexValue,
-                                    0.0f));
+        // Calculate progress
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
+        float const lifetimeProgress =
+            elapsedSimulationLifetime
+            / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+
+        // Check if expired
+        if (lifetimeProgress >= 1.0f)
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update progress
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.SiltCloud.LifetimeProgress = lifetimeProgress;
+        }
+    }
+}
 
-                            //
-                            // Displace ocean surface, if surfacing and enabled
-                            //
+void Points::UpdateEphemeralParticles_Smoke(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    float randomWalkVelocityImpulseToForceCoefficient,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Smoke)].data();
 
-                            if (simulationParameters.DoDisplaceWater
-                                && depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
-                            {
-                                mParentWorld.DisplaceOceanSurfaceAt(
-                                    GetPosition(pointIndex).x,
-                                    // Magnitude is lower with depth and higher with scale
-                                    (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * state.FinalScale * 3.75f); // Magic number
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::Smoke);
 
-                                mSimulationEventHandler.OnAirBubbleSurfaced(1);
-                            }
-                        }
-                    }
+        // Expire early if out of sight
+        if (mEphemeralParticleLod.IsCulled(GetPosition(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex))))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+            ++taskState.CulledCount;
+            continue;
+        }
 
-                    break;
-                }
+        auto const pointIndex = EphemeralParticleIndexToPointIndex(ephemeralParticleIndex);
 
-                case EphemeralType::Ash:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime)
-                    {
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        // Update alpha based off remaining time
-                        float const alpha = std::max(
-                            1.0f - LinearStep(0.5f, 1.0f, elapsedSimulationLifetime / maxSimulationLifetime),
-                            0.0f);
-                        mColorBuffer[pointIndex].w = alpha;
-
-                        // Update progress
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.Ash.ElapsedSimulationTime = elapsedSimulationLifetime;
-                    }
+        auto & state = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.Smoke;
 
-                    break;
-                }
+        // Maintain total distance traveled
+        auto const & p = GetPosition(pointIndex);
+        state.TotalSquareDistanceTraveled += (p - state.PreviousPosition).squareLength();
+        state.PreviousPosition = p;
 
-                case EphemeralType::Debris:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime)
-                    {
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        // Update alpha based off remaining time
-                        float const alpha = std::max(
-                            1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
-                            0.0f);
-                        mColorBuffer[pointIndex].w = alpha;
-                    }
+        // Calculate time progress
+        state.ElapsedSimulationTime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
+        float const timeProgress =
+            state.ElapsedSimulationTime
+            / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
 
-                    break;
-                }
+        // Calculate distance progress
+        assert(state.MaxTotalSquareDistanceTraveled > 0.0f);
+        float const distanceProgress =
+            state.TotalSquareDistanceTraveled
+            / state.MaxTotalSquareDistanceTraveled;
 
-                case EphemeralType::SiltCloud:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f)
-                    {
-                        //
-                        /// Expired
-                        //
+        // Combine progress
+        float const lifetimeProgress = std::max(timeProgress, distanceProgress);
 
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
+        // Check if expired
+        if (lifetimeProgress >= 1.0f
+            || IsCachedUnderwater(pointIndex))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update progress
+            state.LifetimeProgress = lifetimeProgress;
+
+            // Inject random walk in direction orthogonal to current velocity
+            float const randomWalkMagnitude =
+                0.3f * (taskState.Random.GenerateUniformBoolean(0.5f) ? 0.5f : -0.5f);
+            vec2f const deviationDirection =
+                GetVelocity(pointIndex).normalise_approx().to_perpendicular();
+            AddStaticForce(
+                pointIndex,
+                deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
+        }
+    }
+}
 
-                        // Update progress
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.SiltCloud.LifetimeProgress = lifetimeProgress;
-                    }
+void Points::UpdateEphemeralParticles_Sparkle(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::Sparkle)].data();
 
-                    break;
-                }
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::Sparkle);
 
-                case EphemeralType::Smoke:
-                {
-                    auto & state = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.Smoke;
-
-                    // Maintain total distance traveled
-                    auto const & p = GetPosition(pointIndex);
-                    state.TotalSquareDistanceTraveled += (p - state.PreviousPosition).squareLength();
-                    state.PreviousPosition = p;
-
-                    // Calculate time progress
-                    state.ElapsedSimulationTime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
-                    float const timeProgress =
-                        state.ElapsedSimulationTime
-                        / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-
-                    // Calculate distance progress
-                    assert(state.MaxTotalSquareDistanceTraveled > 0.0f);
-                    float const distanceProgress =
-                        state.TotalSquareDistanceTraveled
-                        / state.MaxTotalSquareDistanceTraveled;
-
-                    // Combine progress
-                    float const lifetimeProgress = std::max(timeProgress, distanceProgress);
-
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        //
-                        /// Expired
-                        //
+        // Expire early if out of sight
+        if (mEphemeralParticleLod.IsCulled(GetPosition(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex))))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+            ++taskState.CulledCount;
+            continue;
+        }
 
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        state.LifetimeProgress = lifetimeProgress;
-
-                        // Inject random walk in direction orthogonal to current velocity
-                        float const randomWalkMagnitude =
-                            0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
-                        vec2f const deviationDirection =
-                            GetVelocity(pointIndex).normalise_approx().to_perpendicular();
-                        AddStaticForce(
-                            pointIndex,
-                            deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
-                    }
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime
+            || IsCachedUnderwater(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex)))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update progress based off remaining time
+            assert(maxSimulationLifetime > 0.0f);
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.Sparkle.Progress =
+                elapsedSimulationLifetime / maxSimulationLifetime;
+        }
+    }
+}
 
-                    break;
-                }
+void Points::UpdateEphemeralParticles_WakeBubble(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WakeBubble)].data();
 
-                case EphemeralType::Sparkle:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.Sparkle.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::WakeBubble);
 
-                    break;
-                }
+        // Expire early if out of sight
+        if (mEphemeralParticleLod.IsCulled(GetPosition(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex))))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+            ++taskState.CulledCount;
+            continue;
+        }
 
-                case EphemeralType::WakeBubble:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || !IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WakeBubble.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+        // Check if expired
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        auto const maxSimulationLifetime = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+        if (elapsedSimulationLifetime >= maxSimulationLifetime
+            || !IsCachedUnderwater(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex)))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update progress based off remaining time
+            assert(maxSimulationLifetime > 0.0f);
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WakeBubble.Progress =
+                elapsedSimulationLifetime / maxSimulationLifetime;
+        }
+    }
+}
 
-                    break;
-                }
+void Points::UpdateEphemeralParticles_WaterFoam(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WaterFoam)].data();
 
-                case EphemeralType::WaterFoam:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
+    OceanSurface const & oceanSurface = mParentWorld.GetOceanSurface();
 
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::WaterFoam);
 
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f)
-                    {
-                        //
-                        /// Expired
-                        //
+        // Expire early if out of sight
+        if (mEphemeralParticleLod.IsCulled(GetPosition(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex))))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+            ++taskState.CulledCount;
+            continue;
+        }
 
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WaterFoam.LifetimeProgress = lifetimeProgress;
-
-                        // Constrain onto ocean surface, simulating falling down/floating up
-                        //
-                        // Note: this is not nice - we're acting directly onto the positions of particles,
-                        // which is against the basic rules of the simulation; however, we're doing this
-                        // for these specific ephemeral particles only, so we may live with it.
-
-                        // The older or further from 0.0, the faster it goes to 0.0
-                        float const currentDepth = GetCachedDepth(pointIndex);
-                        float const newDepth = currentDepth * (1.0f - LinearStep(0.0, 5.0f / (1.0f + std::abs(currentDepth)), elapsedSimulationLifetime));
-                        mPositionBuffer[pointIndex].y += currentDepth - newDepth;
-                        mCachedDepthBuffer[pointIndex] = newDepth;
-                        mVelocityBuffer[pointIndex].y = 0.0f; // Just to be nice
-
-                        // Calculate vertical axis
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WaterFoam.VerticalAxis = mParentWorld.GetOceanSurface().GetNormalAt(mPositionBuffer[pointIndex].x);
-                    }
+        auto const pointIndex = EphemeralParticleIndexToPointIndex(ephemeralParticleIndex);
 
-                    break;
-                }
+        // Calculate progress
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
 
-                case EphemeralType::WaterSplash:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
-
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f)
-                    {
-                        //
-                        /// Expired
-                        //
+        float const lifetimeProgress =
+            elapsedSimulationLifetime
+            / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
 
-                        ExpireEphemeralParticle(ephemeralParticleIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WaterSplash.LifetimeProgress = lifetimeProgress;
-
-                        // Constrain onto ocean surface
-                        //
-                        // Note: this is not nice - we're acting directly onto the positions of particles,
-                        // which is against the basic rules of the simulation; however, we're doing this
-                        // for these specific ephemeral particles only, so we may live with it
-                        float const currentDepth = GetCachedDepth(pointIndex);
-                        if (currentDepth > 0.0f)
-                        {
-                            float const newDepth = 0.95f * currentDepth;
-                            mPositionBuffer[pointIndex].y += currentDepth - newDepth;
-                            mCachedDepthBuffer[pointIndex] = newDepth;
-                        }
-                    }
+        // Check if expired
+        if (lifetimeProgress >= 1.0f)
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update progress
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WaterFoam.LifetimeProgress = lifetimeProgress;
 
-                    break;
-                }
+            // Constrain onto ocean surface, simulating falling down/floating up
+            //
+            // Note: this is not nice - we're acting directly onto the positions of particles,
+            // which is against the basic rules of the simulation; however, we're doing this
+            // for these specific ephemeral particles only, so we may live with it.
+
+            // The older or further from 0.0, the faster it goes to 0.0
+            float const currentDepth = GetCachedDepth(pointIndex);
+            float const newDepth = currentDepth * (1.0f - LinearStep(0.0, 5.0f / (1.0f + std::abs(currentDepth)), elapsedSimulationLifetime));
+            mPositionBuffer[pointIndex].y += currentDepth - newDepth;
+            mCachedDepthBuffer[pointIndex] = newDepth;
+            mVelocityBuffer[pointIndex].y = 0.0f; // Just to be nice
+
+            // Calculate vertical axis
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WaterFoam.VerticalAxis = oceanSurface.GetNormalAt(mPositionBuffer[pointIndex].x);
+        }
+    }
+}
 
-                case EphemeralType::None:
-                {
-                    // Do nothing
-                }
+void Points::UpdateEphemeralParticles_WaterSplash(
+    size_t start,
+    size_t end,
+    float currentSimulationTime,
+    EphemeralParticleUpdateTaskState & taskState)
+{
+    ElementIndex const * const restrict typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(EphemeralType::WaterSplash)].data();
+
+    for (size_t i = start; i < end; ++i)
+    {
+        ElementIndex const ephemeralParticleIndex = typeList[i];
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::WaterSplash);
+
+        // Expire early if out of sight
+        if (mEphemeralParticleLod.IsCulled(GetPosition(EphemeralParticleIndexToPointIndex(ephemeralParticleIndex))))
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+            ++taskState.CulledCount;
+            continue;
+        }
+
+        auto const pointIndex = EphemeralParticleIndexToPointIndex(ephemeralParticleIndex);
+
+        // Calculate progress
+        auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].StartSimulationTime;
+        assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime > 0.0f);
+        float const lifetimeProgress =
+            elapsedSimulationLifetime
+            / mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].MaxSimulationLifetime;
+
+        // Check if expired
+        if (lifetimeProgress >= 1.0f)
+        {
+            taskState.ExpiredEphemeralParticles.emplace_back(ephemeralParticleIndex);
+        }
+        else
+        {
+            // Update progress
+            mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].State.WaterSplash.LifetimeProgress = lifetimeProgress;
+
+            // Constrain onto ocean surface
+            //
+            // Note: this is not nice - we're acting directly onto the positions of particles,
+            // which is against the basic rules of the simulation; however, we're doing this
+            // for these specific ephemeral particles only, so we may live with it
+            float const currentDepth = GetCachedDepth(pointIndex);
+            if (currentDepth > 0.0f)
+            {
+                float const newDepth = 0.95f * currentDepth;
+                mPositionBuffer[pointIndex].y += currentDepth - newDepth;
+                mCachedDepthBuffer[pointIndex] = newDepth;
             }
         }
     }
@@ -3054,6 +3445,10 @@ ElementIndex Points::FindFreeEphemeralParticle(
                 // Remove from current place in list
                 UnlinkEphemeralParticleFromActiveList(ephemeralParticleIndex);
 
+                // Remove from its type list; new type will be set by caller
+                RemoveEphemeralParticleFromTypeList(ephemeralParticleIndex);
+                mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = EphemeralType::None;
+
                 break;
             }
         }
@@ -3087,6 +3482,21 @@ ElementIndex Points::FindFreeEphemeralParticle(
     return ephemeralParticleIndex;
 }
 
+void Points::ActivateEphemeralParticle(
+    ElementIndex ephemeralParticleIndex,
+    EphemeralType ephemeralType)
+{
+    assert(ephemeralType != EphemeralType::None);
+    assert(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type == EphemeralType::None);
+
+    mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type = ephemeralType;
+
+    // Add to its type list
+    auto & typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(ephemeralType)];
+    mEphemeralParticleMetadataBuffer[ephemeralParticleIndex].TypeListIndex = static_cast<ElementIndex>(typeList.size());
+    typeList.emplace_back(ephemeralParticleIndex);
+}
+
 void Points::ExpireEphemeralParticle(ElementIndex ephemeralParticleIndex)
 {
     // Freeze the particle (just to prevent drifting)
@@ -3095,6 +3505,9 @@ void Points::ExpireEphemeralParticle(ElementIndex ephemeralParticleIndex)
     // Remove from active list
     UnlinkEphemeralParticleFromActiveList(ephemeralParticleIndex);
 
+    // Remove from type list
+    RemoveEphemeralParticleFromTypeList(ephemeralParticleIndex);
+
     // Register as free
     assert(mFreeEphemeralParticles.size() < mEphemeralPointCount);
     mFreeEphemeralParticles.emplace_back(ephemeralParticleIndex);
@@ -3138,6 +3551,25 @@ void Points::UnlinkEphemeralParticleFromActiveList(ElementIndex ephemeralParticl
     mEphemeralParticleMetadataBuffer[ephemeralParticleIndex].ActiveListNext = nullptr;
 }
 
+void Points::RemoveEphemeralParticleFromTypeList(ElementIndex ephemeralParticleIndex)
+{
+    auto const ephemeralType = mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type;
+    assert(ephemeralType != EphemeralType::None);
+
+    auto & typeList = mActiveEphemeralParticlesByType[static_cast<size_t>(ephemeralType)];
+    ElementIndex const typeListIndex = mEphemeralParticleMetadataBuffer[ephemeralParticleIndex].TypeListIndex;
+    assert(typeListIndex < typeList.size());
+    assert(typeList[typeListIndex] == ephemeralParticleIndex);
+
+    // Swap with last one
+    ElementIndex const lastEphemeralParticleIndex = typeList.back();
+    typeList[typeListIndex] = lastEphemeralParticleIndex;
+    mEphemeralParticleMetadataBuffer[lastEphemeralParticleIndex].TypeListIndex = typeListIndex;
+    typeList.pop_back();
+
+    mEphemeralParticleMetadataBuffer[ephemeralParticleIndex].TypeListIndex = NoneElementIndex;
+}
+
 #ifdef _DEBUG
 void Points::VerifyEphemeralParticleInvariants()
 {
@@ -3172,6 +3604,24 @@ void Points::VerifyEphemeralParticleInvariants()
     }
 
     assert(totalParticles == mEphemeralPointCount);
+
+    size_t totalTypeListParticles = 0;
+
+    for (size_t t = 0; t < EphemeralTypeCount; ++t)
+    {
+        assert(t != static_cast<size_t>(EphemeralType::None) || mActiveEphemeralParticlesByType[t].empty());
+
+        for (size_t i = 0; i < mActiveEphemeralParticlesByType[t].size(); ++i)
+        {
+            ++totalTypeListParticles;
+
+            ElementIndex const ephemeralParticleIndex = mActiveEphemeralParticlesByType[t][i];
+            assert(static_cast<size_t>(mEphemeralParticleAttributesBuffer[ephemeralParticleIndex].Type) == t);
+            assert(mEphemeralParticleMetadataBuffer[ephemeralParticleIndex].TypeListIndex == i);
+        }
+    }
+
+    assert(totalTypeListParticles == mEphemeralPointCount - mFreeEphemeralParticles.size());
 }
 #endif
 
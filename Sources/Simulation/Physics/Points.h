@@ -23,6 +23,9 @@
 #include <Core/GameRandomEngine.h>
 #include <Core/GameTypes.h>
 #include <Core/GameWallClock.h>
+#include <Core/PerfStats.h>
+#include <Core/RandomStream.h>
+#include <Core/ThreadManager.h>
 #include <Core/Vectors.h>
 
 #include <algorithm>
@@ -31,6 +34,7 @@
 #include <chrono>
 #include <cstring>
 #include <functional>
+#include <limits>
 #include <vector>
 
 namespace Physics
@@ -61,9 +65,13 @@ public:
         Sparkle,
         WakeBubble,
         WaterFoam,
-        WaterSplash
+        WaterSplash,
+
+        _Last = WaterSplash
     };
 
+    static size_t constexpr EphemeralTypeCount = static_cast<size_t>(EphemeralType::_Last) + 1;
+
     /*
      * The metadata of a single spring connected to a point.
      */
@@ -586,14 +594,67 @@ private:
         EphemeralParticleMetadata * ActiveListPrev; // Null when first
         EphemeralParticleMetadata * ActiveListNext; // Null when last
 
+        // Position in the list of active particles of the same type; only valid when active
+        ElementIndex TypeListIndex;
+
         EphemeralParticleMetadata(ElementIndex ephemeralParticleIndex)
             : EphemeralParticleIndex(ephemeralParticleIndex)
             , Priority(0) // Will be set
             , ActiveListPrev(nullptr)
             , ActiveListNext(nullptr)
+            , TypeListIndex(NoneElementIndex)
         {}
     };
 
+    /*
+     * Per-task state of the (parallel) update of ephemeral particles; populated
+     * by each task and committed serially at the end of the update.
+     */
+    struct EphemeralParticleUpdateTaskState
+    {
+        RandomStream Random; // Forked from the ship's stream at each update
+        std::vector<ElementIndex> ExpiredEphemeralParticles;
+        std::vector<std::tuple<float, float>> OceanSurfaceDisplacements; // x, yOffset
+        size_t CulledCount; // Subset of ExpiredEphemeralParticles that were expired early by LOD
+
+        EphemeralParticleUpdateTaskState()
+            : Random(0)
+            , ExpiredEphemeralParticles()
+            , OceanSurfaceDisplacements()
+            , CulledCount(0)
+        {}
+    };
+
+    /*
+     * Level-of-detail of cosmetic ephemeral particles (smoke, sparkles, wake bubbles, water foam,
+     * and water splashes), derived from the visible world at each update.
+     *
+     * Cosmetic particles outside of the cull region (the visible world plus a margin) are expired
+     * early and are not spawned at all; inside of the cull region, spawns are thinned out
+     * when zoomed out so much that each particle only covers a handful of pixels.
+     */
+    struct EphemeralParticleLod
+    {
+        vec2f CullRegionBottomLeft;
+        vec2f CullRegionTopRight;
+        float SpawnDensity; // Fraction of spawns that are honored, 0.0 < d <= 1.0
+
+        EphemeralParticleLod()
+            // Nothing culled until we're told what's visible
+            : CullRegionBottomLeft(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest())
+            , CullRegionTopRight(std::numeric_limits<float>::max(), std::numeric_limits<float>::max())
+            , SpawnDensity(1.0f)
+        {}
+
+        inline bool IsCulled(vec2f const & position) const noexcept
+        {
+            return position.x < CullRegionBottomLeft.x
+                || position.x > CullRegionTopRight.x
+                || position.y < CullRegionBottomLeft.y
+                || position.y > CullRegionTopRight.y;
+        }
+    };
+
     /*
      * Ephemeral particle attributes and state.
      */
@@ -738,6 +799,7 @@ public:
     Points(
         ElementCount shipPointCount,
         ElementCount maxEphemeralParticleCount,
+        ShipId shipId,
         World & parentWorld,
         MaterialDatabase const & materialDatabase,
         SimulationEventDispatcher & simulationEventDispatcher,
@@ -789,6 +851,11 @@ public:
         , mLeakingCompositeBuffer(mBufferElementCount, shipPointCount, LeakingComposite(false))
         , mFactoryIsStructurallyLeakingBuffer(mBufferElementCount, shipPointCount, false)
         , mTotalFactoryWetPoints(0)
+        , mIsInWetPointsBuffer(mBufferElementCount, shipPointCount, false)
+        , mWetPoints()
+        , mAreDryWaterVelocitiesDirty(false)
+        , mIsInLeakingPointsBuffer(mBufferElementCount, shipPointCount, false)
+        , mLeakingPoints()
         // Heat dynamics
         , mTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialHeatCapacityReciprocalBuffer(mBufferElementCount, shipPointCount, 0.0f)
@@ -796,6 +863,7 @@ public:
         , mMaterialIgnitionTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialCombustionTypeBuffer(mBufferElementCount, shipPointCount, StructuralMaterial::MaterialCombustionType::Combustion) // Arbitrary
         , mCombustionStateBuffer(mBufferElementCount, shipPointCount, CombustionState())
+        , mIsHotCandidateBuffer(mBufferElementCount, shipPointCount, false)
         // Water reaction dynamics
         , mWaterReactionStateBuffer(mBufferElementCount, shipPointCount, WaterReactionState(0.0f))
         // Electrical dynamics
@@ -827,7 +895,7 @@ public:
         // Gadgets
         , mIsGadgetAttachedBuffer(mBufferElementCount, mElementCount, false)
         // Randomness
-        , mRandomNormalizedUniformFloatBuffer(mBufferElementCount, shipPointCount, [](size_t){ return GameRandomEngine::GetInstance().GenerateNormalizedUniformReal(); })
+        , mRandomNormalizedUniformFloatBuffer(mBufferElementCount, shipPointCount, 0.0f)
         // Immutable render attributes
         , mColorBuffer(mBufferElementCount, shipPointCount, vec4f::zero())
         , mIsColorBufferDirty(true)
@@ -841,6 +909,7 @@ public:
         , mMaterialDatabase(materialDatabase)
         , mSimulationEventHandler(simulationEventDispatcher)
         , mShipPhysicsHandler(nullptr)
+        , mRandomStream(GameRandomEngine::GetInstance().GetSeed(), shipId) // Follows the session seed
         , mCurrentNumMechanicalDynamicsIterations(simulationParameters.NumMechanicalDynamicsIterations<float>())
         , mCurrentElasticityAdjustment(simulationParameters.ElasticityAdjustment)
         , mCurrentStaticFrictionAdjustment(simulationParameters.StaticFrictionAdjustment)
@@ -856,9 +925,17 @@ public:
         , mWaterReactionExplosionCandidates(mRawShipPointCount)
         , mBurningPoints()
         , mStoppedBurningPoints()
+        , mHotCandidatePoints()
+        , mWaterReactivePoints()
+        , mCombustionLowFrequencyPoints()
         , mFreeEphemeralParticles(mEphemeralPointCount)
         , mActiveEphemeralParticleListHeads({ nullptr, nullptr })
         , mActiveEphemeralParticleListTails({ nullptr, nullptr })
+        , mActiveEphemeralParticlesByType()
+        , mEphemeralParticleUpdateTaskStates()
+        , mEphemeralParticleUpdateTasks()
+        , mEphemeralParticleLod()
+        , mCulledEphemeralParticleCount(0)
 #ifdef _DEBUG
         , mDiagnostic_ArePositionsDirty(false)
 #endif
@@ -874,12 +951,27 @@ public:
             mFreeEphemeralParticles.emplace_back(mEphemeralPointCount - 1 - p);
         }
 
+        for (auto & typeList : mActiveEphemeralParticlesByType)
+        {
+            typeList.reset(mEphemeralPointCount);
+        }
+
+        // Initialize randomness of ephemeral particles; ship points' is provided at Add()
+        mRandomStream.FillNormalizedUniformReal(
+            mRandomNormalizedUniformFloatBuffer.data() + shipPointCount,
+            mBufferElementCount - shipPointCount);
+
         // Initialize calculated parameters
         CalculateCombustionDecayParameters(mCurrentCombustionSpeedAdjustment, SimulationParameters::ParticleUpdateLowFrequencyStepTimeDuration<float>);
     }
 
     Points(Points && other) = default;
 
+    RandomStream & GetRandomStream()
+    {
+        return mRandomStream;
+    }
+
     /*
      * Returns an iterator for the (unaligned) ship (i.e. non-ephemeral) points only.
      */
@@ -1146,7 +1238,10 @@ public:
 
     void UpdateEphemeralParticles(
         float currentSimulationTime,
-        SimulationParameters const & simulationParameters);
+        VisibleWorld const & visibleWorld,
+        ThreadPool & simulationThreadPool,
+        SimulationParameters const & simulationParameters,
+        PerfStats & perfStats);
 
     void UpdateHighlights(GameWallClock::float_time currentWallClockTime);
 
@@ -1453,6 +1548,11 @@ public:
         return mMassBuffer[pointElementIndex];
     }
 
+    float const * GetMassBufferAsFloat() const
+    {
+        return mMassBuffer.data();
+    }
+
     void UpdateMasses(SimulationParameters const & simulationParameters);
 
     float GetFactoryStrength(ElementIndex pointElementIndex) const
@@ -1606,6 +1706,11 @@ public:
         return mFoobarSensitivityBuffer[pointElementIndex];
     }
 
+    float const * GetFoobarSensitivityBufferAsFloat() const
+    {
+        return mFoobarSensitivityBuffer.data();
+    }
+
     /*
      * The integration factor is the quantity which, when multiplied with the force on the point,
      * yields the change in position that occurs during a time interval equal to the dynamics simulation step.
@@ -1730,6 +1835,11 @@ public:
         float value)
     {
         mWaterBuffer[pointElementIndex] = value;
+
+        if (value != 0.0f)
+        {
+            AddWetPoint(pointElementIndex);
+        }
     }
 
     float * GetWaterBufferAsFloat()
@@ -1767,9 +1877,23 @@ public:
         vec2f const & waterVelocity)
     {
         mWaterVelocityBuffer[pointElementIndex] = waterVelocity;
+
+        // Might be a dry point
+        mAreDryWaterVelocitiesDirty = true;
     }
 
+    /*
+     * Assumes water velocities are going to be changed, including the ones of
+     * dry points.
+     */
     vec2f * GetWaterVelocityBufferAsVec2()
+    {
+        mAreDryWaterVelocitiesDirty = true;
+
+        return mWaterVelocityBuffer.data();
+    }
+
+    vec2f const * GetWaterVelocityBufferAsVec2() const
     {
         return mWaterVelocityBuffer.data();
     }
@@ -1789,8 +1913,8 @@ public:
         vec2f * const restrict waterVelocityBuffer = mWaterVelocityBuffer.data();
         vec2f * restrict waterMomentumBuffer = mWaterMomentumBuffer.data();
 
-        // No need to visit ephemerals, as they don't get water
-        for (ElementIndex p = 0; p < mRawShipPointCount; ++p)
+        // Points outside of the wet set have zero water, hence zero momentum
+        for (ElementIndex const p : mWetPoints)
         {
             waterMomentumBuffer[p] =
                 waterVelocityBuffer[p]
@@ -1804,8 +1928,23 @@ public:
         vec2f * restrict waterVelocityBuffer = mWaterVelocityBuffer.data();
         vec2f * const restrict waterMomentumBuffer = mWaterMomentumBuffer.data();
 
+        if (mAreDryWaterVelocitiesDirty)
+        {
+            // Someone has set water velocities of points that might be outside
+            // of the wet set; zero them out, as no mass means no velocity
+            for (ElementIndex p = 0; p < mRawShipPointCount; ++p)
+            {
+                if (!mIsInWetPointsBuffer[p])
+                {
+                    waterVelocityBuffer[p] = vec2f::zero();
+                }
+            }
+
+            mAreDryWaterVelocitiesDirty = false;
+        }
+
         // No need to visit ephemerals, as they don't get water
-        for (ElementIndex p = 0; p < mRawShipPointCount; ++p)
+        for (ElementIndex const p : mWetPoints)
         {
             if (waterBuffer[p] != 0.0f)
             {
@@ -1836,11 +1975,63 @@ public:
         return mLeakingCompositeBuffer[pointElementIndex];
     }
 
-    LeakingComposite & GetLeakingComposite(ElementIndex pointElementIndex)
+    void SetWaterPumpForce(
+        ElementIndex pointElementIndex,
+        float waterPumpForce)
     {
-        return mLeakingCompositeBuffer[pointElementIndex];
+        mLeakingCompositeBuffer[pointElementIndex].LeakingSources.WaterPumpForce = waterPumpForce;
+
+        if (waterPumpForce != 0.0f)
+        {
+            AddLeakingPoint(pointElementIndex);
+        }
+    }
+
+    //
+    // Water active sets
+    //
+
+    /*
+     * The (non-ephemeral) points that may have water, i.e. a superset of the points with
+     * non-zero water. Unsorted until PrepareWetPoints() is invoked.
+     *
+     * Points outside of this set have zero water and zero water momentum; their water
+     * velocity is zero as well after each UpdateWaterVelocitiesFromMomenta().
+     */
+    std::vector<ElementIndex> const & GetWetPoints() const
+    {
+        return mWetPoints;
+    }
+
+    inline void AddWetPoint(ElementIndex pointElementIndex)
+    {
+        if (!mIsInWetPointsBuffer[pointElementIndex])
+        {
+            mIsInWetPointsBuffer[pointElementIndex] = true;
+            mWetPoints.push_back(pointElementIndex);
+        }
+    }
+
+    /*
+     * Removes from the set of wet points the ones that have dried up, zeroing their
+     * water velocities, and sorts the set by point index.
+     */
+    void PrepareWetPoints();
+
+    /*
+     * The (non-ephemeral) points that may be leaking, i.e. a superset of the points
+     * that are cumulatively leaking, sorted by point index.
+     */
+    std::vector<ElementIndex> const & GetLeakingPoints() const
+    {
+        return mLeakingPoints;
     }
 
+    /*
+     * Removes from the set of leaking points the ones that are not leaking anymore.
+     */
+    void PruneLeakingPoints();
+
     ElementCount GetTotalFactoryWetPoints() const
     {
         return mTotalFactoryWetPoints;
@@ -1983,6 +2174,28 @@ public:
             * GetMaterialHeatCapacityReciprocal(pointElementIndex);
     }
 
+    /*
+     * Invoked after the temperature of a point has changed, to keep track of the
+     * points that are hot enough to ignite or explode; only these are visited by
+     * the low-frequency combustion update.
+     *
+     * Points that are already burning are not candidates, as they're visited as
+     * burning points.
+     */
+    inline void OnTemperatureChanged(
+        ElementIndex pointElementIndex,
+        float ignitionTemperatureAdjustment)
+    {
+        if (mTemperatureBuffer[pointElementIndex] >= mMaterialIgnitionTemperatureBuffer[pointElementIndex] * ignitionTemperatureAdjustment + SimulationParameters::IgnitionTemperatureHighWatermark
+            && !mIsHotCandidateBuffer[pointElementIndex]
+            && mCombustionStateBuffer[pointElementIndex].State == CombustionState::StateType::NotBurning
+            && pointElementIndex < mRawShipPointCount)
+        {
+            mIsHotCandidateBuffer[pointElementIndex] = true;
+            mHotCandidatePoints.push_back(pointElementIndex);
+        }
+    }
+
     //
     // Electrical dynamics
     //
@@ -2359,6 +2572,11 @@ public:
         return mRandomNormalizedUniformFloatBuffer[pointElementIndex];
     }
 
+    float const * GetRandomNormalizedUniformPersonalitySeedBufferAsFloat() const
+    {
+        return mRandomNormalizedUniformFloatBuffer.data();
+    }
+
     //
     // Immutable attributes
     //
@@ -2497,9 +2715,21 @@ private:
             cumulatedIntakenWaterThresholdForAirBubbles);
     }
 
+    inline void AddLeakingPoint(ElementIndex pointElementIndex)
+    {
+        if (!mIsInLeakingPointsBuffer[pointElementIndex])
+        {
+            mIsInLeakingPointsBuffer[pointElementIndex] = true;
+            mLeakingPoints.insert(
+                std::lower_bound(mLeakingPoints.cbegin(), mLeakingPoints.cend(), pointElementIndex),
+                pointElementIndex);
+        }
+    }
+
     inline void SetStructurallyLeaking(ElementIndex pointElementIndex)
     {
         mLeakingCompositeBuffer[pointElementIndex].LeakingSources.StructuralLeak = 1.0f;
+        AddLeakingPoint(pointElementIndex);
 
         // Randomize the initial water intaken, so that air bubbles won't come out all at the same moment
         mCumulatedIntakenWater[pointElementIndex] = RandomizeCumulatedIntakenWater(mCurrentCumulatedIntakenWaterThresholdForAirBubbles);
@@ -2524,10 +2754,96 @@ private:
         int priority, // 0 (lower) or 1 (higher)
         bool doForce);
 
+    inline void ActivateEphemeralParticle(
+        ElementIndex ephemeralParticleIndex,
+        EphemeralType ephemeralType);
+
     inline void ExpireEphemeralParticle(ElementIndex ephemeralParticleIndex);
 
     inline void UnlinkEphemeralParticleFromActiveList(ElementIndex ephemeralParticleIndex);
 
+    inline void RemoveEphemeralParticleFromTypeList(ElementIndex ephemeralParticleIndex);
+
+    //
+    // Type-specific ephemeral particle updates; each one visits the [start, end) slice of the
+    // list of active particles of its type. These run in parallel, hence they only touch
+    // the particles in their slice and defer any shared-state mutation to the task state.
+    //
+
+    void UpdateEphemeralParticles_AirBubble(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        float oceanSurfaceDisplacementAtAirBubbleSurfacingSurfaceOffset,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_Ash(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_Debris(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_SiltCloud(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_Smoke(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        float randomWalkVelocityImpulseToForceCoefficient,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_Sparkle(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_WakeBubble(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_WaterFoam(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticles_WaterSplash(
+        size_t start,
+        size_t end,
+        float currentSimulationTime,
+        EphemeralParticleUpdateTaskState & taskState);
+
+    void UpdateEphemeralParticleLod(VisibleWorld const & visibleWorld);
+
+    /*
+     * Invoked when about to spawn a cosmetic ephemeral particle; returns true if the
+     * spawn should be skipped, according to the current LOD.
+     */
+    inline bool IsCosmeticEphemeralParticleSpawnCulled(vec2f const & position)
+    {
+        if (mEphemeralParticleLod.IsCulled(position)
+            || (mEphemeralParticleLod.SpawnDensity < 1.0f && mRandomStream.GenerateNormalizedUniformReal() >= mEphemeralParticleLod.SpawnDensity))
+        {
+            ++mCulledEphemeralParticleCount;
+            return true;
+        }
+
+        return false;
+    }
+
     /*
      * Returns an iterator for the ephemeral points only,
      * as ephemeral particle indices.
@@ -2622,6 +2938,17 @@ private:
     // Total number of points that where wet at factory time
     ElementCount mTotalFactoryWetPoints;
 
+    // The active set of points that may have water, and their membership flags
+    Buffer<bool> mIsInWetPointsBuffer;
+    std::vector<ElementIndex> mWetPoints;
+
+    // Whether water velocities might have been set for points outside of the wet set
+    bool mAreDryWaterVelocitiesDirty;
+
+    // The active set of points that may be leaking, and their membership flags
+    Buffer<bool> mIsInLeakingPointsBuffer;
+    std::vector<ElementIndex> mLeakingPoints;
+
     //
     // Heat dynamics
     //
@@ -2632,6 +2959,7 @@ private:
     Buffer<float> mMaterialIgnitionTemperatureBuffer;
     Buffer<StructuralMaterial::MaterialCombustionType> mMaterialCombustionTypeBuffer;
     Buffer<CombustionState> mCombustionStateBuffer;
+    Buffer<bool> mIsHotCandidateBuffer; // Whether the point is in mHotCandidatePoints
 
     //
     // Water reaction dynamics
@@ -2733,6 +3061,9 @@ private:
     SimulationEventDispatcher & mSimulationEventHandler;
     IShipPhysicsHandler * mShipPhysicsHandler;
 
+    // This ship's stream of random numbers; not shared with other ships
+    RandomStream mRandomStream;
+
     // The game parameter values that we are current with; changes
     // in the values of these parameters will trigger a re-calculation
     // of pre-calculated coefficients
@@ -2763,6 +3094,19 @@ private:
     // member only to save allocations at use time
     std::vector<ElementIndex> mStoppedBurningPoints;
 
+    // The indices of the not-burning points that are hot enough to ignite or explode,
+    // as last seen when their temperature changed; unsorted, and may contain points
+    // that have cooled down since, which are pruned by the low-frequency combustion update
+    std::vector<ElementIndex> mHotCandidatePoints;
+
+    // The indices of the points whose material reacts to water; populated
+    // at ship creation
+    std::vector<ElementIndex> mWaterReactivePoints;
+
+    // The points visited by the current low-frequency combustion update;
+    // member only to save allocations at use time
+    std::vector<ElementIndex> mCombustionLowFrequencyPoints;
+
     // Ephemeral particle maintenance
     //
     // Stack of free particles; contains ephemeral particle indices (NOT point indices)
@@ -2770,6 +3114,15 @@ private:
     // Active lists, indexed by prio
     std::array<EphemeralParticleMetadata *, 2> mActiveEphemeralParticleListHeads;
     std::array<EphemeralParticleMetadata *, 2> mActiveEphemeralParticleListTails;
+    // Active particles grouped by type, indexed by type; contain ephemeral particle indices (NOT point indices).
+    // Order within each list is arbitrary
+    std::array<BoundedVector<ElementIndex>, EphemeralTypeCount> mActiveEphemeralParticlesByType;
+    // Per-task state and tasks for the parallel update; members only to save allocations at use time
+    std::vector<EphemeralParticleUpdateTaskState> mEphemeralParticleUpdateTaskStates;
+    std::vector<ThreadPool::Task> mEphemeralParticleUpdateTasks;
+    // Level-of-detail of cosmetic particles, and count of particles culled by it since the last update
+    EphemeralParticleLod mEphemeralParticleLod;
+    size_t mCulledEphemeralParticleCount;
 
     // Calculated constants for combustion decay
     float mCombustionDecayAlphaFunctionA;
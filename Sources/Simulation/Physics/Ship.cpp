@@ -14,6 +14,7 @@
 #include <Core/GameDebug.h>
 #include <Core/GameMath.h>
 #include <Core/GameRandomEngine.h>
+#include <Core/Profiler.h>
 #include <Core/Log.h>
 #include <Core/SysSpecifics.h>
 
@@ -127,8 +128,12 @@ Ship::Ship(
     , mAirBubblesCreatedCount(0)
     , mCurrentSimulationParallelism(0) // We'll detect a difference on first run
     , mCurrentSpringRelaxationParallelComputationMode() // We'll detect a difference on first run
+    , mSpringRelaxationThreadWorkDurations()
+    , mSpringRelaxationShardBalancer()
+    , mShipCollisionPartners()
+    , mShipCollisionPartnerCount(0)
     // Static pressure
-    , mStaticPressureBuffer(mPoints.GetAlignedShipPointCount())
+    , mStaticPressureTaskStates()
     , mStaticPressureNetForceMagnitudeSum(0.0f)
     , mStaticPressureNetForceMagnitudeCount(0.0f)
     , mStaticPressureIterationsPercentagesSum(0.0f)
@@ -186,7 +191,7 @@ Geometry::ShipAABBSet Ship::CalculateExternalAABBs() const
 
             aabb.FrontierEdgeCount = static_cast<float>(frontier.Size);
 
-            allExternalAABBs.Add(aabb);
+            allExternalAABBs.Add(aabb, mId);
         }
     }
 
@@ -225,14 +230,13 @@ void Ship::Update(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
     SimulationParameters const & simulationParameters,
+    VisibleWorld const & visibleWorld,
     StressRenderModeType stressRenderMode,
     Geometry::ShipAABBSet & externalAabbSet, // output
     ThreadManager & threadManager,
     PerfStats & perfStats)
 {
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const updateStartTimestamp = GameChronometer::Now();
-#endif
+    FS_PROFILE_ZONE("Ship::Update");
 
     /////////////////////////////////////////////////////////////////
     //         This is where most of the magic happens             //
@@ -302,22 +306,16 @@ void Ship::Update(
     // and ocean floor collision handling
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto startTimestamp1 = GameChronometer::Now();
-#endif
-
     {
+        FS_PROFILE_ZONE("Ship::RunSpringRelaxation");
+
         auto const springsStartTime = GameChronometer::Now();
 
-        RunSpringRelaxation(threadManager, simulationParameters);
+        RunSpringRelaxation(threadManager, simulationParameters, perfStats);
 
         perfStats.Update<PerfMeasurement::TotalShipsSpringsUpdate>(GameChronometer::Now() - springsStartTime);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedSpringRelaxation = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////////////////////////////////////////
     // Produce silt clouds, if any
     ///////////////////////////////////////////////////////////////////
@@ -358,22 +356,18 @@ void Ship::Update(
         mPoints.ResetStress();
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    // - Inputs: P.Position, S.SpringDeletion, S.RestLength, S.BreakingElongation
-    // - Outputs: S.Destroy(), P.Stress, S.CachedVectorialInfo
-    // - Fires events, updates frontiers
-    mSprings.UpdateForStrainsAndCacheSpringVectors(
-        currentSimulationTime,
-        simulationParameters,
-        mPoints,
-        stressRenderMode);
+    {
+        FS_PROFILE_ZONE("Ship::UpdateForStrains");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateForStress = GameChronometer::Now() - startTimestamp1;
-#endif
+        // - Inputs: P.Position, S.SpringDeletion, S.RestLength, S.BreakingElongation
+        // - Outputs: S.Destroy(), P.Stress, S.CachedVectorialInfo
+        // - Fires events, updates frontiers
+        mSprings.UpdateForStrainsAndCacheSpringVectors(
+            currentSimulationTime,
+            simulationParameters,
+            mPoints,
+            stressRenderMode);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Apply world forces
@@ -384,20 +378,17 @@ void Ship::Update(
     // geometric centers - hence needs to come _after _ UpdateForStrains().
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    ApplyWorldForces(
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        currentSimulationTime,
-        simulationParameters,
-        externalAabbSet);
+    {
+        FS_PROFILE_ZONE("Ship::ApplyWorldForces");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedWorldForces = GameChronometer::Now() - startTimestamp1;
-#endif
+        ApplyWorldForces(
+            effectiveAirDensity,
+            effectiveWaterDensity,
+            currentSimulationTime,
+            simulationParameters,
+            externalAabbSet,
+            threadManager.GetSimulationThreadPool());
+    }
 
     // Cached depths are valid from now on --------------------------->
 
@@ -406,17 +397,19 @@ void Ship::Update(
     // step
     ///////////////////////////////////////////////////////////////////
 
-    ApplyQueuedInteractionForces(simulationParameters);
+    {
+        FS_PROFILE_ZONE("Ship::ApplyQueuedInteractionForces");
+
+        ApplyQueuedInteractionForces(
+            simulationParameters,
+            threadManager.GetSimulationThreadPool());
+    }
 
 
     ///////////////////////////////////////////////////////////////////
     // Decay points
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     // - Inputs: Position, Water, IsLeaking
     // - Output: Decay
 
@@ -449,21 +442,21 @@ void Ship::Update(
             simulationParameters);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedDecayPoints = GameChronometer::Now() - startTimestamp1;
-#endif
-
     /////////////////////////////////////////////////////////////////
     // Update gadgets
     /////////////////////////////////////////////////////////////////
 
     // Might cause explosions; might cause elements to be detached/destroyed
     // (which would flag our structure as dirty)
-    mGadgets.Update(
-        currentWallClockTime,
-        currentSimulationTime,
-        stormParameters,
-        simulationParameters);
+    {
+        FS_PROFILE_ZONE("Ship::UpdateGadgets");
+
+        mGadgets.Update(
+            currentWallClockTime,
+            currentSimulationTime,
+            stormParameters,
+            simulationParameters);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Update state machines - may generate ephemeral particles
@@ -471,21 +464,23 @@ void Ship::Update(
 
     // - Outputs:   Non-spring forces, temperature
     //              Point Detach, Debris generation
-    UpdateStateMachines(currentSimulationTime, simulationParameters);
+    {
+        FS_PROFILE_ZONE("Ship::UpdateStateMachines");
+
+        UpdateStateMachines(currentSimulationTime, simulationParameters);
+    }
 
     /////////////////////////////////////////////////////////////////
     // Update water dynamics - may generate ephemeral particles
     /////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     //
     // Update intake of pressure and water
     //
 
     {
+        FS_PROFILE_ZONE("Ship::UpdatePressureAndWaterInflow");
+
         float waterTakenInStep = 0.f;
 
         // - Inputs: P.Position, P.Water, P.IsLeaking, P.Temperature, P.PlaneId
@@ -497,27 +492,17 @@ void Ship::Update(
             currentSimulationTime,
             stormParameters,
             simulationParameters,
+            threadManager.GetSimulationThreadPool(),
             waterTakenInStep);
 
         // Notify intaken water
         mSimulationEventHandler.OnWaterTaken(waterTakenInStep);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedWaterDynamics = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////
     // Parallel run 1 START
     ///////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    GameChronometer::duration elapsedWaterDiffusion;
-    GameChronometer::duration elapsedEqualizeInternalPressure;
-    GameChronometer::duration elapsedStaticPressure;
-    GameChronometer::duration elapsedHeatPropagation;
-#endif
-
     assert(parallelTasks.empty());
 
     parallelTasks.emplace_back(
@@ -527,9 +512,7 @@ void Ship::Update(
             // Diffuse water (Cost: 14)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            auto startTimestamp2 = GameChronometer::Now();
-#endif
+            FS_PROFILE_ZONE("Ship::UpdateWaterVelocities");
 
             float waterSplashedInStep = 0.f;
 
@@ -539,10 +522,6 @@ void Ship::Update(
 
             // Notify
             mSimulationEventHandler.OnWaterSplashed(waterSplashedInStep);
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedWaterDiffusion = GameChronometer::Now() - startTimestamp2;
-#endif
         });
 
     parallelTasks.emplace_back(
@@ -552,76 +531,70 @@ void Ship::Update(
             // Equalize internal pressure (Cost: 1.5)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            auto startTimestamp2 = GameChronometer::Now();
-#endif
-
-            // - Inputs: InternalPressure, ConnectedSprings
-            // - Outpus: InternalPressure
-            EqualizeInternalPressure(simulationParameters);
+            {
+                FS_PROFILE_ZONE("Ship::EqualizeInternalPressure");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedEqualizeInternalPressure = GameChronometer::Now() - startTimestamp2;
-#endif
+                // - Inputs: InternalPressure, ConnectedSprings
+                // - Outpus: InternalPressure
+                EqualizeInternalPressure(simulationParameters);
+            }
 
             //
-            // Apply static pressure forces (Cost: 10)
+            // Propagate heat (Cost: 4)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            startTimestamp2 = GameChronometer::Now();
-#endif
-
-            if (simulationParameters.StaticPressureForceAdjustment > 0.0f)
             {
-                // - Inputs: frontiers, P.Position, P.InternalPressure
-                // - Outputs: P.DynamicForces
-                ApplyStaticPressureForces(
-                    effectiveAirDensity,
-                    effectiveWaterDensity,
+                FS_PROFILE_ZONE("Ship::PropagateHeat");
+
+                // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
+                // - Outputs: P.Temperature
+                PropagateHeat(
+                    currentSimulationTime,
+                    SimulationParameters::SimulationStepTimeDuration<float>,
+                    stormParameters,
                     simulationParameters);
             }
+        });
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedStaticPressure = GameChronometer::Now() - startTimestamp2;
-#endif
-
-            //
-            // Propagate heat (Cost: 4)
-            //
+    threadManager.GetSimulationThreadPool().RunAndClear(parallelTasks);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            startTimestamp2 = GameChronometer::Now();
-#endif
+    ///////////////////////////////
+    // Parallel run 1 END
+    ///////////////////////////////
 
-            // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
-            // - Outputs: P.Temperature
-            PropagateHeat(
-                currentSimulationTime,
-                SimulationParameters::SimulationStepTimeDuration<float>,
-                stormParameters,
-                simulationParameters);
+    //
+    // Apply static pressure forces (Cost: 10)
+    //
+    // Needs internal pressure to be equalized; runs on its own as it
+    // shards frontiers across the pool
+    //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedHeatPropagation = GameChronometer::Now() - startTimestamp2;
-#endif
-        });
+    if (simulationParameters.StaticPressureForceAdjustment > 0.0f)
+    {
+        FS_PROFILE_ZONE("Ship::ApplyStaticPressureForces");
 
-    threadManager.GetSimulationThreadPool().RunAndClear(parallelTasks);
+        // - Inputs: frontiers, P.Position, P.InternalPressure
+        // - Outputs: P.DynamicForces
+        ApplyStaticPressureForces(
+            effectiveAirDensity,
+            effectiveWaterDensity,
+            simulationParameters,
+            threadManager.GetSimulationThreadPool());
+    }
+    else
+    {
+        // No stats
+        mStaticPressureNetForceMagnitudeSum = 0.0f;
+        mStaticPressureNetForceMagnitudeCount = 0.0f;
+        mStaticPressureIterationsPercentagesSum = 0.0f;
+        mStaticPressureIterationsCount = 0.0f;
+    }
 
     // Publish static pressure stats
     mSimulationEventHandler.OnStaticPressureUpdated(
         mStaticPressureNetForceMagnitudeCount != 0.0f ? mStaticPressureNetForceMagnitudeSum / mStaticPressureNetForceMagnitudeCount : 0.0f,
         mStaticPressureIterationsCount != 0.0f ? mStaticPressureIterationsPercentagesSum / mStaticPressureIterationsCount : 0.0f);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedParallel1 = GameChronometer::Now() - startTimestamp1;
-#endif
-
-    ///////////////////////////////
-    // Parallel run 1 END
-    ///////////////////////////////
-
     //
     // Run sinking/unsinking detection
     //
@@ -642,44 +615,40 @@ void Ship::Update(
     // Generate a new visit sequence number
     ++mCurrentElectricalVisitSequenceNumber;
 
-    mElectricalElements.Update(
-        currentWallClockTime,
-        currentSimulationTime,
-        mCurrentElectricalVisitSequenceNumber,
-        mPoints,
-        mSprings,
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        stormParameters,
-        simulationParameters);
+    {
+        FS_PROFILE_ZONE("Ship::UpdateElectricalElements");
+
+        mElectricalElements.Update(
+            currentWallClockTime,
+            currentSimulationTime,
+            mCurrentElectricalVisitSequenceNumber,
+            mPoints,
+            mSprings,
+            effectiveAirDensity,
+            effectiveWaterDensity,
+            stormParameters,
+            simulationParameters);
+    }
 
     //
     // Diffuse light
     //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    // - Inputs: P.Position, P.PlaneId, EL.AvailableLight
-    //      - EL.AvailableLight depends on electricals which depend on water
-    // - Outputs: P.Light
-    DiffuseLight(
-        simulationParameters,
-        threadManager);
+    {
+        FS_PROFILE_ZONE("Ship::DiffuseLight");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedLightDiffusion = GameChronometer::Now() - startTimestamp1;
-#endif
+        // - Inputs: P.Position, P.PlaneId, EL.AvailableLight
+        //      - EL.AvailableLight depends on electricals which depend on water
+        // - Outputs: P.Light
+        DiffuseLight(
+            simulationParameters,
+            threadManager);
+    }
 
     //
     // Update slow combustion state machine
     //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
         mPoints.UpdateCombustionLowFrequency(
@@ -725,16 +694,16 @@ void Ship::Update(
     // Update fast combustion state machine
     //
 
-    mPoints.UpdateCombustionHighFrequency(
-        currentSimulationTime,
-        SimulationParameters::SimulationStepTimeDuration<float>,
-        mParentWorld.GetCurrentWindSpeed(),
-        mParentWorld.GetCurrentRadialWindField(),
-        simulationParameters);
+    {
+        FS_PROFILE_ZONE("Ship::UpdateCombustionHighFrequency");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedCombustion = GameChronometer::Now() - startTimestamp1;
-#endif
+        mPoints.UpdateCombustionHighFrequency(
+            currentSimulationTime,
+            SimulationParameters::SimulationStepTimeDuration<float>,
+            mParentWorld.GetCurrentWindSpeed(),
+            mParentWorld.GetCurrentRadialWindField(),
+            simulationParameters);
+    }
 
     //
     // Update highlights
@@ -752,10 +721,6 @@ void Ship::Update(
     // Update spring parameters
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
         mSprings.UpdateForDecayAndTemperature(
@@ -781,25 +746,20 @@ void Ship::Update(
             mPoints);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateSpringParameters = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////////////////////////////////////////
     // Update ephemeral particles
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    mPoints.UpdateEphemeralParticles(
-        currentSimulationTime,
-        simulationParameters);
+    {
+        FS_PROFILE_ZONE("Ship::UpdateEphemeralParticles");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateEphemeralParticles = GameChronometer::Now() - startTimestamp1;
-#endif
+        mPoints.UpdateEphemeralParticles(
+            currentSimulationTime,
+            visibleWorld,
+            threadManager.GetSimulationThreadPool(),
+            simulationParameters,
+            perfStats);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Update cleanup
@@ -820,80 +780,6 @@ void Ship::Update(
     VerifyInvariants();
 
 #endif
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const updateEndTimestamp = GameChronometer::Now();
-
-    static std::chrono::microseconds springRelaxationTotal{0};
-    static std::chrono::microseconds updateForStressTotal{0};
-    static std::chrono::microseconds decayPointsTotal{0};
-    static std::chrono::microseconds worldForcesTotal{0};
-    static std::chrono::microseconds waterDynamicsTotal{0};
-    static std::chrono::microseconds parallel1Total{0};
-    static std::chrono::microseconds lightDiffusionTotal{0};
-    static std::chrono::microseconds combustionTotal{0};
-    static std::chrono::microseconds updateSpringParametersTotal{0};
-    static std::chrono::microseconds waterDiffusionTotal{0};
-    static std::chrono::microseconds equalizeInternalPressureTotal{0};
-    static std::chrono::microseconds staticPressureTotal{0};
-    static std::chrono::microseconds heatPropagationTotal{0};
-    static std::chrono::microseconds ephemeralParticlesTotal{0};
-    static std::chrono::microseconds totalUpdateTotal{0};
-    static int profilingFrameCounter = 0;
-
-    springRelaxationTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedSpringRelaxation);
-    updateForStressTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateForStress);
-    decayPointsTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedDecayPoints);
-    worldForcesTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWorldForces);
-    waterDynamicsTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWaterDynamics);
-    parallel1Total += std::chrono::duration_cast<std::chrono::microseconds>(elapsedParallel1);
-    lightDiffusionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedLightDiffusion);
-    combustionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedCombustion);
-    updateSpringParametersTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateSpringParameters);
-    waterDiffusionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWaterDiffusion);
-    equalizeInternalPressureTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedEqualizeInternalPressure);
-    staticPressureTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedStaticPressure);
-    heatPropagationTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedHeatPropagation);
-    ephemeralParticlesTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateEphemeralParticles);
-    totalUpdateTotal += std::chrono::duration_cast<std::chrono::microseconds>(updateEndTimestamp - updateStartTimestamp);
-    ++profilingFrameCounter;
-
-    if (0 == (profilingFrameCounter % 40))
-    {
-        LogMessage("*** Ship update: springRelax=", springRelaxationTotal.count() / profilingFrameCounter / 1000.0f,
-                   " updateForStress=", updateForStressTotal.count() / profilingFrameCounter / 1000.0f,
-                   " decayPoints=", decayPointsTotal.count() / profilingFrameCounter / 1000.0f,
-                   " worldForces=", worldForcesTotal.count() / profilingFrameCounter / 1000.0f,
-                   " waterDynamics=", waterDynamicsTotal.count() / profilingFrameCounter / 1000.0f,
-                   " parallel1=", parallel1Total.count() / profilingFrameCounter / 1000.0f,
-                   " (waterDiffusion=", waterDiffusionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " equalizeInternalPressure=", equalizeInternalPressureTotal.count() / profilingFrameCounter / 1000.0f,
-                   " staticPressure=", staticPressureTotal.count() / profilingFrameCounter / 1000.0f,
-                   " heatPropagation=", heatPropagationTotal.count() / profilingFrameCounter / 1000.0f, ")",
-                   " lightDiffusion=", lightDiffusionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " combustion=", combustionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " updateSpringParameters=", updateSpringParametersTotal.count() / profilingFrameCounter / 1000.0f,
-                   " ephemeralParticles=", ephemeralParticlesTotal.count() / profilingFrameCounter / 1000.0f,
-                   " total: ", totalUpdateTotal.count() / profilingFrameCounter / 1000.0f, "ms");
-
-        springRelaxationTotal = std::chrono::microseconds(0);
-        updateForStressTotal = std::chrono::microseconds(0);
-        decayPointsTotal = std::chrono::microseconds(0);
-        worldForcesTotal = std::chrono::microseconds(0);
-        waterDynamicsTotal = std::chrono::microseconds(0);
-        parallel1Total = std::chrono::microseconds(0);
-        lightDiffusionTotal = std::chrono::microseconds(0);
-        combustionTotal = std::chrono::microseconds(0);
-        updateSpringParametersTotal = std::chrono::microseconds(0);
-        waterDiffusionTotal = std::chrono::microseconds(0);
-        equalizeInternalPressureTotal = std::chrono::microseconds(0);
-        staticPressureTotal = std::chrono::microseconds(0);
-        heatPropagationTotal = std::chrono::microseconds(0);
-        ephemeralParticlesTotal = std::chrono::microseconds(0);
-        totalUpdateTotal = std::chrono::microseconds(0);
-        profilingFrameCounter = 0;
-    }
-#endif
 }
 
 void Ship::UpdateEnd()
@@ -914,6 +800,8 @@ void Ship::UpdateEnd()
 
 void Ship::RenderUpload(RenderContext & renderContext)
 {
+    FS_PROFILE_ZONE("Ship::RenderUpload");
+
     //
     // Run all tasks that need to run when connectivity has changed
     // (i.e. when the connected components have changed, e.g. because
@@ -1174,29 +1062,38 @@ void Ship::Finalize()
 // Mechanical Dynamics
 ///////////////////////////////////////////////////////////////////////////////////
 
-void Ship::ApplyQueuedInteractionForces(SimulationParameters const & simulationParameters)
+void Ship::ApplyQueuedInteractionForces(
+    SimulationParameters const & simulationParameters,
+    ThreadPool & simulationThreadPool)
 {
+    //
+    // Single-point interactions are applied right away, while field
+    // interactions are prepared for being applied all at once
+    //
+
+    assert(mInteractionFields.IsEmpty());
+
     for (auto const & interaction : mQueuedInteractions)
     {
         switch (interaction.Type)
         {
             case Interaction::InteractionType::AntiGravityField:
             {
-                ApplyAntiGravityField(interaction.Arguments.AntiGravityField, simulationParameters);
+                PrepareAntiGravityField(interaction.Arguments.AntiGravityField, simulationParameters);
 
                 break;
             }
 
             case Interaction::InteractionType::Blast:
             {
-                ApplyBlastAt(interaction.Arguments.Blast, simulationParameters);
+                PrepareBlastField(interaction.Arguments.Blast);
 
                 break;
             }
 
             case Interaction::InteractionType::Draw:
             {
-                DrawTo(interaction.Arguments.Draw);
+                PrepareDrawField(interaction.Arguments.Draw);
 
                 break;
             }
@@ -1210,14 +1107,14 @@ void Ship::ApplyQueuedInteractionForces(SimulationParameters const & simulationP
 
             case Interaction::InteractionType::Swirl:
             {
-                SwirlAt(interaction.Arguments.Swirl);
+                PrepareSwirlField(interaction.Arguments.Swirl);
 
                 break;
             }
 
             case Interaction::InteractionType::Tornado:
             {
-                ApplyTornado(interaction.Arguments.Tornado, simulationParameters);
+                PrepareTornadoField(interaction.Arguments.Tornado, simulationParameters);
 
                 break;
             }
@@ -1225,6 +1122,13 @@ void Ship::ApplyQueuedInteractionForces(SimulationParameters const & simulationP
     }
 
     mQueuedInteractions.clear();
+
+    if (!mInteractionFields.IsEmpty())
+    {
+        ApplyInteractionFields(simulationThreadPool);
+
+        mInteractionFields.Clear();
+    }
 }
 
 void Ship::ApplyWorldForces(
@@ -1232,7 +1136,8 @@ void Ship::ApplyWorldForces(
     float effectiveWaterDensity,
     float currentSimulationTime,
     SimulationParameters const & simulationParameters,
-    Geometry::ShipAABBSet & externalAabbSet) // output
+    Geometry::ShipAABBSet & externalAabbSet, // output
+    ThreadPool & simulationThreadPool)
 {
     // New buffer to which new cached depths will be written to
     std::shared_ptr<Buffer<float>> newCachedPointDepths = mPoints.AllocateWorkBufferFloat();
@@ -1241,16 +1146,16 @@ void Ship::ApplyWorldForces(
     // Particle forces
     //
 
-    ApplyWorldParticleForces(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, simulationParameters);
+    ApplyWorldParticleForces(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, simulationParameters, simulationThreadPool);
 
     //
     // Surface forces
     //
 
     if (simulationParameters.DoDisplaceWater)
-        ApplyWorldSurfaceForces<true>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, currentSimulationTime, simulationParameters, externalAabbSet);
+        ApplyWorldSurfaceForces<true>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, currentSimulationTime, simulationParameters, externalAabbSet, simulationThreadPool);
     else
-        ApplyWorldSurfaceForces<false>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, currentSimulationTime, simulationParameters, externalAabbSet);
+        ApplyWorldSurfaceForces<false>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, currentSimulationTime, simulationParameters, externalAabbSet, simulationThreadPool);
 
     // Commit new particle depth buffer
     mPoints.SwapCachedDepthBuffer(*newCachedPointDepths);
@@ -1260,43 +1165,72 @@ void Ship::ApplyWorldParticleForces(
     float effectiveAirDensity,
     float effectiveWaterDensity,
     Buffer<float> & newCachedPointDepths,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadPool & simulationThreadPool)
 {
+    //
+    // Prepare the inputs shared by all tasks
+    //
+
+    mWorldParticleForcesState.EffectiveAirDensity = effectiveAirDensity;
+    mWorldParticleForcesState.EffectiveWaterDensity = effectiveWaterDensity;
+
     // Global wind force
-    vec2f const globalWindForce = Formulae::WindSpeedToForceDensity(
+    mWorldParticleForcesState.GlobalWindForce = Formulae::WindSpeedToForceDensity(
         Conversions::KmhToMs(mParentWorld.GetCurrentWindSpeed()),
         effectiveAirDensity);
 
     // Abovewater points feel this amount of air drag, due to friction
-    float const airFrictionDragCoefficient =
+    mWorldParticleForcesState.AirFrictionDragCoefficient =
         SimulationParameters::AirFrictionDragCoefficient
         * simulationParameters.AirFrictionDragAdjustment;
 
     // Underwater points feel this amount of water drag, due to friction
-    float const waterFrictionDragCoefficient =
+    mWorldParticleForcesState.WaterFrictionDragCoefficient =
         SimulationParameters::WaterFrictionDragCoefficient
         * simulationParameters.WaterFrictionDragAdjustment;
 
+    mWorldParticleForcesState.NewCachedPointDepths = newCachedPointDepths.data();
+
+    //
+    // Run tasks; each point is independent from all others, hence the
+    // outcome does not depend on the sharding
+    //
+
+    simulationThreadPool.Run(mWorldParticleForcesTasks);
+}
+
+void Ship::ApplyWorldParticleForces(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    float const effectiveAirDensity = mWorldParticleForcesState.EffectiveAirDensity;
+    float const effectiveWaterDensity = mWorldParticleForcesState.EffectiveWaterDensity;
+    vec2f const globalWindForce = mWorldParticleForcesState.GlobalWindForce;
+    float const airFrictionDragCoefficient = mWorldParticleForcesState.AirFrictionDragCoefficient;
+    float const waterFrictionDragCoefficient = mWorldParticleForcesState.WaterFrictionDragCoefficient;
+
     OceanSurface const & oceanSurface = mParentWorld.GetOceanSurface();
 
-    float * const restrict newCachedPointDepthsBuffer = newCachedPointDepths.data();
+    float * const restrict newCachedPointDepthsBuffer = mWorldParticleForcesState.NewCachedPointDepths;
     vec2f * const restrict staticForcesBuffer = mPoints.GetStaticForceBufferAsVec2();
 
     //
-    // 1. Various world forces
+    // 1. Calculate and store depths, in batches
     //
 
-    for (auto pointIndex : mPoints)
-    {
-        auto const & pointPosition = mPoints.GetPosition(pointIndex);
-
-        vec2f staticForce = vec2f::zero();
+    oceanSurface.GetDepths(
+        mPoints.GetPositionBufferAsVec2() + startPointIndex,
+        newCachedPointDepthsBuffer + startPointIndex,
+        endPointIndex - startPointIndex);
 
-        //
-        // Calculate and store depth
-        //
+    //
+    // 2. Various world forces
+    //
 
-        newCachedPointDepthsBuffer[pointIndex] = oceanSurface.GetDepth(pointPosition);
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
+    {
+        vec2f staticForce = vec2f::zero();
 
         //
         // Calculate above/under-water coefficient
@@ -1360,13 +1294,13 @@ void Ship::ApplyWorldParticleForces(
     }
 
     //
-    // 2. Radial wind field, if any
+    // 3. Radial wind field, if any
     //
 
     auto const & radialWindField = mParentWorld.GetCurrentRadialWindField();
     if (radialWindField.has_value())
     {
-        for (auto pointIndex : mPoints)
+        for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
         {
             // Only above-water points
             if (newCachedPointDepthsBuffer[pointIndex] <= 0.0f)
@@ -1401,6 +1335,46 @@ void Ship::ApplyWorldParticleForces(
     }
 }
 
+void Ship::CalculateFrontierShards(size_t maxShardCount)
+{
+    //
+    // Split the frontiers into contiguous ranges, in frontier ID order, balanced
+    // by their number of edges; we only split when there are enough edges for
+    // each shard to be worth its dispatch
+    //
+
+    auto const & frontierIds = mFrontiers.GetFrontierIds();
+
+    size_t totalEdgeCount = 0;
+    for (FrontierId const frontierId : frontierIds)
+    {
+        totalEdgeCount += mFrontiers.GetFrontier(frontierId).Size;
+    }
+
+    size_t constexpr MinFrontierEdgesPerShard = 512;
+
+    size_t const shardCount = std::max(
+        std::min(maxShardCount, totalEdgeCount / MinFrontierEdgesPerShard),
+        size_t(1));
+
+    mFrontierShardBoundaries.clear();
+    mFrontierShardBoundaries.push_back(0);
+
+    size_t edgeCount = 0;
+    for (size_t f = 0; f < frontierIds.size() && mFrontierShardBoundaries.size() < shardCount; ++f)
+    {
+        edgeCount += mFrontiers.GetFrontier(frontierIds[f]).Size;
+
+        // Close this shard once it has reached its share of edges
+        if (edgeCount * shardCount >= totalEdgeCount * mFrontierShardBoundaries.size())
+        {
+            mFrontierShardBoundaries.push_back(f + 1);
+        }
+    }
+
+    mFrontierShardBoundaries.push_back(frontierIds.size());
+}
+
 template<bool DoDisplaceWater>
 void Ship::ApplyWorldSurfaceForces(
     float effectiveAirDensity,
@@ -1408,10 +1382,9 @@ void Ship::ApplyWorldSurfaceForces(
     Buffer<float> & newCachedPointDepths,
     float currentSimulationTime,
     SimulationParameters const & simulationParameters,
-    Geometry::ShipAABBSet & externalAabbSet) // output
+    Geometry::ShipAABBSet & externalAabbSet, // output
+    ThreadPool & simulationThreadPool)
 {
-    float totalWaterDisplacementMagnitude = 0.0f;
-
     //
     // Drag constants
     //
@@ -1461,34 +1434,6 @@ void Ship::ApplyWorldSurfaceForces(
         ? 0.065f / simulationParameters.WaterFoamSensitivityAdjustment // Magic
         : std::numeric_limits<float>::max();
 
-    struct WaterFoam
-    {
-        vec2f Position;
-        float VerticalDirection;
-        float Strength;
-        PlaneId Plane;
-
-        WaterFoam()
-            : Position()
-            , VerticalDirection(0.0f)
-            , Strength(0.0f)
-            , Plane(NonePlaneId)
-        { }
-
-        WaterFoam(
-            vec2f const & position,
-            float verticalDirection,
-            float strength,
-            PlaneId plane)
-            : Position(position)
-            , VerticalDirection(verticalDirection)
-            , Strength(strength)
-            , Plane(plane)
-        { }
-    };
-
-    WaterFoam strongestWaterFoam;
-
     //
     // Water splashes
     //
@@ -1497,36 +1442,6 @@ void Ship::ApplyWorldSurfaceForces(
         ? 0.2f / simulationParameters.WaterSplashSensitivityAdjustment // Magic
         : std::numeric_limits<float>::max();
 
-    struct WaterSplash
-    {
-        vec2f Position;
-        vec2f SpawnDirection;
-        float Strength;
-        PlaneId Plane;
-
-        WaterSplash()
-            : Position()
-            , SpawnDirection()
-            , Strength(0.0f)
-            , Plane(NonePlaneId)
-        {
-        }
-
-        WaterSplash(
-            vec2f const & position,
-            vec2f const & spawnDirection,
-            float strength,
-            PlaneId plane)
-            : Position(position)
-            , SpawnDirection(spawnDirection)
-            , Strength(strength)
-            , Plane(plane)
-        {
-        }
-    };
-
-    WaterSplash strongestWaterSplash;
-
     //
     // Lift: Cl * rho * V^2 * A / 2
     //
@@ -1545,388 +1460,473 @@ void Ship::ApplyWorldSurfaceForces(
         * simulationParameters.LiftForceAdjustment;
 
     //
-    // Visit all frontiers
+    // Visit all frontiers, in shards
+    //
+    // Frontiers are independent of each other, except for sharing points and
+    // the ocean surface; each shard hence accumulates its point forces and ocean
+    // surface displacements in its own task state, and we apply them afterwards
+    // in shard order - i.e. in the same order as a serial visit would
     //
 
-    for (FrontierId frontierId : mFrontiers.GetFrontierIds())
+    auto const visitFrontiers = [&](size_t startFrontierOrdinal, size_t endFrontierOrdinal, WorldSurfaceForcesTaskState & taskState)
     {
-        // Initialize AABB and geometric center
-        Geometry::ShipAABB aabb;
-        vec2f geometricCenter = vec2f::zero();
-
-        auto & frontier = mFrontiers.GetFrontier(frontierId);
+        auto const & frontierIds = mFrontiers.GetFrontierIds();
 
-        // We only apply velocity drag and lift, and displace water for *external* frontiers,
-        // not for internal ones
-        if (frontier.Type == FrontierType::External)
+        for (size_t f = startFrontierOrdinal; f < endFrontierOrdinal; ++f)
         {
-            //
-            // Visit all edges of this frontier
-            //
+            FrontierId const frontierId = frontierIds[f];
 
-            assert(frontier.Size >= 3);
+            // Initialize AABB and geometric center
+            Geometry::ShipAABB aabb;
+            vec2f geometricCenter = vec2f::zero();
 
-            ElementIndex const startEdgeIndex = frontier.StartingEdgeIndex;
+            auto & frontier = mFrontiers.GetFrontier(frontierId);
 
-            // Take previous point
-            auto const & previousFrontierEdge = mFrontiers.GetFrontierEdge(startEdgeIndex);
-            vec2f previousPointPosition = mPoints.GetPosition(previousFrontierEdge.PointAIndex);
+            // We only apply velocity drag and lift, and displace water for *external* frontiers,
+            // not for internal ones
+            if (frontier.Type == FrontierType::External)
+            {
+                //
+                // Visit all edges of this frontier
+                //
 
-            // Take this point
-            auto const & thisFrontierEdge = mFrontiers.GetFrontierEdge(previousFrontierEdge.NextEdgeIndex);
-            ElementIndex thisPointIndex = thisFrontierEdge.PointAIndex;
-            vec2f thisPointPosition = mPoints.GetPosition(thisPointIndex);
+                assert(frontier.Size >= 3);
 
-#ifdef _DEBUG
-            size_t visitedPoints = 0;
-#endif
+                ElementIndex const startEdgeIndex = frontier.StartingEdgeIndex;
 
-            ElementIndex const edgeVisitStartEdgeIndex = thisFrontierEdge.NextEdgeIndex;
+                // Take previous point
+                auto const & previousFrontierEdge = mFrontiers.GetFrontierEdge(startEdgeIndex);
+                vec2f previousPointPosition = mPoints.GetPosition(previousFrontierEdge.PointAIndex);
 
-            for (ElementIndex nextEdgeIndex = edgeVisitStartEdgeIndex; /*checked in loop*/; /*advanced in loop*/)
-            {
+                // Take this point
+                auto const & thisFrontierEdge = mFrontiers.GetFrontierEdge(previousFrontierEdge.NextEdgeIndex);
+                ElementIndex thisPointIndex = thisFrontierEdge.PointAIndex;
+                vec2f thisPointPosition = mPoints.GetPosition(thisPointIndex);
 
 #ifdef _DEBUG
-                ++visitedPoints;
+                size_t visitedPoints = 0;
 #endif
 
-                // Update AABB and geometric center with this point
-                aabb.ExtendTo(thisPointPosition);
-                geometricCenter += thisPointPosition;
+                ElementIndex const edgeVisitStartEdgeIndex = thisFrontierEdge.NextEdgeIndex;
 
-                // Get next edge and point
-                auto const & nextFrontierEdge = mFrontiers.GetFrontierEdge(nextEdgeIndex);
-                ElementIndex const nextPointIndex = nextFrontierEdge.PointAIndex;
-                vec2f const nextPointPosition = mPoints.GetPosition(nextPointIndex);
+                for (ElementIndex nextEdgeIndex = edgeVisitStartEdgeIndex; /*checked in loop*/; /*advanced in loop*/)
+                {
 
-                // Get point depth (positive at greater depths, negative over-water)
-                float const thisPointDepth = newCachedPointDepths[thisPointIndex];
+#ifdef _DEBUG
+                    ++visitedPoints;
+#endif
 
-                // UW coefficient: 0.0 if point in air, 1.0 if under water, smooth in-between
-                float const uwCoefficient = Clamp(thisPointDepth, 0.0f, 1.0f);
+                    // Update AABB and geometric center with this point
+                    aabb.ExtendTo(thisPointPosition);
+                    geometricCenter += thisPointPosition;
 
-                // Get point velocity
-                vec2f const thisPointVelocity = mPoints.GetVelocity(thisPointIndex);
+                    // Get next edge and point
+                    auto const & nextFrontierEdge = mFrontiers.GetFrontierEdge(nextEdgeIndex);
+                    ElementIndex const nextPointIndex = nextFrontierEdge.PointAIndex;
+                    vec2f const nextPointPosition = mPoints.GetPosition(nextPointIndex);
 
-                // Edge direction - calculated between p1 and p3
-                vec2f const edgeDir = (nextPointPosition - previousPointPosition).normalise();
+                    // Get point depth (positive at greater depths, negative over-water)
+                    float const thisPointDepth = newCachedPointDepths[thisPointIndex];
 
-                // Magnitude of the edge velocity along the edge; positive when following
-                // frontier's CW order, zero when perpendicular to edge
-                float const edgeVelocityAlongEdge = thisPointVelocity.dot(edgeDir);
+                    // UW coefficient: 0.0 if point in air, 1.0 if under water, smooth in-between
+                    float const uwCoefficient = Clamp(thisPointDepth, 0.0f, 1.0f);
 
-                // Normal to edge - calculated between p1 and p3; points outside
-                vec2f const edgeNormal = edgeDir.to_perpendicular();
+                    // Get point velocity
+                    vec2f const thisPointVelocity = mPoints.GetVelocity(thisPointIndex);
 
-                // Magnitude of the edge velocity along the edge normal; positive when pointing out,
-                // zero when parallel to edge
-                float const edgeVelocityAlongEdgeNormal = thisPointVelocity.dot(edgeNormal);
+                    // Edge direction - calculated between p1 and p3
+                    vec2f const edgeDir = (nextPointPosition - previousPointPosition).normalise();
 
-                //
-                // Drag force
-                //
-                // We would like to use a square law (i.e. drag force proportional to square
-                // of velocity), but then particles at high velocities become subject to
-                // enormous forces, which, for small masses - such as cloth - mean astronomical
-                // accelerations.
-                //
-                // We have to recourse then, again, to a linear law:
-                //
-                // F = - C * |V| * cos(a) * Nn
-                //
-                //      cos(a) == cos(angle between velocity and surface normal) == Vn dot Nn
-                //
-                // With this law, a particle's velocity is overcome by the drag force when its
-                // mass is <= C * dt, i.e. ~78Kg with water drag. Since this mass we do have in our sytem,
-                // we have to cap the force to prevent velocity overcome.
-                //
+                    // Magnitude of the edge velocity along the edge; positive when following
+                    // frontier's CW order, zero when perpendicular to edge
+                    float const edgeVelocityAlongEdge = thisPointVelocity.dot(edgeDir);
 
-                // Cap it to the same direction as velocity, to avoid suction force
-                // (i.e. drag force attracting surface facing opposite of velocity)
-                float const edgeVelocityCapped = std::max(
-                    edgeVelocityAlongEdgeNormal,
-                    0.0f);
-
-                // Max drag force magnitude: m * (V dot Nn) / dt
-                float const maxDragForceMagnitude =
-                    mPoints.GetMass(thisPointIndex) * edgeVelocityCapped
-                    / SimulationParameters::SimulationStepTimeDuration<float>;
-
-                // Calculate drag coefficient: air or water, with soft transition
-                // to avoid discontinuities in drag force close to the air-water interface
-                float const dragCoefficient = Mix(
-                    airPressureDragCoefficient,
-                    waterPressureDragCoefficient,
-                    uwCoefficient);
-
-                // Calculate magnitude of drag force (opposite sign), capped by max drag force
-                //  - C * |V| * cos(a) == - C * |V| * (Vn dot Nn) == -C * (V dot Nn)
-                float const dragForceMagnitude = std::min(
-                    dragCoefficient * edgeVelocityCapped,
-                    maxDragForceMagnitude);
+                    // Normal to edge - calculated between p1 and p3; points outside
+                    vec2f const edgeNormal = edgeDir.to_perpendicular();
 
-                //
-                // Impact force
-                //
-                // Impact force is proportional to kinetic energy, and we only apply it
-                // when there's a discontinuity in the "underwaterness" of a frontier
-                // particle, i.e. when this is the first frame in which the particle
-                // gets underwater.
-                //
-                // For the impact force we consider the particle's velocity projection
-                // along the normal to the ocean surface at this point
-                //
+                    // Magnitude of the edge velocity along the edge normal; positive when pointing out,
+                    // zero when parallel to edge
+                    float const edgeVelocityAlongEdgeNormal = thisPointVelocity.dot(edgeNormal);
 
-                float const pointVelocityMagnitude = thisPointVelocity.length();
-                vec2f const pushDir = thisPointVelocity.normalise(pointVelocityMagnitude);
+                    //
+                    // Drag force
+                    //
+                    // We would like to use a square law (i.e. drag force proportional to square
+                    // of velocity), but then particles at high velocities become subject to
+                    // enormous forces, which, for small masses - such as cloth - mean astronomical
+                    // accelerations.
+                    //
+                    // We have to recourse then, again, to a linear law:
+                    //
+                    // F = - C * |V| * cos(a) * Nn
+                    //
+                    //      cos(a) == cos(angle between velocity and surface normal) == Vn dot Nn
+                    //
+                    // With this law, a particle's velocity is overcome by the drag force when its
+                    // mass is <= C * dt, i.e. ~78Kg with water drag. Since this mass we do have in our sytem,
+                    // we have to cap the force to prevent velocity overcome.
+                    //
 
-                vec2f const oceanSurfaceNormal = mParentWorld.GetOceanSurface().GetNormalAt(thisPointPosition.x); // Points up
-                float const impactVelocity = edgeVelocityCapped * std::abs(pushDir.dot(oceanSurfaceNormal));
+                    // Cap it to the same direction as velocity, to avoid suction force
+                    // (i.e. drag force attracting surface facing opposite of velocity)
+                    float const edgeVelocityCapped = std::max(
+                        edgeVelocityAlongEdgeNormal,
+                        0.0f);
+
+                    // Max drag force magnitude: m * (V dot Nn) / dt
+                    float const maxDragForceMagnitude =
+                        mPoints.GetMass(thisPointIndex) * edgeVelocityCapped
+                        / SimulationParameters::SimulationStepTimeDuration<float>;
+
+                    // Calculate drag coefficient: air or water, with soft transition
+                    // to avoid discontinuities in drag force close to the air-water interface
+                    float const dragCoefficient = Mix(
+                        airPressureDragCoefficient,
+                        waterPressureDragCoefficient,
+                        uwCoefficient);
+
+                    // Calculate magnitude of drag force (opposite sign), capped by max drag force
+                    //  - C * |V| * cos(a) == - C * |V| * (Vn dot Nn) == -C * (V dot Nn)
+                    float const dragForceMagnitude = std::min(
+                        dragCoefficient * edgeVelocityCapped,
+                        maxDragForceMagnitude);
 
-                float const kineticEnergy =
-                    impactVelocity * impactVelocity
-                    * mPoints.GetMass(thisPointIndex);
+                    //
+                    // Impact force
+                    //
+                    // Impact force is proportional to kinetic energy, and we only apply it
+                    // when there's a discontinuity in the "underwaterness" of a frontier
+                    // particle, i.e. when this is the first frame in which the particle
+                    // gets underwater.
+                    //
+                    // For the impact force we consider the particle's velocity projection
+                    // along the normal to the ocean surface at this point
+                    //
 
-                float const waterImpactForceMagnitude =
-                    std::min(kineticEnergy, 100000000.0f) // Cap it to prevent gigantous forces
-                    * waterImpactForceCoefficient
-                    * Step(mPoints.GetCachedDepth(thisPointIndex), 0.0f) * Step(0.0f, newCachedPointDepths[thisPointIndex]);
+                    float const pointVelocityMagnitude = thisPointVelocity.length();
+                    vec2f const pushDir = thisPointVelocity.normalise(pointVelocityMagnitude);
 
-                //
-                // Apply drag and impact forces
-                //
+                    vec2f const oceanSurfaceNormal = mParentWorld.GetOceanSurface().GetNormalAt(thisPointPosition.x); // Points up
+                    float const impactVelocity = edgeVelocityCapped * std::abs(pushDir.dot(oceanSurfaceNormal));
 
-                mPoints.AddStaticForce(
-                    thisPointIndex,
-                    -edgeNormal * (dragForceMagnitude + waterImpactForceMagnitude));
+                    float const kineticEnergy =
+                        impactVelocity * impactVelocity
+                        * mPoints.GetMass(thisPointIndex);
 
-                //
-                // Water displacement
-                //
-                // * The magnitude of water displacement is proportional to the square root of
-                //   the kinetic energy of the particle, thus it is *linearly* proportional to the
-                //   particle's velocity
-                //      * However, in order to generate visible waves also for very small velocities,
-                //        we want the contribution of small velocities to be more than linear wrt
-                //        the contribution of higher velocities, and so we'll be using a piecewise
-                //        function: quadratic for small velocities, and linear for higher
-                // * For a better effect (homogeneous and spawned by all materials), we ignore the
-                //   dependency on the particle's mass
-                // * The deeper the particle is, the less it contributes to displacement
-                //
+                    float const waterImpactForceMagnitude =
+                        std::min(kineticEnergy, 100000000.0f) // Cap it to prevent gigantous forces
+                        * waterImpactForceCoefficient
+                        * Step(mPoints.GetCachedDepth(thisPointIndex), 0.0f) * Step(0.0f, newCachedPointDepths[thisPointIndex]);
 
-                if constexpr (DoDisplaceWater)
-                {
                     //
-                    // Goals:
-                    // - a. Impact displacement: (proportional to, and sign of) vertical component of edge "push"
-                    //    - For simplicity: independent from ocean surface normal at that point
-                    // - b. Straight vertical keel moving along ocean surface (ship marching ahead): must generate waves and foam
-                    //    - If keel is oblique : see a., pushing up or down
-                    //    - In other words : when push surface is full but orthogonal to water surface, vertical component must
-                    //      still be != 0 - provided it has velocity
-                    // - c. Laminar vertical (straight vertical Titanic keel rocking on flat surface): must generate small waves and foam
-                    //    - In other words: when push surface is zero, must still push something - provided it has velocity
+                    // Apply drag and impact forces
                     //
 
+                    taskState.PointStaticForces.emplace_back(
+                        thisPointIndex,
+                        -edgeNormal * (dragForceMagnitude + waterImpactForceMagnitude));
+
                     //
-                    // Impl:
+                    // Water displacement
                     //
-                    // - An edge surface generates a "push" in the direction of the edge velocity; after empirical analysis, we do not consider
-                    //   the magnitude as proportional to the surface area as seen from the edge's velocity axis
-                    //      - In other words: not proportional to the velocity direction _dot_ edge's normal
-                    //      - Would be zero for a velocity in the same direction as the edge surface (laminar vertical case), but to
-                    //        meet goal c., we would clamp the angle, but experiments suggest to let the angle completely go
-                    // - The actual displacement is always vertical (OceanSurface implementation constraint), and its magnitude is
-                    //   proportional to the vertical component of the push vector
-                    //      - Would be zero when push vector is perfectly horizontal, but to meet goal b., we clamp the angle
-                    //      - And to avoid displacements along a horizontal keel traveling parallel to the water surface,
-                    //        we also consider the angle of the push direction wrt the edge surface: we don't clamp
-                    //        if it's parallel
+                    // * The magnitude of water displacement is proportional to the square root of
+                    //   the kinetic energy of the particle, thus it is *linearly* proportional to the
+                    //   particle's velocity
+                    //      * However, in order to generate visible waves also for very small velocities,
+                    //        we want the contribution of small velocities to be more than linear wrt
+                    //        the contribution of higher velocities, and so we'll be using a piecewise
+                    //        function: quadratic for small velocities, and linear for higher
+                    // * For a better effect (homogeneous and spawned by all materials), we ignore the
+                    //   dependency on the particle's mass
+                    // * The deeper the particle is, the less it contributes to displacement
                     //
 
-                    // Note: if we get spurious foam at rest, clamp point velocity to ~0.5/0.6,
-                    // which seems to be the vibration speed of the mesh
+                    if constexpr (DoDisplaceWater)
+                    {
+                        //
+                        // Goals:
+                        // - a. Impact displacement: (proportional to, and sign of) vertical component of edge "push"
+                        //    - For simplicity: independent from ocean surface normal at that point
+                        // - b. Straight vertical keel moving along ocean surface (ship marching ahead): must generate waves and foam
+                        //    - If keel is oblique : see a., pushing up or down
+                        //    - In other words : when push surface is full but orthogonal to water surface, vertical component must
+                        //      still be != 0 - provided it has velocity
+                        // - c. Laminar vertical (straight vertical Titanic keel rocking on flat surface): must generate small waves and foam
+                        //    - In other words: when push surface is zero, must still push something - provided it has velocity
+                        //
 
-                    //
-                    // Push velocity magnitude
-                    //
+                        //
+                        // Impl:
+                        //
+                        // - An edge surface generates a "push" in the direction of the edge velocity; after empirical analysis, we do not consider
+                        //   the magnitude as proportional to the surface area as seen from the edge's velocity axis
+                        //      - In other words: not proportional to the velocity direction _dot_ edge's normal
+                        //      - Would be zero for a velocity in the same direction as the edge surface (laminar vertical case), but to
+                        //        meet goal c., we would clamp the angle, but experiments suggest to let the angle completely go
+                        // - The actual displacement is always vertical (OceanSurface implementation constraint), and its magnitude is
+                        //   proportional to the vertical component of the push vector
+                        //      - Would be zero when push vector is perfectly horizontal, but to meet goal b., we clamp the angle
+                        //      - And to avoid displacements along a horizontal keel traveling parallel to the water surface,
+                        //        we also consider the angle of the push direction wrt the edge surface: we don't clamp
+                        //        if it's parallel
+                        //
 
-                    // Clamp edge velocity to prevent ocean surface instabilities with extremely high
-                    // velocities
-                    float const absPointVelocityMagnitudeCapped = std::min(
-                        std::abs(pointVelocityMagnitude),
-                        10000.0f); // Magic number
+                        // Note: if we get spurious foam at rest, clamp point velocity to ~0.5/0.6,
+                        // which seems to be the vibration speed of the mesh
 
-                    //
-                    // Displacement magnitude
-                    //
+                        //
+                        // Push velocity magnitude
+                        //
 
-                    // Transform push velocity (absolute) into a displacement magnitude (absolute)
-                    float const linearAbsDisplacementMagnitude = WdmY0 + wdmLinearSlope * (absPointVelocityMagnitudeCapped - WdmX0);
-                    float const quadraticAbsDisplacementMagnitude =
-                        wdmQuadraticA * absPointVelocityMagnitudeCapped * absPointVelocityMagnitudeCapped
-                        + wdmQuadraticB * absPointVelocityMagnitudeCapped;
+                        // Clamp edge velocity to prevent ocean surface instabilities with extremely high
+                        // velocities
+                        float const absPointVelocityMagnitudeCapped = std::min(
+                            std::abs(pointVelocityMagnitude),
+                            10000.0f); // Magic number
 
-                    //
-                    // Depth attenuation: tapers down displacement the deeper the point is
-                    //
+                        //
+                        // Displacement magnitude
+                        //
 
-                    // Depth at which the point stops contributing: rises with impact velocity along vertical, and asymmetric wrt sinking or rising
-                    float const absVerticalPointVelocityMagnitudeCapped = absPointVelocityMagnitudeCapped * std::abs(pushDir.y);
-                    float constexpr MaxVerticalVel = 35.0f;
-                    float const maxDepth =
-                        (0.5f + LinearStep(0.0f, MaxVerticalVel, absVerticalPointVelocityMagnitudeCapped) * 0.5f)
-                        * (pushDir.y <= 0.0f ? 12.0f : 4.0f); // Keep up-push low or else bodies keep jumping up and down forever
+                        // Transform push velocity (absolute) into a displacement magnitude (absolute)
+                        float const linearAbsDisplacementMagnitude = WdmY0 + wdmLinearSlope * (absPointVelocityMagnitudeCapped - WdmX0);
+                        float const quadraticAbsDisplacementMagnitude =
+                            wdmQuadraticA * absPointVelocityMagnitudeCapped * absPointVelocityMagnitudeCapped
+                            + wdmQuadraticB * absPointVelocityMagnitudeCapped;
 
-                    // Linear attenuation up to maxDepth
-                    float const depthAttenuation = 1.0f - LinearStep(0.0f, maxDepth, thisPointDepth); // Tapers down contribution the deeper the point is
+                        //
+                        // Depth attenuation: tapers down displacement the deeper the point is
+                        //
 
-                    //
-                    // Displacement angle: due to the fact that we displace the ocean surface vertically, here we calculate the
-                    // vertical component of the displacement, clamping it however to ensure goal b.
-                    //
-                    // With the clamp, we technically consider a push as vertical depending on either:
-                    //  - The verticality of the push direction itself (obviously)
-                    //  - The aligment of the push direction wrt the frontier edge , which maximizes pressure and thus
-                    //    vertical (escaping) displacement
-                    // There's those two maxima, and a minimum when both the push is parallel to the frontier edge,
-                    // and the displacement vector is fully horizontal; for example, along the underwater keel
-                    // marching ahead
-                    // Push angle factor (push multiplier that takes into account the visible surface)
-                    float const minDisplacementAngleVerticalFactor = 0.5f * std::abs(pushDir.dot(edgeNormal));
-                    float const displacementAngleVerticalFactor = std::max(std::abs(pushDir.y), minDisplacementAngleVerticalFactor) * Sign(pushDir.y);
+                        // Depth at which the point stops contributing: rises with impact velocity along vertical, and asymmetric wrt sinking or rising
+                        float const absVerticalPointVelocityMagnitudeCapped = absPointVelocityMagnitudeCapped * std::abs(pushDir.y);
+                        float constexpr MaxVerticalVel = 35.0f;
+                        float const maxDepth =
+                            (0.5f + LinearStep(0.0f, MaxVerticalVel, absVerticalPointVelocityMagnitudeCapped) * 0.5f)
+                            * (pushDir.y <= 0.0f ? 12.0f : 4.0f); // Keep up-push low or else bodies keep jumping up and down forever
 
-                    //
-                    // Final displacement
-                    //
+                        // Linear attenuation up to maxDepth
+                        float const depthAttenuation = 1.0f - LinearStep(0.0f, maxDepth, thisPointDepth); // Tapers down contribution the deeper the point is
 
-                    float const displacement =
-                        (absPointVelocityMagnitudeCapped < WdmX0 ? quadraticAbsDisplacementMagnitude : linearAbsDisplacementMagnitude)
-                        * 0.4f // Magic magnitude adjustment
-                        * depthAttenuation
-                        * Step(0.0f, thisPointDepth) // No displacement for above-water points
-                        * displacementAngleVerticalFactor; // Take vertical component, adjusting sign
+                        //
+                        // Displacement angle: due to the fact that we displace the ocean surface vertically, here we calculate the
+                        // vertical component of the displacement, clamping it however to ensure goal b.
+                        //
+                        // With the clamp, we technically consider a push as vertical depending on either:
+                        //  - The verticality of the push direction itself (obviously)
+                        //  - The aligment of the push direction wrt the frontier edge , which maximizes pressure and thus
+                        //    vertical (escaping) displacement
+                        // There's those two maxima, and a minimum when both the push is parallel to the frontier edge,
+                        // and the displacement vector is fully horizontal; for example, along the underwater keel
+                        // marching ahead
+                        // Push angle factor (push multiplier that takes into account the visible surface)
+                        float const minDisplacementAngleVerticalFactor = 0.5f * std::abs(pushDir.dot(edgeNormal));
+                        float const displacementAngleVerticalFactor = std::max(std::abs(pushDir.y), minDisplacementAngleVerticalFactor) * Sign(pushDir.y);
 
-                    float const absDisplacement = std::abs(displacement);
+                        //
+                        // Final displacement
+                        //
 
-                    float const oceanSurfaceDisplacement = displacement * simulationParameters.WaterDisplacementWaveHeightAdjustment;
-                    mParentWorld.DisplaceOceanSurfaceAt(thisPointPosition.x, oceanSurfaceDisplacement);
-                    totalWaterDisplacementMagnitude += std::abs(oceanSurfaceDisplacement);
+                        float const displacement =
+                            (absPointVelocityMagnitudeCapped < WdmX0 ? quadraticAbsDisplacementMagnitude : linearAbsDisplacementMagnitude)
+                            * 0.4f // Magic magnitude adjustment
+                            * depthAttenuation
+                            * Step(0.0f, thisPointDepth) // No displacement for above-water points
+                            * displacementAngleVerticalFactor; // Take vertical component, adjusting sign
 
-                    //
-                    // Water foam
-                    //
+                        float const absDisplacement = std::abs(displacement);
 
-                    if (absDisplacement > minAbsDisplacementForWaterFoam // Both upwards and downwards
-                        && thisPointDepth < 1.5f) // Only spawn foam on the surface
-                    {
-                        float const strength = absDisplacement - minAbsDisplacementForWaterFoam;
-                        if (strength > strongestWaterFoam.Strength)
+                        float const oceanSurfaceDisplacement = displacement * simulationParameters.WaterDisplacementWaveHeightAdjustment;
+                        taskState.OceanSurfaceDisplacements.emplace_back(thisPointPosition.x, oceanSurfaceDisplacement);
+
+                        //
+                        // Water foam
+                        //
+
+                        if (absDisplacement > minAbsDisplacementForWaterFoam // Both upwards and downwards
+                            && thisPointDepth < 1.5f) // Only spawn foam on the surface
                         {
-                            strongestWaterFoam = WaterFoam(
-                                thisPointPosition,
-                                Sign(edgeVelocityAlongEdgeNormal),
-                                strength,
-                                mPoints.GetPlaneId(thisPointIndex));
+                            float const strength = absDisplacement - minAbsDisplacementForWaterFoam;
+                            if (strength > taskState.StrongestWaterFoam.Strength)
+                            {
+                                taskState.StrongestWaterFoam = WaterFoam(
+                                    thisPointPosition,
+                                    Sign(edgeVelocityAlongEdgeNormal),
+                                    strength,
+                                    mPoints.GetPlaneId(thisPointIndex));
+                            }
                         }
-                    }
 
-                    //
-                    // Water splashes
-                    //
+                        //
+                        // Water splashes
+                        //
 
-                    if (displacement < -minAbsDisplacementForWaterSplash // Only downwards
-                        && thisPointDepth < 2.0f) // Only spawn splashes on the surface
-                    {
-                        float const strength = -displacement - minAbsDisplacementForWaterSplash;
-                        assert(strength > 0.0f);
-                        if (strength > strongestWaterSplash.Strength)
+                        if (displacement < -minAbsDisplacementForWaterSplash // Only downwards
+                            && thisPointDepth < 2.0f) // Only spawn splashes on the surface
                         {
-                            strongestWaterSplash = WaterSplash(
-                                thisPointPosition,
-                                oceanSurfaceNormal, // Points up
-                                strength,
-                                mPoints.GetPlaneId(thisPointIndex));
+                            float const strength = -displacement - minAbsDisplacementForWaterSplash;
+                            assert(strength > 0.0f);
+                            if (strength > taskState.StrongestWaterSplash.Strength)
+                            {
+                                taskState.StrongestWaterSplash = WaterSplash(
+                                    thisPointPosition,
+                                    oceanSurfaceNormal, // Points up
+                                    strength,
+                                    mPoints.GetPlaneId(thisPointIndex));
+                            }
                         }
                     }
+
+                    //
+                    // Lift: Cl * V^2 * (Rho * A / 2)
+                    //
+
+                    // Cap velocity as a proxy to cap lift force, to avoid massive lift forces that
+                    // would makes structures explode when velocity is reached suddenly
+                    float const edgeVelocityAlongEdgeSquareCapped = std::min(edgeVelocityAlongEdge * edgeVelocityAlongEdge, 30.0f * 30.0f);
+
+                    float const liftForce =
+                        mPoints.GetStructuralMaterial(thisPointIndex).LiftCoefficient
+                        * edgeVelocityAlongEdgeSquareCapped
+                        * liftForceFactor_Rho_A_Half_Adj;
+
+                    // Add force, towards the interior - we assume lift materials are placed on the bottom surface if we want an upward lift
+                    taskState.PointStaticForces.emplace_back(
+                        thisPointIndex,
+                        -edgeNormal * liftForce);
+
+                    //
+                    // Advance edge in the frontier visit
+                    //
+
+                    nextEdgeIndex = nextFrontierEdge.NextEdgeIndex;
+                    if (nextEdgeIndex == edgeVisitStartEdgeIndex)
+                        break;
+
+                    previousPointPosition = thisPointPosition;
+                    thisPointPosition = nextPointPosition;
+                    thisPointIndex = nextPointIndex;
                 }
 
+#ifdef _DEBUG
+                assert(visitedPoints == frontier.Size);
+#endif
+            }
+            else
+            {
                 //
-                // Lift: Cl * V^2 * (Rho * A / 2)
+                // Simply update AABB and geometric center
                 //
 
-                // Cap velocity as a proxy to cap lift force, to avoid massive lift forces that
-                // would makes structures explode when velocity is reached suddenly
-                float const edgeVelocityAlongEdgeSquareCapped = std::min(edgeVelocityAlongEdge * edgeVelocityAlongEdge, 30.0f * 30.0f);
+                ElementIndex const frontierStartEdge = frontier.StartingEdgeIndex;
+
+                for (ElementIndex edgeIndex = frontierStartEdge; /*checked in loop*/; /*advanced in loop*/)
+                {
+                    auto const & frontierEdge = mFrontiers.GetFrontierEdge(edgeIndex);
+
+                    // Update AABB and geometric center with this point
+                    auto const pointPosition = mPoints.GetPosition(frontierEdge.PointAIndex);
+                    aabb.ExtendTo(pointPosition);
+                    geometricCenter += pointPosition;
+
+                    // Advance
+                    edgeIndex = frontierEdge.NextEdgeIndex;
+                    if (edgeIndex == frontierStartEdge)
+                        break;
+                }
+            }
+
+            //
+            // Finalize AABB and geometric center update
+            //
+
+            aabb.FrontierEdgeCount = static_cast<float>(frontier.Size);
+
+            geometricCenter /= static_cast<float>(frontier.Size);
+
+            // Store AABB and geometric center in frontier
+            frontier.AABB = aabb;
+            frontier.GeometricCenterPosition = geometricCenter;
+        }
+    };
+
+    CalculateFrontierShards(simulationThreadPool.GetParallelism());
+    size_t const shardCount = mFrontierShardBoundaries.size() - 1;
+
+    if (mWorldSurfaceForcesTaskStates.size() < shardCount)
+    {
+        mWorldSurfaceForcesTaskStates.resize(shardCount);
+    }
+
+    for (size_t t = 0; t < shardCount; ++t)
+    {
+        mWorldSurfaceForcesTaskStates[t].Reset();
+    }
+
+    if (shardCount == 1)
+    {
+        visitFrontiers(mFrontierShardBoundaries[0], mFrontierShardBoundaries[1], mWorldSurfaceForcesTaskStates[0]);
+    }
+    else
+    {
+        assert(mFrontierShardTasks.empty());
 
-                float const liftForce =
-                    mPoints.GetStructuralMaterial(thisPointIndex).LiftCoefficient
-                    * edgeVelocityAlongEdgeSquareCapped
-                    * liftForceFactor_Rho_A_Half_Adj;
+        for (size_t t = 0; t < shardCount; ++t)
+        {
+            mFrontierShardTasks.emplace_back(
+                [this, &visitFrontiers, t]()
+                {
+                    visitFrontiers(mFrontierShardBoundaries[t], mFrontierShardBoundaries[t + 1], mWorldSurfaceForcesTaskStates[t]);
+                });
+        }
 
-                // Add force, towards the interior - we assume lift materials are placed on the bottom surface if we want an upward lift
-                mPoints.AddStaticForce(
-                    thisPointIndex,
-                    -edgeNormal * liftForce);
+        simulationThreadPool.RunAndClear(mFrontierShardTasks);
+    }
 
-                //
-                // Advance edge in the frontier visit
-                //
+    //
+    // Commit task states, in shard order
+    //
 
-                nextEdgeIndex = nextFrontierEdge.NextEdgeIndex;
-                if (nextEdgeIndex == edgeVisitStartEdgeIndex)
-                    break;
+    float totalWaterDisplacementMagnitude = 0.0f;
+    WaterFoam strongestWaterFoam;
+    WaterSplash strongestWaterSplash;
 
-                previousPointPosition = thisPointPosition;
-                thisPointPosition = nextPointPosition;
-                thisPointIndex = nextPointIndex;
-            }
+    for (size_t t = 0; t < shardCount; ++t)
+    {
+        auto const & taskState = mWorldSurfaceForcesTaskStates[t];
 
-#ifdef _DEBUG
-            assert(visitedPoints == frontier.Size);
-#endif
-        }
-        else
+        for (auto const & [pointIndex, force] : taskState.PointStaticForces)
         {
-            //
-            // Simply update AABB and geometric center
-            //
-
-            ElementIndex const frontierStartEdge = frontier.StartingEdgeIndex;
+            mPoints.AddStaticForce(pointIndex, force);
+        }
 
-            for (ElementIndex edgeIndex = frontierStartEdge; /*checked in loop*/; /*advanced in loop*/)
+        if constexpr (DoDisplaceWater)
+        {
+            for (auto const & [x, oceanSurfaceDisplacement] : taskState.OceanSurfaceDisplacements)
             {
-                auto const & frontierEdge = mFrontiers.GetFrontierEdge(edgeIndex);
+                mParentWorld.DisplaceOceanSurfaceAt(x, oceanSurfaceDisplacement);
+                totalWaterDisplacementMagnitude += std::abs(oceanSurfaceDisplacement);
+            }
 
-                // Update AABB and geometric center with this point
-                auto const pointPosition = mPoints.GetPosition(frontierEdge.PointAIndex);
-                aabb.ExtendTo(pointPosition);
-                geometricCenter += pointPosition;
+            if (taskState.StrongestWaterFoam.Strength > strongestWaterFoam.Strength)
+            {
+                strongestWaterFoam = taskState.StrongestWaterFoam;
+            }
 
-                // Advance
-                edgeIndex = frontierEdge.NextEdgeIndex;
-                if (edgeIndex == frontierStartEdge)
-                    break;
+            if (taskState.StrongestWaterSplash.Strength > strongestWaterSplash.Strength)
+            {
+                strongestWaterSplash = taskState.StrongestWaterSplash;
             }
         }
+    }
 
-        //
-        // Finalize AABB and geometric center update
-        //
-
-        aabb.FrontierEdgeCount = static_cast<float>(frontier.Size);
-
-        geometricCenter /= static_cast<float>(frontier.Size);
-
-        // Store AABB and geometric center in frontier
-        frontier.AABB = aabb;
-        frontier.GeometricCenterPosition = geometricCenter;
-
-        // Store AABB in AABB set, but only if external
+    // Store external frontiers' AABBs in AABB set
+    for (FrontierId const frontierId : mFrontiers.GetFrontierIds())
+    {
+        auto const & frontier = mFrontiers.GetFrontier(frontierId);
         if (frontier.Type == FrontierType::External)
         {
-            externalAabbSet.Add(aabb);
+            externalAabbSet.Add(frontier.AABB, mId);
         }
     }
 
@@ -1967,7 +1967,8 @@ void Ship::ApplyWorldSurfaceForces(
 void Ship::ApplyStaticPressureForces(
     float effectiveAirDensity,
     float effectiveWaterDensity,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadPool & simulationThreadPool)
 {
     //
     // At this moment, dynamic forces are all zero - we are the first populating those
@@ -1981,26 +1982,86 @@ void Ship::ApplyStaticPressureForces(
             return v == vec2f::zero();
         }));
 
-    // Initialize stats
+    //
+    // Visit all frontiers in shards, calculating static pressure forces on each;
+    // as frontiers may share points, each shard accumulates its forces in its own
+    // task state, and we apply them afterwards in shard order
+    //
+
+    CalculateFrontierShards(simulationThreadPool.GetParallelism());
+    size_t const shardCount = mFrontierShardBoundaries.size() - 1;
+
+    while (mStaticPressureTaskStates.size() < shardCount)
+    {
+        mStaticPressureTaskStates.emplace_back(mPoints.GetAlignedShipPointCount());
+    }
+
+    auto const visitFrontiers = [&](size_t t)
+    {
+        auto & taskState = mStaticPressureTaskStates[t];
+        taskState.Reset();
+
+        auto const & frontierIds = mFrontiers.GetFrontierIds();
+
+        for (size_t f = mFrontierShardBoundaries[t]; f < mFrontierShardBoundaries[t + 1]; ++f)
+        {
+            auto const & frontier = mFrontiers.GetFrontier(frontierIds[f]);
+
+            // Only consider external frontiers
+            if (frontier.Type == FrontierType::External)
+            {
+                ApplyStaticPressureForces(
+                    frontier,
+                    effectiveAirDensity,
+                    effectiveWaterDensity,
+                    simulationParameters,
+                    taskState);
+            }
+        }
+    };
+
+    if (shardCount == 1)
+    {
+        visitFrontiers(0);
+    }
+    else
+    {
+        assert(mFrontierShardTasks.empty());
+
+        for (size_t t = 0; t < shardCount; ++t)
+        {
+            mFrontierShardTasks.emplace_back(
+                [&visitFrontiers, t]()
+                {
+                    visitFrontiers(t);
+                });
+        }
+
+        simulationThreadPool.RunAndClear(mFrontierShardTasks);
+    }
+
+    //
+    // Commit task states, in shard order
+    //
+
     mStaticPressureNetForceMagnitudeSum = 0.0f;
     mStaticPressureNetForceMagnitudeCount = 0.0f;
     mStaticPressureIterationsPercentagesSum = 0.0f;
     mStaticPressureIterationsCount = 0.0f;
 
-    // Visit all frontiers and apply static pressure forces on each
-    for (FrontierId const frontierId : mFrontiers.GetFrontierIds())
+    for (size_t t = 0; t < shardCount; ++t)
     {
-        auto const & frontier = mFrontiers.GetFrontier(frontierId);
+        auto const & taskState = mStaticPressureTaskStates[t];
 
-        // Only consider external frontiers
-        if (frontier.Type == FrontierType::External)
+        for (auto const & [pointIndex, force] : taskState.PointForces)
         {
-            ApplyStaticPressureForces(
-                frontier,
-                effectiveAirDensity,
-                effectiveWaterDensity,
-                simulationParameters);
+            mPoints.AddDynamicForce0(pointIndex, force);
         }
+
+        mStaticPressureNetForceMagnitudeSum += taskState.NetForceMagnitudeSum;
+        mStaticPressureNetForceMagnitudeCount += taskState.NetForceMagnitudeCount;
+        mStaticPressureIterationsPercentagesSum += taskState.IterationsPercentagesSum;
+        mStaticPressureIterationsCount += taskState.IterationsCount;
     }
 }
 
@@ -2019,7 +2080,8 @@ void Ship::ApplyStaticPressureForces(
     Frontiers::Frontier const & frontier,
     float effectiveAirDensity,
     float effectiveWaterDensity,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    StaticPressureTaskState & taskState)
 {
     //
     // The hydrostatic pressure force acting on point P, between edges
@@ -2118,7 +2180,7 @@ void Ship::ApplyStaticPressureForces(
     // proportional to its "area" (length)
     //
 
-    mStaticPressureBuffer.clear();
+    taskState.StaticPressureBuffer.clear();
 
     // Note: these track *normalized* forces
     vec2f netForce = vec2f::zero();
@@ -2242,7 +2304,7 @@ void Ship::ApplyStaticPressureForces(
             ////}
 
             // Store force
-            mStaticPressureBuffer.emplace_back(
+            taskState.StaticPressureBuffer.emplace_back(
                 thisPointIndex,
                 forceVector,
                 torqueArm);
@@ -2309,9 +2371,9 @@ void Ship::ApplyStaticPressureForces(
 
             float minNetForceMagnitude = std::numeric_limits<float>::max();
             float minNetTorqueMagnitude = std::numeric_limits<float>::max();
-            for (size_t hpi = 0; hpi < mStaticPressureBuffer.GetCurrentPopulatedSize(); ++hpi)
+            for (size_t hpi = 0; hpi < taskState.StaticPressureBuffer.GetCurrentPopulatedSize(); ++hpi)
             {
-                auto const & hp = mStaticPressureBuffer[hpi];
+                auto const & hp = taskState.StaticPressureBuffer[hpi];
 
                 vec2f const & thisForce = hp.ForceVector;
 
@@ -2350,9 +2412,9 @@ void Ship::ApplyStaticPressureForces(
 
             float minNetForceMagnitude = std::numeric_limits<float>::max();
             float minNetTorqueMagnitude = std::numeric_limits<float>::max();
-            for (size_t hpi = 0; hpi < mStaticPressureBuffer.GetCurrentPopulatedSize(); ++hpi)
+            for (size_t hpi = 0; hpi < taskState.StaticPressureBuffer.GetCurrentPopulatedSize(); ++hpi)
             {
-                auto const & hp = mStaticPressureBuffer[hpi];
+                auto const & hp = taskState.StaticPressureBuffer[hpi];
 
                 vec2f const & thisForce = hp.ForceVector;
                 float const thisTorque = hp.TorqueArm.cross(thisForce);
@@ -2390,11 +2452,11 @@ void Ship::ApplyStaticPressureForces(
             break;
         }
 
-        vec2f const thisForce = mStaticPressureBuffer[*bestHPIndex].ForceVector;
-        float const thisTorque = mStaticPressureBuffer[*bestHPIndex].TorqueArm.cross(thisForce);
+        vec2f const thisForce = taskState.StaticPressureBuffer[*bestHPIndex].ForceVector;
+        float const thisTorque = taskState.StaticPressureBuffer[*bestHPIndex].TorqueArm.cross(thisForce);
 
         // Adjust force vector of optimal particle
-        mStaticPressureBuffer[*bestHPIndex].ForceVector *= bestLambda;
+        taskState.StaticPressureBuffer[*bestHPIndex].ForceVector *= bestLambda;
 
         // Update net force and torque
         //
@@ -2404,10 +2466,10 @@ void Ship::ApplyStaticPressureForces(
     }
 
     // Update stats (aggregate across all frontiers)
-    mStaticPressureNetForceMagnitudeSum += netForce.length();
-    mStaticPressureNetForceMagnitudeCount += 1.0f;
-    mStaticPressureIterationsPercentagesSum += static_cast<float>(iter + 1) / static_cast<float>(frontier.Size);
-    mStaticPressureIterationsCount += 1.0f;
+    taskState.NetForceMagnitudeSum += netForce.length();
+    taskState.NetForceMagnitudeCount += 1.0f;
+    taskState.IterationsPercentagesSum += static_cast<float>(iter + 1) / static_cast<float>(frontier.Size);
+    taskState.IterationsCount += 1.0f;
 
     //
     // 3. Apply forces as dynamic forces - so they only apply to current positions
@@ -2435,12 +2497,12 @@ void Ship::ApplyStaticPressureForces(
         * simulationParameters.StaticPressureForceAdjustment
         * mRepairGracePeriodMultiplier; // Static pressure hinders the repair process
 
-    size_t const particleCount = mStaticPressureBuffer.GetCurrentPopulatedSize();
+    size_t const particleCount = taskState.StaticPressureBuffer.GetCurrentPopulatedSize();
     for (size_t hpi = 0; hpi < particleCount; ++hpi)
     {
-        mPoints.AddDynamicForce0(
-            mStaticPressureBuffer[hpi].PointIndex,
-            mStaticPressureBuffer[hpi].ForceVector * forceMultiplier);
+        taskState.PointForces.emplace_back(
+            taskState.StaticPressureBuffer[hpi].PointIndex,
+            taskState.StaticPressureBuffer[hpi].ForceVector * forceMultiplier);
     }
 }
 
@@ -2522,6 +2584,7 @@ void Ship::UpdatePressureAndWaterInflow(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
     SimulationParameters const & simulationParameters,
+    ThreadPool & simulationThreadPool,
     float & waterTakenInStep)
 {
     //
@@ -2550,213 +2613,291 @@ void Ship::UpdatePressureAndWaterInflow(
     float const cumulatedIntakenWaterThresholdForAirBubbles =
         SimulationParameters::AirBubblesDensityToCumulatedIntakenWater(simulationParameters.AirBubblesDensity);
 
-    for (auto pointIndex : mPoints.RawShipPoints())
-    {
-        // This is one of the few cases in which we prefer branching over calculating
-        // for all points, mostly because we expect a tiny fraction of all points to
-        // be leaking at any moment
-        auto const & pointCompositeLeaking = mPoints.GetLeakingComposite(pointIndex);
-        if (pointCompositeLeaking.IsCumulativelyLeaking)
-        {
-            // Point could be structurally hull or not; could be leaking if it's a watertight door
+    //
+    // We only visit the points that may be leaking, as we expect a tiny fraction of all
+    // points to be leaking at any moment; these are sorted by index.
+    //
+    // Points are independent of each other here, hence we visit them in shards; the only
+    // shared state we would touch is the ephemeral particles', so we queue air bubbles in
+    // each shard's task state and spawn them afterwards, in shard order - i.e. in the same
+    // order as when visiting all points serially.
+    //
 
-            float const pointDepth = mPoints.GetCachedDepth(pointIndex);
+    mPoints.PruneLeakingPoints();
 
-            // External water height
-            //
-            // We also incorporate rain in the sources of external water height:
-            // - If point is below water surface: external water height is due to depth
-            // - If point is above water surface: external water height is due to rain
-            float const externalWaterHeight = std::max(
-                pointDepth + 0.1f, // Magic number to force flotsam to take some water in and eventually sink
-                rainEquivalentWaterHeight); // At most is one meter, so does not interfere with underwater pressure
+    auto const & leakingPoints = mPoints.GetLeakingPoints();
 
-            // Internal water height
-            float const internalWaterHeight = mPoints.GetWater(pointIndex);
+    // Make sure SetWater() won't have to grow the set of wet points concurrently
+    for (auto const pointIndex : leakingPoints)
+    {
+        mPoints.AddWetPoint(pointIndex);
+    }
 
-            float totalPointDeltaWater = 0.0f;
-            float totalPointDeltaWaterForStepTotal = 0.0f; // For total returned - discounts orhpaned points' structural
+    auto const visitLeakingPoints = [&](size_t startLeakingPoint, size_t endLeakingPoint, PressureAndWaterInflowTaskState & taskState)
+    {
+        for (size_t l = startLeakingPoint; l < endLeakingPoint; ++l)
+        {
+            ElementIndex const pointIndex = leakingPoints[l];
 
-            if (pointCompositeLeaking.LeakingSources.StructuralLeak != 0.0f)
+            auto const & pointCompositeLeaking = mPoints.GetLeakingComposite(pointIndex);
+            if (pointCompositeLeaking.IsCumulativelyLeaking)
             {
+                // Point could be structurally hull or not; could be leaking if it's a watertight door
+
+                float const pointDepth = mPoints.GetCachedDepth(pointIndex);
+
+                // External water height
                 //
-                // 1. Update water due to structural leaks (holes)
-                //
+                // We also incorporate rain in the sources of external water height:
+                // - If point is below water surface: external water height is due to depth
+                // - If point is above water surface: external water height is due to rain
+                float const externalWaterHeight = std::max(
+                    pointDepth + 0.1f, // Magic number to force flotsam to take some water in and eventually sink
+                    rainEquivalentWaterHeight); // At most is one meter, so does not interfere with underwater pressure
+
+                // Internal water height
+                float const internalWaterHeight = mPoints.GetWater(pointIndex);
 
+                float totalPointDeltaWater = 0.0f;
+                float totalPointDeltaWaterForStepTotal = 0.0f; // For total returned - discounts orhpaned points' structural
+
+                if (pointCompositeLeaking.LeakingSources.StructuralLeak != 0.0f)
                 {
                     //
-                    // 1.1) Calculate velocity of incoming water, based off Bernoulli's equation applied to point:
-                    //  v**2/2 + p/density = c (assuming y of incoming water does not change along the intake)
-                    //      With: p = pressure of water at point = d*wh*g (d = water density, wh = water height in point)
-                    //
-                    // Considering that at equilibrium we have v=0 and p=external_pressure,
-                    // then c=external_pressure/density;
-                    // external_pressure is height_of_water_at_y*g*density, then c=height_of_water_at_y*g;
-                    // hence, the velocity of water incoming at point p, when the "water height" in the point is already
-                    // wh and the external water pressure is d*height_of_water_at_y*g, is:
-                    //  v = +/- sqrt(2*g*|height_of_water_at_y-wh|)
+                    // 1. Update water due to structural leaks (holes)
                     //
 
-                    float incomingWaterVelocity_Structural;
-                    if (externalWaterHeight >= internalWaterHeight)
                     {
-                        // Incoming water
-                        incomingWaterVelocity_Structural = sqrtf(2.0f * SimulationParameters::GravityMagnitude * (externalWaterHeight - internalWaterHeight));
-                    }
-                    else
-                    {
-                        // Outgoing water
-                        incomingWaterVelocity_Structural = -sqrtf(2.0f * SimulationParameters::GravityMagnitude * (internalWaterHeight - externalWaterHeight));
+                        //
+                        // 1.1) Calculate velocity of incoming water, based off Bernoulli's equation applied to point:
+                        //  v**2/2 + p/density = c (assuming y of incoming water does not change along the intake)
+                        //      With: p = pressure of water at point = d*wh*g (d = water density, wh = water height in point)
+                        //
+                        // Considering that at equilibrium we have v=0 and p=external_pressure,
+                        // then c=external_pressure/density;
+                        // external_pressure is height_of_water_at_y*g*density, then c=height_of_water_at_y*g;
+                        // hence, the velocity of water incoming at point p, when the "water height" in the point is already
+                        // wh and the external water pressure is d*height_of_water_at_y*g, is:
+                        //  v = +/- sqrt(2*g*|height_of_water_at_y-wh|)
+                        //
+
+                        float incomingWaterVelocity_Structural;
+                        if (externalWaterHeight >= internalWaterHeight)
+                        {
+                            // Incoming water
+                            incomingWaterVelocity_Structural = sqrtf(2.0f * SimulationParameters::GravityMagnitude * (externalWaterHeight - internalWaterHeight));
+                        }
+                        else
+                        {
+                            // Outgoing water
+                            incomingWaterVelocity_Structural = -sqrtf(2.0f * SimulationParameters::GravityMagnitude * (internalWaterHeight - externalWaterHeight));
+                        }
+
+                        //
+                        // 1.2) In/Outtake water according to velocity:
+                        // - During dt, we move a volume of water Vw equal to A*v*dt; the equivalent change in water
+                        //   height is thus Vw/A, i.e. v*dt
+                        //
+
+                        float deltaWater_Structural =
+                            incomingWaterVelocity_Structural
+                            * SimulationParameters::SimulationStepTimeDuration<float>
+                            * mPoints.GetMaterialWaterIntake(pointIndex)
+                            * simulationParameters.WaterIntakeAdjustment;
+
+                        //
+                        // 1.3) Update water
+                        //
+
+                        if (deltaWater_Structural < 0.0f)
+                        {
+                            // Outgoing water
+
+                            // Make sure we don't over-drain the point
+                            deltaWater_Structural = std::max(-mPoints.GetWater(pointIndex), deltaWater_Structural);
+
+                            // Honor the water retention of this material
+                            deltaWater_Structural *= mPoints.GetMaterialWaterRestitution(pointIndex);
+                        }
+
+                        // Adjust water
+                        mPoints.SetWater(
+                            pointIndex,
+                            mPoints.GetWater(pointIndex) + deltaWater_Structural);
+
+                        // Update total delta water
+                        totalPointDeltaWater += deltaWater_Structural;
+                        if (!mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+                        {
+                            // Only count water taken if this point has a spring, to avoid counting
+                            // water and generating bubbles for orphaned particles
+                            // (note that leaking points have no connected triangles)
+                            totalPointDeltaWaterForStepTotal += deltaWater_Structural;
+                        }
                     }
 
                     //
-                    // 1.2) In/Outtake water according to velocity:
-                    // - During dt, we move a volume of water Vw equal to A*v*dt; the equivalent change in water
-                    //   height is thus Vw/A, i.e. v*dt
+                    // 2. Update internal pressure due to structural leaks (holes)
+                    //    (positive is incoming)
+                    //
+                    //    Structural delta pressure is independent from structural delta water
                     //
 
-                    float deltaWater_Structural =
-                        incomingWaterVelocity_Structural
-                        * SimulationParameters::SimulationStepTimeDuration<float>
-                        * mPoints.GetMaterialWaterIntake(pointIndex)
-                        * simulationParameters.WaterIntakeAdjustment;
+                    {
+                        float const externalPressure = Formulae::CalculateTotalPressureAt(
+                            mPoints.GetPosition(pointIndex).y,
+                            mPoints.GetPosition(pointIndex).y + pointDepth, // oceanSurfaceY
+                            effectiveAirDensity,
+                            effectiveWaterDensity,
+                            simulationParameters);
+
+                        mPoints.SetInternalPressure(
+                            pointIndex,
+                            externalPressure);
+                    }
+                }
 
+                float const waterPumpForce = pointCompositeLeaking.LeakingSources.WaterPumpForce;
+                if (waterPumpForce != 0.0f)
+                {
                     //
-                    // 1.3) Update water
+                    // 3) Update water due to forced leaks (pumps)
+                    //    (positive is incoming)
                     //
 
-                    if (deltaWater_Structural < 0.0f)
+                    float deltaWater_Forced = 0.0f;
+                    if (waterPumpForce > 0.0f)
                     {
-                        // Outgoing water
-
-                        // Make sure we don't over-drain the point
-                        deltaWater_Structural = std::max(-mPoints.GetWater(pointIndex), deltaWater_Structural);
-
-                        // Honor the water retention of this material
-                        deltaWater_Structural *= mPoints.GetMaterialWaterRestitution(pointIndex);
+                        // Inward pump: only works if underwater
+                        deltaWater_Forced = (externalWaterHeight > 0.0f)
+                            ? waterPumpForce * waterPumpPowerMultiplier // No need to cap as sea is infinite
+                            : 0.0f;
+                    }
+                    else
+                    {
+                        // Outward pump: only works if water inside
+                        deltaWater_Forced = (internalWaterHeight > 0.0f)
+                            ? waterPumpForce * waterPumpPowerMultiplier // We'll cap it
+                            : 0.0f;
                     }
 
+                    // Make sure we don't over-drain the point
+                    deltaWater_Forced = std::max(-mPoints.GetWater(pointIndex), deltaWater_Forced);
+
                     // Adjust water
                     mPoints.SetWater(
                         pointIndex,
-                        mPoints.GetWater(pointIndex) + deltaWater_Structural);
+                        mPoints.GetWater(pointIndex) + deltaWater_Forced);
 
                     // Update total delta water
-                    totalPointDeltaWater += deltaWater_Structural;
-                    if (!mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
-                    {
-                        // Only count water taken if this point has a spring, to avoid counting
-                        // water and generating bubbles for orphaned particles
-                        // (note that leaking points have no connected triangles)
-                        totalPointDeltaWaterForStepTotal += deltaWater_Structural;
-                    }
-                }
+                    totalPointDeltaWater += deltaWater_Forced;
+                    totalPointDeltaWaterForStepTotal += deltaWater_Forced;
 
-                //
-                // 2. Update internal pressure due to structural leaks (holes)
-                //    (positive is incoming)
-                //
-                //    Structural delta pressure is independent from structural delta water
-                //
+                    //
+                    // 4) Update pressure due to forced leaks (pumps)
+                    //    (positive is incoming)
+                    //
+                    //    Forced delta pressure depends on (effective) forced delta water only
+                    //
 
-                {
-                    float const externalPressure = Formulae::CalculateTotalPressureAt(
-                        mPoints.GetPosition(pointIndex).y,
-                        mPoints.GetPosition(pointIndex).y + pointDepth, // oceanSurfaceY
-                        effectiveAirDensity,
-                        effectiveWaterDensity,
-                        simulationParameters);
+                    float const deltaPressure_Forced = deltaWater_Forced * volumetricWaterPressure;
 
                     mPoints.SetInternalPressure(
                         pointIndex,
-                        externalPressure);
+                        std::max(mPoints.GetInternalPressure(pointIndex) + deltaPressure_Forced, 0.0f)); // Make sure we don't over-drain the point
                 }
-            }
 
-            float const waterPumpForce = pointCompositeLeaking.LeakingSources.WaterPumpForce;
-            if (waterPumpForce != 0.0f)
-            {
                 //
-                // 3) Update water due to forced leaks (pumps)
-                //    (positive is incoming)
+                // 5) Check if it's time to produce air bubbles
                 //
 
-                float deltaWater_Forced = 0.0f;
-                if (waterPumpForce > 0.0f)
+                mPoints.GetCumulatedIntakenWater(pointIndex) += totalPointDeltaWater;
+                if (mPoints.GetCumulatedIntakenWater(pointIndex) > cumulatedIntakenWaterThresholdForAirBubbles)
                 {
-                    // Inward pump: only works if underwater
-                    deltaWater_Forced = (externalWaterHeight > 0.0f)
-                        ? waterPumpForce * waterPumpPowerMultiplier // No need to cap as sea is infinite
-                        : 0.0f;
+                    // Generate air bubbles - but not on ropes as that looks awful
+                    if (doGenerateAirBubbles
+                        && !mPoints.IsRope(pointIndex))
+                    {
+                        // Deferred, as spawning ephemeral particles is not thread-safe
+                        taskState.AirBubblePoints.push_back(pointIndex);
+                    }
+
+                    // Consume all cumulated water
+                    mPoints.GetCumulatedIntakenWater(pointIndex) = 0.0f;
                 }
-                else
+
+                // Adjust total water taken during this step, but not counting
+                // ropes, to prevent "rushing water" sound from playing for
+                // ropes, and also to prevent rope-only ships from playing
+                // "farewell"
+                if (!mPoints.IsRope(pointIndex))
                 {
-                    // Outward pump: only works if water inside
-                    deltaWater_Forced = (internalWaterHeight > 0.0f)
-                        ? waterPumpForce * waterPumpPowerMultiplier // We'll cap it
-                        : 0.0f;
+                    taskState.WaterTakenInStep += totalPointDeltaWaterForStepTotal;
                 }
+            }
+        }
+    };
 
-                // Make sure we don't over-drain the point
-                deltaWater_Forced = std::max(-mPoints.GetWater(pointIndex), deltaWater_Forced);
+    size_t constexpr MinLeakingPointsPerShard = 256;
 
-                // Adjust water
-                mPoints.SetWater(
-                    pointIndex,
-                    mPoints.GetWater(pointIndex) + deltaWater_Forced);
+    size_t const shardCount = std::max(
+        std::min(simulationThreadPool.GetParallelism(), leakingPoints.size() / MinLeakingPointsPerShard),
+        size_t(1));
 
-                // Update total delta water
-                totalPointDeltaWater += deltaWater_Forced;
-                totalPointDeltaWaterForStepTotal += deltaWater_Forced;
+    if (mPressureAndWaterInflowTaskStates.size() < shardCount)
+    {
+        mPressureAndWaterInflowTaskStates.resize(shardCount);
+    }
 
-                //
-                // 4) Update pressure due to forced leaks (pumps)
-                //    (positive is incoming)
-                //
-                //    Forced delta pressure depends on (effective) forced delta water only
-                //
+    for (size_t t = 0; t < shardCount; ++t)
+    {
+        mPressureAndWaterInflowTaskStates[t].Reset();
+    }
 
-                float const deltaPressure_Forced = deltaWater_Forced * volumetricWaterPressure;
+    if (shardCount == 1)
+    {
+        visitLeakingPoints(0, leakingPoints.size(), mPressureAndWaterInflowTaskStates[0]);
+    }
+    else
+    {
+        assert(mPressureAndWaterInflowTasks.empty());
 
-                mPoints.SetInternalPressure(
-                    pointIndex,
-                    std::max(mPoints.GetInternalPressure(pointIndex) + deltaPressure_Forced, 0.0f)); // Make sure we don't over-drain the point
-            }
+        for (size_t t = 0; t < shardCount; ++t)
+        {
+            mPressureAndWaterInflowTasks.emplace_back(
+                [&visitLeakingPoints, &leakingPoints, this, t, shardCount]()
+                {
+                    visitLeakingPoints(
+                        t * leakingPoints.size() / shardCount,
+                        (t + 1) * leakingPoints.size() / shardCount,
+                        mPressureAndWaterInflowTaskStates[t]);
+                });
+        }
 
-            //
-            // 5) Check if it's time to produce air bubbles
-            //
+        simulationThreadPool.RunAndClear(mPressureAndWaterInflowTasks);
+    }
 
-            mPoints.GetCumulatedIntakenWater(pointIndex) += totalPointDeltaWater;
-            if (mPoints.GetCumulatedIntakenWater(pointIndex) > cumulatedIntakenWaterThresholdForAirBubbles)
-            {
-                // Generate air bubbles - but not on ropes as that looks awful
-                if (doGenerateAirBubbles
-                    && !mPoints.IsRope(pointIndex))
-                {
-                    InternalSpawnAirBubble(
-                        mPoints.GetPosition(pointIndex),
-                        pointDepth,
-                        SimulationParameters::ShipAirBubbleFinalScale,
-                        mPoints.GetTemperature(pointIndex),
-                        mPoints.GetPlaneId(pointIndex),
-                        currentSimulationTime,
-                        simulationParameters);
-                }
+    //
+    // Commit task states, in shard order
+    //
 
-                // Consume all cumulated water
-                mPoints.GetCumulatedIntakenWater(pointIndex) = 0.0f;
-            }
+    for (size_t t = 0; t < shardCount; ++t)
+    {
+        auto const & taskState = mPressureAndWaterInflowTaskStates[t];
 
-            // Adjust total water taken during this step, but not counting
-            // ropes, to prevent "rushing water" sound from playing for
-            // ropes, and also to prevent rope-only ships from playing
-            // "farewell"
-            if (!mPoints.IsRope(pointIndex))
-            {
-                waterTakenInStep += totalPointDeltaWaterForStepTotal;
-            }
+        for (auto const pointIndex : taskState.AirBubblePoints)
+        {
+            InternalSpawnAirBubble(
+                mPoints.GetPosition(pointIndex),
+                mPoints.GetCachedDepth(pointIndex),
+                SimulationParameters::ShipAirBubbleFinalScale,
+                mPoints.GetTemperature(pointIndex),
+                mPoints.GetPlaneId(pointIndex),
+                currentSimulationTime,
+                simulationParameters);
         }
+
+        waterTakenInStep += taskState.WaterTakenInStep;
     }
 }
 
@@ -2866,16 +3007,35 @@ void Ship::UpdateWaterVelocities(
     assert(!mPoints.Diagnostic_ArePositionsDirty());
 #endif
 
+    //
+    // We only visit wet points: water only moves out of points that have water, and
+    // points without water contribute nothing to kinetic energy losses. Wet points
+    // are visited in index order, hence results are the same as when visiting all points.
+    //
+
+    mPoints.PrepareWetPoints();
+
     // Calculate water momenta
     mPoints.UpdateWaterMomentaFromVelocities();
 
-    // Source and result water buffers
-    auto oldPointWaterBuffer = mPoints.MakeWaterBufferCopy();
-    float const * restrict oldPointWaterBufferData = oldPointWaterBuffer->data();
+    // Source and result water buffers; the source buffer is only populated
+    // for wet points and their neighbors
+    auto oldPointWaterBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict oldPointWaterBufferData = oldPointWaterBuffer->data();
     float * restrict newPointWaterBufferData = mPoints.GetWaterBufferAsFloat();
-    vec2f * restrict oldPointWaterVelocityBufferData = mPoints.GetWaterVelocityBufferAsVec2();
+    vec2f const * restrict oldPointWaterVelocityBufferData = static_cast<Points const &>(mPoints).GetWaterVelocityBufferAsVec2();
     vec2f * restrict newPointWaterMomentumBufferData = mPoints.GetWaterMomentumBufferAsVec2f();
 
+    for (auto const pointIndex : mPoints.GetWetPoints())
+    {
+        oldPointWaterBufferData[pointIndex] = newPointWaterBufferData[pointIndex];
+
+        for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+        {
+            oldPointWaterBufferData[cs.OtherEndpointIndex] = newPointWaterBufferData[cs.OtherEndpointIndex];
+        }
+    }
+
     // Weights of outbound water flows along each spring, including impermeable ones;
     // set to zero for springs whose resultant scalar water velocities are
     // directed towards the point being visited
@@ -2903,12 +3063,16 @@ void Ship::UpdateWaterVelocities(
     //  0.0f: point has water
     //
 
+    // We only need these for the neighbors of wet points
     auto pointFreenessFactorBuffer = mPoints.AllocateWorkBufferFloat();
     float * restrict pointFreenessFactorBufferData = pointFreenessFactorBuffer->data();
-    for (auto pointIndex : mPoints.RawShipPoints())
+    for (auto const pointIndex : mPoints.GetWetPoints())
     {
-        pointFreenessFactorBufferData[pointIndex] =
-            FastExp(-oldPointWaterBufferData[pointIndex] * 10.0f);
+        for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+        {
+            pointFreenessFactorBufferData[cs.OtherEndpointIndex] =
+                FastExp(-oldPointWaterBufferData[cs.OtherEndpointIndex] * 10.0f);
+        }
     }
 
     // Count of non-hull free and drowned neighbor points for a given point
@@ -2920,13 +3084,17 @@ void Ship::UpdateWaterVelocities(
 #endif
 
     //
-    // Visit all non-ephemeral points and move water and its momenta
+    // Visit all wet points and move water and its momenta
     //
     // No need to visit ephemeral points as they have no springs
     //
 
-    for (auto pointIndex : mPoints.RawShipPoints())
+    // Note: the set of wet points grows while we visit it, as water reaches dry points
+    size_t const wetPointCount = mPoints.GetWetPoints().size();
+    for (size_t w = 0; w < wetPointCount; ++w)
     {
+        ElementIndex const pointIndex = mPoints.GetWetPoints()[w];
+
         //
         // 1) Calculate water momenta along *all* springs connected to this point,
         //    including impermeable ones - as we'll eventually bounce back along those
@@ -3075,6 +3243,11 @@ void Ship::UpdateWaterVelocities(
                 newPointWaterBufferData[pointIndex] -= springOutboundQuantityOfWater;
                 newPointWaterBufferData[cs.OtherEndpointIndex] += springOutboundQuantityOfWater;
 
+                if (springOutboundQuantityOfWater != 0.0f)
+                {
+                    mPoints.AddWetPoint(cs.OtherEndpointIndex);
+                }
+
                 // Remove "old momentum" (old velocity) from point
                 newPointWaterMomentumBufferData[pointIndex] -=
                     oldPointWaterVelocityBufferData[pointIndex]
@@ -3273,6 +3446,42 @@ void Ship::RecalculateLightDiffusionParallelism(ThreadPool const & simulationThr
     }
 }
 
+void Ship::RecalculateWorldParticleForcesParallelism(ThreadPool const & simulationThreadPool)
+{
+    auto const simulationParallelism = simulationThreadPool.GetParallelism();
+
+    LogMessage("Ship::RecalculateWorldParticleForcesParallelism: simulationParallelism=", simulationParallelism);
+
+    //
+    // Prepare tasks
+    //
+
+    mWorldParticleForcesTasks.clear();
+
+    ElementCount const numberOfPoints = mPoints.GetElementCount(); // Includes ephemerals
+
+    auto const pointShards = CalculatePointShards(
+        numberOfPoints,
+        simulationThreadPool);
+
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < simulationParallelism; ++t)
+    {
+        ElementIndex const pointEnd = pointStart + static_cast<ElementCount>(pointShards[t]);
+        assert(pointEnd <= numberOfPoints);
+
+        mWorldParticleForcesTasks.emplace_back(
+            [this, pointStart, pointEnd]()
+            {
+                ApplyWorldParticleForces(
+                    pointStart,
+                    pointEnd);
+            });
+
+        pointStart = pointEnd;
+    }
+}
+
 void Ship::DiffuseLight(
     SimulationParameters const & simulationParameters,
     ThreadManager & threadManager)
@@ -3499,6 +3708,9 @@ void Ship::PropagateHeat(
             newPointTemperatureBufferData[pointIndex] -=
                 std::max(dissipationDeltaT, deltaT);
         }
+
+        // Track points that may now ignite or explode
+        mPoints.OnTemperatureChanged(pointIndex, simulationParameters.IgnitionTemperatureAdjustment);
     }
 }
 
@@ -3763,12 +3975,18 @@ void Ship::UpdateForSimulationParameters(
     if (simulationParallelism != mCurrentSimulationParallelism
         || simulationParameters.SpringRelaxationParallelComputationMode != mCurrentSpringRelaxationParallelComputationMode)
     {
+        // Start adaptive sharding from scratch
+        mSpringRelaxationShardBalancer.Reset(simulationParallelism);
+
         // Re-calculate spring relaxation parallelism
         RecalculateSpringRelaxationParallelism(simulationThreadPool, simulationParameters);
 
         // Re-calculate light diffusion parallelism
         RecalculateLightDiffusionParallelism(simulationThreadPool);
 
+        // Re-calculate world particle forces parallelism
+        RecalculateWorldParticleForcesParallelism(simulationThreadPool);
+
         // Remember new values
         mCurrentSimulationParallelism = simulationParallelism;
         mCurrentSpringRelaxationParallelComputationMode = simulationParameters.SpringRelaxationParallelComputationMode;
@@ -4507,9 +4725,11 @@ void Ship::InternalSpawnWaterSplash(
             planeId,
             simulationParameters);
 
-        // Store cached depth for it, as we might be calculating cached depths at this moment
-        assert(splashPointIndex != NoneElementIndex);
-        outputCachedPointDepths[splashPointIndex] = impactDepth;
+        if (splashPointIndex != NoneElementIndex)
+        {
+            // Store cached depth for it, as we might be calculating cached depths at this moment
+            outputCachedPointDepths[splashPointIndex] = impactDepth;
+        }
     }
 }
 
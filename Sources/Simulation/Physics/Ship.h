@@ -24,7 +24,9 @@
 #include <Core/ImageData.h>
 #include <Core/PerfStats.h>
 #include <Core/RunningAverage.h>
+#include <Core/ShardBalancer.h>
 #include <Core/ThreadManager.h>
+#include <Core/TriangleGrid.h>
 #include <Core/Vectors.h>
 
 #include <array>
@@ -67,6 +69,14 @@ public:
 
     Geometry::AABB CalculateParticleAABB() const;
 
+    /*
+     * Populates the grid with all the triangles that might end up in the specified
+     * region during the current simulation step.
+     */
+    void BuildTriangleGrid(
+        Geometry::AABB const & region,
+        Geometry::TriangleGrid & grid) const;
+
     PlaneId GetMaxPlaneId() const
     {
         return mMaxMaxPlaneId;
@@ -105,6 +115,7 @@ public:
         float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
         SimulationParameters const & simulationParameters,
+        VisibleWorld const & visibleWorld,
         StressRenderModeType stressRenderMode,
         Geometry::ShipAABBSet & externalAabbSet,
         ThreadManager & threadManager,
@@ -588,17 +599,132 @@ private:
 
     std::list<Interaction> mQueuedInteractions;
 
-    void ApplyBlastAt(Interaction::ArgumentsUnion::BlastArguments const & args, SimulationParameters const & simulationParameters);
+    void Pull(Interaction::ArgumentsUnion::PullArguments const & args);
 
-    void DrawTo(Interaction::ArgumentsUnion::DrawArguments const & args);
+    //
+    // Interaction fields
+    //
+    // Queued field interactions are not applied one by one; rather, each is first
+    // prepared into its evaluation form, and then all fields are evaluated together
+    // in a single pass over the points.
+    //
 
-    void Pull(Interaction::ArgumentsUnion::PullArguments const & args);
+    struct InteractionFields
+    {
+        struct Blast
+        {
+            vec2f CenterPos;
+            float SquareRadius;
+            float ForceMagnitude;
+            Geometry::AABB Aabb;
+        };
 
-    void SwirlAt(Interaction::ArgumentsUnion::SwirlArguments const & args);
+        struct Draw
+        {
+            vec2f CenterPos;
+            float Strength;
+        };
 
-    void ApplyAntiGravityField(Interaction::ArgumentsUnion::AntiGravityFieldArguments const & args, SimulationParameters const & simulationParameters);
+        struct Swirl
+        {
+            vec2f CenterPos;
+            float Strength;
+        };
 
-    void ApplyTornado(Interaction::ArgumentsUnion::TornadoArguments const & args, SimulationParameters const & simulationParameters);
+        struct AntiGravity
+        {
+            vec2f StartPos;
+            vec2f Segment; // End - Start
+            float SegmentSquaredLength;
+            float StrengthMultiplier;
+            float TargetVelocityMagnitudeBase;
+        };
+
+        struct Tornado
+        {
+            float CenterX;
+            float EffectiveBottom;
+            float EffectiveTop;
+            float Height;
+            float EffectiveHeight;
+            float EffectiveTopRadius;
+            float EffectiveMiddleRadius;
+            float EffectiveBottomRadius;
+            float RotationPhase;
+            float StrengthMultiplier;
+            float HeatDepth;
+            float EffectiveOrbitV;
+            float EffectiveUpwardForceMagnitude;
+            float TargetTemperature;
+            Geometry::AABB Aabb;
+        };
+
+        // Fields affecting all points
+        std::vector<Draw> Draws;
+        std::vector<Swirl> Swirls;
+        std::vector<AntiGravity> AntiGravities;
+
+        // Fields affecting only the points within their AABB
+        std::vector<Blast> Blasts;
+        std::vector<Tornado> Tornadoes;
+
+        bool IsEmpty() const
+        {
+            return Draws.empty() && Swirls.empty() && AntiGravities.empty() && Blasts.empty() && Tornadoes.empty();
+        }
+
+        void Clear()
+        {
+            Draws.clear();
+            Swirls.clear();
+            AntiGravities.clear();
+            Blasts.clear();
+            Tornadoes.clear();
+        }
+    };
+
+    InteractionFields mInteractionFields;
+
+    void PrepareBlastField(Interaction::ArgumentsUnion::BlastArguments const & args);
+
+    void PrepareDrawField(Interaction::ArgumentsUnion::DrawArguments const & args);
+
+    void PrepareSwirlField(Interaction::ArgumentsUnion::SwirlArguments const & args);
+
+    void PrepareAntiGravityField(Interaction::ArgumentsUnion::AntiGravityFieldArguments const & args, SimulationParameters const & simulationParameters);
+
+    void PrepareTornadoField(Interaction::ArgumentsUnion::TornadoArguments const & args, SimulationParameters const & simulationParameters);
+
+    // The state of an interaction fields task, i.e. of a shard of points
+    struct InteractionFieldsTaskState
+    {
+        // The bounded fields intersecting the shard's AABB
+        std::vector<InteractionFields::Blast const *> Blasts;
+        std::vector<InteractionFields::Tornado const *> Tornadoes;
+
+        void Reset()
+        {
+            Blasts.clear();
+            Tornadoes.clear();
+        }
+    };
+
+    // One per shard, grown as needed
+    std::vector<InteractionFieldsTaskState> mInteractionFieldsTaskStates;
+
+    // The interaction fields tasks, populated and cleared at each run
+    std::vector<typename ThreadPool::Task> mInteractionFieldsTasks;
+
+    void ApplyInteractionFields(ThreadPool & simulationThreadPool);
+
+    void ApplyInteractionFields(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        InteractionFieldsTaskState & taskState);
+
+    void ApplyTornadoField(
+        ElementIndex pointIndex,
+        InteractionFields::Tornado const & tornado);
 
 private:
 
@@ -608,20 +734,30 @@ private:
 
     // Mechanical
 
-    void ApplyQueuedInteractionForces(SimulationParameters const & simulationParameters);
+    void ApplyQueuedInteractionForces(
+        SimulationParameters const & simulationParameters,
+        ThreadPool & simulationThreadPool);
 
     void ApplyWorldForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
         float currentSimulationTime,
         SimulationParameters const & simulationParameters,
-        Geometry::ShipAABBSet & externalAabbSet);
+        Geometry::ShipAABBSet & externalAabbSet,
+        ThreadPool & simulationThreadPool);
 
     void ApplyWorldParticleForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
         Buffer<float> & newCachedPointDepths,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadPool & simulationThreadPool);
+
+    void ApplyWorldParticleForces(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    void RecalculateWorldParticleForcesParallelism(ThreadPool const & simulationThreadPool);
 
     template<bool DoDisplaceWater>
     void ApplyWorldSurfaceForces(
@@ -630,18 +766,25 @@ private:
         Buffer<float> & newCachedPointDepths,
         float currentSimulationTime,
         SimulationParameters const & simulationParameters,
-        Geometry::ShipAABBSet & externalAabbSet);
+        Geometry::ShipAABBSet & externalAabbSet,
+        ThreadPool & simulationThreadPool);
 
     void ApplyStaticPressureForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadPool & simulationThreadPool);
+
+    struct StaticPressureTaskState;
 
     void ApplyStaticPressureForces(
         Frontiers::Frontier const & frontier,
         float effectiveAirDensity,
         float effectiveWaterDensity,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        StaticPressureTaskState & taskState);
+
+    void CalculateFrontierShards(size_t maxShardCount);
 
     //
     // Spring relaxation
@@ -671,7 +814,8 @@ private:
 
     void RunSpringRelaxation(
         ThreadManager & threadManager,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        PerfStats & perfStats);
 
     void RunSpringRelaxation_FullSpeed(ThreadManager & threadManager);
 
@@ -728,14 +872,22 @@ private:
         SpringRelaxationCoefficients const & coefficients,
         SimulationParameters const & simulationParameters);
 
+    void PrepareShipCollisions();
+
+    inline void HandleCollisionsWithOtherShips(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
     static std::vector<size_t> CalculateSpringRelaxationSpringShards(
         size_t totalSprings,
         size_t perfectSquareCount,
-        ThreadPool const & simulationThreadPool);
+        ThreadPool const & simulationThreadPool,
+        std::vector<float> const * shardWeights = nullptr); // Null when shards have no weights
 
     static std::vector<size_t> CalculatePointShards(
         size_t totalPoints,
-        ThreadPool const & simulationThreadPool);
+        ThreadPool const & simulationThreadPool,
+        std::vector<float> const * shardWeights = nullptr); // Null when shards have no weights
 
     static inline int GetSafeNumMechanicalDynamicsIterations(SimulationParameters const & simulationParameters);
 
@@ -753,6 +905,7 @@ private:
         float currentSimulationTime,
         Storm::Parameters const & stormParameters,
         SimulationParameters const & simulationParameters,
+        ThreadPool & simulationThreadPool,
         float & waterTakenInStep);
 
     void EqualizeInternalPressure(SimulationParameters const & simulationParameters);
@@ -1207,6 +1360,17 @@ private:
     // The last spring relaxation computation parameters; used to detect changes
     std::optional<SpringRelaxationParallelComputationModeType> mCurrentSpringRelaxationParallelComputationMode;
 
+    // Adaptive sharding (FullSpeed and Hybrid modes)
+
+    // The time each thread has spent working - i.e. not waiting for the other
+    // threads - during the current step. Each entry is only written by its thread,
+    // once per task.
+    // The vector is sized when the number of threads is known.
+    std::vector<GameChronometer::duration> mSpringRelaxationThreadWorkDurations;
+
+    // Weighs shards based on the work durations
+    ShardBalancer mSpringRelaxationShardBalancer;
+
     // Physics
 
     struct SpringRelaxationCoefficients
@@ -1227,6 +1391,23 @@ private:
     // The vector is sized when the number of threads is known.
     std::vector<CacheAligned<EnergeticSiltImpact>> mPerThreadSiltImpacts;
 
+    // The other ships we might be colliding with during the current step,
+    // each with a grid of its triangles in the collision region.
+    // Entries beyond the count are stale, kept for their storage.
+    struct ShipCollisionPartner
+    {
+        Ship const * OtherShip;
+        Geometry::TriangleGrid OtherShipTriangles;
+
+        ShipCollisionPartner()
+            : OtherShip(nullptr)
+            , OtherShipTriangles()
+        {}
+    };
+
+    std::vector<ShipCollisionPartner> mShipCollisionPartners;
+    size_t mShipCollisionPartnerCount;
+
     //
     // Static pressure
     //
@@ -1247,12 +1428,46 @@ private:
         {}
     };
 
-    // Buffer of StaticPressureOnPoint structs, aiding static pressure calculations.
-    //
-    // Note: index in this buffer is _not_ point index, this is simply a container.
-    // Note: may be populated for the same point multiple times, once for each crossing of
-    // the frontier through that point.
-    Buffer<StaticPressureOnPoint> mStaticPressureBuffer;
+    // The state of a static pressure task, i.e. of a shard of frontiers
+    struct StaticPressureTaskState
+    {
+        // Buffer of StaticPressureOnPoint structs, aiding static pressure calculations.
+        //
+        // Note: index in this buffer is _not_ point index, this is simply a container.
+        // Note: may be populated for the same point multiple times, once for each crossing of
+        // the frontier through that point.
+        Buffer<StaticPressureOnPoint> StaticPressureBuffer;
+
+        // The forces calculated by this task, to be applied as dynamic forces
+        std::vector<std::tuple<ElementIndex, vec2f>> PointForces;
+
+        // For statistics
+        float NetForceMagnitudeSum;
+        float NetForceMagnitudeCount;
+        float IterationsPercentagesSum;
+        float IterationsCount;
+
+        explicit StaticPressureTaskState(size_t maxPointCount)
+            : StaticPressureBuffer(maxPointCount)
+            , PointForces()
+            , NetForceMagnitudeSum(0.0f)
+            , NetForceMagnitudeCount(0.0f)
+            , IterationsPercentagesSum(0.0f)
+            , IterationsCount(0.0f)
+        {}
+
+        void Reset()
+        {
+            PointForces.clear();
+            NetForceMagnitudeSum = 0.0f;
+            NetForceMagnitudeCount = 0.0f;
+            IterationsPercentagesSum = 0.0f;
+            IterationsCount = 0.0f;
+        }
+    };
+
+    // One per shard, grown as needed
+    std::vector<StaticPressureTaskState> mStaticPressureTaskStates;
 
     // For statistics
     float mStaticPressureNetForceMagnitudeSum;
@@ -1290,6 +1505,143 @@ private:
     // The light diffusion tasks
     std::vector<typename ThreadPool::Task> mLightDiffusionTasks;
 
+    //
+    // World particle forces
+    //
+
+    // The inputs to the world particle forces tasks, valid for the current step
+    struct WorldParticleForcesState
+    {
+        float EffectiveAirDensity;
+        float EffectiveWaterDensity;
+        vec2f GlobalWindForce;
+        float AirFrictionDragCoefficient;
+        float WaterFrictionDragCoefficient;
+        float * NewCachedPointDepths;
+    };
+
+    WorldParticleForcesState mWorldParticleForcesState;
+
+    // The world particle forces tasks
+    std::vector<typename ThreadPool::Task> mWorldParticleForcesTasks;
+
+    //
+    // Frontier shards
+    //
+
+    // The boundaries of the current frontier shards, as ordinals in the
+    // frontier IDs; shard i spans [boundaries[i], boundaries[i + 1])
+    std::vector<size_t> mFrontierShardBoundaries;
+
+    // The tasks visiting frontier shards, populated and cleared at each run
+    std::vector<typename ThreadPool::Task> mFrontierShardTasks;
+
+    //
+    // Pressure and water inflow
+    //
+
+    // The state of a pressure and water inflow task, i.e. of a shard of leaking points
+    struct PressureAndWaterInflowTaskState
+    {
+        std::vector<ElementIndex> AirBubblePoints; // Points to spawn air bubbles at, in order
+        float WaterTakenInStep;
+
+        PressureAndWaterInflowTaskState()
+            : AirBubblePoints()
+            , WaterTakenInStep(0.0f)
+        {}
+
+        void Reset()
+        {
+            AirBubblePoints.clear();
+            WaterTakenInStep = 0.0f;
+        }
+    };
+
+    // One per shard, grown as needed
+    std::vector<PressureAndWaterInflowTaskState> mPressureAndWaterInflowTaskStates;
+
+    // The pressure and water inflow tasks, populated and cleared at each run
+    std::vector<typename ThreadPool::Task> mPressureAndWaterInflowTasks;
+
+    //
+    // World surface forces
+    //
+
+    struct WaterFoam
+    {
+        vec2f Position;
+        float VerticalDirection;
+        float Strength;
+        PlaneId Plane;
+
+        WaterFoam()
+            : Position()
+            , VerticalDirection(0.0f)
+            , Strength(0.0f)
+            , Plane(NonePlaneId)
+        { }
+
+        WaterFoam(
+            vec2f const & position,
+            float verticalDirection,
+            float strength,
+            PlaneId plane)
+            : Position(position)
+            , VerticalDirection(verticalDirection)
+            , Strength(strength)
+            , Plane(plane)
+        { }
+    };
+
+    struct WaterSplash
+    {
+        vec2f Position;
+        vec2f SpawnDirection;
+        float Strength;
+        PlaneId Plane;
+
+        WaterSplash()
+            : Position()
+            , SpawnDirection()
+            , Strength(0.0f)
+            , Plane(NonePlaneId)
+        {
+        }
+
+        WaterSplash(
+            vec2f const & position,
+            vec2f const & spawnDirection,
+            float strength,
+            PlaneId plane)
+            : Position(position)
+            , SpawnDirection(spawnDirection)
+            , Strength(strength)
+            , Plane(plane)
+        {
+        }
+    };
+
+    // The state of a world surface forces task, i.e. of a shard of frontiers
+    struct WorldSurfaceForcesTaskState
+    {
+        std::vector<std::tuple<ElementIndex, vec2f>> PointStaticForces;
+        std::vector<std::tuple<float, float>> OceanSurfaceDisplacements; // x, displacement
+        WaterFoam StrongestWaterFoam;
+        WaterSplash StrongestWaterSplash;
+
+        void Reset()
+        {
+            PointStaticForces.clear();
+            OceanSurfaceDisplacements.clear();
+            StrongestWaterFoam = WaterFoam();
+            StrongestWaterSplash = WaterSplash();
+        }
+    };
+
+    // One per shard, grown as needed
+    std::vector<WorldSurfaceForcesTaskState> mWorldSurfaceForcesTaskStates;
+
     //
     // Debug
     //
@@ -518,7 +518,7 @@ bool Ship::DestroyAt(
         [&](ElementIndex pointIndex)
         {
             // Choose a detach velocity - using the same distribution as Debris
-            vec2f const detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
+            vec2f const detachVelocity = mPoints.GetRandomStream().GenerateUniformRadialVector(
                 SimulationParameters::MinDebrisParticlesVelocity,
                 SimulationParameters::MaxDebrisParticlesVelocity);
 
@@ -581,7 +581,7 @@ bool Ship::DestroyAt(
                         ? 1.0f
                         : (1.0f - (pointSquareDistance / squareRadius)) * (1.0f - (pointSquareDistance / squareRadius));
 
-                    if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+                    if (mPoints.GetRandomStream().GenerateNormalizedUniformReal() <= destroyProbability)
                     {
                         doDestroyPoint(pointIndex);
 
@@ -730,6 +730,8 @@ bool Ship::ApplyHeatBlasterAt(
                 pointIndex,
                 std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
 
+            mPoints.OnTemperatureChanged(pointIndex, simulationParameters.IgnitionTemperatureAdjustment);
+
             // Remember we've found a point
             atLeastOnePointFound = true;
         }
@@ -807,34 +809,17 @@ void Ship::ApplyBlastAt(
             forceMagnitude));
 }
 
-void Ship::ApplyBlastAt(
-    Interaction::ArgumentsUnion::BlastArguments const & args,
-    SimulationParameters const & /*simulationParameters*/)
+void Ship::PrepareBlastField(Interaction::ArgumentsUnion::BlastArguments const & args)
 {
-    float const squareRadius = args.Radius * args.Radius;
-
-    // Visit all points
-    for (auto pointIndex : mPoints)
-    {
-        vec2f const pointRadius = mPoints.GetPosition(pointIndex) - args.CenterPos;
-        float const squarePointDistance = pointRadius.squareLength();
-        if (squarePointDistance < squareRadius)
-        {
-            float const pointRadiusLength = std::sqrt(squarePointDistance);
-
-            //
-            // Apply blast force
-            //
-            // (inversely proportional to square root of distance, not second power as one would expect though)
-            //
-
-            mPoints.AddStaticForce(
-                pointIndex,
-                pointRadius.normalise(pointRadiusLength)
-                * args.ForceMagnitude * mPoints.GetFoobarSensitivity(pointIndex)
-                / std::sqrt(std::max((pointRadiusLength * 0.4f) + 0.6f, 1.0f)));
-        }
-    }
+    mInteractionFields.Blasts.push_back({
+        args.CenterPos,
+        args.Radius * args.Radius,
+        args.ForceMagnitude,
+        Geometry::AABB(
+            args.CenterPos.x - args.Radius,
+            args.CenterPos.x + args.Radius,
+            args.CenterPos.y + args.Radius,
+            args.CenterPos.y - args.Radius) });
 }
 
 bool Ship::ApplyElectricSparkAt(
@@ -935,27 +920,11 @@ void Ship::DrawTo(
             strength));
 }
 
-void Ship::DrawTo(Interaction::ArgumentsUnion::DrawArguments const & args)
+void Ship::PrepareDrawField(Interaction::ArgumentsUnion::DrawArguments const & args)
 {
-    //
-    // F = ForceStrength/sqrt(distance), along radius
-    //
-
-    for (auto pointIndex : mPoints)
-    {
-        vec2f displacement = (args.CenterPos - mPoints.GetPosition(pointIndex));
-        float forceMagnitude = args.Strength / sqrtf(0.1f + displacement.length());
-
-        // Scale back force if mass is small
-        // 0  -> 0
-        // 50 -> 1
-        // +INF -> 1
-        forceMagnitude *= std::min(mPoints.GetMass(pointIndex) / 50.0f, 1.0f);
-
-        mPoints.AddStaticForce(
-            pointIndex,
-            displacement.normalise() * forceMagnitude);
-    }
+    mInteractionFields.Draws.push_back({
+        args.CenterPos,
+        args.Strength });
 }
 
 void Ship::SwirlAt(
@@ -969,21 +938,11 @@ void Ship::SwirlAt(
             strength));
 }
 
-void Ship::SwirlAt(Interaction::ArgumentsUnion::SwirlArguments const & args)
+void Ship::PrepareSwirlField(Interaction::ArgumentsUnion::SwirlArguments const & args)
 {
-    //
-    // F = ForceStrength*radius/sqrt(distance), perpendicular to radius
-    //
-
-    for (auto pointIndex : mPoints)
-    {
-        vec2f displacement = (args.CenterPos - mPoints.GetPosition(pointIndex));
-        float forceMagnitude = args.Strength / sqrtf(0.1f + displacement.length());
-
-        mPoints.AddStaticForce(
-            pointIndex,
-            vec2f(-displacement.y, displacement.x) * forceMagnitude);
-    }
+    mInteractionFields.Swirls.push_back({
+        args.CenterPos,
+        args.Strength });
 }
 
 void Ship::ApplyAntiGravityField(
@@ -999,66 +958,28 @@ void Ship::ApplyAntiGravityField(
             strengthMultiplier));
 }
 
-void Ship::ApplyAntiGravityField(
+void Ship::PrepareAntiGravityField(
     Interaction::ArgumentsUnion::AntiGravityFieldArguments const & args,
     SimulationParameters const & simulationParameters)
 {
-    float const targetVelocityMagnitudeBase =
-        15.0f
-        * args.StrengthMultiplier
-        * simulationParameters.AntiGravityFieldAccelerationAdjustment
-        * (simulationParameters.IsUltraViolentMode ? 5.0f : 1.0f);
-
     float const segmentSquaredLength = (args.StartPos - args.EndPos).squareLength();
     if (segmentSquaredLength == 0.0f)
     {
         return;
     }
 
-    for (auto pointIndex : mPoints)
-    {
-        vec2f const & p = mPoints.GetPosition(pointIndex);
-        float const m = mPoints.GetMass(pointIndex);
-
-        // Consider the line extending the segment, parameterized as P1 + t (P2 - P1).
-        // We find projection of point P onto the line.
-        // It falls where t = [(P-P1) . (P2-P)] / |P2-P1|^2
-        // We clamp t from [0,1] to handle points outside the segment P1-P2.
-        const float t = Clamp((p - args.StartPos).dot(args.EndPos - args.StartPos) / segmentSquaredLength, 0.0f, 1.0f);
-        vec2f const projection = args.StartPos + (args.EndPos - args.StartPos) * t;  // Projection falls on the segment
-        float const distance = (projection - p).length();
-        vec2f const projectionDirectionNormalized = (projection - p).normalise(distance);
-
-        // Counteract gravity, but towards the segment
-        vec2f force = projectionDirectionNormalized * SimulationParameters::GravityMagnitude * m;
-
-        // Calculate mass damper: 0.25 when light, 1.0 when heavy - so light particles stay behind
-        float constexpr MinMassDamper = 0.35f;
-        float const ls = LinearStep(10.0f, 800.0f, m);
-        float const massDamper = MinMassDamper + ls * ls * (1.0f - MinMassDamper);
-
-        // Calculate distance damper - no more action when closer than a limit distance,
-        // which depends on the mass itself
-        float const limitDistance = (18.5f + 7.0f * mPoints.GetRandomNormalizedUniformPersonalitySeed(pointIndex)) * massDamper / args.StrengthMultiplier;
-        float const distanceDamper = LinearStep(limitDistance - limitDistance * 0.2f, limitDistance + limitDistance * 0.2f, distance);
-
-        //
-        // Calculate our magic force
-        //
-        // We add a force to impose a specific velocity towards the force field segment, leaving untouched
-        // the current velocity component orthogonal to that
-        //
-
-        float const targetVelocityMagnitudeInDirection = targetVelocityMagnitudeBase * massDamper;
-        vec2f const & currentVelocity = mPoints.GetVelocity(pointIndex);
-        float const currentVelocityMagnitudeInDirection = currentVelocity.dot(projectionDirectionNormalized);
-        float constexpr DesiredVelocityConvergenceRate = 0.3f; // The higher, the more breakage
-        float const desiredVelocityMagnitudeInDirection = currentVelocityMagnitudeInDirection + (targetVelocityMagnitudeInDirection - currentVelocityMagnitudeInDirection) * DesiredVelocityConvergenceRate;
-        vec2f const requiredAcceleration = projectionDirectionNormalized * (desiredVelocityMagnitudeInDirection - currentVelocityMagnitudeInDirection) / SimulationParameters::SimulationStepTimeDuration<float>;
-        force += requiredAcceleration * m * distanceDamper;
+    float const targetVelocityMagnitudeBase =
+        15.0f
+        * args.StrengthMultiplier
+        * simulationParameters.AntiGravityFieldAccelerationAdjustment
+        * (simulationParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-        mPoints.AddStaticForce(pointIndex, force);
-    }
+    mInteractionFields.AntiGravities.push_back({
+        args.StartPos,
+        args.EndPos - args.StartPos,
+        segmentSquaredLength,
+        args.StrengthMultiplier,
+        targetVelocityMagnitudeBase });
 }
 
 void Ship::ApplyTornado(
@@ -1080,7 +1001,7 @@ void Ship::ApplyTornado(
             heatDepth));
 }
 
-void Ship::ApplyTornado(
+void Ship::PrepareTornadoField(
     Interaction::ArgumentsUnion::TornadoArguments const & args,
     SimulationParameters const & simulationParameters)
 {
@@ -1092,10 +1013,11 @@ void Ship::ApplyTornado(
     float constexpr ExtraHeightFraction = 1.1f;
     float const effectiveHeight = args.Size.height * ExtraHeightFraction;
 
-    // Quick checks on vortex AABB
+    // Vortex AABB
     float const centerX = args.BottomCenterPos.x;
     float const effectiveTop = args.BottomCenterPos.y + effectiveHeight;
     float const effectiveBottom = args.BottomCenterPos.y;
+    float const maxEffectiveRadius = std::max({ effectiveTopRadius, effectiveMiddleRadius, effectiveBottomRadius });
 
     // The magnitude V of the particle velocity in the vortex is of our choice (rendering / shader syncs to it);
     // high enough to cause breakages
@@ -1115,122 +1037,559 @@ void Ship::ApplyTornado(
         700.0f // Magic
         * (simulationParameters.IsUltraViolentMode ? 2.0f : 1.0f);
 
-    for (auto pointIndex : mPoints)
+    mInteractionFields.Tornadoes.push_back({
+        centerX,
+        effectiveBottom,
+        effectiveTop,
+        args.Size.height,
+        effectiveHeight,
+        effectiveTopRadius,
+        effectiveMiddleRadius,
+        effectiveBottomRadius,
+        args.RotationPhase,
+        args.StrengthMultiplier,
+        args.HeatDepth,
+        effectiveOrbitV,
+        effectiveUpwardForceMagnitude,
+        targetTemperature,
+        Geometry::AABB(
+            centerX - maxEffectiveRadius,
+            centerX + maxEffectiveRadius,
+            effectiveTop,
+            effectiveBottom) });
+}
+
+void Ship::ApplyInteractionFields(ThreadPool & simulationThreadPool)
+{
+    ElementCount const pointCount = mPoints.GetElementCount(); // Includes ephemerals
+
+    size_t constexpr MinPointsPerShard = 1024;
+
+    size_t const shardCount = std::max(
+        std::min(simulationThreadPool.GetParallelism(), static_cast<size_t>(pointCount) / MinPointsPerShard),
+        size_t(1));
+
+    if (mInteractionFieldsTaskStates.size() < shardCount)
     {
-        vec2f const & p = mPoints.GetPosition(pointIndex);
+        mInteractionFieldsTaskStates.resize(shardCount);
+    }
+
+    for (size_t t = 0; t < shardCount; ++t)
+    {
+        mInteractionFieldsTaskStates[t].Reset();
+    }
 
-        if (p.y > effectiveBottom && p.y <= effectiveTop) // Note: skipping y=effectiveBottom to ensure non-zero radius
+    if (shardCount == 1)
+    {
+        ApplyInteractionFields(0, pointCount, mInteractionFieldsTaskStates[0]);
+    }
+    else
+    {
+        // Shards start at vectorization word boundaries
+        auto const calculateShardStart = [pointCount, shardCount](size_t t) -> ElementIndex
+        {
+            return static_cast<ElementIndex>(
+                (t * pointCount / shardCount) / vectorization_float_count<size_t> * vectorization_float_count<size_t>);
+        };
+
+        assert(mInteractionFieldsTasks.empty());
+
+        for (size_t t = 0; t < shardCount; ++t)
+        {
+            ElementIndex const startPointIndex = calculateShardStart(t);
+            ElementIndex const endPointIndex = (t == shardCount - 1) ? pointCount : calculateShardStart(t + 1);
+
+            mInteractionFieldsTasks.emplace_back(
+                [this, startPointIndex, endPointIndex, t]()
+                {
+                    ApplyInteractionFields(
+                        startPointIndex,
+                        endPointIndex,
+                        mInteractionFieldsTaskStates[t]);
+                });
+        }
+
+        //
+        // Each point is only visited by its own shard, hence the outcome
+        // does not depend on the sharding
+        //
+
+        simulationThreadPool.RunAndClear(mInteractionFieldsTasks);
+    }
+}
+
+void Ship::ApplyInteractionFields(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    InteractionFieldsTaskState & taskState)
+{
+    assert((startPointIndex % vectorization_float_count<ElementIndex>) == 0);
+
+    vec2f const * restrict const positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f const * restrict const velocityBuffer = mPoints.GetVelocityBufferAsVec2();
+    float const * restrict const massBuffer = mPoints.GetMassBufferAsFloat();
+    float const * restrict const foobarSensitivityBuffer = mPoints.GetFoobarSensitivityBufferAsFloat();
+    float const * restrict const personalitySeedBuffer = mPoints.GetRandomNormalizedUniformPersonalitySeedBufferAsFloat();
+    vec2f * restrict const staticForceBuffer = mPoints.GetStaticForceBufferAsVec2();
+
+    auto const & draws = mInteractionFields.Draws;
+    auto const & swirls = mInteractionFields.Swirls;
+    auto const & antiGravities = mInteractionFields.AntiGravities;
+
+    //
+    // Reject the bounded fields that may not reach any of our points
+    //
+
+    if (!mInteractionFields.Blasts.empty() || !mInteractionFields.Tornadoes.empty())
+    {
+        Geometry::AABB shardAabb;
+        for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
         {
-            // Calculate radius, depending on y
-            float const shapeYFactor = std::min((p.y - effectiveBottom) / args.Size.height, 1.0f);
-            float const effectiveRadius = (shapeYFactor <= 0.5f)
-                ? effectiveBottomRadius + (effectiveMiddleRadius - effectiveBottomRadius) * (shapeYFactor * 2.0f)
-                : effectiveMiddleRadius + (effectiveTopRadius - effectiveMiddleRadius) * ((shapeYFactor - 0.5f) * 2.0f);
-
-            // Normalized distance from center
-            float const rn = (p.x - centerX) / effectiveRadius;
-            float const absRn = std::fabsf(rn);
-            if (absRn <= 1.0f)
+            shardAabb.ExtendTo(positionBuffer[pointIndex]);
+        }
+
+        for (auto const & blast : mInteractionFields.Blasts)
+        {
+            if (blast.Aabb.Intersects(shardAabb))
+            {
+                taskState.Blasts.push_back(&blast);
+            }
+        }
+
+        for (auto const & tornado : mInteractionFields.Tornadoes)
+        {
+            if (tornado.Aabb.Intersects(shardAabb))
             {
-                float const m = mPoints.GetMass(pointIndex);
+                taskState.Tornadoes.push_back(&tornado);
+            }
+        }
+    }
 
-                // We bump forces with the material's wind receptivity,
-                // as tornadoes are made of wind :-)
-                float const materialFactor = m * (1.0f + mPoints.GetMaterialWindReceptivity(pointIndex));
+    bool const hasForceFields =
+        !draws.empty()
+        || !swirls.empty()
+        || !antiGravities.empty()
+        || !taskState.Blasts.empty();
 
-                // Tornado strength is lower at the edges
-                float const tornadoDepth =
-                    (1.0f - LinearStep(0.9f, 1.0f, absRn))
-                    * (1.0f - LinearStep(args.Size.height, effectiveHeight, (p.y - effectiveBottom)));
+    if (!hasForceFields && taskState.Tornadoes.empty())
+    {
+        return;
+    }
 
-                if (!mPoints.IsEphemeral(pointIndex))
+    //
+    // Visit all points, evaluating all fields on each point and accumulating
+    // their forces
+    //
+
+    ElementIndex pointIndex = startPointIndex;
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+    if (hasForceFields)
+    {
+        __m128 const Zero = _mm_setzero_ps();
+        __m128 const One = _mm_set1_ps(1.0f);
+
+        for (; pointIndex + 4 <= endPointIndex; pointIndex += 4)
+        {
+            // Positions, de-interleaved
+            __m128 const p01 = _mm_load_ps(reinterpret_cast<float const *>(positionBuffer + pointIndex));
+            __m128 const p23 = _mm_load_ps(reinterpret_cast<float const *>(positionBuffer + pointIndex + 2));
+            __m128 const px = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 const py = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+
+            __m128 const m = _mm_load_ps(massBuffer + pointIndex);
+
+            __m128 fx = Zero;
+            __m128 fy = Zero;
+
+            // Blasts
+            if (!taskState.Blasts.empty())
+            {
+                __m128 const foobarSensitivity = _mm_load_ps(foobarSensitivityBuffer + pointIndex);
+
+                for (auto const * const blast : taskState.Blasts)
                 {
-                    //
-                    // 1. Weaken structures; simulates 3D forces pulling structures towards the camera or away from it
-                    //
+                    __m128 const dx = _mm_sub_ps(px, _mm_set1_ps(blast->CenterPos.x));
+                    __m128 const dy = _mm_sub_ps(py, _mm_set1_ps(blast->CenterPos.y));
+                    __m128 const squareDistance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+                    __m128 const distance = _mm_sqrt_ps(squareDistance);
+
+                    __m128 const forceMagnitude = _mm_div_ps(
+                        _mm_mul_ps(_mm_set1_ps(blast->ForceMagnitude), foobarSensitivity),
+                        _mm_sqrt_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(distance, _mm_set1_ps(0.4f)), _mm_set1_ps(0.6f)), One)));
+
+                    // Only within radius, and zero at the center
+                    __m128 const scale = _mm_and_ps(
+                        _mm_div_ps(forceMagnitude, distance),
+                        _mm_and_ps(
+                            _mm_cmplt_ps(squareDistance, _mm_set1_ps(blast->SquareRadius)),
+                            _mm_cmpneq_ps(distance, Zero)));
+
+                    fx = _mm_add_ps(fx, _mm_mul_ps(dx, scale));
+                    fy = _mm_add_ps(fy, _mm_mul_ps(dy, scale));
+                }
+            }
 
-                    // Delta-weakness to reach our target
-                    float constexpr TargetWeakness = 0.12f;
-                    float const currentWeakness = mPoints.GetWeakness(pointIndex);
-                    float const deltaWeakness = (TargetWeakness - currentWeakness) * 0.1f; // Reach slowly
+            // Draws
+            if (!draws.empty())
+            {
+                __m128 const massFactor = _mm_min_ps(_mm_div_ps(m, _mm_set1_ps(50.0f)), One);
 
-                    // How much we weaken depends on the strength of the point, so we may weaken "structurally", not homogeneuosly
-                    // float const weakeningStrength = 1.0f - LinearStep(0.02f, 0.27f, mPoints.GetFactoryStrength(pointIndex)); // This was a totally different way, opposite (weakening the weak)
-                    float const weakeningStrength = LinearStep(0.01f, 0.07f, mPoints.GetFactoryStrength(pointIndex));
+                for (auto const & draw : draws)
+                {
+                    __m128 const dx = _mm_sub_ps(_mm_set1_ps(draw.CenterPos.x), px);
+                    __m128 const dy = _mm_sub_ps(_mm_set1_ps(draw.CenterPos.y), py);
+                    __m128 const distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
 
-                    mPoints.SetWeakness(
-                        pointIndex,
-                        currentWeakness + deltaWeakness * weakeningStrength * tornadoDepth * args.StrengthMultiplier);
+                    __m128 const forceMagnitude = _mm_mul_ps(
+                        _mm_div_ps(_mm_set1_ps(draw.Strength), _mm_sqrt_ps(_mm_add_ps(distance, _mm_set1_ps(0.1f)))),
+                        massFactor);
 
-                    //
-                    // Heat
-                    //
+                    __m128 const scale = _mm_and_ps(
+                        _mm_div_ps(forceMagnitude, distance),
+                        _mm_cmpneq_ps(distance, Zero));
 
-                    // Increase temperature to target - slowly
-                    float const currentTemperature = mPoints.GetTemperature(pointIndex);
-                    mPoints.SetTemperature(
-                        pointIndex,
-                        currentTemperature + (targetTemperature - currentTemperature) * 0.007f * args.HeatDepth);
+                    fx = _mm_add_ps(fx, _mm_mul_ps(dx, scale));
+                    fy = _mm_add_ps(fy, _mm_mul_ps(dy, scale));
                 }
+            }
 
-                //
-                // 2. Apply forces
-                //
+            // Swirls
+            for (auto const & swirl : swirls)
+            {
+                __m128 const dx = _mm_sub_ps(_mm_set1_ps(swirl.CenterPos.x), px);
+                __m128 const dy = _mm_sub_ps(_mm_set1_ps(swirl.CenterPos.y), py);
+                __m128 const distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
 
-                // In order to simulate a vortex, we apply a centripetal force projected along the X axis,
-                // emulating the projection of an orbital motion.
-                //
-                // For a circular orbit motion, the velocity, the radius, and the centripetal acceleration must satisfy:
-                //  V^2/R = |Ac|
-                //
-                // Fixing V and R, we have |Fc| = m*V^2/R
+                __m128 const forceMagnitude = _mm_div_ps(
+                    _mm_set1_ps(swirl.Strength),
+                    _mm_sqrt_ps(_mm_add_ps(distance, _mm_set1_ps(0.1f))));
+
+                fx = _mm_sub_ps(fx, _mm_mul_ps(dy, forceMagnitude));
+                fy = _mm_add_ps(fy, _mm_mul_ps(dx, forceMagnitude));
+            }
+
+            // Anti-gravity fields
+            if (!antiGravities.empty())
+            {
+                __m128 const v01 = _mm_load_ps(reinterpret_cast<float const *>(velocityBuffer + pointIndex));
+                __m128 const v23 = _mm_load_ps(reinterpret_cast<float const *>(velocityBuffer + pointIndex + 2));
+                __m128 const vx = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 const vy = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(3, 1, 3, 1));
+
+                // Mass damper
+                __m128 const ls = _mm_min_ps(_mm_max_ps(_mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(10.0f)), _mm_set1_ps(800.0f - 10.0f)), Zero), One);
+                __m128 const massDamper = _mm_add_ps(_mm_set1_ps(0.35f), _mm_mul_ps(_mm_mul_ps(ls, ls), _mm_set1_ps(1.0f - 0.35f)));
+
+                __m128 const personalLimitDistance = _mm_mul_ps(
+                    _mm_add_ps(_mm_set1_ps(18.5f), _mm_mul_ps(_mm_set1_ps(7.0f), _mm_load_ps(personalitySeedBuffer + pointIndex))),
+                    massDamper);
+
+                __m128 const gravityForceMagnitude = _mm_mul_ps(m, _mm_set1_ps(SimulationParameters::GravityMagnitude));
+
+                for (auto const & antiGravity : antiGravities)
+                {
+                    __m128 const segmentX = _mm_set1_ps(antiGravity.Segment.x);
+                    __m128 const segmentY = _mm_set1_ps(antiGravity.Segment.y);
+
+                    // Projection onto segment
+                    __m128 const rx = _mm_sub_ps(px, _mm_set1_ps(antiGravity.StartPos.x));
+                    __m128 const ry = _mm_sub_ps(py, _mm_set1_ps(antiGravity.StartPos.y));
+                    __m128 const t = _mm_min_ps(
+                        _mm_max_ps(
+                            _mm_div_ps(
+                                _mm_add_ps(_mm_mul_ps(rx, segmentX), _mm_mul_ps(ry, segmentY)),
+                                _mm_set1_ps(antiGravity.SegmentSquaredLength)),
+                            Zero),
+                        One);
+                    __m128 const qx = _mm_sub_ps(_mm_mul_ps(segmentX, t), rx);
+                    __m128 const qy = _mm_sub_ps(_mm_mul_ps(segmentY, t), ry);
+                    __m128 const distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)));
+
+                    __m128 const inverseDistance = _mm_and_ps(
+                        _mm_div_ps(One, distance),
+                        _mm_cmpneq_ps(distance, Zero));
+                    __m128 const dirX = _mm_mul_ps(qx, inverseDistance);
+                    __m128 const dirY = _mm_mul_ps(qy, inverseDistance);
+
+                    // Distance damper
+                    __m128 const limitDistance = _mm_div_ps(personalLimitDistance, _mm_set1_ps(antiGravity.StrengthMultiplier));
+                    __m128 const limitDistanceLEdge = _mm_sub_ps(limitDistance, _mm_mul_ps(limitDistance, _mm_set1_ps(0.2f)));
+                    __m128 const limitDistanceREdge = _mm_add_ps(limitDistance, _mm_mul_ps(limitDistance, _mm_set1_ps(0.2f)));
+                    __m128 const distanceDamper = _mm_min_ps(
+                        _mm_max_ps(
+                            _mm_div_ps(_mm_sub_ps(distance, limitDistanceLEdge), _mm_sub_ps(limitDistanceREdge, limitDistanceLEdge)),
+                            Zero),
+                        One);
+
+                    // Velocity convergence
+                    __m128 const targetVelocityMagnitudeInDirection = _mm_mul_ps(_mm_set1_ps(antiGravity.TargetVelocityMagnitudeBase), massDamper);
+                    __m128 const currentVelocityMagnitudeInDirection = _mm_add_ps(_mm_mul_ps(vx, dirX), _mm_mul_ps(vy, dirY));
+                    __m128 const requiredAccelerationMagnitude = _mm_mul_ps(
+                        _mm_sub_ps(targetVelocityMagnitudeInDirection, currentVelocityMagnitudeInDirection),
+                        _mm_set1_ps(0.3f / SimulationParameters::SimulationStepTimeDuration<float>));
+
+                    __m128 const forceMagnitude = _mm_add_ps(
+                        gravityForceMagnitude,
+                        _mm_mul_ps(_mm_mul_ps(requiredAccelerationMagnitude, m), distanceDamper));
+
+                    fx = _mm_add_ps(fx, _mm_mul_ps(dirX, forceMagnitude));
+                    fy = _mm_add_ps(fy, _mm_mul_ps(dirY, forceMagnitude));
+                }
+            }
+
+            // Accumulate into static forces, re-interleaved
+            float * const f = reinterpret_cast<float *>(staticForceBuffer + pointIndex);
+            _mm_store_ps(f, _mm_add_ps(_mm_load_ps(f), _mm_unpacklo_ps(fx, fy)));
+            _mm_store_ps(f + 4, _mm_add_ps(_mm_load_ps(f + 4), _mm_unpackhi_ps(fx, fy)));
+
+            // Tornadoes
+            for (auto const * const tornado : taskState.Tornadoes)
+            {
+                for (ElementIndex l = 0; l < 4; ++l)
+                {
+                    ApplyTornadoField(pointIndex + l, *tornado);
+                }
+            }
+        }
+    }
+
+#endif
+
+    for (; pointIndex < endPointIndex; ++pointIndex)
+    {
+        vec2f const & p = positionBuffer[pointIndex];
+        float const m = massBuffer[pointIndex];
+
+        vec2f force = vec2f::zero();
+
+        //
+        // Blasts: inversely proportional to square root of distance, not second power as one would expect though
+        //
+
+        for (auto const * const blast : taskState.Blasts)
+        {
+            vec2f const pointRadius = p - blast->CenterPos;
+            float const squarePointDistance = pointRadius.squareLength();
+            if (squarePointDistance < blast->SquareRadius)
+            {
+                float const pointRadiusLength = std::sqrt(squarePointDistance);
+
+                force +=
+                    pointRadius.normalise(pointRadiusLength)
+                    * blast->ForceMagnitude * foobarSensitivityBuffer[pointIndex]
+                    / std::sqrt(std::max((pointRadiusLength * 0.4f) + 0.6f, 1.0f));
+            }
+        }
+
+        //
+        // Draws: F = ForceStrength/sqrt(distance), along radius
+        //
+
+        for (auto const & draw : draws)
+        {
+            vec2f const displacement = (draw.CenterPos - p);
+            float const displacementLength = displacement.length();
+            float forceMagnitude = draw.Strength / sqrtf(0.1f + displacementLength);
+
+            // Scale back force if mass is small
+            // 0  -> 0
+            // 50 -> 1
+            // +INF -> 1
+            forceMagnitude *= std::min(m / 50.0f, 1.0f);
+
+            force += displacement.normalise(displacementLength) * forceMagnitude;
+        }
+
+        //
+        // Swirls: F = ForceStrength*radius/sqrt(distance), perpendicular to radius
+        //
+
+        for (auto const & swirl : swirls)
+        {
+            vec2f const displacement = (swirl.CenterPos - p);
+            float const forceMagnitude = swirl.Strength / sqrtf(0.1f + displacement.length());
+
+            force += vec2f(-displacement.y, displacement.x) * forceMagnitude;
+        }
+
+        //
+        // Anti-gravity fields
+        //
+
+        for (auto const & antiGravity : antiGravities)
+        {
+            // Consider the line extending the segment, parameterized as P1 + t (P2 - P1).
+            // We find projection of point P onto the line.
+            // It falls where t = [(P-P1) . (P2-P)] / |P2-P1|^2
+            // We clamp t from [0,1] to handle points outside the segment P1-P2.
+            float const t = Clamp((p - antiGravity.StartPos).dot(antiGravity.Segment) / antiGravity.SegmentSquaredLength, 0.0f, 1.0f);
+            vec2f const projection = antiGravity.StartPos + antiGravity.Segment * t;  // Projection falls on the segment
+            float const distance = (projection - p).length();
+            vec2f const projectionDirectionNormalized = (projection - p).normalise(distance);
+
+            // Counteract gravity, but towards the segment
+            force += projectionDirectionNormalized * SimulationParameters::GravityMagnitude * m;
+
+            // Calculate mass damper: 0.25 when light, 1.0 when heavy - so light particles stay behind
+            float constexpr MinMassDamper = 0.35f;
+            float const ls = LinearStep(10.0f, 800.0f, m);
+            float const massDamper = MinMassDamper + ls * ls * (1.0f - MinMassDamper);
+
+            // Calculate distance damper - no more action when closer than a limit distance,
+            // which depends on the mass itself
+            float const limitDistance = (18.5f + 7.0f * personalitySeedBuffer[pointIndex]) * massDamper / antiGravity.StrengthMultiplier;
+            float const distanceDamper = LinearStep(limitDistance - limitDistance * 0.2f, limitDistance + limitDistance * 0.2f, distance);
+
+            //
+            // Calculate our magic force
+            //
+            // We add a force to impose a specific velocity towards the force field segment, leaving untouched
+            // the current velocity component orthogonal to that
+            //
+
+            float const targetVelocityMagnitudeInDirection = antiGravity.TargetVelocityMagnitudeBase * massDamper;
+            vec2f const & currentVelocity = velocityBuffer[pointIndex];
+            float const currentVelocityMagnitudeInDirection = currentVelocity.dot(projectionDirectionNormalized);
+            float constexpr DesiredVelocityConvergenceRate = 0.3f; // The higher, the more breakage
+            float const desiredVelocityMagnitudeInDirection = currentVelocityMagnitudeInDirection + (targetVelocityMagnitudeInDirection - currentVelocityMagnitudeInDirection) * DesiredVelocityConvergenceRate;
+            vec2f const requiredAcceleration = projectionDirectionNormalized * (desiredVelocityMagnitudeInDirection - currentVelocityMagnitudeInDirection) / SimulationParameters::SimulationStepTimeDuration<float>;
+            force += requiredAcceleration * m * distanceDamper;
+        }
+
+        if (hasForceFields)
+        {
+            staticForceBuffer[pointIndex] += force;
+        }
+
+        //
+        // Tornadoes
+        //
+
+        for (auto const * const tornado : taskState.Tornadoes)
+        {
+            ApplyTornadoField(pointIndex, *tornado);
+        }
+    }
+}
+
+void Ship::ApplyTornadoField(
+    ElementIndex pointIndex,
+    InteractionFields::Tornado const & tornado)
+{
+    vec2f const & p = mPoints.GetPosition(pointIndex);
+
+    if (p.y > tornado.EffectiveBottom && p.y <= tornado.EffectiveTop) // Note: skipping y=effectiveBottom to ensure non-zero radius
+    {
+        // Calculate radius, depending on y
+        float const shapeYFactor = std::min((p.y - tornado.EffectiveBottom) / tornado.Height, 1.0f);
+        float const effectiveRadius = (shapeYFactor <= 0.5f)
+            ? tornado.EffectiveBottomRadius + (tornado.EffectiveMiddleRadius - tornado.EffectiveBottomRadius) * (shapeYFactor * 2.0f)
+            : tornado.EffectiveMiddleRadius + (tornado.EffectiveTopRadius - tornado.EffectiveMiddleRadius) * ((shapeYFactor - 0.5f) * 2.0f);
+
+        // Normalized distance from center
+        float const rn = (p.x - tornado.CenterX) / effectiveRadius;
+        float const absRn = std::fabsf(rn);
+        if (absRn <= 1.0f)
+        {
+            float const m = mPoints.GetMass(pointIndex);
+
+            // We bump forces with the material's wind receptivity,
+            // as tornadoes are made of wind :-)
+            float const materialFactor = m * (1.0f + mPoints.GetMaterialWindReceptivity(pointIndex));
+
+            // Tornado strength is lower at the edges
+            float const tornadoDepth =
+                (1.0f - LinearStep(0.9f, 1.0f, absRn))
+                * (1.0f - LinearStep(tornado.Height, tornado.EffectiveHeight, (p.y - tornado.EffectiveBottom)));
+
+            if (!mPoints.IsEphemeral(pointIndex))
+            {
                 //
-                // We project this centripetal force to the x axis, as Fcx = Fc * cos(alpha),
-                // with alpha derivable from x as: alpha = PI/2 - PI/2 * x/R
-                // Thus, Fcx = |Fc| * sin(PI/2 - alpha) = |Fc| * sin(PI/2 * x/R)
+                // 1. Weaken structures; simulates 3D forces pulling structures towards the camera or away from it
                 //
-                // However, this model has an equilibrium at x=0 (it's basically a damped oscillator),
-                // and thus we drive it a bit with an attractor that rotates around the vortex.
-                // The attractor is randomized - by the particle's plane ID, so that whole pieces
-                // experience the same forces.
-
-                float constexpr RotationSpeed = 1.0f; // Magic: too fast risks creating Lissajous'
-                float const attractorX = std::sinf(args.RotationPhase * RotationSpeed + static_cast<float>(mPoints.GetPlaneId(pointIndex)));
-
-                float const cForceX =
-                    -materialFactor
-                    * effectiveOrbitV * effectiveOrbitV / effectiveRadius
-                    * std::sinf(Pi<float> / 2.0f * (rn + 0.2f * attractorX * (1.0f - absRn))) // Disturb with attractor, but mostly where needed (at equilibrium)
-                    * (1.0f - LinearStep(200.0f, 1500.0, m)) // Modulate with mass so to avoid humongous momenta
-                    * tornadoDepth;
-
-                // Updraft force
-
-                // We bump force for lighter materials - so that they fly high;
-                // We lower force for heavier materials as they shouldn't be easily lifted off the ground
-                float constexpr UpdraftLowMassThreshold = 30.0f;
-                float constexpr UpdraftLowMassMin = 5.0f;
-                float const updraftMassFactor = (m < UpdraftLowMassThreshold)
-                    ? UpdraftLowMassMin + (UpdraftLowMassThreshold - UpdraftLowMassMin) * (m / UpdraftLowMassThreshold)
-                    : m * (1.0f - LinearStep(550.0f, 2500.0, m));
-
-                float const upForceY =
-                    updraftMassFactor
-                    * effectiveUpwardForceMagnitude
-                    * tornadoDepth;
+
+                // Delta-weakness to reach our target
+                float constexpr TargetWeakness = 0.12f;
+                float const currentWeakness = mPoints.GetWeakness(pointIndex);
+                float const deltaWeakness = (TargetWeakness - currentWeakness) * 0.1f; // Reach slowly
+
+                // How much we weaken depends on the strength of the point, so we may weaken "structurally", not homogeneuosly
+                // float const weakeningStrength = 1.0f - LinearStep(0.02f, 0.27f, mPoints.GetFactoryStrength(pointIndex)); // This was a totally different way, opposite (weakening the weak)
+                float const weakeningStrength = LinearStep(0.01f, 0.07f, mPoints.GetFactoryStrength(pointIndex));
+
+                mPoints.SetWeakness(
+                    pointIndex,
+                    currentWeakness + deltaWeakness * weakeningStrength * tornadoDepth * tornado.StrengthMultiplier);
 
                 //
-                // Final force
+                // Heat
                 //
 
-                vec2f const tornadoForce = vec2f(
-                    cForceX,
-                    upForceY);
-
-                mPoints.AddStaticForce(
+                // Increase temperature to target - slowly
+                float const currentTemperature = mPoints.GetTemperature(pointIndex);
+                mPoints.SetTemperature(
                     pointIndex,
-                    tornadoForce * mPoints.GetFoobarSensitivity(pointIndex));
+                    currentTemperature + (tornado.TargetTemperature - currentTemperature) * 0.007f * tornado.HeatDepth);
             }
+            //
+            // 2. Apply forces
+            //
+
+            // In order to simulate a vortex, we apply a centripetal force projected along the X axis,
+            // emulating the projection of an orbital motion.
+            //
+            // For a circular orbit motion, the velocity, the radius, and the centripetal acceleration must satisfy:
+            //  V^2/R = |Ac|
+            //
+            // Fixing V and R, we have |Fc| = m*V^2/R
+            //
+            // We project this centripetal force to the x axis, as Fcx = Fc * cos(alpha),
+            // with alpha derivable from x as: alpha = PI/2 - PI/2 * x/R
+            // Thus, Fcx = |Fc| * sin(PI/2 - alpha) = |Fc| * sin(PI/2 * x/R)
+            //
+            // However, this model has an equilibrium at x=0 (it's basically a damped oscillator),
+            // and thus we drive it a bit with an attractor that rotates around the vortex.
+            // The attractor is randomized - by the particle's plane ID, so that whole pieces
+            // experience the same forces.
+
+            float constexpr RotationSpeed = 1.0f; // Magic: too fast risks creating Lissajous'
+            float const attractorX = std::sinf(tornado.RotationPhase * RotationSpeed + static_cast<float>(mPoints.GetPlaneId(pointIndex)));
+
+            float const cForceX =
+                -materialFactor
+                * tornado.EffectiveOrbitV * tornado.EffectiveOrbitV / effectiveRadius
+                * std::sinf(Pi<float> / 2.0f * (rn + 0.2f * attractorX * (1.0f - absRn))) // Disturb with attractor, but mostly where needed (at equilibrium)
+                * (1.0f - LinearStep(200.0f, 1500.0, m)) // Modulate with mass so to avoid humongous momenta
+                * tornadoDepth;
+
+            // Updraft force
+
+            // We bump force for lighter materials - so that they fly high;
+            // We lower force for heavier materials as they shouldn't be easily lifted off the ground
+            float constexpr UpdraftLowMassThreshold = 30.0f;
+            float constexpr UpdraftLowMassMin = 5.0f;
+            float const updraftMassFactor = (m < UpdraftLowMassThreshold)
+                ? UpdraftLowMassMin + (UpdraftLowMassThreshold - UpdraftLowMassMin) * (m / UpdraftLowMassThreshold)
+                : m * (1.0f - LinearStep(550.0f, 2500.0, m));
+
+            float const upForceY =
+                updraftMassFactor
+                * tornado.EffectiveUpwardForceMagnitude
+                * tornadoDepth;
+
+            //
+            // Final force
+            //
+
+            vec2f const tornadoForce = vec2f(
+                cForceX,
+                upForceY);
+
+            mPoints.AddStaticForce(
+                pointIndex,
+                tornadoForce * mPoints.GetFoobarSensitivity(pointIndex));
         }
     }
 }
@@ -8,6 +8,9 @@
 #include <Core/Algorithms.h>
 #include <Core/SysSpecifics.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace Physics {
 
 namespace /* anonymous */ {
@@ -17,6 +20,25 @@ namespace /* anonymous */ {
     // We pretend a fixed mass just for sanity of the simulation.
     float constexpr SiltImpactKineticEnergyPretendMass = 700.0f;
 
+    //
+    // Ship-ship collisions
+    //
+
+    // Margin by which we enlarge the AABBs of the other ship's triangles when
+    // binning them, accounting for the triangles moving during the step
+    float constexpr ShipCollisionTriangleMargin = 0.5f;
+
+    // Dimensions of the other ship's triangle grid cells
+    float constexpr ShipCollisionGridMinCellSize = 1.0f;
+    int constexpr ShipCollisionGridMaxCellsPerSide = 128;
+
+    // Distance beyond a triangle's edge at which we move an intruding point
+    float constexpr ShipCollisionSeparation = 0.01f;
+
+    // Collision response, relative to the other ship's triangle
+    float constexpr ShipCollisionElasticity = 0.2f;
+    float constexpr ShipCollisionFrictionFactor = 0.9f; // 1.0 - friction
+
 }
 
 void Ship::RecalculateSpringRelaxationParallelism(
@@ -56,6 +78,9 @@ void Ship::RecalculateSpringRelaxationParallelism(
 
     // Resize storage for per-thread silt impacts
     mPerThreadSiltImpacts.resize(simulationThreadPool.GetParallelism());
+
+    // Resize storage for per-thread work durations
+    mSpringRelaxationThreadWorkDurations.resize(simulationThreadPool.GetParallelism());
 }
 
 void Ship::RecalculateSpringRelaxationParallelism_FullSpeed(
@@ -75,15 +100,18 @@ void Ship::RecalculateSpringRelaxationParallelism_FullSpeed(
     auto const springShards = CalculateSpringRelaxationSpringShards(
         mSprings.GetElementCount(),
         mSprings.GetPerfectSquareCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     auto const shipPointShards = CalculatePointShards(
         mPoints.GetAlignedShipPointCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     auto const ephemeralPointShards = CalculatePointShards(
         mPoints.GetMaxEphemeralParticleCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     ElementIndex springStart = 0;
     ElementIndex shipPointStart = 0;
@@ -140,15 +168,18 @@ void Ship::RecalculateSpringRelaxationParallelism_StepByStep(
     auto const springShards = CalculateSpringRelaxationSpringShards(
         mSprings.GetElementCount(),
         mSprings.GetPerfectSquareCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     auto const shipPointShards = CalculatePointShards(
         mPoints.GetAlignedShipPointCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     auto const ephemeralPointShards = CalculatePointShards(
         mPoints.GetMaxEphemeralParticleCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     ElementIndex springStart = 0;
     ElementIndex shipPointStart = 0;
@@ -206,6 +237,10 @@ void Ship::RecalculateSpringRelaxationParallelism_StepByStep(
                     t,
                     mSpringRelaxationCoefficients,
                     simulationParameters);
+
+                HandleCollisionsWithOtherShips(
+                    shipPointStart,
+                    shipPointEnd);
             });
 
         ElementIndex const ephemeralPointEnd = ephemeralPointStart + static_cast<ElementCount>(ephemeralPointShards[t]);
@@ -229,6 +264,10 @@ void Ship::RecalculateSpringRelaxationParallelism_StepByStep(
                     mSpringRelaxationCoefficients,
                     simulationParameters);
 
+                HandleCollisionsWithOtherShips(
+                    shipPointStart,
+                    shipPointEnd);
+
                 // Ephemeral
 
                 Integrate(
@@ -268,15 +307,18 @@ void Ship::RecalculateSpringRelaxationParallelism_Hybrid(
     auto const springShards = CalculateSpringRelaxationSpringShards(
         mSprings.GetElementCount(),
         mSprings.GetPerfectSquareCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     auto const shipPointShards = CalculatePointShards(
         mPoints.GetAlignedShipPointCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     auto const ephemeralPointShards = CalculatePointShards(
         mPoints.GetMaxEphemeralParticleCount(),
-        simulationThreadPool);
+        simulationThreadPool,
+        &(mSpringRelaxationShardBalancer.GetWeights()));
 
     ElementIndex springStart = 0;
     ElementIndex shipPointStart = 0;
@@ -400,7 +442,8 @@ Ship::SpringRelaxationCoefficients Ship::CalculateSpringRelaxationCoefficients(
 
 void Ship::RunSpringRelaxation(
     ThreadManager & threadManager,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    PerfStats & perfStats)
 {
     //
     // Recalculate all coefficients, and prepare silt impacts
@@ -414,6 +457,17 @@ void Ship::RunSpringRelaxation(
         threadSiltImpact.value.KineticEnergy = 0.0f;
     }
 
+    std::fill(
+        mSpringRelaxationThreadWorkDurations.begin(),
+        mSpringRelaxationThreadWorkDurations.end(),
+        GameChronometer::duration::zero());
+
+    //
+    // Prepare collisions with other ships
+    //
+
+    PrepareShipCollisions();
+
     //
     // Run
     //
@@ -439,6 +493,41 @@ void Ship::RunSpringRelaxation(
         }
     }
 
+    //
+    // Adapt shards to the work done by each thread
+    //
+
+    if (simulationParameters.SpringRelaxationParallelComputationMode != SpringRelaxationParallelComputationModeType::StepByStep)
+    {
+        assert(!mSpringRelaxationThreadWorkDurations.empty());
+
+        GameChronometer::duration totalWorkDuration = GameChronometer::duration::zero();
+        GameChronometer::duration maxWorkDuration = GameChronometer::duration::zero();
+        for (auto const & threadWorkDuration : mSpringRelaxationThreadWorkDurations)
+        {
+            totalWorkDuration += threadWorkDuration;
+            maxWorkDuration = std::max(maxWorkDuration, threadWorkDuration);
+        }
+
+        perfStats.Update<PerfMeasurement::TotalShipsSpringsStragglerGap>(maxWorkDuration - totalWorkDuration / mSpringRelaxationThreadWorkDurations.size());
+
+        if (mParentWorld.IsDeterministicSession())
+        {
+            // Shard boundaries decide the order in which per-thread forces are summed,
+            // hence in deterministic sessions they may not depend on timings: go back
+            // to (or stay at) the nominal shards
+            if (!mSpringRelaxationShardBalancer.HasNominalWeights())
+            {
+                mSpringRelaxationShardBalancer.Reset(mSpringRelaxationShardBalancer.GetShardCount());
+                RecalculateSpringRelaxationParallelism(threadManager.GetSimulationThreadPool(), simulationParameters);
+            }
+        }
+        else if (mSpringRelaxationShardBalancer.Update(mSpringRelaxationThreadWorkDurations))
+        {
+            RecalculateSpringRelaxationParallelism(threadManager.GetSimulationThreadPool(), simulationParameters);
+        }
+    }
+
     //
     // Coalesce silt impacts
     //
@@ -512,6 +601,10 @@ void Ship::RunSpringRelaxation_FullSpeed_Thread(
     // Get the total count of threads participating
     int const numberOfThreads = static_cast<int>(mSpringRelaxation_FullSpeed_Tasks.size());
 
+    // Time spent working, i.e. not waiting for other threads
+    GameChronometer::duration workDuration = GameChronometer::duration::zero();
+    auto workStartTime = GameChronometer::Now();
+
     //
     // Loop for all mechanical dynamics iterations
     //
@@ -534,6 +627,8 @@ void Ship::RunSpringRelaxation_FullSpeed_Thread(
 
         // - DynamicForces = sf | sf + others at first iteration only
 
+        workDuration += GameChronometer::Now() - workStartTime;
+
         // Signal completion
         mSpringRelaxation_FullSpeed_SpringForcesCompleted.fetch_add(1, std::memory_order_acq_rel);
 
@@ -550,6 +645,8 @@ void Ship::RunSpringRelaxation_FullSpeed_Thread(
             }
         }
 
+        workStartTime = GameChronometer::Now();
+
         //
         // Integrate dynamic and static forces,
         // and reset dynamic forces
@@ -572,6 +669,13 @@ void Ship::RunSpringRelaxation_FullSpeed_Thread(
                 threadIndex,
                 mSpringRelaxationCoefficients,
                 simulationParameters);
+
+            // Handle collisions with other ships
+            //  - Changes position and velocity
+
+            HandleCollisionsWithOtherShips(
+                startShipPointIndex,
+                endShipPointIndex);
         }
 
         // - DynamicForces = 0
@@ -609,6 +713,8 @@ void Ship::RunSpringRelaxation_FullSpeed_Thread(
             // Sync for next iteration
             //
 
+            workDuration += GameChronometer::Now() - workStartTime;
+
             // Signal completion
             mSpringRelaxation_FullSpeed_IntegrationsCompleted.fetch_add(1, std::memory_order_acq_rel);
 
@@ -624,8 +730,14 @@ void Ship::RunSpringRelaxation_FullSpeed_Thread(
                     break;
                 }
             }
+
+            workStartTime = GameChronometer::Now();
         }
     }
+
+    workDuration += GameChronometer::Now() - workStartTime;
+
+    mSpringRelaxationThreadWorkDurations[threadIndex] += workDuration;
 }
 
 void Ship::RunSpringRelaxation_StepByStep(
@@ -764,6 +876,9 @@ void Ship::RunSpringRelaxation_Hybrid_Thread(
     // Get the total count of threads participating
     int const numberOfThreads = static_cast<int>(mSpringRelaxation_Hybrid_2_Tasks.size());
 
+    // Time spent working, i.e. not waiting for other threads
+    auto workStartTime = GameChronometer::Now();
+
     //
     //
     //
@@ -783,6 +898,8 @@ void Ship::RunSpringRelaxation_Hybrid_Thread(
 
     // - DynamicForces = sf | sf + others at first iteration only
 
+    GameChronometer::duration workDuration = GameChronometer::Now() - workStartTime;
+
     // Signal completion
     mSpringRelaxation_Hybrid_IterationCompleted.fetch_add(1, std::memory_order_acq_rel);
 
@@ -799,6 +916,8 @@ void Ship::RunSpringRelaxation_Hybrid_Thread(
         }
     }
 
+    workStartTime = GameChronometer::Now();
+
     //
     // Integrate dynamic and static forces,
     // and reset dynamic forces
@@ -821,7 +940,18 @@ void Ship::RunSpringRelaxation_Hybrid_Thread(
             threadIndex,
             mSpringRelaxationCoefficients,
             simulationParameters);
+
+        // Handle collisions with other ships
+        //  - Changes position and velocity
+
+        HandleCollisionsWithOtherShips(
+            startShipPointIndex,
+            endShipPointIndex);
     }
+
+    workDuration += GameChronometer::Now() - workStartTime;
+
+    mSpringRelaxationThreadWorkDurations[threadIndex] += workDuration;
 }
 
 void Ship::RunSpringRelaxation_Hybrid_EphemeralParticle_Thread(
@@ -830,6 +960,8 @@ void Ship::RunSpringRelaxation_Hybrid_EphemeralParticle_Thread(
     ElementIndex endEphemeralPointIndex,
     SimulationParameters const & simulationParameters)
 {
+    auto const workStartTime = GameChronometer::Now();
+
     //
     // Integrate static forces
     //
@@ -848,6 +980,8 @@ void Ship::RunSpringRelaxation_Hybrid_EphemeralParticle_Thread(
         threadIndex,
         mSpringRelaxationCoefficients_EphemeralParticles,
         simulationParameters);
+
+    mSpringRelaxationThreadWorkDurations[threadIndex] += GameChronometer::Now() - workStartTime;
 }
 
 void Ship::Integrate(
@@ -957,7 +1091,7 @@ void Ship::HandleCollisionsWithSeaFloor(
 
     auto & maxSiltImpact = mPerThreadSiltImpacts[threadIndex];
 
-    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
+    auto const handleCollision = [&](ElementIndex pointIndex)
     {
         auto const & position = mPoints.GetPosition(pointIndex);
 
@@ -1101,17 +1235,308 @@ void Ship::HandleCollisionsWithSeaFloor(
                 }
             }
         }
+    };
+
+    //
+    // Prefilter: no point may be underneath the ocean floor unless it's lower than the
+    // highest silt sample in the x range spanned by the points; we first find this range,
+    // and then only visit points below that height, which - unless the ship is resting on
+    // the floor - are very few, if any at all
+    //
+
+    vec2f const * const positions = mPoints.GetPositionBufferAsVec2(); // Not restrict: we update positions while visiting
+
+    float minX = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float minY = std::numeric_limits<float>::max();
+
+    ElementIndex pointIndex = startPointIndex;
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+    __m128 minX_4 = _mm_set1_ps(minX);
+    __m128 maxX_4 = _mm_set1_ps(maxX);
+    __m128 minY_4 = _mm_set1_ps(minY);
+
+    for (; pointIndex + 4 <= endPointIndex; pointIndex += 4)
+    {
+        __m128 const pos01_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + pointIndex)); // x0,y0,x1,y1
+        __m128 const pos23_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + pointIndex + 2)); // x2,y2,x3,y3
+        __m128 const x_4 = _mm_shuffle_ps(pos01_4, pos23_4, _MM_SHUFFLE(2, 0, 2, 0)); // x0,x1,x2,x3
+        __m128 const y_4 = _mm_shuffle_ps(pos01_4, pos23_4, _MM_SHUFFLE(3, 1, 3, 1)); // y0,y1,y2,y3
+
+        minX_4 = _mm_min_ps(minX_4, x_4);
+        maxX_4 = _mm_max_ps(maxX_4, x_4);
+        minY_4 = _mm_min_ps(minY_4, y_4);
+    }
+
+    alignas(16) float minXs[4];
+    alignas(16) float maxXs[4];
+    alignas(16) float minYs[4];
+    _mm_store_ps(minXs, minX_4);
+    _mm_store_ps(maxXs, maxX_4);
+    _mm_store_ps(minYs, minY_4);
+
+    for (size_t l = 0; l < 4; ++l)
+    {
+        minX = std::min(minX, minXs[l]);
+        maxX = std::max(maxX, maxXs[l]);
+        minY = std::min(minY, minYs[l]);
+    }
+
+#endif
+
+    for (; pointIndex < endPointIndex; ++pointIndex)
+    {
+        minX = std::min(minX, positions[pointIndex].x);
+        maxX = std::max(maxX, positions[pointIndex].x);
+        minY = std::min(minY, positions[pointIndex].y);
+    }
+
+    if (minX > maxX)
+    {
+        // No points (or only invalid ones)
+        return;
+    }
+
+    // At this moment points might be outside of world boundaries, hence we clamp
+    // x's as we'll do later before sampling the ocean floor height
+    float const maxSiltHeight = oceanFloor.GetMaxSiltHeightBetween(
+        Clamp(minX, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth),
+        Clamp(maxX, -SimulationParameters::HalfMaxWorldWidth, SimulationParameters::HalfMaxWorldWidth));
+
+    if (minY >= maxSiltHeight)
+    {
+        // All points are above the ocean floor
+        return;
+    }
+
+    //
+    // Visit candidates
+    //
+
+    pointIndex = startPointIndex;
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+    __m128 const maxSiltHeight_4 = _mm_set1_ps(maxSiltHeight);
+
+    for (; pointIndex + 4 <= endPointIndex; pointIndex += 4)
+    {
+        __m128 const pos01_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + pointIndex)); // x0,y0,x1,y1
+        __m128 const pos23_4 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + pointIndex + 2)); // x2,y2,x3,y3
+        __m128 const y_4 = _mm_shuffle_ps(pos01_4, pos23_4, _MM_SHUFFLE(3, 1, 3, 1)); // y0,y1,y2,y3
+
+        int const candidateMask = _mm_movemask_ps(_mm_cmplt_ps(y_4, maxSiltHeight_4));
+        if (candidateMask != 0)
+        {
+            for (ElementIndex l = 0; l < 4; ++l)
+            {
+                if ((candidateMask & (1 << l)) != 0)
+                {
+                    handleCollision(pointIndex + l);
+                }
+            }
+        }
+    }
+
+#endif
+
+    for (; pointIndex < endPointIndex; ++pointIndex)
+    {
+        if (positions[pointIndex].y < maxSiltHeight)
+        {
+            handleCollision(pointIndex);
+        }
+    }
+}
+
+void Ship::BuildTriangleGrid(
+    Geometry::AABB const & region,
+    Geometry::TriangleGrid & grid) const
+{
+    grid.BeginBuild(region, ShipCollisionGridMinCellSize, ShipCollisionGridMaxCellsPerSide);
+
+    for (auto t : mTriangles)
+    {
+        if (!mTriangles.IsDeleted(t))
+        {
+            vec2f const & a = mPoints.GetPosition(mTriangles.GetPointAIndex(t));
+            vec2f const & b = mPoints.GetPosition(mTriangles.GetPointBIndex(t));
+            vec2f const & c = mPoints.GetPosition(mTriangles.GetPointCIndex(t));
+
+            grid.Add(
+                t,
+                Geometry::AABB(
+                    std::min(a.x, std::min(b.x, c.x)) - ShipCollisionTriangleMargin,
+                    std::max(a.x, std::max(b.x, c.x)) + ShipCollisionTriangleMargin,
+                    std::max(a.y, std::max(b.y, c.y)) + ShipCollisionTriangleMargin,
+                    std::min(a.y, std::min(b.y, c.y)) - ShipCollisionTriangleMargin));
+        }
+    }
+
+    grid.EndBuild();
+}
+
+void Ship::PrepareShipCollisions()
+{
+    //
+    // Bin the triangles of each other ship that the broadphase has
+    // found to be close to us; this is a no-op when no ships are close
+    //
+
+    mShipCollisionPartnerCount = 0;
+
+    for (auto const & candidate : mParentWorld.GetShipCollisionCandidates(mId))
+    {
+        if (mShipCollisionPartnerCount == mShipCollisionPartners.size())
+        {
+            mShipCollisionPartners.emplace_back();
+        }
+
+        auto & partner = mShipCollisionPartners[mShipCollisionPartnerCount];
+
+        partner.OtherShip = &(mParentWorld.GetShip(candidate.OtherShipId));
+        partner.OtherShip->BuildTriangleGrid(candidate.Region, partner.OtherShipTriangles);
+
+        if (!partner.OtherShipTriangles.IsEmpty())
+        {
+            ++mShipCollisionPartnerCount;
+        }
+    }
+}
+
+void Ship::HandleCollisionsWithOtherShips(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    //
+    // Point-vs-triangle: each point of ours that is inside a triangle of another ship is moved out
+    // through the closest edge of that triangle - preferring edges on the other ship's boundary - and
+    // its velocity relative to the triangle is reflected.
+    //
+    // We only act on our own points; the other ship does the same with its points when it
+    // runs its own spring relaxation.
+    //
+
+    if (mShipCollisionPartnerCount == 0)
+    {
+        return;
+    }
+
+    // Skip padding points
+    endPointIndex = std::min(endPointIndex, static_cast<ElementIndex>(mPoints.GetRawShipPointCount()));
+
+    for (size_t p = 0; p < mShipCollisionPartnerCount; ++p)
+    {
+        auto const & partner = mShipCollisionPartners[p];
+        Points const & otherPoints = partner.OtherShip->GetPoints();
+        Triangles const & otherTriangles = partner.OtherShip->GetTriangles();
+        Geometry::AABB const & region = partner.OtherShipTriangles.GetRegion();
+
+        for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
+        {
+            vec2f const position = mPoints.GetPosition(pointIndex);
+            if (!region.Contains(position) || mPoints.IsPinned(pointIndex))
+            {
+                continue;
+            }
+
+            partner.OtherShipTriangles.VisitCandidates(
+                position,
+                [&](ElementIndex t) -> bool
+                {
+                    auto const & triangleVertices = otherTriangles.GetPointIndices(t);
+
+                    std::array<vec2f, 3> const vertexPositions = {
+                        otherPoints.GetPosition(triangleVertices[0]),
+                        otherPoints.GetPosition(triangleVertices[1]),
+                        otherPoints.GetPosition(triangleVertices[2]) };
+
+                    if (!Geometry::IsPointInTriangle(position, vertexPositions[0], vertexPositions[1], vertexPositions[2]))
+                    {
+                        return false;
+                    }
+
+                    //
+                    // Find exit edge
+                    //
+
+                    vec2f bestNormal = vec2f::zero();
+                    float bestDepth = std::numeric_limits<float>::max();
+                    bool bestIsBoundary = false;
+
+                    for (int e = 0; e < 3; ++e)
+                    {
+                        vec2f const & edgeA = vertexPositions[e];
+                        vec2f const & edgeB = vertexPositions[(e + 1) % 3];
+                        vec2f const & opposite = vertexPositions[(e + 2) % 3];
+
+                        vec2f normal = (edgeB - edgeA).to_perpendicular().normalise();
+                        if (normal.dot(opposite - edgeA) > 0.0f)
+                        {
+                            // Make it point outside of the triangle
+                            normal = -normal;
+                        }
+
+                        float const depth = normal.dot(edgeA - position); // >= 0 as we're inside
+
+                        ElementIndex const oppositeTriangle = otherTriangles.GetOppositeTriangle(t, e).TriangleElementIndex;
+                        bool const isBoundary = (oppositeTriangle == NoneElementIndex || otherTriangles.IsDeleted(oppositeTriangle));
+
+                        if ((isBoundary && !bestIsBoundary)
+                            || (isBoundary == bestIsBoundary && depth < bestDepth))
+                        {
+                            bestNormal = normal;
+                            bestDepth = depth;
+                            bestIsBoundary = isBoundary;
+                        }
+                    }
+
+                    //
+                    // Impart final position and velocity
+                    //
+
+                    mPoints.SetPosition(
+                        pointIndex,
+                        position + bestNormal * (bestDepth + ShipCollisionSeparation));
+
+                    vec2f const triangleVelocity =
+                        (otherPoints.GetVelocity(triangleVertices[0])
+                            + otherPoints.GetVelocity(triangleVertices[1])
+                            + otherPoints.GetVelocity(triangleVertices[2]))
+                        / 3.0f;
+
+                    vec2f const relativeVelocity = mPoints.GetVelocity(pointIndex) - triangleVelocity;
+                    float const relativeVelocityAlongNormal = relativeVelocity.dot(bestNormal);
+                    if (relativeVelocityAlongNormal < 0.0f)
+                    {
+                        // Moving into the other ship: Vn' = -e*Vn, Vt' = a*Vt
+                        vec2f const normalVelocity = bestNormal * relativeVelocityAlongNormal;
+                        vec2f const tangentialVelocity = relativeVelocity - normalVelocity;
+
+                        mPoints.SetVelocity(
+                            pointIndex,
+                            triangleVelocity
+                            - normalVelocity * ShipCollisionElasticity
+                            + tangentialVelocity * ShipCollisionFrictionFactor);
+                    }
+
+                    return true;
+                });
+        }
     }
 }
 
 std::vector<size_t> Ship::CalculateSpringRelaxationSpringShards(
     size_t totalSprings,
     size_t perfectSquareCount,
-    ThreadPool const & simulationThreadPool)
+    ThreadPool const & simulationThreadPool,
+    std::vector<float> const * shardWeights)
 {
     //
     // Calculates number of springs for each shard, taking into
-    // account processors' speeds and task costs
+    // account processors' speeds, shards' weights, and task costs
     //
 
     float constexpr PerfectSquareSpringCost = 1.0f;
@@ -1120,14 +1545,21 @@ std::vector<size_t> Ship::CalculateSpringRelaxationSpringShards(
     size_t const perfectSquareSpringCount = perfectSquareCount * 4;
     assert(totalSprings >= perfectSquareSpringCount);
 
+    assert(shardWeights == nullptr || shardWeights->size() == simulationThreadPool.GetParallelism());
+
+    auto const getShardSpeed = [&](size_t s)
+        {
+            auto const cpuInfo = simulationThreadPool.GetThreadCpuInfo(s);
+            assert(cpuInfo.has_value()); // It's a simulation thread
+
+            return cpuInfo->Speed * (shardWeights != nullptr ? (*shardWeights)[s] : 1.0f);
+        };
+
     // Calculate cpu speed normalization factor (denominator)
     float cpuSpeedNormalizationFactor = 0.0f;
     for (size_t s = 0; s < simulationThreadPool.GetParallelism(); ++s)
     {
-        auto const cpuInfo = simulationThreadPool.GetThreadCpuInfo(s);
-        assert(cpuInfo.has_value()); // It's a simulation thread
-
-        cpuSpeedNormalizationFactor += cpuInfo->Speed;
+        cpuSpeedNormalizationFactor += getShardSpeed(s);
     }
 
     LogMessage("Ship::CalculateSpringRelaxationSpringShards(totalSprings=", totalSprings, ", perfectSquareSpringCount=", perfectSquareSpringCount, ")");
@@ -1158,10 +1590,9 @@ std::vector<size_t> Ship::CalculateSpringRelaxationSpringShards(
         float const remainingSpringCost = remainingPerfectSquareSpringCost + remainingImperfectSquareSpringCost;
 
         // Total budget for this shard
-        auto const cpuInfo = simulationThreadPool.GetThreadCpuInfo(s);
-        assert(cpuInfo.has_value()); // It's a simulation thread
+        float const shardSpeed = getShardSpeed(s);
         assert(cpuSpeedNormalizationFactor > 0.0f);
-        float const totalShardBudget = cpuInfo->Speed / cpuSpeedNormalizationFactor * remainingSpringCost;
+        float const totalShardBudget = shardSpeed / cpuSpeedNormalizationFactor * remainingSpringCost;
         float remainingShardBudget = totalShardBudget;
 
         // Calculate springs for this shard
@@ -1177,7 +1608,7 @@ std::vector<size_t> Ship::CalculateSpringRelaxationSpringShards(
             // Checks and balances
             springsAssignedCount += shardSpringCount;
 
-            LogMessage("  Shard ", s, ": ", shardSpringCount, " (cpu_speed=", cpuInfo->Speed, " budget=", remainingShardBudget, " cost=", remainingSpringCost, ")");
+            LogMessage("  Shard ", s, ": ", shardSpringCount, " (speed=", shardSpeed, " budget=", remainingShardBudget, " cost=", remainingSpringCost, ")");
 
             assert(springsAssignedCount == totalSprings);
         }
@@ -1224,13 +1655,13 @@ std::vector<size_t> Ship::CalculateSpringRelaxationSpringShards(
                 shardCost += static_cast<float>(shardImperfectSquareSpringCost) * PerfectSquareSpringCost;
             }
 
-            LogMessage("  Shard ", s, ": ", shardSpringCount, " (cpu_speed=", cpuInfo->Speed, " budget=", totalShardBudget, " cost=", shardCost, ")");
+            LogMessage("  Shard ", s, ": ", shardSpringCount, " (speed=", shardSpeed, " budget=", totalShardBudget, " cost=", shardCost, ")");
         }
 
         springShards[s] = shardSpringCount;
 
         // Reduce normalization factor to account for remaining threads
-        cpuSpeedNormalizationFactor -= cpuInfo->Speed;
+        cpuSpeedNormalizationFactor -= shardSpeed;
     }
 
     return springShards;
@@ -1238,21 +1669,29 @@ std::vector<size_t> Ship::CalculateSpringRelaxationSpringShards(
 
 std::vector<size_t> Ship::CalculatePointShards(
     size_t totalPoints,
-    ThreadPool const & simulationThreadPool)
+    ThreadPool const & simulationThreadPool,
+    std::vector<float> const * shardWeights)
 {
     //
     // Calculates number of points for each shard, taking into
-    // account processors' speeds
+    // account processors' speeds and shards' weights
     //
 
+    assert(shardWeights == nullptr || shardWeights->size() == simulationThreadPool.GetParallelism());
+
+    auto const getShardSpeed = [&](size_t s)
+        {
+            auto const cpuInfo = simulationThreadPool.GetThreadCpuInfo(s);
+            assert(cpuInfo.has_value()); // It's a simulation thread
+
+            return cpuInfo->Speed * (shardWeights != nullptr ? (*shardWeights)[s] : 1.0f);
+        };
+
     // Calculate cpu speed normalization factor (denominator)
     float cpuSpeedNormalizationFactor = 0.0f;
     for (size_t s = 0; s < simulationThreadPool.GetParallelism(); ++s)
     {
-        auto const cpuInfo = simulationThreadPool.GetThreadCpuInfo(s);
-        assert(cpuInfo.has_value()); // It's a simulation thread
-
-        cpuSpeedNormalizationFactor += cpuInfo->Speed;
+        cpuSpeedNormalizationFactor += getShardSpeed(s);
     }
 
     LogMessage("Ship::CalculatePointShards(totalPoints=", totalPoints, ")");
@@ -1275,10 +1714,9 @@ std::vector<size_t> Ship::CalculatePointShards(
         float const remainingPointCost = static_cast<float>(remainingPointCount);
 
         // Total budget for this shard
-        auto const cpuInfo = simulationThreadPool.GetThreadCpuInfo(s);
-        assert(cpuInfo.has_value()); // It's a simulation thread
+        float const shardSpeed = getShardSpeed(s);
         assert(cpuSpeedNormalizationFactor > 0.0f);
-        float const totalShardBudget = cpuInfo->Speed / cpuSpeedNormalizationFactor * remainingPointCost;
+        float const totalShardBudget = shardSpeed / cpuSpeedNormalizationFactor * remainingPointCost;
 
         // Calculate points for this shard
         size_t shardPointCount;
@@ -1293,7 +1731,7 @@ std::vector<size_t> Ship::CalculatePointShards(
             // Checks and balances
             pointsAssignedCount += shardPointCount;
 
-            LogMessage("  Shard ", s, ": ", shardPointCount, " (cpu_speed=", cpuInfo->Speed, " budget=", totalShardBudget, " cost=", remainingPointCost, ")");
+            LogMessage("  Shard ", s, ": ", shardPointCount, " (speed=", shardSpeed, " budget=", totalShardBudget, " cost=", remainingPointCost, ")");
 
             assert(pointsAssignedCount == totalPoints);
         }
@@ -1312,13 +1750,13 @@ std::vector<size_t> Ship::CalculatePointShards(
 
             float const shardCost = static_cast<float>(shardPointCount);
 
-            LogMessage("  Shard ", s, ": ", shardPointCount, " (cpu_speed=", cpuInfo->Speed, " budget=", totalShardBudget, " cost=", shardCost, ")");
+            LogMessage("  Shard ", s, ": ", shardPointCount, " (speed=", shardSpeed, " budget=", totalShardBudget, " cost=", shardCost, ")");
         }
 
         pointShards[s] = shardPointCount;
 
         // Reduce normalization factor to account for remaining threads
-        cpuSpeedNormalizationFactor -= cpuInfo->Speed;
+        cpuSpeedNormalizationFactor -= shardSpeed;
     }
 
     return pointShards;
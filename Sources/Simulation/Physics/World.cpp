@@ -6,6 +6,7 @@
 #include "Physics.h"
 
 #include <Core/GameRandomEngine.h>
+#include <Core/Profiler.h>
 
 #include <algorithm>
 #include <cassert>
@@ -24,6 +25,7 @@ World::World(
     //
     , mSimulationEventHandler(simulationEventDispatcher)
     , mEventRecorder(nullptr)
+    , mIsDeterministicSession(false)
     //
     , mAllShips()
     , mStars()
@@ -38,13 +40,14 @@ World::World(
     , mNpcs(std::make_unique<Npcs>(*this, npcDatabase, mSimulationEventHandler, simulationParameters))
     //
     , mAllShipExternalAABBs()
+    , mShipCollisionCandidates()
 {
     // Initialize world pieces that need to be initialized now
     mStars.Update(mCurrentSimulationTime, simulationParameters);
     mStorm.Update(simulationParameters);
     mWind.Update(mStorm.GetParameters(), simulationParameters);
     mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
-    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters);
+    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters, nullptr);
     mOceanFloor.Update(simulationParameters);
     mUnderwaterPlants.Update(mCurrentSimulationTime, mWind, mOceanSurface, mOceanFloor, simulationParameters);
 }
@@ -71,7 +74,7 @@ void World::AddShip(std::unique_ptr<Ship> ship)
     // Update AABBSet
     for (auto const & aabb : shipExternalAABBs.GetItems())
     {
-        mAllShipExternalAABBs.Add(aabb);
+        mAllShipExternalAABBs.Add(aabb, mAllShips.back()->GetId());
     }
 }
 
@@ -138,6 +141,13 @@ size_t World::GetAllShipTriangleCount() const
         });
 }
 
+Ship const & World::GetShip(ShipId shipId) const
+{
+    assert(shipId < mAllShips.size());
+
+    return *(mAllShips[shipId]);
+}
+
 std::optional<Geometry::AABB> World::GetLargestShipExternalAABB() const
 {
     std::optional<Geometry::AABB> largestAABB;
@@ -1624,16 +1634,79 @@ bool World::RestoreTriangle(GlobalElementId triangleId)
 // Simulation
 //////////////////////////////////////////////////////////////////////////////
 
+void World::UpdateShipCollisionCandidates()
+{
+    // Margin around the intersection of two AABBs, accounting for
+    // the ships moving during the step
+    float constexpr RegionMargin = 2.0f;
+
+    mShipCollisionCandidates.resize(mAllShips.size());
+    for (auto & candidates : mShipCollisionCandidates)
+    {
+        candidates.clear();
+    }
+
+    if (mAllShips.size() < 2)
+    {
+        return;
+    }
+
+    auto const addCandidate = [this](ShipId shipId, ShipId otherShipId, Geometry::AABB const & region)
+    {
+        auto & candidates = mShipCollisionCandidates[shipId];
+
+        // Merge with the region we already have for the same other ship, if any
+        auto it = std::find_if(
+            candidates.begin(),
+            candidates.end(),
+            [otherShipId](auto const & c)
+            {
+                return c.OtherShipId == otherShipId;
+            });
+
+        if (it != candidates.end())
+        {
+            it->Region.ExtendTo(region);
+        }
+        else
+        {
+            candidates.emplace_back(otherShipId, region);
+        }
+    };
+
+    auto const & aabbs = mAllShipExternalAABBs.GetItems();
+    auto const & shipIds = mAllShipExternalAABBs.GetShipIds();
+
+    mAllShipExternalAABBs.VisitCrossShipIntersections(
+        [&](size_t i1, size_t i2)
+        {
+            Geometry::AABB const region(
+                std::max(aabbs[i1].BottomLeft.x, aabbs[i2].BottomLeft.x) - RegionMargin,
+                std::min(aabbs[i1].TopRight.x, aabbs[i2].TopRight.x) + RegionMargin,
+                std::min(aabbs[i1].TopRight.y, aabbs[i2].TopRight.y) + RegionMargin,
+                std::max(aabbs[i1].BottomLeft.y, aabbs[i2].BottomLeft.y) - RegionMargin);
+
+            addCandidate(shipIds[i1], shipIds[i2], region);
+            addCandidate(shipIds[i2], shipIds[i1], region);
+        });
+}
+
 void World::Update(
     SimulationParameters const & simulationParameters,
-    ViewModel const & viewModel,
+    VisibleWorld const & visibleWorld,
     StressRenderModeType stressRenderMode,
     ThreadManager & threadManager,
     PerfStats & perfStats)
 {
+    FS_PROFILE_ZONE("World::Update");
+
     // Update current time
     mCurrentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
 
+    // Detect ship-ship collision candidates, using the AABBs as they
+    // were at the end of the previous cycle
+    UpdateShipCollisionCandidates();
+
     // Prepare all AABBs
     mAllShipExternalAABBs.Clear();
 
@@ -1649,13 +1722,19 @@ void World::Update(
 
     mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
 
-    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters);
+    {
+        FS_PROFILE_ZONE("World::UpdateOceanSurface");
+
+        mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters, &(threadManager.GetSimulationThreadPool()));
+    }
 
     mOceanFloor.Update(simulationParameters);
 
     {
         // Interactive bodies - affects ships and npcs
 
+        FS_PROFILE_ZONE("World::UpdateInteractiveBodies");
+
         assert(mNpcs);
 
         mInteractiveBodies.Update(mAllShips, *mNpcs, mOceanSurface, mCurrentSimulationTime, simulationParameters);
@@ -1667,6 +1746,7 @@ void World::Update(
             mCurrentSimulationTime,
             mStorm.GetParameters(),
             simulationParameters,
+            visibleWorld,
             stressRenderMode,
             mAllShipExternalAABBs,
             threadManager,
@@ -1674,6 +1754,8 @@ void World::Update(
     }
 
     {
+        FS_PROFILE_ZONE("World::UpdateNpcs");
+
         auto const startTime = std::chrono::steady_clock::now();
 
         assert(mNpcs);
@@ -1683,14 +1765,20 @@ void World::Update(
     }
 
     {
+        FS_PROFILE_ZONE("World::UpdateFishes");
+
         auto const startTime = std::chrono::steady_clock::now();
 
-        mFishes.Update(mCurrentSimulationTime, mOceanSurface, mOceanFloor, simulationParameters, viewModel.GetVisibleWorld(), mAllShipExternalAABBs);
+        mFishes.Update(mCurrentSimulationTime, mOceanSurface, mOceanFloor, simulationParameters, visibleWorld, mAllShipExternalAABBs);
 
         perfStats.Update<PerfMeasurement::TotalFishUpdate>(std::chrono::steady_clock::now() - startTime);
     }
 
-    mUnderwaterPlants.Update(mCurrentSimulationTime, mWind, mOceanSurface, mOceanFloor, simulationParameters);
+    {
+        FS_PROFILE_ZONE("World::UpdateUnderwaterPlants");
+
+        mUnderwaterPlants.Update(mCurrentSimulationTime, mWind, mOceanSurface, mOceanFloor, simulationParameters);
+    }
 
     //
     // Signal update end (for quantities/state that needed to persist during whole Update cycle)
@@ -1706,12 +1794,16 @@ void World::Update(
     mNpcs->UpdateEnd();
 
     mOceanFloor.UpdateEnd();
+
+    threadManager.GetSimulationThreadPool().PublishStatistics(perfStats);
 }
 
 void World::RenderUpload(
     SimulationParameters const & simulationParameters,
     RenderContext & renderContext)
 {
+    FS_PROFILE_ZONE("World::RenderUpload");
+
     mStars.Upload(renderContext);
 
     mWind.Upload(renderContext);
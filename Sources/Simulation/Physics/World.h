@@ -55,6 +55,18 @@ public:
 
     void SetEventRecorder(EventRecorder * eventRecorder);
 
+    // Recordings, replays, and headless runs are deterministic sessions, in which
+    // the simulation may not depend on timings
+    bool IsDeterministicSession() const
+    {
+        return mIsDeterministicSession;
+    }
+
+    void SetDeterministicSession(bool isDeterministicSession)
+    {
+        mIsDeterministicSession = isDeterministicSession;
+    }
+
     void ReplayRecordedEvent(
         RecordedEvent const & event,
         SimulationParameters const & simulationParameters);
@@ -77,6 +89,29 @@ public:
 
     std::optional<Geometry::AABB> GetLargestShipExternalAABB() const;
 
+    // A region where the specified ship might be colliding with another ship,
+    // as detected by the broadphase at the beginning of the current step
+    struct ShipCollisionCandidate
+    {
+        ShipId OtherShipId;
+        Geometry::AABB Region;
+
+        ShipCollisionCandidate(
+            ShipId otherShipId,
+            Geometry::AABB const & region)
+            : OtherShipId(otherShipId)
+            , Region(region)
+        {}
+    };
+
+    std::vector<ShipCollisionCandidate> const & GetShipCollisionCandidates(ShipId shipId) const
+    {
+        assert(shipId < mShipCollisionCandidates.size());
+        return mShipCollisionCandidates[shipId];
+    }
+
+    Ship const & GetShip(ShipId shipId) const;
+
     Geometry::AABB CalculateAllShipParticleAABB() const;
 
     Npcs const & GetNpcs() const
@@ -530,7 +565,7 @@ public:
 
     void Update(
         SimulationParameters const & simulationParameters,
-        ViewModel const & viewModel,
+        VisibleWorld const & visibleWorld,
         StressRenderModeType stressRenderMode,
         ThreadManager & threadManager,
         PerfStats & perfStats);
@@ -539,6 +574,10 @@ public:
         SimulationParameters const & simulationParameters,
         RenderContext & renderContext);
 
+private:
+
+    void UpdateShipCollisionCandidates();
+
 private:
 
     // The current simulation time
@@ -550,6 +589,8 @@ private:
     // The current event recorder (if any)
     EventRecorder * mEventRecorder;
 
+    bool mIsDeterministicSession;
+
     // Repository
     std::vector<std::unique_ptr<Ship>> mAllShips;
     Stars mStars;
@@ -566,6 +607,10 @@ private:
     // The set of all ships' external AABB's in the world, updated at each
     // simulation cycle and at each ship addition
     Geometry::ShipAABBSet mAllShipExternalAABBs;
+
+    // The ship-ship collision candidates, by ship; calculated at the beginning
+    // of each simulation cycle out of the AABBs of the previous cycle
+    std::vector<std::vector<ShipCollisionCandidate>> mShipCollisionCandidates;
 };
 
 }
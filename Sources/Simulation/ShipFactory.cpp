@@ -331,6 +331,7 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
 
     auto [points, allElectricalElementInstanceIndices] = CreatePoints(
         pointInfos2,
+        shipId,
         parentWorld,
         materialDatabase,
         simulationEventDispatcher,
@@ -1869,6 +1870,7 @@ std::vector<ElementIndex> ShipFactory::PropagateFrontier(
 
 std::tuple<Physics::Points, std::set<ElectricalElementInstanceIndex>> ShipFactory::CreatePoints(
     std::vector<ShipFactoryPoint> const & pointInfos2,
+    ShipId shipId,
     World & parentWorld,
     MaterialDatabase const & materialDatabase,
     SimulationEventDispatcher & simulationEventDispatcher,
@@ -1895,6 +1897,7 @@ std::tuple<Physics::Points, std::set<ElectricalElementInstanceIndex>> ShipFactor
     Physics::Points points(
         static_cast<ElementIndex>(pointInfos2.size()),
         simulationParameters.MaxEphemeralParticles, // Here we freeze it
+        shipId,
         parentWorld,
         materialDatabase,
         simulationEventDispatcher,
@@ -155,6 +155,7 @@ private:
 
     static std::tuple<Physics::Points, std::set<ElectricalElementInstanceIndex>> CreatePoints(
         std::vector<ShipFactoryPoint> const & pointInfos2,
+        ShipId shipId,
         Physics::World & parentWorld,
         MaterialDatabase const & materialDatabase,
         SimulationEventDispatcher & simulationEventDispatcher,
@@ -0,0 +1,335 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "StateSnapshot.h"
+
+#include <Core/DeSerializationBuffer.h>
+#include <Core/GameExceptions.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+static std::uint32_t constexpr StateSnapshotsMagic = 0x46535353; // FSSS
+static std::uint16_t constexpr StateSnapshotsVersion = 1;
+
+namespace /* anonymous */ {
+
+    // FNV-1a
+    std::uint64_t constexpr DigestOffsetBasis = 14695981039346656037ull;
+    std::uint64_t constexpr DigestPrime = 1099511628211ull;
+
+    void DigestBytes(
+        void const * data,
+        size_t size,
+        std::uint64_t & digest)
+    {
+        auto const * const bytes = static_cast<std::uint8_t const *>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            digest ^= bytes[i];
+            digest *= DigestPrime;
+        }
+    }
+
+    // Not std::isnan, as we're built with finite math
+    bool IsNaN(float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(float));
+        return (bits & 0x7f800000u) == 0x7f800000u && (bits & 0x007fffffu) != 0;
+    }
+
+    bool AreEqual(
+        float value1,
+        float value2,
+        float tolerance)
+    {
+        if (IsNaN(value1) || IsNaN(value2))
+        {
+            return IsNaN(value1) && IsNaN(value2);
+        }
+
+        float const magnitude = std::max(1.0f, std::max(std::abs(value1), std::abs(value2)));
+        return std::abs(value1 - value2) <= tolerance * magnitude;
+    }
+
+}
+
+std::string StateSubsystemTypeToStr(StateSubsystemType subsystem)
+{
+    switch (subsystem)
+    {
+        case StateSubsystemType::Position:
+            return "position";
+        case StateSubsystemType::Velocity:
+            return "velocity";
+        case StateSubsystemType::Water:
+            return "water";
+        case StateSubsystemType::Temperature:
+            return "temperature";
+        case StateSubsystemType::Spring:
+            return "spring";
+    }
+
+    assert(false);
+    return "";
+}
+
+size_t StateSnapshot::GetComponentCount(StateSubsystemType subsystem)
+{
+    switch (subsystem)
+    {
+        case StateSubsystemType::Position:
+        case StateSubsystemType::Velocity:
+        case StateSubsystemType::Spring:
+            return 2;
+
+        case StateSubsystemType::Water:
+        case StateSubsystemType::Temperature:
+            return 1;
+    }
+
+    assert(false);
+    return 1;
+}
+
+StateSnapshot StateSnapshot::Capture(
+    Physics::World const & world,
+    std::uint64_t step)
+{
+    StateSnapshot snapshot(step);
+
+    for (size_t s = 0; s < world.GetShipCount(); ++s)
+    {
+        auto const & ship = world.GetShip(static_cast<ShipId>(s));
+        auto & shipState = snapshot.AddShip(ship.GetId());
+
+        //
+        // Points - ship points only, as ephemeral particles are cosmetic
+        //
+
+        auto const & points = ship.GetPoints();
+        ElementCount const pointCount = points.GetRawShipPointCount();
+
+        auto & positions = shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Position)];
+        auto & velocities = shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Velocity)];
+        auto & water = shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Water)];
+        auto & temperatures = shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Temperature)];
+
+        positions.reserve(pointCount * 2);
+        velocities.reserve(pointCount * 2);
+        water.reserve(pointCount);
+        temperatures.reserve(pointCount);
+
+        for (ElementIndex p = 0; p < pointCount; ++p)
+        {
+            positions.push_back(points.GetPosition(p).x);
+            positions.push_back(points.GetPosition(p).y);
+            velocities.push_back(points.GetVelocity(p).x);
+            velocities.push_back(points.GetVelocity(p).y);
+            water.push_back(points.GetWater(p));
+            temperatures.push_back(points.GetTemperature(p));
+        }
+
+        //
+        // Springs
+        //
+
+        auto const & springs = ship.GetSprings();
+
+        auto & springStates = shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Spring)];
+        springStates.reserve(springs.GetElementCount() * 2);
+
+        for (auto const springIndex : springs)
+        {
+            springStates.push_back(springs.IsDeleted(springIndex) ? 1.0f : 0.0f);
+            springStates.push_back(springs.GetRestLength(springIndex));
+        }
+    }
+
+    return snapshot;
+}
+
+std::uint64_t StateSnapshot::CalculateDigest(StateSubsystemType subsystem) const
+{
+    std::uint64_t digest = DigestOffsetBasis;
+
+    for (auto const & shipState : mShips)
+    {
+        auto const & values = shipState.Subsystems[static_cast<size_t>(subsystem)];
+
+        // Also the number of elements, so that e.g. a missing ship changes the digest
+        std::uint64_t const valueCount = static_cast<std::uint64_t>(values.size());
+        DigestBytes(&valueCount, sizeof(valueCount), digest);
+
+        DigestBytes(values.data(), values.size() * sizeof(float), digest);
+    }
+
+    return digest;
+}
+
+std::vector<StateSnapshot::Divergence> StateSnapshot::FindDivergences(
+    StateSnapshot const & snapshot1,
+    StateSnapshot const & snapshot2,
+    float tolerance)
+{
+    std::vector<Divergence> divergences;
+
+    std::vector<float> const noValues;
+
+    for (size_t ss = 0; ss < SubsystemCount; ++ss)
+    {
+        StateSubsystemType const subsystem = static_cast<StateSubsystemType>(ss);
+        size_t const componentCount = GetComponentCount(subsystem);
+
+        std::optional<Divergence> divergence;
+
+        size_t const shipCount = std::max(snapshot1.mShips.size(), snapshot2.mShips.size());
+        for (size_t s = 0; s < shipCount && !divergence.has_value(); ++s)
+        {
+            auto const & values1 = (s < snapshot1.mShips.size()) ? snapshot1.mShips[s].Subsystems[ss] : noValues;
+            auto const & values2 = (s < snapshot2.mShips.size()) ? snapshot2.mShips[s].Subsystems[ss] : noValues;
+
+            size_t const valueCount = std::max(values1.size(), values2.size());
+            for (size_t v = 0; v < valueCount; ++v)
+            {
+                std::optional<float> const value1 = (v < values1.size()) ? std::optional<float>(values1[v]) : std::nullopt;
+                std::optional<float> const value2 = (v < values2.size()) ? std::optional<float>(values2[v]) : std::nullopt;
+
+                if (!value1.has_value() || !value2.has_value() || !AreEqual(*value1, *value2, tolerance))
+                {
+                    divergence = Divergence{
+                        subsystem,
+                        static_cast<ShipId>(s),
+                        static_cast<ElementIndex>(v / componentCount),
+                        v % componentCount,
+                        value1,
+                        value2 };
+
+                    break;
+                }
+            }
+        }
+
+        if (divergence.has_value())
+        {
+            divergences.push_back(*divergence);
+        }
+    }
+
+    return divergences;
+}
+
+void StateSnapshot::SaveToStream(
+    std::vector<StateSnapshot> const & snapshots,
+    BinaryWriteStream & outputStream)
+{
+    DeSerializationBuffer<BigEndianess> buffer(1024 * 1024);
+
+    buffer.Append(StateSnapshotsMagic);
+    buffer.Append(StateSnapshotsVersion);
+
+    buffer.Append(static_cast<std::uint32_t>(snapshots.size()));
+
+    for (auto const & snapshot : snapshots)
+    {
+        buffer.Append(snapshot.mStep);
+        buffer.Append(static_cast<std::uint32_t>(snapshot.mShips.size()));
+
+        for (auto const & shipState : snapshot.mShips)
+        {
+            buffer.Append(static_cast<std::uint32_t>(shipState.Id));
+
+            for (auto const & values : shipState.Subsystems)
+            {
+                // Values as-is, as they only make sense on the same architecture anyway
+                buffer.Append(static_cast<std::uint32_t>(values.size()));
+                buffer.Append(reinterpret_cast<unsigned char const *>(values.data()), values.size() * sizeof(float));
+            }
+        }
+    }
+
+    outputStream.Write(buffer.GetData(), buffer.GetSize());
+}
+
+std::vector<StateSnapshot> StateSnapshot::LoadFromStream(BinaryReadStream & inputStream)
+{
+    size_t const size = inputStream.GetSize();
+
+    DeSerializationBuffer<BigEndianess> buffer(size);
+    inputStream.Read(buffer.Receive(size), size);
+
+    size_t offset = 0;
+
+    auto const ensureAvailable = [&](size_t count)
+        {
+            if (offset + count > size)
+            {
+                throw GameException("State snapshots file is truncated");
+            }
+        };
+
+    ensureAvailable(sizeof(std::uint32_t) + sizeof(std::uint16_t) + sizeof(std::uint32_t));
+
+    std::uint32_t magic;
+    offset += buffer.ReadAt(offset, magic);
+    if (magic != StateSnapshotsMagic)
+    {
+        throw GameException("File is not a state snapshots file");
+    }
+
+    std::uint16_t version;
+    offset += buffer.ReadAt(offset, version);
+    if (version != StateSnapshotsVersion)
+    {
+        throw GameException("State snapshots file was made with an incompatible version of the game");
+    }
+
+    std::uint32_t snapshotCount;
+    offset += buffer.ReadAt(offset, snapshotCount);
+
+    std::vector<StateSnapshot> snapshots;
+    snapshots.reserve(snapshotCount);
+
+    for (std::uint32_t i = 0; i < snapshotCount; ++i)
+    {
+        ensureAvailable(sizeof(std::uint64_t) + sizeof(std::uint32_t));
+
+        std::uint64_t step;
+        offset += buffer.ReadAt(offset, step);
+
+        auto & snapshot = snapshots.emplace_back(step);
+
+        std::uint32_t shipCount;
+        offset += buffer.ReadAt(offset, shipCount);
+
+        for (std::uint32_t s = 0; s < shipCount; ++s)
+        {
+            ensureAvailable(sizeof(std::uint32_t));
+
+            std::uint32_t shipId;
+            offset += buffer.ReadAt(offset, shipId);
+
+            auto & shipState = snapshot.AddShip(static_cast<ShipId>(shipId));
+
+            for (auto & values : shipState.Subsystems)
+            {
+                ensureAvailable(sizeof(std::uint32_t));
+
+                std::uint32_t valueCount;
+                offset += buffer.ReadAt(offset, valueCount);
+
+                ensureAvailable(valueCount * sizeof(float));
+
+                values.resize(valueCount);
+                offset += buffer.ReadAt(offset, reinterpret_cast<unsigned char *>(values.data()), valueCount * sizeof(float));
+            }
+        }
+    }
+
+    return snapshots;
+}
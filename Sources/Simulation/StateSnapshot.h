@@ -0,0 +1,128 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-18
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Physics/Physics.h"
+
+#include <Core/GameTypes.h>
+#include <Core/Streams.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * The subsystems of the state of a ship that we validate.
+ */
+enum class StateSubsystemType : std::uint32_t
+{
+    Position = 0,   // Points: x, y
+    Velocity,       // Points: x, y
+    Water,          // Points
+    Temperature,    // Points
+    Spring,         // Springs: is deleted (0 or 1), rest length
+
+    _Last = Spring
+};
+
+std::string StateSubsystemTypeToStr(StateSubsystemType subsystem);
+
+/*
+ * The state of the ships of a World at a simulation step, by subsystem, for verifying
+ * that two configurations of the simulation - or two builds - yield the same results.
+ *
+ * Digests are exact: they are equal only when the state is bit-identical. Comparing two
+ * snapshots instead finds the elements whose values differ beyond a tolerance.
+ *
+ * Elements are identified by their index, hence only snapshots of ships with the same
+ * layout may be compared.
+ */
+class StateSnapshot final
+{
+public:
+
+    static size_t constexpr SubsystemCount = static_cast<size_t>(StateSubsystemType::_Last) + 1;
+
+    // Number of floats making up the state of one element of the subsystem
+    static size_t GetComponentCount(StateSubsystemType subsystem);
+
+    struct ShipState
+    {
+        ShipId Id;
+        std::array<std::vector<float>, SubsystemCount> Subsystems; // All components of all elements
+
+        explicit ShipState(ShipId id)
+            : Id(id)
+            , Subsystems()
+        {}
+    };
+
+    /*
+     * The first element of a subsystem whose value diverges between two snapshots.
+     */
+    struct Divergence
+    {
+        StateSubsystemType Subsystem;
+        ShipId Ship;
+        ElementIndex Element;
+        size_t Component;
+        std::optional<float> Value1; // None when the element does not exist in the first snapshot
+        std::optional<float> Value2; // None when the element does not exist in the second snapshot
+    };
+
+public:
+
+    explicit StateSnapshot(std::uint64_t step)
+        : mStep(step)
+        , mShips()
+    {}
+
+    static StateSnapshot Capture(
+        Physics::World const & world,
+        std::uint64_t step);
+
+    std::uint64_t GetStep() const
+    {
+        return mStep;
+    }
+
+    std::vector<ShipState> const & GetShips() const
+    {
+        return mShips;
+    }
+
+    ShipState & AddShip(ShipId shipId)
+    {
+        return mShips.emplace_back(shipId);
+    }
+
+    /*
+     * Hash of the bit patterns of the subsystem's state in all ships.
+     */
+    std::uint64_t CalculateDigest(StateSubsystemType subsystem) const;
+
+    /*
+     * Returns the first divergence of each subsystem whose values differ by more than the
+     * specified tolerance, relative to the magnitude of the values when they are above one.
+     */
+    static std::vector<Divergence> FindDivergences(
+        StateSnapshot const & snapshot1,
+        StateSnapshot const & snapshot2,
+        float tolerance);
+
+    static void SaveToStream(
+        std::vector<StateSnapshot> const & snapshots,
+        BinaryWriteStream & outputStream);
+
+    static std::vector<StateSnapshot> LoadFromStream(BinaryReadStream & inputStream);
+
+private:
+
+    std::uint64_t mStep;
+    std::vector<ShipState> mShips; // By ship ID
+};
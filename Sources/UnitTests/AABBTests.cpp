@@ -1,6 +1,10 @@
 #include <Core/AABB.h>
 #include <Core/AABBSet.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 TEST(AABBTests, AABB_Contains)
@@ -48,3 +52,45 @@ TEST(AABBTests, AABBSet_MakeUnion)
     EXPECT_EQ(res->TopRight, vec2f(25.0f, 100.0f));
     EXPECT_EQ(res->BottomLeft, vec2f(10.0f, 70.0f));
 }
+
+TEST(AABBTests, AABB_Intersects)
+{
+    Geometry::AABB t(10.0f, 20.0f, 100.0f, 90.0f);
+
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(15.0f, 16.0f, 96.0f, 95.0f))); // Contained
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(0.0f, 30.0f, 110.0f, 80.0f))); // Containing
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(18.0f, 25.0f, 92.0f, 80.0f))); // Overlapping corner
+    EXPECT_TRUE(t.Intersects(Geometry::AABB(20.0f, 25.0f, 95.0f, 94.0f))); // Touching edge
+    EXPECT_FALSE(t.Intersects(Geometry::AABB(21.0f, 25.0f, 95.0f, 94.0f)));
+    EXPECT_FALSE(t.Intersects(Geometry::AABB(15.0f, 16.0f, 89.0f, 80.0f)));
+    EXPECT_FALSE(t.Intersects(Geometry::AABB()));
+}
+
+TEST(AABBTests, ShipAABBSet_VisitCrossShipIntersections)
+{
+    Geometry::ShipAABBSet t;
+    t.Add(Geometry::ShipAABB(0.0f, 10.0f, 10.0f, 0.0f, 1), 0); // 0
+    t.Add(Geometry::ShipAABB(5.0f, 15.0f, 5.0f, -5.0f, 1), 1); // 1: intersects 0
+    t.Add(Geometry::ShipAABB(8.0f, 9.0f, 4.0f, 3.0f, 1), 0); // 2: intersects 0 (same ship) and 1
+    t.Add(Geometry::ShipAABB(2.0f, 3.0f, 30.0f, 20.0f, 1), 1); // 3: overlaps 0 along X only
+    t.Add(Geometry::ShipAABB(100.0f, 110.0f, 10.0f, 0.0f, 1), 2); // 4: far away
+
+    std::vector<std::pair<size_t, size_t>> pairs;
+    t.VisitCrossShipIntersections(
+        [&pairs](size_t i1, size_t i2)
+        {
+            pairs.emplace_back(std::min(i1, i2), std::max(i1, i2));
+        });
+
+    std::sort(pairs.begin(), pairs.end());
+
+    ASSERT_EQ(pairs.size(), 2u);
+    EXPECT_EQ(pairs[0], std::make_pair(size_t(0), size_t(1)));
+    EXPECT_EQ(pairs[1], std::make_pair(size_t(1), size_t(2)));
+
+    // Ship IDs follow AABBs, and are cleared with them
+    EXPECT_EQ(t.GetShipIds(), std::vector<ShipId>({ 0, 1, 0, 1, 2 }));
+    t.Clear();
+    EXPECT_EQ(t.GetCount(), 0u);
+    EXPECT_TRUE(t.GetShipIds().empty());
+}
@@ -542,6 +542,93 @@ TEST(AlgorithmsTests, SmoothBufferAndAdd_16_5_NeonVectorized)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// OceanSurfaceSamples
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::array<Algorithms::OceanSurfaceWave, 3> const OceanSurfaceTestWaves = {
+    Algorithms::OceanSurfaceWave{ -345.23, 0.0336, 1.5f },
+    Algorithms::OceanSurfaceWave{ 227.87, -0.0524, 1.125f },
+    Algorithms::OceanSurfaceWave{ -512.11, 0.3972, 0.0625f }
+};
+
+template<typename Algorithm>
+void RunGenerateOceanSurfaceSamplesTest(Algorithm algorithm)
+{
+    static size_t constexpr SamplesCount = 96; // Spans more than one phase block
+
+    // One extra height, as the algorithm reads the height field at the end of the range
+    std::array<float, SamplesCount + 1> heightField;
+    for (size_t i = 0; i < heightField.size(); ++i)
+    {
+        heightField[i] = 50.0f + 0.01f * static_cast<float>(i % 7);
+    }
+
+    std::array<float, SamplesCount * 2> samples;
+
+    algorithm(
+        heightField.data(),
+        50.0f,
+        10.0f,
+        OceanSurfaceTestWaves,
+        0,
+        SamplesCount,
+        samples.data());
+
+    auto const expectedSampleValue = [&](size_t i)
+    {
+        double value = (heightField[i] - 50.0) * 10.0;
+        for (auto const & wave : OceanSurfaceTestWaves)
+        {
+            value += wave.Amplitude * std::sin(2.0 * Pi<double> * (wave.PhaseOrigin + static_cast<double>(i) * wave.PhaseDx));
+        }
+
+        return static_cast<float>(value);
+    };
+
+    for (size_t i = 0; i < SamplesCount; ++i)
+    {
+        EXPECT_TRUE(ApproxEquals(samples[i * 2], expectedSampleValue(i), 0.0001f));
+        EXPECT_TRUE(ApproxEquals(samples[i * 2 + 1], expectedSampleValue(i + 1) - expectedSampleValue(i), 0.0001f));
+    }
+}
+
+TEST(AlgorithmsTests, GenerateOceanSurfaceSamples_Naive)
+{
+    RunGenerateOceanSurfaceSamplesTest(Algorithms::GenerateOceanSurfaceSamples_Naive<3>);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, GenerateOceanSurfaceSamples_SSEVectorized)
+{
+    RunGenerateOceanSurfaceSamplesTest(Algorithms::GenerateOceanSurfaceSamples_SSEVectorized<3>);
+}
+#endif
+
+TEST(AlgorithmsTests, GenerateOceanSurfaceSamples_IndependentOfRanges)
+{
+    static size_t constexpr SamplesCount = 256;
+
+    std::array<float, SamplesCount + 1> heightField;
+    for (size_t i = 0; i < heightField.size(); ++i)
+    {
+        heightField[i] = 50.0f - 0.02f * static_cast<float>(i % 5);
+    }
+
+    std::array<float, SamplesCount * 2> wholeSamples;
+    Algorithms::GenerateOceanSurfaceSamples(heightField.data(), 50.0f, 10.0f, OceanSurfaceTestWaves, 0, SamplesCount, wholeSamples.data());
+
+    std::array<float, SamplesCount * 2> rangedSamples;
+    Algorithms::GenerateOceanSurfaceSamples(heightField.data(), 50.0f, 10.0f, OceanSurfaceTestWaves, 0, 64, rangedSamples.data());
+    Algorithms::GenerateOceanSurfaceSamples(heightField.data(), 50.0f, 10.0f, OceanSurfaceTestWaves, 64, 192, rangedSamples.data());
+    Algorithms::GenerateOceanSurfaceSamples(heightField.data(), 50.0f, 10.0f, OceanSurfaceTestWaves, 192, SamplesCount, rangedSamples.data());
+
+    for (size_t i = 0; i < SamplesCount * 2; ++i)
+    {
+        EXPECT_EQ(wholeSamples[i], rangedSamples[i]);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // CalculateSpringVectors
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
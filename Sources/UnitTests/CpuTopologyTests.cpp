@@ -0,0 +1,213 @@
+#include <Core/CpuTopology.h>
+
+#include <map>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    // A fake sysfs CPU directory
+    class FakeSysfs
+    {
+    public:
+
+        void AddFile(std::string const & relativePath, std::string const & content)
+        {
+            mFiles[std::filesystem::path("sys") / relativePath] = content;
+        }
+
+        void AddCpu(
+            size_t cpuId,
+            std::optional<int> capacity,
+            std::string const & threadSiblingsList,
+            std::optional<std::string> const & l3SharedCpuList)
+        {
+            std::string const cpuDir = "cpu" + std::to_string(cpuId);
+
+            if (capacity.has_value())
+                AddFile(cpuDir + "/cpu_capacity", std::to_string(*capacity) + "\n");
+
+            AddFile(cpuDir + "/topology/thread_siblings_list", threadSiblingsList + "\n");
+
+            if (l3SharedCpuList.has_value())
+                AddFile(cpuDir + "/cache/index3/shared_cpu_list", *l3SharedCpuList + "\n");
+        }
+
+        std::optional<CpuTopology> Load(std::optional<std::vector<size_t>> const & allowedCpuIds = std::nullopt) const
+        {
+            return CpuTopology::Load(
+                "sys",
+                [this](std::filesystem::path const & filePath) -> std::optional<std::string>
+                {
+                    auto const it = mFiles.find(filePath);
+                    if (it == mFiles.end())
+                        return std::nullopt;
+
+                    return it->second;
+                },
+                allowedCpuIds);
+        }
+
+    private:
+
+        std::map<std::filesystem::path, std::string> mFiles;
+    };
+
+    std::vector<size_t> GetCpuIds(std::vector<ThreadManager::CpuInfo> const & cpuResources)
+    {
+        std::vector<size_t> cpuIds;
+        for (auto const & cpuInfo : cpuResources)
+            cpuIds.push_back(cpuInfo.CpuId);
+
+        return cpuIds;
+    }
+}
+
+TEST(CpuTopologyTests, ParseCpuList)
+{
+    EXPECT_EQ(CpuTopology::ParseCpuList("0"), std::vector<size_t>({ 0 }));
+    EXPECT_EQ(CpuTopology::ParseCpuList("0-3\n"), std::vector<size_t>({ 0, 1, 2, 3 }));
+    EXPECT_EQ(CpuTopology::ParseCpuList("0-1,8,10-11"), std::vector<size_t>({ 0, 1, 8, 10, 11 }));
+    EXPECT_EQ(CpuTopology::ParseCpuList(""), std::vector<size_t>());
+}
+
+TEST(CpuTopologyTests, ParseCpuList_Invalid)
+{
+    EXPECT_THROW(CpuTopology::ParseCpuList("a-3"), std::exception);
+    EXPECT_THROW(CpuTopology::ParseCpuList("3-1"), std::exception);
+    EXPECT_THROW(CpuTopology::ParseCpuList("1-"), std::exception);
+}
+
+TEST(CpuTopologyTests, Load_NoTopology)
+{
+    FakeSysfs sysfs;
+
+    EXPECT_FALSE(sysfs.Load().has_value());
+}
+
+TEST(CpuTopologyTests, Load_Invalid)
+{
+    FakeSysfs sysfs;
+    sysfs.AddFile("online", "0-x");
+
+    EXPECT_FALSE(sysfs.Load().has_value());
+}
+
+TEST(CpuTopologyTests, Load_Hybrid)
+{
+    // Two P-cores with SMT (0,1 and 2,3), two E-cores (4, 5); one L3
+    FakeSysfs sysfs;
+    sysfs.AddFile("online", "0-5\n");
+    sysfs.AddCpu(0, 1024, "0-1", "0-5");
+    sysfs.AddCpu(1, 1024, "0-1", "0-5");
+    sysfs.AddCpu(2, 1024, "2-3", "0-5");
+    sysfs.AddCpu(3, 1024, "2-3", "0-5");
+    sysfs.AddCpu(4, 512, "4", "0-5");
+    sysfs.AddCpu(5, 512, "5", "0-5");
+
+    auto const topology = sysfs.Load();
+    ASSERT_TRUE(topology.has_value());
+
+    auto const & logicalCpus = topology->GetLogicalCpus();
+    ASSERT_EQ(logicalCpus.size(), 6u);
+    EXPECT_EQ(logicalCpus[3].CpuId, 3u);
+    EXPECT_EQ(logicalCpus[3].CoreId, 2u);
+    EXPECT_EQ(logicalCpus[3].CacheDomainId, 0u);
+    EXPECT_FLOAT_EQ(logicalCpus[3].Capacity, 1.0f);
+    EXPECT_FLOAT_EQ(logicalCpus[4].Capacity, 0.5f);
+
+    // P-cores first, then E-cores, then SMT siblings
+    auto const cpuResources = topology->MakeCpuResources();
+    EXPECT_EQ(GetCpuIds(cpuResources), std::vector<size_t>({ 0, 2, 4, 5, 1, 3 }));
+    EXPECT_FLOAT_EQ(cpuResources[0].Speed, 1.0f);
+    EXPECT_FLOAT_EQ(cpuResources[2].Speed, 0.5f);
+    EXPECT_FLOAT_EQ(cpuResources[4].Speed, CpuTopology::SmtSiblingSpeedFactor);
+}
+
+TEST(CpuTopologyTests, Load_Chiplets)
+{
+    // Two L3 domains of two cores each, SMT siblings numbered after all cores
+    // (0-3 cores, 4-7 siblings); domain of cpu 2 is listed first in sysfs order
+    // but both have equal capacity, hence lowest domain wins
+    FakeSysfs sysfs;
+    sysfs.AddFile("online", "0-7");
+    sysfs.AddCpu(0, std::nullopt, "0,4", "0-1,4-5");
+    sysfs.AddCpu(1, std::nullopt, "1,5", "0-1,4-5");
+    sysfs.AddCpu(2, std::nullopt, "2,6", "2-3,6-7");
+    sysfs.AddCpu(3, std::nullopt, "3,7", "2-3,6-7");
+    sysfs.AddCpu(4, std::nullopt, "0,4", "0-1,4-5");
+    sysfs.AddCpu(5, std::nullopt, "1,5", "0-1,4-5");
+    sysfs.AddCpu(6, std::nullopt, "2,6", "2-3,6-7");
+    sysfs.AddCpu(7, std::nullopt, "3,7", "2-3,6-7");
+
+    auto const topology = sysfs.Load();
+    ASSERT_TRUE(topology.has_value());
+
+    auto cpuResources = topology->MakeCpuResources();
+    EXPECT_EQ(GetCpuIds(cpuResources), std::vector<size_t>({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+
+    // ThreadManager keeps this order among equal speeds
+    ThreadManager threadManager(false, 2, cpuResources, [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {});
+    EXPECT_EQ(threadManager.GetNthFastestCpu(0).CpuId, 0u);
+    EXPECT_EQ(threadManager.GetNthFastestCpu(1).CpuId, 1u);
+    EXPECT_EQ(threadManager.GetNthFastestCpu(2).CpuId, 2u);
+}
+
+TEST(CpuTopologyTests, Load_Chiplets_PrefersDomainWithMostCapacity)
+{
+    // Domain 0 has one core, domain 1 has three
+    FakeSysfs sysfs;
+    sysfs.AddFile("online", "0-3");
+    sysfs.AddCpu(0, std::nullopt, "0", "0");
+    sysfs.AddCpu(1, std::nullopt, "1", "1-3");
+    sysfs.AddCpu(2, std::nullopt, "2", "1-3");
+    sysfs.AddCpu(3, std::nullopt, "3", "1-3");
+
+    auto const topology = sysfs.Load();
+    ASSERT_TRUE(topology.has_value());
+
+    EXPECT_EQ(GetCpuIds(topology->MakeCpuResources()), std::vector<size_t>({ 1, 2, 3, 0 }));
+}
+
+TEST(CpuTopologyTests, Load_RestrictedToAllowedCpus)
+{
+    // Domain 0 has two cores, domain 1 has three, but we may only run on three of them
+    FakeSysfs sysfs;
+    sysfs.AddFile("online", "0-4");
+    sysfs.AddCpu(0, std::nullopt, "0", "0-1");
+    sysfs.AddCpu(1, std::nullopt, "1", "0-1");
+    sysfs.AddCpu(2, std::nullopt, "2", "2-4");
+    sysfs.AddCpu(3, std::nullopt, "3", "2-4");
+    sysfs.AddCpu(4, std::nullopt, "4", "2-4");
+
+    EXPECT_EQ(GetCpuIds(sysfs.Load()->MakeCpuResources()), std::vector<size_t>({ 2, 3, 4, 0, 1 }));
+
+    auto const topology = sysfs.Load(std::vector<size_t>({ 0, 1, 2, 7 }));
+    ASSERT_TRUE(topology.has_value());
+    ASSERT_EQ(topology->GetLogicalCpus().size(), 3u);
+
+    EXPECT_EQ(GetCpuIds(topology->MakeCpuResources()), std::vector<size_t>({ 0, 1, 2 }));
+
+    // None allowed
+    EXPECT_FALSE(sysfs.Load(std::vector<size_t>({ 7 })).has_value());
+}
+
+TEST(CpuTopologyTests, Load_OfflineCpusAndMissingFiles)
+{
+    // Cpu 1 offline; no SMT or cache information
+    FakeSysfs sysfs;
+    sysfs.AddFile("online", "0,2-3");
+
+    auto const topology = sysfs.Load();
+    ASSERT_TRUE(topology.has_value());
+
+    auto const & logicalCpus = topology->GetLogicalCpus();
+    ASSERT_EQ(logicalCpus.size(), 3u);
+    EXPECT_EQ(logicalCpus[1].CpuId, 2u);
+    EXPECT_EQ(logicalCpus[1].CoreId, 2u);
+    EXPECT_EQ(logicalCpus[1].CacheDomainId, 0u);
+    EXPECT_FLOAT_EQ(logicalCpus[1].Capacity, 1.0f);
+
+    EXPECT_EQ(GetCpuIds(topology->MakeCpuResources()), std::vector<size_t>({ 0, 2, 3 }));
+}
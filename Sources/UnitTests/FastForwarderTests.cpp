@@ -0,0 +1,207 @@
+#include <Game/FastForwarder.h>
+
+#include <Simulation/SimulationParameters.h>
+
+#include <Core/GameWallClock.h>
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+size_t GetStepCount(float simulationDuration)
+{
+    return static_cast<size_t>(std::round(simulationDuration / SimulationParameters::SimulationStepTimeDuration<float>));
+}
+
+// Advances the wall clock as the game does at each simulation step
+void AdvanceWallClock()
+{
+    if (GameWallClock::GetInstance().IsDeterministic())
+    {
+        GameWallClock::GetInstance().AdvanceDeterministicTime(
+            std::chrono::duration_cast<GameWallClock::duration>(
+                std::chrono::duration<double>(SimulationParameters::SimulationStepTimeDuration<double>)));
+    }
+}
+
+}
+
+TEST(FastForwarderTests, Start_CalculatesStepCount)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    FastForwarder fastForwarder;
+    EXPECT_FALSE(fastForwarder.IsFastForwarding());
+
+    EXPECT_TRUE(fastForwarder.Start(2.0f));
+    EXPECT_TRUE(fastForwarder.IsFastForwarding());
+    EXPECT_EQ(fastForwarder.GetRemainingStepCount(), GetStepCount(2.0f));
+
+    // Restart replaces what's left
+    EXPECT_TRUE(fastForwarder.Start(1.0f));
+    EXPECT_EQ(fastForwarder.GetRemainingStepCount(), GetStepCount(1.0f));
+}
+
+TEST(FastForwarderTests, Start_DoesNothingWithLessThanOneStep)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    FastForwarder fastForwarder;
+
+    EXPECT_FALSE(fastForwarder.Start(SimulationParameters::SimulationStepTimeDuration<float> * 0.4f));
+    EXPECT_FALSE(fastForwarder.IsFastForwarding());
+    EXPECT_FALSE(wallClock.IsDeterministic());
+}
+
+TEST(FastForwarderTests, RunSteps_RunsAllStepsInOneBatch)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    FastForwarder fastForwarder;
+    ASSERT_TRUE(fastForwarder.Start(1.0f));
+
+    size_t stepCount = 0;
+    size_t const ranStepCount = fastForwarder.RunSteps(
+        [&]()
+        {
+            AdvanceWallClock();
+            ++stepCount;
+        },
+        GameChronometer::duration::max());
+
+    EXPECT_EQ(ranStepCount, GetStepCount(1.0f));
+    EXPECT_EQ(stepCount, GetStepCount(1.0f));
+    EXPECT_FALSE(fastForwarder.IsFastForwarding());
+}
+
+TEST(FastForwarderTests, RunSteps_RunsAtLeastOneStepPerBatch)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    FastForwarder fastForwarder;
+    ASSERT_TRUE(fastForwarder.Start(SimulationParameters::SimulationStepTimeDuration<float> * 3.0f));
+
+    size_t stepCount = 0;
+    auto const runStep = [&]()
+        {
+            AdvanceWallClock();
+            ++stepCount;
+        };
+
+    EXPECT_EQ(fastForwarder.RunSteps(runStep, GameChronometer::duration::zero()), 1u);
+    EXPECT_EQ(fastForwarder.GetRemainingStepCount(), 2u);
+    EXPECT_EQ(fastForwarder.RunSteps(runStep, GameChronometer::duration::zero()), 1u);
+    EXPECT_EQ(fastForwarder.RunSteps(runStep, GameChronometer::duration::zero()), 1u);
+
+    EXPECT_EQ(stepCount, 3u);
+    EXPECT_FALSE(fastForwarder.IsFastForwarding());
+}
+
+TEST(FastForwarderTests, RunSteps_StepMayStop)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    FastForwarder fastForwarder;
+    ASSERT_TRUE(fastForwarder.Start(1.0f));
+
+    size_t stepCount = 0;
+    size_t const ranStepCount = fastForwarder.RunSteps(
+        [&]()
+        {
+            AdvanceWallClock();
+            if (++stepCount == 5)
+            {
+                fastForwarder.Stop();
+            }
+        },
+        GameChronometer::duration::max());
+
+    EXPECT_EQ(ranStepCount, 5u);
+    EXPECT_FALSE(fastForwarder.IsFastForwarding());
+    EXPECT_FALSE(wallClock.IsDeterministic());
+}
+
+TEST(FastForwarderTests, WallClock_AdvancesByOneStepPerStep)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    // Real time does not flow while paused, hence only steps may move the clock
+    wallClock.SetPaused(true);
+    float const floatTimeBefore = wallClock.NowAsFloat();
+
+    FastForwarder fastForwarder;
+    ASSERT_TRUE(fastForwarder.Start(1.0f));
+
+    fastForwarder.RunSteps(
+        [&]()
+        {
+            EXPECT_TRUE(wallClock.IsDeterministic());
+            AdvanceWallClock();
+        },
+        GameChronometer::duration::max());
+
+    EXPECT_FALSE(wallClock.IsDeterministic());
+    EXPECT_NEAR(
+        wallClock.NowAsFloat(),
+        floatTimeBefore + static_cast<float>(GetStepCount(1.0f)) * SimulationParameters::SimulationStepTimeDuration<float>,
+        0.0001f);
+}
+
+TEST(FastForwarderTests, WallClock_ReentersDeterministicModeWhenStepExitsIt)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    FastForwarder fastForwarder;
+    ASSERT_TRUE(fastForwarder.Start(1.0f));
+
+    size_t stepCount = 0;
+    fastForwarder.RunSteps(
+        [&]()
+        {
+            EXPECT_TRUE(wallClock.IsDeterministic());
+            AdvanceWallClock();
+
+            // As when a replay completes while fast-forwarding
+            if (++stepCount == 5)
+            {
+                wallClock.ExitDeterministicMode();
+            }
+        },
+        GameChronometer::duration::max());
+
+    EXPECT_EQ(stepCount, GetStepCount(1.0f));
+    EXPECT_FALSE(wallClock.IsDeterministic());
+}
+
+TEST(FastForwarderTests, WallClock_KeepsDeterministicModeItDidNotEnter)
+{
+    GameWallClock wallClock;
+    GameWallClock::ThreadScope const threadScope(&wallClock);
+
+    wallClock.EnterDeterministicMode();
+
+    FastForwarder fastForwarder;
+    ASSERT_TRUE(fastForwarder.Start(1.0f));
+    fastForwarder.RunSteps(
+        [&]()
+        {
+            AdvanceWallClock();
+        },
+        GameChronometer::duration::max());
+
+    EXPECT_TRUE(wallClock.IsDeterministic());
+    EXPECT_NEAR(
+        wallClock.NowAsFloat(),
+        static_cast<float>(GetStepCount(1.0f)) * SimulationParameters::SimulationStepTimeDuration<float>,
+        0.0001f);
+}
@@ -309,3 +309,25 @@ TEST_P(SinCos4Test, SinCos4Test)
     EXPECT_TRUE(ApproxEquals(c[3], std::cosf(x[3]), 0.000001f));
 }
 
+TEST(GameMathTests, SinTurns4)
+{
+    std::array<float, 16> const x{
+        0.0f, 0.01f, -0.01f, 0.1f,
+        0.25f, 0.49f, 0.5f, 0.75f,
+        0.999f, 1.0f, 1.25f, 3.6f,
+        -0.25f, -0.6f, -1.3f, -2.75f
+    };
+
+    std::array<float, 16> s;
+
+    for (size_t i = 0; i < x.size(); i += 4)
+    {
+        SinTurns4(&(x[i]), &(s[i]));
+    }
+
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_TRUE(ApproxEquals(s[i], static_cast<float>(std::sin(2.0 * Pi<double> * x[i])), 0.000001f));
+    }
+}
+
@@ -0,0 +1,45 @@
+#include <Core/GameRandomEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <thread>
+
+TEST(GameRandomEngineTests, SameSeed_SameSequence)
+{
+    GameRandomEngine engine1(1234);
+    GameRandomEngine engine2(1234);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(engine1.GenerateUniformInteger<std::uint32_t>(0, 1000000), engine2.GenerateUniformInteger<std::uint32_t>(0, 1000000));
+    }
+}
+
+TEST(GameRandomEngineTests, ThreadScope_BindsAndRestores)
+{
+    GameRandomEngine & singleton = GameRandomEngine::GetInstance();
+    EXPECT_EQ(GameRandomEngine::GetThreadInstance(), nullptr);
+
+    GameRandomEngine engine1(1);
+    GameRandomEngine engine2(2);
+
+    {
+        GameRandomEngine::ThreadScope const scope1(&engine1);
+        EXPECT_EQ(&GameRandomEngine::GetInstance(), &engine1);
+
+        {
+            GameRandomEngine::ThreadScope const scope2(&engine2);
+            EXPECT_EQ(&GameRandomEngine::GetInstance(), &engine2);
+
+            // Other threads are not affected
+            GameRandomEngine * otherThreadInstance = nullptr;
+            std::thread([&otherThreadInstance]() { otherThreadInstance = &GameRandomEngine::GetInstance(); }).join();
+            EXPECT_EQ(otherThreadInstance, &singleton);
+        }
+
+        EXPECT_EQ(&GameRandomEngine::GetInstance(), &engine1);
+    }
+
+    EXPECT_EQ(&GameRandomEngine::GetInstance(), &singleton);
+}
@@ -0,0 +1,70 @@
+#include <Game/HeadlessSimulation.h>
+
+#include <Simulation/StateSnapshot.h>
+
+#include "TestingUtils.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+StateSnapshot RunTestShip(
+    std::shared_ptr<HeadlessSimulation::Databases const> const & databases,
+    size_t stepCount,
+    bool isFastForward)
+{
+    TestAssetManager assetManager;
+    ThreadManager threadManager(false, 1, MakeCpuInfos(1), [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {});
+
+    HeadlessSimulation simulation(
+        assetManager,
+        databases,
+        OceanFloorHeightMap(),
+        threadManager,
+        42);
+
+    simulation.GetSimulationParameters().NumberOfFishes = 0;
+
+    simulation.AddShip(
+        MakeTestShipDefinition(ShipSpaceSize(12, 6), databases->MaterialDb),
+        ShipLoadOptions());
+
+    if (isFastForward)
+    {
+        EXPECT_EQ(simulation.FastForward(static_cast<float>(stepCount) * SimulationParameters::SimulationStepTimeDuration<float>), stepCount);
+    }
+    else
+    {
+        for (size_t s = 0; s < stepCount; ++s)
+        {
+            simulation.Update();
+        }
+    }
+
+    EXPECT_EQ(simulation.GetStepCount(), stepCount);
+
+    return StateSnapshot::Capture(simulation.GetWorld(), simulation.GetStepCount());
+}
+
+}
+
+TEST(HeadlessSimulationTests, FastForward_MatchesUpdates)
+{
+    auto const databases = MakeTestSimulationDatabases();
+
+    size_t constexpr StepCount = 120;
+
+    StateSnapshot const initialSnapshot = RunTestShip(databases, 0, false);
+    StateSnapshot const updatedSnapshot = RunTestShip(databases, StepCount, false);
+    StateSnapshot const fastForwardedSnapshot = RunTestShip(databases, StepCount, true);
+
+    // The ship has moved
+    EXPECT_NE(updatedSnapshot.CalculateDigest(StateSubsystemType::Position), initialSnapshot.CalculateDigest(StateSubsystemType::Position));
+
+    // Stepping back-to-back makes no difference
+    for (size_t s = 0; s < StateSnapshot::SubsystemCount; ++s)
+    {
+        auto const subsystem = static_cast<StateSubsystemType>(s);
+        EXPECT_EQ(fastForwardedSnapshot.CalculateDigest(subsystem), updatedSnapshot.CalculateDigest(subsystem)) << StateSubsystemTypeToStr(subsystem);
+    }
+}
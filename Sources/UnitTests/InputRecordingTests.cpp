@@ -0,0 +1,345 @@
+#include <Game/InputRecording.h>
+
+#include <Core/GameExceptions.h>
+#include <Core/GameWallClock.h>
+#include <Core/MemoryStreams.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+class TestInputReplayTarget final : public IInputReplayTarget
+{
+public:
+
+    Physics::World & GetReplayWorld() override
+    {
+        throw std::logic_error("Not expected to replay World inputs");
+    }
+
+    void ReplayAddShip(ShipLoadSpecifications const & loadSpecs) override
+    {
+        LoadedShips.emplace_back(loadSpecs.DefinitionFilepath, false);
+    }
+
+    void ReplayResetAndLoadShip(ShipLoadSpecifications const & loadSpecs) override
+    {
+        LoadedShips.emplace_back(loadSpecs.DefinitionFilepath, true);
+    }
+
+    std::vector<std::pair<std::filesystem::path, bool>> LoadedShips; // Path, isReset
+};
+
+}
+
+TEST(InputRecordingTests, Payload_RoundTrip)
+{
+    RecordedInput input(7, RecordedInputType::DestroyAt);
+
+    input.WriteArguments(
+        vec2f(1.5f, -2.5f),
+        4.0f,
+        std::optional<NpcId>(),
+        std::optional<NpcId>(NpcId(3)),
+        std::vector<ElementIndex>({ 10, 20, 30 }),
+        true);
+
+    auto const [v, f, o1, o2, vec, b] = input.ReadArguments<
+        vec2f,
+        float,
+        std::optional<NpcId>,
+        std::optional<NpcId>,
+        std::vector<ElementIndex>,
+        bool>();
+
+    EXPECT_EQ(v, vec2f(1.5f, -2.5f));
+    EXPECT_EQ(f, 4.0f);
+    EXPECT_FALSE(o1.has_value());
+    ASSERT_TRUE(o2.has_value());
+    EXPECT_EQ(*o2, NpcId(3));
+    EXPECT_EQ(vec, std::vector<ElementIndex>({ 10, 20, 30 }));
+    EXPECT_TRUE(b);
+}
+
+TEST(InputRecordingTests, Payload_ThrowsOnTruncatedPayload)
+{
+    RecordedInput input(7, RecordedInputType::DestroyAt);
+    input.WriteArguments(
+        std::string("abcdef"),
+        vec2f(1.5f, -2.5f));
+
+    // Truncated scalar
+    RecordedInput truncatedInput1(input.Step, input.Type, std::vector<std::uint8_t>(input.Payload.begin(), input.Payload.end() - 1));
+    EXPECT_THROW(
+        (truncatedInput1.ReadArguments<std::string, vec2f>()),
+        GameException);
+
+    // Truncated string
+    RecordedInput truncatedInput2(input.Step, input.Type, std::vector<std::uint8_t>(input.Payload.begin(), input.Payload.begin() + sizeof(std::uint32_t) + 3));
+    EXPECT_THROW(
+        (truncatedInput2.ReadArguments<std::string, vec2f>()),
+        GameException);
+
+    // Trailing bytes
+    EXPECT_THROW(
+        (input.ReadArguments<std::string>()),
+        GameException);
+}
+
+TEST(InputRecordingTests, Recording_SaveAndLoad)
+{
+    SimulationParameters simulationParameters;
+    simulationParameters.FloodRadius = 3.25f;
+    simulationParameters.StormRate = std::chrono::minutes(11);
+
+    InputRecording initialRecording(
+        42,
+        3,
+        ShipLoadSpecifications("foo/bar.shp"),
+        simulationParameters,
+        OceanFloorHeightMap());
+
+    MemoryBinaryWriteStream writeStream;
+
+    {
+        InputRecorder recorder(std::move(initialRecording));
+
+        VisibleWorld visibleWorld{};
+        visibleWorld.Center = vec2f(1.0f, 2.0f);
+
+        recorder.Record(RecordedInputType::TogglePinAt, vec2f(5.0f, 6.0f));
+        recorder.OnSimulationStep(visibleWorld);
+        recorder.OnSimulationStep(visibleWorld); // Not recorded again
+        recorder.Record(RecordedInputType::TriggerStorm);
+        recorder.OnSimulationStep(visibleWorld);
+
+        auto recording = recorder.StopRecording();
+        recording.FinalStateDigests = { 1, 0xfedcba9876543210ull, 3 };
+        recording.SaveToStream(writeStream);
+    }
+
+    auto readStream = writeStream.MakeReadStreamCopy();
+    InputRecording const loaded = InputRecording::LoadFromStream(readStream);
+
+    EXPECT_EQ(loaded.Seed, 42u);
+    EXPECT_EQ(loaded.SimulationParallelism, 3u);
+    EXPECT_EQ(loaded.ShipLoadSpecs.DefinitionFilepath, std::filesystem::path("foo/bar.shp"));
+    EXPECT_EQ(loaded.InitialSimulationParameters.FloodRadius, 3.25f);
+    EXPECT_EQ(loaded.InitialSimulationParameters.StormRate, std::chrono::minutes(11));
+    EXPECT_EQ(loaded.StepCount, 3u);
+    EXPECT_EQ(loaded.FinalStateDigests, std::vector<std::uint64_t>({ 1, 0xfedcba9876543210ull, 3 }));
+
+    ASSERT_EQ(loaded.Inputs.size(), 3u);
+
+    EXPECT_EQ(loaded.Inputs[0].Step, 0u);
+    EXPECT_EQ(loaded.Inputs[0].Type, RecordedInputType::TogglePinAt);
+    EXPECT_EQ(std::get<0>(loaded.Inputs[0].ReadArguments<vec2f>()), vec2f(5.0f, 6.0f));
+
+    EXPECT_EQ(loaded.Inputs[1].Step, 0u);
+    EXPECT_EQ(loaded.Inputs[1].Type, RecordedInputType::VisibleWorld);
+    EXPECT_EQ(std::get<0>(loaded.Inputs[1].ReadArguments<VisibleWorld>()).Center, vec2f(1.0f, 2.0f));
+
+    EXPECT_EQ(loaded.Inputs[2].Step, 2u);
+    EXPECT_EQ(loaded.Inputs[2].Type, RecordedInputType::TriggerStorm);
+    EXPECT_TRUE(loaded.Inputs[2].Payload.empty());
+}
+
+TEST(InputRecordingTests, Recording_Load_ThrowsOnBadMagic)
+{
+    MemoryBinaryReadStream readStream(std::vector<std::uint8_t>({ 0x01, 0x02, 0x03, 0x04, 0x00, 0x01 }));
+
+    EXPECT_THROW(
+        InputRecording::LoadFromStream(readStream),
+        GameException);
+}
+
+TEST(InputRecordingTests, Recording_Load_ThrowsOnBadInputCount)
+{
+    MemoryBinaryWriteStream writeStream;
+    InputRecording(1, 1, ShipLoadSpecifications("foo/bar.shp"), SimulationParameters(), OceanFloorHeightMap())
+        .SaveToStream(writeStream);
+
+    // Without inputs, the input count is at the very end
+    std::vector<std::uint8_t> data(writeStream.GetData(), writeStream.GetData() + writeStream.GetSize());
+    ASSERT_GE(data.size(), sizeof(std::uint64_t));
+    std::fill(data.end() - sizeof(std::uint64_t), data.end(), std::uint8_t(0x7f));
+
+    MemoryBinaryReadStream readStream(std::move(data));
+    EXPECT_THROW(
+        InputRecording::LoadFromStream(readStream),
+        GameException);
+}
+
+TEST(InputRecordingTests, Recording_SimulationParametersChanges)
+{
+    SimulationParameters simulationParameters;
+
+    InputRecorder recorder(
+        InputRecording(
+            1,
+            1,
+            ShipLoadSpecifications("foo/bar.shp"),
+            simulationParameters,
+            OceanFloorHeightMap()));
+
+    VisibleWorld const visibleWorld{};
+
+    // Step 0: no changes
+    recorder.OnSimulationParameters(simulationParameters);
+    recorder.OnSimulationStep(visibleWorld);
+
+    // Step 1: two changes
+    simulationParameters.SeaDepth = 123.0f;
+    simulationParameters.NumberOfClouds = 7;
+    recorder.OnSimulationParameters(simulationParameters);
+    recorder.OnSimulationStep(visibleWorld);
+
+    // Step 2: one change, and back
+    simulationParameters.SeaDepth = 456.0f;
+    recorder.OnSimulationParameters(simulationParameters);
+    recorder.OnSimulationStep(visibleWorld);
+
+    auto recording = recorder.StopRecording();
+
+    // Only changed parameters are recorded
+    ASSERT_EQ(recording.Inputs.size(), 3u);
+    EXPECT_EQ(recording.Inputs[1].Type, RecordedInputType::SimulationParametersChange);
+    EXPECT_EQ(recording.Inputs[1].Step, 1u);
+    EXPECT_EQ(
+        std::get<0>(recording.Inputs[1].ReadArguments<RecordedSimulationParameters>()),
+        RecordedSimulationParameters({ { "SeaDepth", 123.0f }, { "NumberOfClouds", std::int64_t(7) } }));
+    EXPECT_EQ(recording.Inputs[2].Type, RecordedInputType::SimulationParametersChange);
+    EXPECT_EQ(recording.Inputs[2].Step, 2u);
+    EXPECT_EQ(
+        std::get<0>(recording.Inputs[2].ReadArguments<RecordedSimulationParameters>()),
+        RecordedSimulationParameters({ { "SeaDepth", 456.0f } }));
+
+    // Replay
+    TestInputReplayTarget target;
+    InputReplayer replayer(std::move(recording));
+
+    replayer.OnSimulationStep(target);
+    EXPECT_EQ(replayer.GetSimulationParameters().SeaDepth, SimulationParameters().SeaDepth);
+
+    replayer.OnSimulationStep(target);
+    EXPECT_EQ(replayer.GetSimulationParameters().SeaDepth, 123.0f);
+    EXPECT_EQ(replayer.GetSimulationParameters().NumberOfClouds, 7u);
+
+    replayer.OnSimulationStep(target);
+    EXPECT_EQ(replayer.GetSimulationParameters().SeaDepth, 456.0f);
+    EXPECT_EQ(replayer.GetSimulationParameters().NumberOfClouds, 7u);
+
+    EXPECT_TRUE(replayer.IsCompleted());
+}
+
+TEST(InputRecordingTests, SimulationParameters_ApplyByName)
+{
+    SimulationParameters parameters;
+    float const defaultSeaDepth = parameters.SeaDepth;
+
+    SimulationParametersRecording::Apply(
+        RecordedSimulationParameters({
+            { "NotAParameterOfThisBuild", 1.0f },
+            { "FloodRadius", 2.5f },
+            { "DoRainWithStorm", false },
+            { "StormRate", std::int64_t(13) },
+            { "MaxNpcs", std::int64_t(2000) },
+            { "SpringRelaxationParallelComputationMode", std::int64_t(static_cast<std::int64_t>(SpringRelaxationParallelComputationModeType::StepByStep)) } }),
+        parameters);
+
+    EXPECT_EQ(parameters.SeaDepth, defaultSeaDepth);
+    EXPECT_EQ(parameters.FloodRadius, 2.5f);
+    EXPECT_FALSE(parameters.DoRainWithStorm);
+    EXPECT_EQ(parameters.StormRate, std::chrono::minutes(13));
+    EXPECT_EQ(parameters.MaxNpcs, 2000u);
+    EXPECT_EQ(parameters.SpringRelaxationParallelComputationMode, SpringRelaxationParallelComputationModeType::StepByStep);
+
+    // Round-trip
+    SimulationParameters roundTripParameters;
+    SimulationParametersRecording::Apply(SimulationParametersRecording::Capture(parameters), roundTripParameters);
+    EXPECT_TRUE(SimulationParametersRecording::CaptureChanges(parameters, roundTripParameters).empty());
+}
+
+TEST(InputRecordingTests, SimulationParameters_ApplyThrowsOnUnexpectedType)
+{
+    SimulationParameters parameters;
+
+    EXPECT_THROW(
+        SimulationParametersRecording::Apply(RecordedSimulationParameters({ { "SeaDepth", true } }), parameters),
+        GameException);
+}
+
+TEST(InputRecordingTests, Recording_ShipLoads)
+{
+    MemoryBinaryWriteStream writeStream;
+
+    {
+        InputRecorder recorder(
+            InputRecording(
+                1,
+                1,
+                ShipLoadSpecifications("foo/bar.shp"),
+                SimulationParameters(),
+                OceanFloorHeightMap()));
+
+        VisibleWorld const visibleWorld{};
+
+        recorder.OnSimulationStep(visibleWorld);
+        recorder.OnShipLoaded(ShipLoadSpecifications("foo/second.shp"), false);
+        recorder.OnSimulationStep(visibleWorld);
+        recorder.OnShipLoaded(ShipLoadSpecifications("foo/third.shp"), true);
+
+        recorder.StopRecording().SaveToStream(writeStream);
+    }
+
+    auto readStream = writeStream.MakeReadStreamCopy();
+    InputRecording loaded = InputRecording::LoadFromStream(readStream);
+
+    TestInputReplayTarget target;
+    InputReplayer replayer(std::move(loaded));
+
+    replayer.OnSimulationStep(target);
+    EXPECT_TRUE(target.LoadedShips.empty());
+
+    replayer.OnSimulationStep(target);
+    ASSERT_EQ(target.LoadedShips.size(), 1u);
+    EXPECT_EQ(target.LoadedShips[0].first, std::filesystem::path("foo/second.shp"));
+    EXPECT_FALSE(target.LoadedShips[0].second);
+
+    // Loaded after the last step; no final state to verify
+    ASSERT_TRUE(replayer.IsCompleted());
+    EXPECT_FALSE(replayer.OnCompleted(target).has_value());
+    ASSERT_EQ(target.LoadedShips.size(), 2u);
+    EXPECT_EQ(target.LoadedShips[1].first, std::filesystem::path("foo/third.shp"));
+    EXPECT_TRUE(target.LoadedShips[1].second);
+}
+
+TEST(InputRecordingTests, WallClock_DeterministicMode)
+{
+    auto & wallClock = GameWallClock::GetInstance();
+
+    wallClock.SetPaused(true);
+    float const floatTimeBefore = wallClock.NowAsFloat();
+
+    wallClock.EnterDeterministicMode();
+    EXPECT_TRUE(wallClock.IsDeterministic());
+
+    auto const start = wallClock.Now();
+    EXPECT_EQ(wallClock.NowAsFloat(), 0.0f);
+
+    wallClock.AdvanceDeterministicTime(std::chrono::milliseconds(500));
+
+    EXPECT_EQ(wallClock.Now() - start, std::chrono::milliseconds(500));
+    EXPECT_EQ(wallClock.NowAsFloat(), 0.5f);
+
+    wallClock.ExitDeterministicMode();
+    EXPECT_FALSE(wallClock.IsDeterministic());
+
+    // Float time continues from before the deterministic session
+    EXPECT_FLOAT_EQ(wallClock.NowAsFloat(), floatTimeBefore + 0.5f);
+
+    wallClock.SetPaused(false);
+}
@@ -0,0 +1,112 @@
+#include <Simulation/Physics/Physics.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/SimulationParameters.h>
+
+#include "gtest/gtest.h"
+
+#include <utility>
+
+namespace {
+
+size_t constexpr SamplesCount = SimulationParameters::OceanFloorTerrainSamples<size_t>;
+float constexpr Dx = SimulationParameters::MaxWorldWidth / static_cast<float>(SamplesCount - 1);
+
+void ExpectSameSamples(
+    Physics::OceanFloor const & actual,
+    Physics::OceanFloor const & expected)
+{
+    for (size_t i = 0; i < SamplesCount - 1; ++i)
+    {
+        // In-between samples, so we also check deltas
+        float const x = -SimulationParameters::HalfMaxWorldWidth + (static_cast<float>(i) + 0.25f) * Dx;
+
+        EXPECT_FLOAT_EQ(actual.GetSiltHeightAt(x), expected.GetSiltHeightAt(x));
+
+        auto const actualBedrockNormal = actual.GetBedrockNormalAt(static_cast<register_int>(i));
+        auto const expectedBedrockNormal = expected.GetBedrockNormalAt(static_cast<register_int>(i));
+        EXPECT_FLOAT_EQ(actualBedrockNormal.x, expectedBedrockNormal.x);
+        EXPECT_FLOAT_EQ(actualBedrockNormal.y, expectedBedrockNormal.y);
+    }
+}
+
+}
+
+TEST(OceanFloorTests, Edits_AreVisibleWithoutUpdate)
+{
+    SimulationParameters simulationParameters;
+
+    Physics::OceanFloor oceanFloor{ OceanFloorHeightMap() };
+    oceanFloor.Update(simulationParameters);
+    oceanFloor.UpdateEnd();
+
+    EXPECT_FALSE(oceanFloor.IsDirty());
+
+    // E.g. while the game is paused
+
+    float const heightBefore = oceanFloor.GetSiltHeightAt(0.0f);
+
+    oceanFloor.DisplaceAt(0.0f, 5.0f);
+
+    EXPECT_TRUE(oceanFloor.IsDirty());
+    EXPECT_GT(oceanFloor.GetSiltHeightAt(0.0f), heightBefore);
+
+    float const adjustedHeightBefore = oceanFloor.GetSiltHeightAt(100.0f);
+
+    oceanFloor.UpdateEnd();
+    auto const isAdjusted = oceanFloor.AdjustTo(90.0f, adjustedHeightBefore + 50.0f, 110.0f, adjustedHeightBefore + 50.0f);
+
+    ASSERT_TRUE(isAdjusted.has_value());
+    EXPECT_TRUE(*isAdjusted);
+    EXPECT_TRUE(oceanFloor.IsDirty());
+    EXPECT_GT(oceanFloor.GetSiltHeightAt(100.0f), adjustedHeightBefore);
+
+    oceanFloor.UpdateEnd();
+    oceanFloor.Update(simulationParameters);
+
+    EXPECT_FALSE(oceanFloor.IsDirty());
+}
+
+TEST(OceanFloorTests, Edits_MatchFullRecalculation)
+{
+    SimulationParameters simulationParameters;
+
+    Physics::OceanFloor oceanFloor{ OceanFloorHeightMap() };
+    oceanFloor.Update(simulationParameters);
+
+    // Multiple, overlapping and disjoint edits
+    oceanFloor.AdjustTo(-100.0f, -900.0f, -50.0f, -850.0f);
+    oceanFloor.AdjustTo(-60.0f, -870.0f, -20.0f, -950.0f);
+    oceanFloor.DisplaceAt(-20.0f, 10.0f);
+    oceanFloor.DisplaceAt(300.0f, -7.0f);
+    oceanFloor.DisplaceAt(300.5f, -2.0f);
+    oceanFloor.DisplaceAt(SimulationParameters::HalfMaxWorldWidth, 3.0f);
+    oceanFloor.DisplaceAt(-SimulationParameters::HalfMaxWorldWidth, 4.0f);
+    oceanFloor.Update(simulationParameters);
+
+    // Same terrain, calculated from scratch
+    Physics::OceanFloor expectedOceanFloor{ OceanFloorHeightMap() };
+    expectedOceanFloor.Update(simulationParameters);
+    expectedOceanFloor.SetHeightMap(oceanFloor.GetHeightMap());
+
+    ExpectSameSamples(oceanFloor, expectedOceanFloor);
+}
+
+TEST(OceanFloorTests, GetMaxSiltHeightBetween_BoundsSiltHeights)
+{
+    SimulationParameters simulationParameters;
+
+    Physics::OceanFloor oceanFloor{ OceanFloorHeightMap() };
+    oceanFloor.Update(simulationParameters);
+    oceanFloor.DisplaceAt(12.0f, 40.0f);
+    oceanFloor.Update(simulationParameters);
+
+    for (auto const & [leftX, rightX] : { std::make_pair(-30.0f, 50.0f), std::make_pair(11.0f, 11.5f), std::make_pair(SimulationParameters::HalfMaxWorldWidth - 20.0f, SimulationParameters::HalfMaxWorldWidth) })
+    {
+        float const maxSiltHeight = oceanFloor.GetMaxSiltHeightBetween(leftX, rightX);
+
+        for (float x = leftX; x <= rightX; x += 0.1f)
+        {
+            EXPECT_LE(oceanFloor.GetSiltHeightAt(x), maxSiltHeight);
+        }
+    }
+}
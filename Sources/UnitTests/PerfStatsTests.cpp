@@ -0,0 +1,102 @@
+#include <Core/PerfStats.h>
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+using namespace std::chrono_literals;
+
+TEST(PerfStatsTests, Histogram_BucketIndexIsMonotonic)
+{
+    size_t previousBucketIndex = 0;
+    for (std::int64_t ns = 1; ns < (std::int64_t(1) << 40); ns = ns * 9 / 8 + 1)
+    {
+        size_t const bucketIndex = PerfStats::Histogram::ToBucketIndex(ns);
+        EXPECT_GE(bucketIndex, previousBucketIndex);
+        EXPECT_LT(bucketIndex, PerfStats::Histogram::BucketCount);
+        previousBucketIndex = bucketIndex;
+    }
+
+    EXPECT_EQ(PerfStats::Histogram::ToBucketIndex(0), 0u);
+    EXPECT_EQ(PerfStats::Histogram::ToBucketIndex(std::int64_t(1) << 50), PerfStats::Histogram::BucketCount - 1);
+}
+
+TEST(PerfStatsTests, Histogram_BucketUpperBoundIsWithinRelativeError)
+{
+    for (std::int64_t ns : { std::int64_t(1500), std::int64_t(33333), std::int64_t(1000000), std::int64_t(16666666), std::int64_t(250000000) })
+    {
+        size_t const bucketIndex = PerfStats::Histogram::ToBucketIndex(ns);
+        auto const upperBoundNs = std::chrono::duration_cast<std::chrono::nanoseconds>(PerfStats::Histogram::GetBucketUpperBound(bucketIndex)).count();
+
+        EXPECT_GE(upperBoundNs, ns);
+        EXPECT_LE(
+            static_cast<double>(upperBoundNs),
+            static_cast<double>(ns) * (1.0 + 1.0 / static_cast<double>(PerfStats::Histogram::SubBucketCount)) + 1.0);
+    }
+}
+
+TEST(PerfStatsTests, Histogram_Percentiles)
+{
+    PerfStats::Histogram histogram;
+
+    EXPECT_EQ(histogram.GetPercentile(0.5f), GameChronometer::duration::zero());
+
+    // 98 x 1ms, 1 x 10ms, 1 x 100ms
+    for (int i = 0; i < 98; ++i)
+    {
+        histogram.Update(1ms);
+    }
+
+    histogram.Update(10ms);
+    histogram.Update(100ms);
+
+    EXPECT_EQ(histogram.GetCount(), 100u);
+
+    auto const toMs = [](GameChronometer::duration d)
+    {
+        return std::chrono::duration<float, std::milli>(d).count();
+    };
+
+    EXPECT_NEAR(toMs(histogram.GetPercentile(0.5f)), 1.0f, 0.125f);
+    EXPECT_NEAR(toMs(histogram.GetPercentile(0.95f)), 1.0f, 0.125f);
+    EXPECT_NEAR(toMs(histogram.GetPercentile(0.99f)), 10.0f, 1.25f);
+    EXPECT_NEAR(toMs(histogram.GetMax()), 100.0f, 12.5f);
+}
+
+TEST(PerfStatsTests, Ratio_WindowBySubtraction)
+{
+    PerfStats stats;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        stats.Update<PerfMeasurement::TotalUpdate>(50ms);
+    }
+
+    PerfStats const windowStart = stats;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        stats.Update<PerfMeasurement::TotalUpdate>(2ms);
+    }
+
+    PerfStats const window = stats - windowStart;
+
+    auto const & measurement = window.GetMeasurement<PerfMeasurement::TotalUpdate>();
+    EXPECT_EQ(measurement.GetHistogram().GetCount(), 10u);
+    EXPECT_NEAR(measurement.ToRatio<std::chrono::milliseconds>(), 2.0f, 0.01f);
+    EXPECT_NEAR(measurement.ToMax<std::chrono::milliseconds>(), 2.0f, 0.25f);
+    EXPECT_NEAR(measurement.ToPercentile<std::chrono::milliseconds>(0.99f), 2.0f, 0.25f);
+
+    // Not in window
+    EXPECT_NEAR(stats.GetMeasurement<PerfMeasurement::TotalUpdate>().ToMax<std::chrono::milliseconds>(), 50.0f, 6.25f);
+}
+
+TEST(PerfStatsTests, Subtraction_IncludesLastMeasurement)
+{
+    PerfStats stats;
+    stats.Update<PerfMeasurement::_Last>(3ms);
+
+    PerfStats const window = stats - PerfStats();
+
+    EXPECT_EQ(window.GetMeasurement<PerfMeasurement::_Last>().GetHistogram().GetCount(), 1u);
+}
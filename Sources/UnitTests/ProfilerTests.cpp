@@ -0,0 +1,183 @@
+#include <Core/Profiler.h>
+
+#include <picojson.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    std::vector<picojson::object> GetTraceEvents(
+        picojson::value const & trace,
+        std::string const & name)
+    {
+        std::vector<picojson::object> events;
+
+        for (auto const & event : trace.get<picojson::object>().at("traceEvents").get<picojson::array>())
+        {
+            auto const & eventObject = event.get<picojson::object>();
+            if (eventObject.at("name").get<std::string>() == name)
+            {
+                events.push_back(eventObject);
+            }
+        }
+
+        return events;
+    }
+
+    std::vector<std::string> GetThreadNames(picojson::value const & trace)
+    {
+        std::vector<std::string> threadNames;
+
+        for (auto const & event : GetTraceEvents(trace, "thread_name"))
+        {
+            threadNames.push_back(event.at("args").get<picojson::object>().at("name").get<std::string>());
+        }
+
+        return threadNames;
+    }
+
+}
+
+TEST(ProfilerTests, DisabledZonesAreNotRecorded)
+{
+    Profiler::GetInstance().Disable();
+    Profiler::GetInstance().Clear();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::Disabled");
+    }
+
+    auto const trace = Profiler::GetInstance().ExportChromeTrace();
+
+    EXPECT_TRUE(GetTraceEvents(trace, "ProfilerTests::Disabled").empty());
+}
+
+TEST(ProfilerTests, NestedZones)
+{
+    Profiler::GetInstance().Clear();
+    Profiler::GetInstance().Enable();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::Outer");
+
+        {
+            FS_PROFILE_ZONE("ProfilerTests::Inner");
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    Profiler::GetInstance().Disable();
+
+    auto const trace = Profiler::GetInstance().ExportChromeTrace();
+
+    auto const outerEvents = GetTraceEvents(trace, "ProfilerTests::Outer");
+    ASSERT_EQ(outerEvents.size(), 1u);
+    auto const innerEvents = GetTraceEvents(trace, "ProfilerTests::Inner");
+    ASSERT_EQ(innerEvents.size(), 1u);
+
+    auto const & outer = outerEvents[0];
+    auto const & inner = innerEvents[0];
+
+    EXPECT_EQ(outer.at("ph").get<std::string>(), "X");
+    EXPECT_EQ(outer.at("tid").get<std::int64_t>(), inner.at("tid").get<std::int64_t>());
+    EXPECT_EQ(outer.at("args").get<picojson::object>().at("depth").get<std::int64_t>(), 0);
+    EXPECT_EQ(inner.at("args").get<picojson::object>().at("depth").get<std::int64_t>(), 1);
+
+    // Inner is within outer
+    double const outerStart = outer.at("ts").get<double>();
+    double const outerEnd = outerStart + outer.at("dur").get<double>();
+    double const innerStart = inner.at("ts").get<double>();
+    double const innerEnd = innerStart + inner.at("dur").get<double>();
+    EXPECT_GE(innerStart, outerStart);
+    EXPECT_LE(innerEnd, outerEnd);
+    EXPECT_GE(inner.at("dur").get<double>(), 1000.0);
+}
+
+TEST(ProfilerTests, ZoneOpenedWhileDisabledStaysBalanced)
+{
+    Profiler::GetInstance().Clear();
+    Profiler::GetInstance().Disable();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::OpenedWhileDisabled");
+
+        Profiler::GetInstance().Enable();
+
+        {
+            FS_PROFILE_ZONE("ProfilerTests::OpenedWhileEnabled");
+        }
+    }
+
+    Profiler::GetInstance().Disable();
+
+    auto const trace = Profiler::GetInstance().ExportChromeTrace();
+
+    EXPECT_TRUE(GetTraceEvents(trace, "ProfilerTests::OpenedWhileDisabled").empty());
+
+    auto const events = GetTraceEvents(trace, "ProfilerTests::OpenedWhileEnabled");
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].at("args").get<picojson::object>().at("depth").get<std::int64_t>(), 0);
+}
+
+TEST(ProfilerTests, RingBufferKeepsMostRecentZones)
+{
+    Profiler::GetInstance().Clear();
+    Profiler::GetInstance().Enable();
+
+    for (size_t i = 0; i < Profiler::ThreadRingBufferSize + 10; ++i)
+    {
+        FS_PROFILE_ZONE("ProfilerTests::Ring");
+    }
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::RingLast");
+    }
+
+    Profiler::GetInstance().Disable();
+
+    auto const trace = Profiler::GetInstance().ExportChromeTrace();
+
+    EXPECT_EQ(GetTraceEvents(trace, "ProfilerTests::Ring").size(), Profiler::ThreadRingBufferSize - 1);
+    EXPECT_EQ(GetTraceEvents(trace, "ProfilerTests::RingLast").size(), 1u);
+}
+
+TEST(ProfilerTests, ThreadsRecordIntoOwnBuffers)
+{
+    Profiler::GetInstance().Clear();
+    Profiler::GetInstance().Enable();
+
+    std::thread thread(
+        []()
+        {
+            Profiler::GetInstance().SetThisThreadName("ProfilerTests Thread");
+
+            FS_PROFILE_ZONE("ProfilerTests::OtherThread");
+        });
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::ThisThread");
+    }
+
+    thread.join();
+
+    Profiler::GetInstance().Disable();
+
+    auto const trace = Profiler::GetInstance().ExportChromeTrace();
+
+    auto const otherThreadEvents = GetTraceEvents(trace, "ProfilerTests::OtherThread");
+    ASSERT_EQ(otherThreadEvents.size(), 1u);
+    auto const thisThreadEvents = GetTraceEvents(trace, "ProfilerTests::ThisThread");
+    ASSERT_EQ(thisThreadEvents.size(), 1u);
+
+    EXPECT_NE(otherThreadEvents[0].at("tid").get<std::int64_t>(), thisThreadEvents[0].at("tid").get<std::int64_t>());
+
+    auto const threadNames = GetThreadNames(trace);
+    EXPECT_NE(std::find(threadNames.begin(), threadNames.end(), "ProfilerTests Thread"), threadNames.end());
+}
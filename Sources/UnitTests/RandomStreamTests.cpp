@@ -0,0 +1,176 @@
+#include <Core/RandomStream.h>
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(RandomStreamTests, SameSeedAndStream_SameSequence)
+{
+    RandomStream s1(42, 7);
+    RandomStream s2(42, 7);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(s1.NextUInt32(), s2.NextUInt32());
+    }
+}
+
+TEST(RandomStreamTests, DifferentStreams_DifferentSequences)
+{
+    RandomStream s1(42, 7);
+    RandomStream s2(42, 8);
+
+    int equalCount = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (s1.NextUInt32() == s2.NextUInt32())
+            ++equalCount;
+    }
+
+    EXPECT_LT(equalCount, 5);
+}
+
+TEST(RandomStreamTests, Fork_IsDeterministic)
+{
+    RandomStream p1(42, 0);
+    RandomStream p2(42, 0);
+
+    RandomStream c1 = p1.Fork();
+    RandomStream c2 = p2.Fork();
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(c1.NextUInt32(), c2.NextUInt32());
+    }
+
+    // Parents have advanced identically
+    EXPECT_EQ(p1.NextUInt32(), p2.NextUInt32());
+}
+
+TEST(RandomStreamTests, NormalizedUniformReal_Range)
+{
+    RandomStream s(1, 1);
+
+    float sum = 0.0f;
+    for (int i = 0; i < 10000; ++i)
+    {
+        float const v = s.GenerateNormalizedUniformReal();
+        EXPECT_GE(v, 0.0f);
+        EXPECT_LT(v, 1.0f);
+        sum += v;
+    }
+
+    EXPECT_NEAR(0.5f, sum / 10000.0f, 0.02f);
+}
+
+TEST(RandomStreamTests, UniformInteger_Range)
+{
+    RandomStream s(1, 1);
+
+    std::vector<int> counts(6, 0);
+    for (int i = 0; i < 6000; ++i)
+    {
+        int const v = s.GenerateUniformInteger<int>(-2, 3);
+        ASSERT_GE(v, -2);
+        ASSERT_LE(v, 3);
+        ++counts[v + 2];
+    }
+
+    for (int c : counts)
+    {
+        EXPECT_GT(c, 800);
+        EXPECT_LT(c, 1200);
+    }
+}
+
+TEST(RandomStreamTests, UniformInteger_SingleValue)
+{
+    RandomStream s(1, 1);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(5u, s.GenerateUniformInteger<unsigned int>(5, 5));
+    }
+}
+
+TEST(RandomStreamTests, StandardNormalReal_Moments)
+{
+    RandomStream s(1, 1);
+
+    size_t constexpr N = 20000;
+    float sum = 0.0f;
+    float sumSquares = 0.0f;
+    for (size_t i = 0; i < N; ++i)
+    {
+        float const v = s.GenerateStandardNormalReal();
+        sum += v;
+        sumSquares += v * v;
+    }
+
+    float const mean = sum / static_cast<float>(N);
+    float const variance = sumSquares / static_cast<float>(N) - mean * mean;
+
+    EXPECT_NEAR(0.0f, mean, 0.05f);
+    EXPECT_NEAR(1.0f, variance, 0.05f);
+}
+
+class RandomStreamTests_Fill : public testing::TestWithParam<std::tuple<size_t, size_t>>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    RandomStreamTests_Fill,
+    RandomStreamTests_Fill,
+    ::testing::Values(
+        std::make_tuple(0, 0),
+        std::make_tuple(0, 1),
+        std::make_tuple(0, 4),
+        std::make_tuple(0, 37),
+        std::make_tuple(1, 37),
+        std::make_tuple(3, 8),
+        std::make_tuple(5, 101)
+    ));
+
+TEST_P(RandomStreamTests_Fill, FillNormalizedUniformReal_MatchesOneAtATime)
+{
+    size_t const preDraws = std::get<0>(GetParam());
+    size_t const count = std::get<1>(GetParam());
+
+    RandomStream s1(42, 3);
+    RandomStream s2(42, 3);
+
+    for (size_t i = 0; i < preDraws; ++i)
+    {
+        s1.NextUInt32();
+        s2.NextUInt32();
+    }
+
+    std::vector<float> batch(count + 1, -1.0f);
+    s1.FillNormalizedUniformReal(batch.data(), count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(s2.GenerateNormalizedUniformReal(), batch[i]);
+    }
+
+    // Did not overrun
+    EXPECT_EQ(-1.0f, batch[count]);
+
+    // Streams are still in sync
+    EXPECT_EQ(s1.NextUInt32(), s2.NextUInt32());
+}
+
+TEST(RandomStreamTests, FillUniformReal_Range)
+{
+    RandomStream s(1, 1);
+
+    std::vector<float> values(1001);
+    s.FillUniformReal(values.data(), values.size(), -3.0f, 5.0f);
+
+    for (float v : values)
+    {
+        EXPECT_GE(v, -3.0f);
+        EXPECT_LT(v, 5.0f);
+    }
+}
@@ -0,0 +1,134 @@
+#include <Core/ShardBalancer.h>
+
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    // Simulates shards whose time is proportional to their weight over their speed
+    std::vector<GameChronometer::duration> MakeShardDurations(
+        ShardBalancer const & balancer,
+        std::vector<float> const & shardSpeeds)
+    {
+        std::vector<GameChronometer::duration> durations;
+        for (size_t s = 0; s < shardSpeeds.size(); ++s)
+        {
+            durations.push_back(
+                std::chrono::duration_cast<GameChronometer::duration>(
+                    std::chrono::duration<float, std::milli>(balancer.GetWeights()[s] / shardSpeeds[s])));
+        }
+
+        return durations;
+    }
+
+    // Runs one whole period; returns whether the weights have changed
+    bool RunPeriod(
+        ShardBalancer & balancer,
+        std::vector<float> const & shardSpeeds)
+    {
+        bool hasChanged = false;
+        for (size_t i = 0; i < ShardBalancer::PeriodStepCount; ++i)
+        {
+            hasChanged |= balancer.Update(MakeShardDurations(balancer, shardSpeeds));
+        }
+
+        return hasChanged;
+    }
+}
+
+TEST(ShardBalancerTests, DecidesAtEndOfPeriodOnly)
+{
+    ShardBalancer balancer(2);
+
+    for (size_t i = 0; i < ShardBalancer::PeriodStepCount - 1; ++i)
+    {
+        EXPECT_FALSE(balancer.Update({ 1ms, 3ms }));
+    }
+
+    EXPECT_EQ(balancer.GetLastRelativeStragglerGap(), 0.0f);
+
+    EXPECT_TRUE(balancer.Update({ 1ms, 3ms }));
+
+    EXPECT_NEAR(balancer.GetLastRelativeStragglerGap(), 0.5f, 0.001f);
+    float const gapMs = std::chrono::duration<float, std::milli>(balancer.GetLastStragglerGap()).count();
+    EXPECT_NEAR(gapMs, 1.0f, 0.001f);
+    EXPECT_GT(balancer.GetWeights()[0], 1.0f);
+    EXPECT_LT(balancer.GetWeights()[1], 1.0f);
+}
+
+TEST(ShardBalancerTests, ConvergesOnUnevenShards)
+{
+    ShardBalancer balancer(4);
+
+    std::vector<float> const shardSpeeds = { 1.0f, 1.0f, 0.5f, 2.0f };
+
+    RunPeriod(balancer, shardSpeeds);
+    EXPECT_GT(balancer.GetLastRelativeStragglerGap(), ShardBalancer::StartRelativeGap);
+
+    for (int p = 0; p < 20; ++p)
+    {
+        RunPeriod(balancer, shardSpeeds);
+    }
+
+    EXPECT_LT(balancer.GetLastRelativeStragglerGap(), ShardBalancer::StopRelativeGap);
+    EXPECT_FALSE(balancer.IsRebalancing());
+
+    // Weights follow speeds
+    EXPECT_NEAR(balancer.GetWeights()[2] / balancer.GetWeights()[0], 0.5f, 0.05f);
+    EXPECT_NEAR(balancer.GetWeights()[3] / balancer.GetWeights()[0], 2.0f, 0.2f);
+}
+
+TEST(ShardBalancerTests, Hysteresis_DoesNotStartBelowStartThreshold)
+{
+    ShardBalancer balancer(2);
+
+    // 5% gap
+    std::vector<float> const shardSpeeds = { 1.0f, 1.0f / 1.1f };
+
+    for (int p = 0; p < 5; ++p)
+    {
+        EXPECT_FALSE(RunPeriod(balancer, shardSpeeds));
+    }
+
+    EXPECT_FALSE(balancer.IsRebalancing());
+    EXPECT_EQ(balancer.GetWeights()[0], 1.0f);
+    EXPECT_EQ(balancer.GetWeights()[1], 1.0f);
+}
+
+TEST(ShardBalancerTests, Hysteresis_KeepsGoingUntilStopThreshold)
+{
+    ShardBalancer balancer(2);
+
+    // 25% gap: starts
+    EXPECT_TRUE(RunPeriod(balancer, { 1.0f, 1.0f / 1.67f }));
+    EXPECT_TRUE(balancer.IsRebalancing());
+
+    // ~5% gap now: between thresholds, hence keeps going
+    std::vector<float> const shardSpeeds = {
+        1.0f,
+        balancer.GetWeights()[1] / balancer.GetWeights()[0] / 1.1f };
+    EXPECT_TRUE(RunPeriod(balancer, shardSpeeds));
+    EXPECT_TRUE(balancer.IsRebalancing());
+}
+
+TEST(ShardBalancerTests, Reset)
+{
+    ShardBalancer balancer(2);
+    EXPECT_TRUE(balancer.HasNominalWeights());
+
+    RunPeriod(balancer, { 1.0f, 0.5f });
+    ASSERT_NE(balancer.GetWeights()[0], 1.0f);
+    EXPECT_FALSE(balancer.HasNominalWeights());
+
+    balancer.Reset(3);
+
+    EXPECT_EQ(balancer.GetShardCount(), 3u);
+    EXPECT_EQ(balancer.GetWeights(), std::vector<float>({ 1.0f, 1.0f, 1.0f }));
+    EXPECT_TRUE(balancer.HasNominalWeights());
+    EXPECT_FALSE(balancer.IsRebalancing());
+    EXPECT_EQ(balancer.GetLastRelativeStragglerGap(), 0.0f);
+}
@@ -0,0 +1,114 @@
+#include <Game/HeadlessSimulation.h>
+
+#include <Core/GameGeometry.h>
+
+#include "TestingUtils.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+bool IsInsideShip(
+    vec2f const & position,
+    Physics::Ship const & ship)
+{
+    Physics::Points const & points = ship.GetPoints();
+    Physics::Triangles const & triangles = ship.GetTriangles();
+
+    for (auto t : triangles)
+    {
+        if (!triangles.IsDeleted(t))
+        {
+            auto const & vertices = triangles.GetPointIndices(t);
+            if (Geometry::IsPointInTriangle(
+                position,
+                points.GetPosition(vertices[0]),
+                points.GetPosition(vertices[1]),
+                points.GetPosition(vertices[2])))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+vec2f CalculateAverageVelocity(Physics::Ship const & ship)
+{
+    Physics::Points const & points = ship.GetPoints();
+
+    vec2f velocity = vec2f::zero();
+    for (ElementIndex p = 0; p < points.GetRawShipPointCount(); ++p)
+    {
+        velocity += points.GetVelocity(p);
+    }
+
+    return velocity / static_cast<float>(points.GetRawShipPointCount());
+}
+
+}
+
+TEST(ShipCollisionsTests, PointInsideOtherShip_IsPushedOutAndReflected)
+{
+    auto const databases = MakeTestSimulationDatabases();
+
+    TestAssetManager assetManager;
+    ThreadManager threadManager(false, 1, MakeCpuInfos(1), [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {});
+
+    HeadlessSimulation simulation(
+        assetManager,
+        databases,
+        OceanFloorHeightMap(),
+        threadManager,
+        42);
+
+    simulation.GetSimulationParameters().NumberOfFishes = 0;
+
+    // Ship A spans x=[-6, 5]; ship B spans x=[3.7, 14.7], and is half a
+    // meter higher so that no points of A lie on edges of B
+    ShipId const shipAId = simulation.AddShip(
+        MakeTestShipDefinition(ShipSpaceSize(12, 6), databases->MaterialDb),
+        ShipLoadOptions());
+
+    ShipDefinition shipBDefinition = MakeTestShipDefinition(ShipSpaceSize(12, 6), databases->MaterialDb);
+    shipBDefinition.PhysicsData = ShipPhysicsData(vec2f(9.7f, 0.5f), 1.0f);
+    ShipId const shipBId = simulation.AddShip(
+        std::move(shipBDefinition),
+        ShipLoadOptions());
+
+    Physics::Ship const & shipA = simulation.GetWorld().GetShip(shipAId);
+    Physics::Ship const & shipB = simulation.GetWorld().GetShip(shipBId);
+
+    // Find the point of A at (4, 3), 0.3m inside the left side of B
+    std::optional<ElementIndex> pointIndex;
+    for (ElementIndex p = 0; p < shipA.GetPoints().GetRawShipPointCount(); ++p)
+    {
+        if (shipA.GetPoints().GetPosition(p) == vec2f(4.0f, 3.0f))
+        {
+            pointIndex = p;
+        }
+    }
+
+    ASSERT_TRUE(pointIndex.has_value());
+    ASSERT_TRUE(IsInsideShip(shipA.GetPoints().GetPosition(*pointIndex), shipB));
+
+    // Throw A into B
+    simulation.GetWorld().MoveBy(
+        shipAId,
+        vec2f::zero(),
+        vec2f(5.0f, 0.0f),
+        simulation.GetSimulationParameters());
+
+    ASSERT_GT(shipA.GetPoints().GetVelocity(*pointIndex).x, 0.0f);
+
+    simulation.Update();
+
+    // Pushed out
+    EXPECT_FALSE(IsInsideShip(shipA.GetPoints().GetPosition(*pointIndex), shipB));
+    EXPECT_LT(shipA.GetPoints().GetPosition(*pointIndex).x, shipB.GetPoints().GetPosition(0).x); // B's bottom-left corner
+
+    // No longer moving into B
+    vec2f const relativeVelocity = shipA.GetPoints().GetVelocity(*pointIndex) - CalculateAverageVelocity(shipB);
+    EXPECT_LE(relativeVelocity.x, 0.0f);
+}
@@ -0,0 +1,142 @@
+#include <Simulation/StateSnapshot.h>
+
+#include <Core/GameExceptions.h>
+#include <Core/MemoryStreams.h>
+
+#include "gtest/gtest.h"
+
+#include <limits>
+
+namespace {
+
+StateSnapshot MakeSnapshot(
+    std::uint64_t step,
+    std::vector<float> const & positions,
+    std::vector<float> const & water)
+{
+    StateSnapshot snapshot(step);
+
+    auto & shipState = snapshot.AddShip(0);
+    shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Position)] = positions;
+    shipState.Subsystems[static_cast<size_t>(StateSubsystemType::Water)] = water;
+
+    return snapshot;
+}
+
+}
+
+TEST(StateSnapshotTests, Digest_EqualForSameState)
+{
+    auto const snapshot1 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, { 0.5f, 0.25f });
+    auto const snapshot2 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, { 0.5f, 0.25f });
+
+    for (size_t ss = 0; ss < StateSnapshot::SubsystemCount; ++ss)
+    {
+        EXPECT_EQ(
+            snapshot1.CalculateDigest(static_cast<StateSubsystemType>(ss)),
+            snapshot2.CalculateDigest(static_cast<StateSubsystemType>(ss)));
+    }
+}
+
+TEST(StateSnapshotTests, Digest_DiffersOnlyForChangedSubsystem)
+{
+    auto const snapshot1 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, { 0.5f, 0.25f });
+    auto const snapshot2 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, { 0.5f, 0.25000003f });
+
+    EXPECT_EQ(snapshot1.CalculateDigest(StateSubsystemType::Position), snapshot2.CalculateDigest(StateSubsystemType::Position));
+    EXPECT_NE(snapshot1.CalculateDigest(StateSubsystemType::Water), snapshot2.CalculateDigest(StateSubsystemType::Water));
+}
+
+TEST(StateSnapshotTests, FindDivergences_None)
+{
+    auto const snapshot1 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, { 0.5f, 0.25f });
+    auto const snapshot2 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, { 0.5f, 0.25f });
+
+    EXPECT_TRUE(StateSnapshot::FindDivergences(snapshot1, snapshot2, 0.0f).empty());
+}
+
+TEST(StateSnapshotTests, FindDivergences_FirstElementPerSubsystem)
+{
+    auto const snapshot1 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f }, { 0.5f, 0.25f });
+    auto const snapshot2 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.5f, 5.0f, 7.0f }, { 0.5f, 0.75f });
+
+    auto const divergences = StateSnapshot::FindDivergences(snapshot1, snapshot2, 0.0f);
+
+    ASSERT_EQ(divergences.size(), 2u);
+
+    EXPECT_EQ(divergences[0].Subsystem, StateSubsystemType::Position);
+    EXPECT_EQ(divergences[0].Ship, ShipId(0));
+    EXPECT_EQ(divergences[0].Element, ElementIndex(1));
+    EXPECT_EQ(divergences[0].Component, 1u);
+    EXPECT_EQ(divergences[0].Value1, 4.0f);
+    EXPECT_EQ(divergences[0].Value2, 4.5f);
+
+    EXPECT_EQ(divergences[1].Subsystem, StateSubsystemType::Water);
+    EXPECT_EQ(divergences[1].Element, ElementIndex(1));
+    EXPECT_EQ(divergences[1].Component, 0u);
+}
+
+TEST(StateSnapshotTests, FindDivergences_Tolerance)
+{
+    auto const snapshot1 = MakeSnapshot(10, { 1000.0f, 0.001f }, {});
+    auto const snapshot2 = MakeSnapshot(10, { 1000.5f, 0.0015f }, {});
+
+    // Relative to magnitude above one, absolute below
+    EXPECT_TRUE(StateSnapshot::FindDivergences(snapshot1, snapshot2, 0.001f).empty());
+
+    auto const divergences = StateSnapshot::FindDivergences(snapshot1, snapshot2, 0.0001f);
+    ASSERT_EQ(divergences.size(), 1u);
+    EXPECT_EQ(divergences[0].Component, 0u);
+}
+
+TEST(StateSnapshotTests, FindDivergences_NaNs)
+{
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+
+    EXPECT_TRUE(StateSnapshot::FindDivergences(MakeSnapshot(1, { nan, 1.0f }, {}), MakeSnapshot(1, { nan, 1.0f }, {}), 0.1f).empty());
+    EXPECT_EQ(StateSnapshot::FindDivergences(MakeSnapshot(1, { nan, 1.0f }, {}), MakeSnapshot(1, { 0.0f, 1.0f }, {}), 0.1f).size(), 1u);
+}
+
+TEST(StateSnapshotTests, FindDivergences_MissingElements)
+{
+    auto const snapshot1 = MakeSnapshot(10, { 1.0f, 2.0f, 3.0f, 4.0f }, {});
+    auto const snapshot2 = MakeSnapshot(10, { 1.0f, 2.0f }, {});
+
+    auto const divergences = StateSnapshot::FindDivergences(snapshot1, snapshot2, 0.0f);
+
+    ASSERT_EQ(divergences.size(), 1u);
+    EXPECT_EQ(divergences[0].Element, ElementIndex(1));
+    EXPECT_EQ(divergences[0].Value1, 3.0f);
+    EXPECT_FALSE(divergences[0].Value2.has_value());
+}
+
+TEST(StateSnapshotTests, SaveAndLoad)
+{
+    std::vector<StateSnapshot> snapshots;
+    snapshots.emplace_back(MakeSnapshot(0, { 1.0f, 2.0f }, { 0.5f }));
+    snapshots.emplace_back(MakeSnapshot(50, { 1.5f, 2.5f }, { 0.75f }));
+
+    MemoryBinaryWriteStream writeStream;
+    StateSnapshot::SaveToStream(snapshots, writeStream);
+
+    auto readStream = writeStream.MakeReadStreamCopy();
+    auto const loaded = StateSnapshot::LoadFromStream(readStream);
+
+    ASSERT_EQ(loaded.size(), 2u);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(loaded[i].GetStep(), snapshots[i].GetStep());
+        ASSERT_EQ(loaded[i].GetShips().size(), 1u);
+        EXPECT_TRUE(StateSnapshot::FindDivergences(loaded[i], snapshots[i], 0.0f).empty());
+        EXPECT_EQ(loaded[i].CalculateDigest(StateSubsystemType::Position), snapshots[i].CalculateDigest(StateSubsystemType::Position));
+    }
+}
+
+TEST(StateSnapshotTests, Load_ThrowsOnBadMagic)
+{
+    MemoryBinaryReadStream readStream(std::vector<std::uint8_t>({ 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 }));
+
+    EXPECT_THROW(
+        StateSnapshot::LoadFromStream(readStream),
+        GameException);
+}
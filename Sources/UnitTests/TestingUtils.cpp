@@ -1,5 +1,8 @@
 #include "TestingUtils.h"
 
+#include <Render/GameTextureDatabases.h>
+
+#include <Core/TextureAtlas.h>
 #include <Core/Utils.h>
 
 #include <cassert>
@@ -53,9 +56,7 @@ std::vector<IAssetManager::AssetDescriptor> TestAssetManager::EnumerateTextureDa
 
 std::string TestAssetManager::GetMaterialTextureRelativePath(std::string const & materialTextureName) const
 {
-    assert(false); // Not needed by tests, so far
-    (void)materialTextureName;
-    return "";
+    return materialTextureName;
 }
 
 RgbImageData TestAssetManager::LoadMaterialTexture(std::string const & frameRelativePath) const
@@ -123,14 +124,12 @@ picojson::value TestAssetManager::LoadElectricalMaterialDatabase() const
 
 picojson::value TestAssetManager::LoadFishSpeciesDatabase() const
 {
-    assert(false); // Not needed by tests, so far
-    return picojson::value();
+    return Utils::ParseJSONString(FishSpeciesDatabaseJson);
 }
 
 picojson::value TestAssetManager::LoadNpcDatabase() const
 {
-    assert(false); // Not needed by tests, so far
-    return picojson::value();
+    return Utils::ParseJSONString(NpcDatabaseJson);
 }
 
 ////////////////////////////////////
@@ -191,4 +190,98 @@ std::vector<ThreadManager::CpuInfo> MakeCpuInfos(size_t parallelism)
         cpuInfos.emplace_back(p, 1.0f);
 
     return cpuInfos;
+}
+
+std::shared_ptr<HeadlessSimulation::Databases const> MakeTestSimulationDatabases()
+{
+    //
+    // Materials
+    //
+
+    std::vector<StructuralMaterial> structuralMaterials;
+    structuralMaterials.emplace_back(MakeTestStructuralMaterial("TestHull", rgbColor(0x40, 0x40, 0x40)));
+    for (size_t u = 0; u <= static_cast<size_t>(StructuralMaterial::MaterialUniqueType::_Last); ++u)
+    {
+        StructuralMaterial material = MakeTestStructuralMaterial("TestUnique" + std::to_string(u), rgbColor(0x80, 0x80, static_cast<std::uint8_t>(u)));
+        material.UniqueType = static_cast<StructuralMaterial::MaterialUniqueType>(u);
+        structuralMaterials.emplace_back(std::move(material));
+    }
+
+    std::vector<StructuralMaterial const *> structuralMaterialPtrs;
+    for (auto const & material : structuralMaterials)
+        structuralMaterialPtrs.push_back(&material);
+
+    MaterialDatabase materialDatabase = MaterialDatabase::Make(structuralMaterialPtrs, {});
+
+    //
+    // Fish and NPCs
+    //
+
+    TestAssetManager assetManager;
+    assetManager.FishSpeciesDatabaseJson = "[]";
+    assetManager.NpcDatabaseJson = R"({
+        "humans": { "global": { "head_material": "TestHull", "feet_material": "TestHull" }, "sub_kinds": [] },
+        "furniture": { "sub_kinds": [] },
+        "string_table": {}
+    })";
+
+    FishSpeciesDatabase fishSpeciesDatabase = FishSpeciesDatabase::Load(assetManager);
+
+    // NPCs need at least an icon
+    std::vector<TextureAtlasFrameMetadata<GameTextureDatabases::NpcTextureDatabase>> npcFrames;
+    npcFrames.emplace_back(
+        1.0f, 1.0f,
+        vec2f::zero(),
+        vec2f(1.0f, 1.0f),
+        0, 0,
+        TextureFrameMetadata<GameTextureDatabases::NpcTextureDatabase>(
+            ImageSize(1, 1),
+            1.0f, 1.0f,
+            false,
+            ImageCoordinates(0, 0),
+            vec2f::zero(),
+            vec2f::zero(),
+            TextureFrameId<GameTextureDatabases::NpcTextureGroups>(GameTextureDatabases::NpcTextureGroups::Icon, 0),
+            "0", "0"));
+
+    TextureAtlas<GameTextureDatabases::NpcTextureDatabase> const npcTextureAtlas(
+        TextureAtlasMetadata<GameTextureDatabases::NpcTextureDatabase>(
+            ImageSize(1, 1),
+            TextureAtlasOptions::None,
+            std::move(npcFrames)),
+        RgbaImageData(1, 1, rgbaColor::zero()));
+
+    NpcDatabase npcDatabase = NpcDatabase::Load(assetManager, materialDatabase, npcTextureAtlas);
+
+    return std::make_shared<HeadlessSimulation::Databases const>(
+        std::move(materialDatabase),
+        std::move(fishSpeciesDatabase),
+        std::move(npcDatabase),
+        2);
+}
+
+ShipDefinition MakeTestShipDefinition(ShipSpaceSize const & size, MaterialDatabase const & materialDatabase)
+{
+    StructuralMaterial const & hullMaterial = materialDatabase.GetStructuralMaterial("TestHull");
+
+    auto structuralLayer = std::make_unique<StructuralLayerData>(size);
+    for (size_t i = 0; i < size.GetLinearSize(); ++i)
+    {
+        structuralLayer->Buffer.Data[i].Material = &hullMaterial;
+    }
+
+    // Provide textures, so that the ship needs no material textures
+    ImageSize const textureSize(size.width, size.height);
+
+    return ShipDefinition(
+        ShipLayers(
+            size,
+            std::move(structuralLayer),
+            nullptr,
+            nullptr,
+            std::make_unique<TextureLayerData>(RgbaImageData(textureSize, rgbaColor(0x40, 0x40, 0x40, 0xff))),
+            std::make_unique<TextureLayerData>(RgbaImageData(textureSize, rgbaColor(0x40, 0x40, 0x40, 0xff)))),
+        ShipMetadata("Test"),
+        ShipPhysicsData(),
+        std::nullopt);
 }
\ No newline at end of file
@@ -4,11 +4,14 @@
 #include <Core/ThreadManager.h>
 
 #include <Simulation/Materials.h>
+#include <Simulation/ShipDefinition.h>
 
 #include <Game/FileSystem.h>
+#include <Game/HeadlessSimulation.h>
 
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -33,6 +36,8 @@ class TestAssetManager : public IAssetManager
 public:
 
     std::vector<TestTextureDatabase> TestTextureDatabases;
+    std::string FishSpeciesDatabaseJson;
+    std::string NpcDatabaseJson;
 
 public:
 
@@ -327,3 +332,9 @@ StructuralMaterial MakeTestStructuralMaterial(std::string name, rgbColor colorKe
 ElectricalMaterial MakeTestElectricalMaterial(std::string name, rgbColor colorKey, bool isInstanced = false);
 
 std::vector<ThreadManager::CpuInfo> MakeCpuInfos(size_t parallelism);
+
+// Databases made from scratch: a hull material and the unique materials, no fish, and no NPC kinds
+std::shared_ptr<HeadlessSimulation::Databases const> MakeTestSimulationDatabases();
+
+// A solid rectangle of the test hull material
+ShipDefinition MakeTestShipDefinition(ShipSpaceSize const & size, MaterialDatabase const & materialDatabase);
@@ -1,7 +1,9 @@
 #include <Core/ThreadPool.h>
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
+#include <thread>
 #include <vector>
 
 #include "TestingUtils.h"
@@ -99,4 +101,90 @@ TEST_P(ThreadPoolTests_FourRuns, Four_Runs)
     t.Run(tasks);
 
     ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
-}
\ No newline at end of file
+}
+TEST(ThreadPoolTests, Statistics_CountsTasksAndCriticalPath)
+{
+    ThreadManager threadManager{ false, 16, MakeCpuInfos(16), [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {} };
+
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, 3, threadManager);
+
+    // Task 1 is the straggler
+    std::vector<ThreadPool::Task> tasks;
+    tasks.emplace_back([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    tasks.emplace_back([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+    tasks.emplace_back([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    tasks.emplace_back([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }); // Runs on calling thread
+
+    t.Run(tasks);
+    t.Run(tasks);
+
+    PerfStats perfStats;
+    t.PublishStatistics(perfStats);
+
+    EXPECT_EQ(perfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolRun>().GetHistogram().GetCount(), 2u);
+    EXPECT_EQ(perfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolCriticalPath>().GetHistogram().GetCount(), 2u);
+
+    ASSERT_EQ(perfStats.GetSimulationThreadPoolThreadCount(), 3u);
+    EXPECT_EQ(perfStats.GetSimulationThreadPoolThread(0).TaskCount.GetValue(), 4u);
+    EXPECT_EQ(perfStats.GetSimulationThreadPoolThread(1).TaskCount.GetValue(), 2u);
+    EXPECT_EQ(perfStats.GetSimulationThreadPoolThread(2).TaskCount.GetValue(), 2u);
+
+    // Critical path is the straggler's, and the other threads wait for it
+    float const criticalPath = perfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolCriticalPath>().ToRatio<std::chrono::milliseconds>();
+    EXPECT_GE(criticalPath, 20.0f);
+    EXPECT_LE(criticalPath, perfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolRun>().ToRatio<std::chrono::milliseconds>());
+    EXPECT_GT(perfStats.GetMeasurement<PerfMeasurement::SimulationThreadPoolImbalance>().ToRatio<std::chrono::milliseconds>(), 10.0f);
+    EXPECT_GT(perfStats.GetSimulationThreadPoolThread(1).GetUtilization(), perfStats.GetSimulationThreadPoolThread(2).GetUtilization());
+
+    // Publishing forgets
+    PerfStats perfStats2;
+    t.PublishStatistics(perfStats2);
+    EXPECT_EQ(perfStats2.GetMeasurement<PerfMeasurement::SimulationThreadPoolRun>().GetHistogram().GetCount(), 0u);
+    EXPECT_EQ(perfStats2.GetSimulationThreadPoolThreadCount(), 0u);
+}
+
+TEST(ThreadPoolTests, Run_TasksSeeInstancesBoundToCallingThread)
+{
+    ThreadManager threadManager{ false, 16, MakeCpuInfos(16), [](ThreadManager::ThreadTaskKind, std::optional<size_t>, size_t, std::string const &) {} };
+
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, 4, threadManager);
+
+    GameRandomEngine randomEngine(1);
+    GameWallClock wallClock;
+
+    std::vector<GameRandomEngine *> randomEngines(4, nullptr);
+    std::vector<GameWallClock *> wallClocks(4, nullptr);
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        tasks.emplace_back(
+            [&, i]()
+            {
+                randomEngines[i] = &GameRandomEngine::GetInstance();
+                wallClocks[i] = &GameWallClock::GetInstance();
+            });
+    }
+
+    {
+        GameRandomEngine::ThreadScope const randomEngineScope(&randomEngine);
+        GameWallClock::ThreadScope const wallClockScope(&wallClock);
+
+        t.Run(tasks);
+    }
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(randomEngines[i], &randomEngine);
+        EXPECT_EQ(wallClocks[i], &wallClock);
+    }
+
+    // Unbound again
+    t.Run(tasks);
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(randomEngines[i], &GameRandomEngine::GetInstance());
+        EXPECT_EQ(wallClocks[i], &GameWallClock::GetInstance());
+    }
+}
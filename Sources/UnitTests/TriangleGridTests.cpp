@@ -0,0 +1,109 @@
+#include <Core/TriangleGrid.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+std::vector<ElementIndex> GetCandidates(
+    Geometry::TriangleGrid const & grid,
+    vec2f const & point)
+{
+    std::vector<ElementIndex> candidates;
+    grid.VisitCandidates(
+        point,
+        [&candidates](ElementIndex t)
+        {
+            candidates.push_back(t);
+            return false;
+        });
+
+    std::sort(candidates.begin(), candidates.end());
+
+    return candidates;
+}
+
+}
+
+TEST(TriangleGridTests, BinsTrianglesByAABB)
+{
+    Geometry::TriangleGrid grid;
+
+    grid.BeginBuild(Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f), 1.0f, 100);
+    grid.Add(0, Geometry::AABB(0.5f, 1.5f, 1.5f, 0.5f)); // Cells (0,0) - (1,1)
+    grid.Add(1, Geometry::AABB(5.2f, 5.8f, 5.8f, 5.2f)); // Cell (5,5)
+    grid.Add(2, Geometry::AABB(-5.0f, 20.0f, 20.0f, -5.0f)); // All cells
+    grid.Add(3, Geometry::AABB(20.0f, 30.0f, 30.0f, 20.0f)); // Outside
+    grid.EndBuild();
+
+    EXPECT_FALSE(grid.IsEmpty());
+
+    EXPECT_EQ(GetCandidates(grid, vec2f(0.1f, 0.1f)), std::vector<ElementIndex>({ 0, 2 }));
+    EXPECT_EQ(GetCandidates(grid, vec2f(1.9f, 1.9f)), std::vector<ElementIndex>({ 0, 2 }));
+    EXPECT_EQ(GetCandidates(grid, vec2f(2.1f, 1.9f)), std::vector<ElementIndex>({ 2 }));
+    EXPECT_EQ(GetCandidates(grid, vec2f(5.9f, 5.1f)), std::vector<ElementIndex>({ 1, 2 }));
+    EXPECT_EQ(GetCandidates(grid, vec2f(9.9f, 9.9f)), std::vector<ElementIndex>({ 2 }));
+
+    // Outside of region
+    EXPECT_TRUE(GetCandidates(grid, vec2f(25.0f, 25.0f)).empty());
+}
+
+TEST(TriangleGridTests, StopsAtFirstAcceptedCandidate)
+{
+    Geometry::TriangleGrid grid;
+
+    grid.BeginBuild(Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f), 1.0f, 100);
+    grid.Add(4, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+    grid.Add(7, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+    grid.Add(9, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+    grid.EndBuild();
+
+    int visitCount = 0;
+    bool const result = grid.VisitCandidates(
+        vec2f(3.0f, 3.0f),
+        [&visitCount](ElementIndex t)
+        {
+            ++visitCount;
+            return t == 7;
+        });
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(visitCount, 2);
+
+    EXPECT_FALSE(grid.VisitCandidates(
+        vec2f(3.0f, 3.0f),
+        [](ElementIndex)
+        {
+            return false;
+        }));
+}
+
+TEST(TriangleGridTests, CapsCellCount)
+{
+    Geometry::TriangleGrid grid;
+
+    // 1000m region with at most 10 cells per side: cells are 100m
+    grid.BeginBuild(Geometry::AABB(0.0f, 1000.0f, 1000.0f, 0.0f), 1.0f, 10);
+    grid.Add(0, Geometry::AABB(10.0f, 20.0f, 20.0f, 10.0f));
+    grid.EndBuild();
+
+    EXPECT_EQ(GetCandidates(grid, vec2f(99.0f, 99.0f)), std::vector<ElementIndex>({ 0 }));
+    EXPECT_TRUE(GetCandidates(grid, vec2f(101.0f, 99.0f)).empty());
+}
+
+TEST(TriangleGridTests, RebuildDiscardsPreviousContent)
+{
+    Geometry::TriangleGrid grid;
+
+    grid.BeginBuild(Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f), 1.0f, 100);
+    grid.Add(0, Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f));
+    grid.EndBuild();
+
+    grid.BeginBuild(Geometry::AABB(0.0f, 10.0f, 10.0f, 0.0f), 2.0f, 100);
+    grid.EndBuild();
+
+    EXPECT_TRUE(grid.IsEmpty());
+    EXPECT_TRUE(GetCandidates(grid, vec2f(5.0f, 5.0f)).empty());
+}